@@ -0,0 +1,382 @@
+#include "Cell/CellGeometry.h"
+#include "Cell/CellType.h"
+#include "Container/CellArray.h"
+#include "Threading/ParallelFor.h"
+
+namespace
+{
+    /** 并行计算时的区间粒度（单元数量） */
+    constexpr uint32 CellGrainSize = 8192;
+
+    /** ECellType 的取值数量上限（按 uint8 分组） */
+    constexpr uint32 CellTypeSlotCount = 256;
+
+    // ============================================================================
+    // 基础几何运算（内联，供各单元类型内核使用）
+    // ============================================================================
+
+    inline float TriangleArea(const FVector& V0, const FVector& V1, const FVector& V2)
+    {
+        return (V1 - V0).Cross(V2 - V0).Size() * 0.5f;
+    }
+
+    inline FVector TriangleNormal(const FVector& V0, const FVector& V1, const FVector& V2)
+    {
+        return (V1 - V0).Cross(V2 - V0).GetSafeNormal();
+    }
+
+    inline float TetraVolume(const FVector& V0, const FVector& V1, const FVector& V2, const FVector& V3)
+    {
+        const FVector A = V1 - V0;
+        const FVector B = V2 - V0;
+        const FVector C = V3 - V0;
+        return FMath::Abs(A.Dot(B.Cross(C))) / 6.0f;
+    }
+
+    /** 中心点与每条边构成的三角形法线之和（四边形、多边形共用） */
+    inline FVector FanNormal(const FVector* P, const int32* Indices, uint32 Count)
+    {
+        FVector Center = FVector::ZeroVector();
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            Center += P[Indices[i]];
+        }
+        Center = Center / static_cast<float>(Count);
+
+        FVector Normal = FVector::ZeroVector();
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            const uint32 Next = i + 1 == Count ? 0 : i + 1;
+            Normal += TriangleNormal(Center, P[Indices[i]], P[Indices[Next]]);
+        }
+        return Normal.GetSafeNormal();
+    }
+
+    // ============================================================================
+    // 单元类型内核
+    // 每种类型提供：维度、固定顶点数（0 表示可变）、Measure（长度/面积/体积）、Normal
+    // ============================================================================
+
+    struct FEmptyKernel
+    {
+        static constexpr int32 Dimension = 0;
+        static constexpr uint32 FixedVertexCount = 0;
+        static float Measure(const FVector*, const int32*, uint32) { return 0.0f; }
+        static FVector Normal(const FVector*, const int32*, uint32) { return FVector::ZeroVector(); }
+    };
+
+    struct FLineKernel
+    {
+        static constexpr int32 Dimension = 1;
+        static constexpr uint32 FixedVertexCount = 2;
+        static float Measure(const FVector* P, const int32* I, uint32)
+        {
+            return (P[I[1]] - P[I[0]]).Size();
+        }
+        static FVector Normal(const FVector*, const int32*, uint32) { return FVector::ZeroVector(); }
+    };
+
+    struct FPolyLineKernel
+    {
+        static constexpr int32 Dimension = 1;
+        static constexpr uint32 FixedVertexCount = 0;
+        static float Measure(const FVector* P, const int32* I, uint32 Count)
+        {
+            float Length = 0.0f;
+            for (uint32 i = 1; i < Count; ++i)
+            {
+                Length += (P[I[i]] - P[I[i - 1]]).Size();
+            }
+            return Length;
+        }
+        static FVector Normal(const FVector*, const int32*, uint32) { return FVector::ZeroVector(); }
+    };
+
+    struct FTriangleKernel
+    {
+        static constexpr int32 Dimension = 2;
+        static constexpr uint32 FixedVertexCount = 3;
+        static float Measure(const FVector* P, const int32* I, uint32)
+        {
+            return TriangleArea(P[I[0]], P[I[1]], P[I[2]]);
+        }
+        static FVector Normal(const FVector* P, const int32* I, uint32)
+        {
+            return TriangleNormal(P[I[0]], P[I[1]], P[I[2]]);
+        }
+    };
+
+    struct FQuadKernel
+    {
+        static constexpr int32 Dimension = 2;
+        static constexpr uint32 FixedVertexCount = 4;
+        static float Measure(const FVector* P, const int32* I, uint32)
+        {
+            return TriangleArea(P[I[0]], P[I[1]], P[I[2]]) + TriangleArea(P[I[0]], P[I[2]], P[I[3]]);
+        }
+        static FVector Normal(const FVector* P, const int32* I, uint32)
+        {
+            return FanNormal(P, I, 4);
+        }
+    };
+
+    struct FPolygonKernel
+    {
+        static constexpr int32 Dimension = 2;
+        static constexpr uint32 FixedVertexCount = 0;
+        static float Measure(const FVector* P, const int32* I, uint32 Count)
+        {
+            float Area = 0.0f;
+            for (uint32 i = 1; i + 1 < Count; ++i)
+            {
+                Area += TriangleArea(P[I[0]], P[I[i]], P[I[i + 1]]);
+            }
+            return Area;
+        }
+        static FVector Normal(const FVector* P, const int32* I, uint32 Count)
+        {
+            return Count < 3 ? FVector::ZeroVector() : FanNormal(P, I, Count);
+        }
+    };
+
+    struct FTetraKernel
+    {
+        static constexpr int32 Dimension = 3;
+        static constexpr uint32 FixedVertexCount = 4;
+        static float Measure(const FVector* P, const int32* I, uint32)
+        {
+            return TetraVolume(P[I[0]], P[I[1]], P[I[2]], P[I[3]]);
+        }
+        static FVector Normal(const FVector*, const int32*, uint32) { return FVector::ZeroVector(); }
+    };
+
+    struct FHexKernel
+    {
+        static constexpr int32 Dimension = 3;
+        static constexpr uint32 FixedVertexCount = 8;
+        static float Measure(const FVector* P, const int32* I, uint32)
+        {
+            // 沿对角线 0-6 分割为 6 个四面体
+            const FVector& V0 = P[I[0]];
+            const FVector& V6 = P[I[6]];
+            return TetraVolume(V0, P[I[1]], P[I[2]], V6) +
+                   TetraVolume(V0, P[I[2]], P[I[3]], V6) +
+                   TetraVolume(V0, P[I[3]], P[I[7]], V6) +
+                   TetraVolume(V0, P[I[7]], P[I[4]], V6) +
+                   TetraVolume(V0, P[I[4]], P[I[5]], V6) +
+                   TetraVolume(V0, P[I[5]], P[I[1]], V6);
+        }
+        static FVector Normal(const FVector*, const int32*, uint32) { return FVector::ZeroVector(); }
+    };
+
+    struct FPyramidKernel
+    {
+        static constexpr int32 Dimension = 3;
+        static constexpr uint32 FixedVertexCount = 5;
+        static float Measure(const FVector* P, const int32* I, uint32)
+        {
+            return TetraVolume(P[I[0]], P[I[1]], P[I[2]], P[I[4]]) +
+                   TetraVolume(P[I[0]], P[I[2]], P[I[3]], P[I[4]]);
+        }
+        static FVector Normal(const FVector*, const int32*, uint32) { return FVector::ZeroVector(); }
+    };
+
+    struct FPrismKernel
+    {
+        static constexpr int32 Dimension = 3;
+        static constexpr uint32 FixedVertexCount = 6;
+        static float Measure(const FVector* P, const int32* I, uint32)
+        {
+            return TetraVolume(P[I[0]], P[I[1]], P[I[2]], P[I[3]]) +
+                   TetraVolume(P[I[1]], P[I[2]], P[I[3]], P[I[4]]) +
+                   TetraVolume(P[I[2]], P[I[3]], P[I[4]], P[I[5]]);
+        }
+        static FVector Normal(const FVector*, const int32*, uint32) { return FVector::ZeroVector(); }
+    };
+
+    struct FPolyhedronKernel
+    {
+        static constexpr int32 Dimension = 3;
+        static constexpr uint32 FixedVertexCount = 0;
+        static float Measure(const FVector*, const int32*, uint32) { return 0.0f; }
+        static FVector Normal(const FVector*, const int32*, uint32) { return FVector::ZeroVector(); }
+    };
+
+    // ============================================================================
+    // 分组执行
+    // ============================================================================
+
+    struct FGroupContext
+    {
+        const FVector* Positions;
+        const FCellArray* Cells;
+        float* Out;
+        bool bParallel;
+    };
+
+    /**
+     * 对一组同类型单元执行计算
+     * @param GroupCells 单元索引列表（为 nullptr 时表示 [0, GroupCount) 的全部单元）
+     * @param Write 写入函数，签名 void(float* Out, uint32 CellIndex, const int32* Indices, uint32 Count)
+     */
+    template<typename KernelType, typename WriteType>
+    void RunGroup(const FGroupContext& Context, const uint32* GroupCells, uint32 GroupCount, WriteType Write)
+    {
+        const FCellArray& Cells = *Context.Cells;
+        float* Out = Context.Out;
+        ParallelForRange(GroupCount, CellGrainSize, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                const uint32 CellIndex = GroupCells ? GroupCells[i] : i;
+                const FCellView Cell = Cells.GetCellViewUnchecked(static_cast<int32>(CellIndex));
+                Write(Out, CellIndex, Cell.begin(), Cell.Num());
+            }
+        }, Context.bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+    }
+
+    template<typename KernelType>
+    void ComputeGroup(const FGroupContext& Context, ECellGeometryQuantity Quantity, const uint32* GroupCells, uint32 GroupCount)
+    {
+        constexpr uint32 FixedCount = KernelType::FixedVertexCount;
+        const FVector* P = Context.Positions;
+
+        // 标量：顶点数不足的退化单元写入 0
+        auto WriteScalar = [P](float* Out, uint32 CellIndex, const int32* I, uint32 Count)
+        {
+            Out[CellIndex] = Count >= FixedCount ? KernelType::Measure(P, I, Count) : 0.0f;
+        };
+        auto WriteZero = [](float* Out, uint32 CellIndex, const int32*, uint32)
+        {
+            Out[CellIndex] = 0.0f;
+        };
+
+        switch (Quantity)
+        {
+            case ECellGeometryQuantity::Size:
+                RunGroup<KernelType>(Context, GroupCells, GroupCount, WriteScalar);
+                break;
+            case ECellGeometryQuantity::Area:
+                if (KernelType::Dimension == 2) RunGroup<KernelType>(Context, GroupCells, GroupCount, WriteScalar);
+                else RunGroup<KernelType>(Context, GroupCells, GroupCount, WriteZero);
+                break;
+            case ECellGeometryQuantity::Volume:
+                if (KernelType::Dimension == 3) RunGroup<KernelType>(Context, GroupCells, GroupCount, WriteScalar);
+                else RunGroup<KernelType>(Context, GroupCells, GroupCount, WriteZero);
+                break;
+            case ECellGeometryQuantity::Centroid:
+                RunGroup<KernelType>(Context, GroupCells, GroupCount, [P](float* Out, uint32 CellIndex, const int32* I, uint32 Count)
+                {
+                    // 固定顶点数的单元使用编译期常量循环次数
+                    const uint32 N = FixedCount > 0 ? FixedCount : Count;
+                    FVector Sum = FVector::ZeroVector();
+                    if (Count >= N && N > 0)
+                    {
+                        for (uint32 k = 0; k < N; ++k)
+                        {
+                            Sum += P[I[k]];
+                        }
+                        Sum = Sum / static_cast<float>(N);
+                    }
+                    float* Dest = Out + static_cast<size_t>(CellIndex) * 3;
+                    Dest[0] = Sum.X;
+                    Dest[1] = Sum.Y;
+                    Dest[2] = Sum.Z;
+                });
+                break;
+            case ECellGeometryQuantity::Normal:
+                RunGroup<KernelType>(Context, GroupCells, GroupCount, [P](float* Out, uint32 CellIndex, const int32* I, uint32 Count)
+                {
+                    const FVector Normal = Count >= FixedCount ? KernelType::Normal(P, I, Count) : FVector::ZeroVector();
+                    float* Dest = Out + static_cast<size_t>(CellIndex) * 3;
+                    Dest[0] = Normal.X;
+                    Dest[1] = Normal.Y;
+                    Dest[2] = Normal.Z;
+                });
+                break;
+        }
+    }
+
+    void ComputeGroupByType(const FGroupContext& Context, ECellType CellType, ECellGeometryQuantity Quantity, const uint32* GroupCells, uint32 GroupCount)
+    {
+        switch (CellType)
+        {
+            case ECellType::Line: ComputeGroup<FLineKernel>(Context, Quantity, GroupCells, GroupCount); break;
+            case ECellType::PolyLine: ComputeGroup<FPolyLineKernel>(Context, Quantity, GroupCells, GroupCount); break;
+            case ECellType::Triangle: ComputeGroup<FTriangleKernel>(Context, Quantity, GroupCells, GroupCount); break;
+            case ECellType::Quad: ComputeGroup<FQuadKernel>(Context, Quantity, GroupCells, GroupCount); break;
+            case ECellType::Polygon: ComputeGroup<FPolygonKernel>(Context, Quantity, GroupCells, GroupCount); break;
+            case ECellType::Tetra: ComputeGroup<FTetraKernel>(Context, Quantity, GroupCells, GroupCount); break;
+            case ECellType::Hex: ComputeGroup<FHexKernel>(Context, Quantity, GroupCells, GroupCount); break;
+            case ECellType::Pyramid: ComputeGroup<FPyramidKernel>(Context, Quantity, GroupCells, GroupCount); break;
+            case ECellType::Prism: ComputeGroup<FPrismKernel>(Context, Quantity, GroupCells, GroupCount); break;
+            case ECellType::Polyhedron: ComputeGroup<FPolyhedronKernel>(Context, Quantity, GroupCells, GroupCount); break;
+            default: ComputeGroup<FEmptyKernel>(Context, Quantity, GroupCells, GroupCount); break;
+        }
+    }
+}
+
+EFieldType FCellGeometry::GetFieldType(ECellGeometryQuantity Quantity)
+{
+    switch (Quantity)
+    {
+        case ECellGeometryQuantity::Centroid:
+        case ECellGeometryQuantity::Normal:
+            return EFieldType::Vector;
+        default:
+            return EFieldType::Scalar;
+    }
+}
+
+void FCellGeometry::Compute(TArrayView<const FVector> Positions, const FCellArray& Cells, ECellGeometryQuantity Quantity, FField& OutField, bool bParallel)
+{
+    const std::string FieldName = OutField.GetFieldName().empty() ? EnumToString(Quantity) : OutField.GetFieldName();
+    OutField.Initialize(FieldName, GetFieldType(Quantity), EFieldAttachment::Cell);
+
+    const uint32 CellCount = Cells.GetCellCount();
+    OutField.Resize(CellCount);
+    if (CellCount == 0)
+    {
+        return;
+    }
+
+    const FGroupContext Context{ Positions.GetData(), &Cells, OutField.GetFieldData().GetData(), bParallel };
+
+    if (Cells.IsUniform())
+    {
+        ComputeGroupByType(Context, Cells.GetUniformCellType(), Quantity, nullptr, CellCount);
+        return;
+    }
+
+    // 按单元类型计数排序，得到每种类型的单元索引列表
+    uint32 TypeOffsets[CellTypeSlotCount + 1] = {};
+    for (uint32 CellIndex = 0; CellIndex < CellCount; ++CellIndex)
+    {
+        ++TypeOffsets[static_cast<uint8>(Cells.GetCellType(static_cast<int32>(CellIndex))) + 1];
+    }
+    for (uint32 Slot = 0; Slot < CellTypeSlotCount; ++Slot)
+    {
+        TypeOffsets[Slot + 1] += TypeOffsets[Slot];
+    }
+
+    TArray<uint32> SortedCells;
+    SortedCells.Resize(CellCount);
+    uint32 Cursor[CellTypeSlotCount];
+    for (uint32 Slot = 0; Slot < CellTypeSlotCount; ++Slot)
+    {
+        Cursor[Slot] = TypeOffsets[Slot];
+    }
+    for (uint32 CellIndex = 0; CellIndex < CellCount; ++CellIndex)
+    {
+        SortedCells[Cursor[static_cast<uint8>(Cells.GetCellType(static_cast<int32>(CellIndex)))]++] = CellIndex;
+    }
+
+    for (uint32 Slot = 0; Slot < CellTypeSlotCount; ++Slot)
+    {
+        const uint32 GroupCount = TypeOffsets[Slot + 1] - TypeOffsets[Slot];
+        if (GroupCount > 0)
+        {
+            ComputeGroupByType(Context, static_cast<ECellType>(Slot), Quantity, SortedCells.GetData() + TypeOffsets[Slot], GroupCount);
+        }
+    }
+}
@@ -1,4 +1,10 @@
 #include "../../Public/Cell/CellType.h"
+#include "Cell/CellTriangle.h"
+#include "Cell/CellQuad.h"
+#include "Cell/CellTetra.h"
+#include "Cell/CellHex.h"
+#include "Cell/CellPrism.h"
+#include "Cell/CellPyramid.h"
 
 
 // ============================================================================
@@ -63,4 +69,87 @@ int32 ICellType::GetCellDimension(ECellType CellType)
         default:
             return 0;
     }
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// 边界面
+// ============================================================================
+
+namespace
+{
+    template<uint32 FaceVertexCount>
+    uint32 CopyFace(const int32 (&Face)[FaceVertexCount], uint32 Count, int32* OutLocalIndices)
+    {
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            OutLocalIndices[i] = Face[i];
+        }
+        return Count;
+    }
+}
+
+uint32 ICellType::GetFaceCount(ECellType CellType, uint32 VertexCount)
+{
+    // 顶点数量不足的固定类型单元视为无边界面，避免越界访问
+    const uint32 StandardVertexCount = GetStandardVertexCount(CellType);
+    if (StandardVertexCount > 0 && VertexCount < StandardVertexCount)
+    {
+        return 0;
+    }
+
+    switch (CellType)
+    {
+        case ECellType::Line:
+        case ECellType::PolyLine:
+            return VertexCount >= 2 ? 2 : 0;
+        case ECellType::Triangle:
+            return 3;
+        case ECellType::Quad:
+            return 4;
+        case ECellType::Polygon:
+            return VertexCount >= 3 ? VertexCount : 0;
+        case ECellType::Tetra:
+            return 4;
+        case ECellType::Hex:
+            return 6;
+        case ECellType::Pyramid:
+        case ECellType::Prism:
+            return 5;
+        default:
+            return 0;
+    }
+}
+
+uint32 ICellType::GetFaceLocalIndices(ECellType CellType, uint32 VertexCount, uint32 FaceIndex, int32* OutLocalIndices)
+{
+    if (FaceIndex >= GetFaceCount(CellType, VertexCount))
+    {
+        return 0;
+    }
+
+    switch (CellType)
+    {
+        case ECellType::Line:
+        case ECellType::PolyLine:
+            OutLocalIndices[0] = FaceIndex == 0 ? 0 : static_cast<int32>(VertexCount - 1);
+            return 1;
+        case ECellType::Triangle:
+            return CopyFace(ICellTriangle::Edges[FaceIndex], 2, OutLocalIndices);
+        case ECellType::Quad:
+            return CopyFace(ICellQuad::Edges[FaceIndex], 2, OutLocalIndices);
+        case ECellType::Polygon:
+            OutLocalIndices[0] = static_cast<int32>(FaceIndex);
+            OutLocalIndices[1] = static_cast<int32>((FaceIndex + 1) % VertexCount);
+            return 2;
+        case ECellType::Tetra:
+            return CopyFace(ICellTetra::Faces[FaceIndex], 3, OutLocalIndices);
+        case ECellType::Hex:
+            return CopyFace(ICellHex::Faces[FaceIndex], 4, OutLocalIndices);
+        case ECellType::Pyramid:
+            return CopyFace(ICellPyramid::Faces[FaceIndex], ICellPyramid::FaceVertexCounts[FaceIndex], OutLocalIndices);
+        case ECellType::Prism:
+            return CopyFace(ICellPrism::Faces[FaceIndex], ICellPrism::FaceVertexCounts[FaceIndex], OutLocalIndices);
+        default:
+            return 0;
+    }
+}
@@ -1,21 +1,33 @@
 #include "../../Public/Container/CellArray.h"
+#include "Exception/Exception.h"
 #include <algorithm>
+#include <atomic>
 
 // ============================================================================
 // 构造函数和析构函数
 // ============================================================================
 
 FCellArray::FCellArray()
-    : ReservedCapacity(0)
+    : UniformCellType(ECellType::None)
+    , UniformStride(0)
+    , CellCount(0)
+    , bIsUniform(true)
+    , ReservedCapacity(0)
     , bEnableMemoryReuse(true)
+    , Version(AllocateVersion())
 {
     // 预分配初始容量
     // Reserve(1024);
 }
 
 FCellArray::FCellArray(uint32 InitialCapacity)
-    : ReservedCapacity(0)
+    : UniformCellType(ECellType::None)
+    , UniformStride(0)
+    , CellCount(0)
+    , bIsUniform(true)
+    , ReservedCapacity(0)
     , bEnableMemoryReuse(true)
+    , Version(AllocateVersion())
 {
     Reserve(InitialCapacity);
 }
@@ -24,17 +36,32 @@ FCellArray::FCellArray(const FCellArray& Other)
     : VertexIndices(Other.VertexIndices)
     , CellOffsets(Other.CellOffsets)
     , CellTypes(Other.CellTypes)
+    , UniformCellType(Other.UniformCellType)
+    , UniformStride(Other.UniformStride)
+    , CellCount(Other.CellCount)
+    , bIsUniform(Other.bIsUniform)
     , ReservedCapacity(Other.ReservedCapacity)
     , bEnableMemoryReuse(Other.bEnableMemoryReuse)
+    , Version(AllocateVersion())
 {}
 
 FCellArray::FCellArray(FCellArray&& Other) noexcept
     : VertexIndices(std::move(Other.VertexIndices))
     , CellOffsets(std::move(Other.CellOffsets))
     , CellTypes(std::move(Other.CellTypes))
+    , UniformCellType(Other.UniformCellType)
+    , UniformStride(Other.UniformStride)
+    , CellCount(Other.CellCount)
+    , bIsUniform(Other.bIsUniform)
     , ReservedCapacity(Other.ReservedCapacity)
     , bEnableMemoryReuse(Other.bEnableMemoryReuse)
+    , Version(AllocateVersion())
 {
+    Other.MarkModified();
+    Other.UniformCellType = ECellType::None;
+    Other.UniformStride = 0;
+    Other.CellCount = 0;
+    Other.bIsUniform = true;
     Other.ReservedCapacity = 0;
 }
 
@@ -47,8 +74,13 @@ FCellArray& FCellArray::operator=(const FCellArray& Other)
         VertexIndices = Other.VertexIndices;
         CellOffsets = Other.CellOffsets;
         CellTypes = Other.CellTypes;
+        UniformCellType = Other.UniformCellType;
+        UniformStride = Other.UniformStride;
+        CellCount = Other.CellCount;
+        bIsUniform = Other.bIsUniform;
         ReservedCapacity = Other.ReservedCapacity;
         bEnableMemoryReuse = Other.bEnableMemoryReuse;
+        MarkModified();
     }
     return *this;
 }
@@ -60,20 +92,46 @@ FCellArray& FCellArray::operator=(FCellArray&& Other) noexcept
         VertexIndices = std::move(Other.VertexIndices);
         CellOffsets = std::move(Other.CellOffsets);
         CellTypes = std::move(Other.CellTypes);
+        UniformCellType = Other.UniformCellType;
+        UniformStride = Other.UniformStride;
+        CellCount = Other.CellCount;
+        bIsUniform = Other.bIsUniform;
         ReservedCapacity = Other.ReservedCapacity;
         bEnableMemoryReuse = Other.bEnableMemoryReuse;
+        MarkModified();
+        Other.MarkModified();
+        Other.UniformCellType = ECellType::None;
+        Other.UniformStride = 0;
+        Other.CellCount = 0;
+        Other.bIsUniform = true;
         Other.ReservedCapacity = 0;
     }
     return *this;
 }
 
+// ============================================================================
+// 版本号
+// ============================================================================
+
+uint64 FCellArray::AllocateVersion()
+{
+    // 全局递增，保证不同实例之间的版本号也不会重复
+    static std::atomic<uint64> GlobalVersion{0};
+    return ++GlobalVersion;
+}
+
+uint64 FCellArray::GetVersion() const
+{
+    return Version;
+}
+
 // ============================================================================
 // 容量和大小
 // ============================================================================
 
 uint32 FCellArray::GetCellCount() const
 {
-    return static_cast<uint32>(CellTypes.Num());
+    return CellCount;
 }
 
 uint32 FCellArray::GetVertexIndexCount() const
@@ -83,18 +141,33 @@ uint32 FCellArray::GetVertexIndexCount() const
 
 bool FCellArray::IsEmpty() const
 {
-    return CellTypes.IsEmpty();
+    return CellCount == 0;
 }
 
 void FCellArray::Reserve(uint32 Capacity)
 {
     // 估算每个单元平均4个顶点
+    // 均质存储时不需要偏移和类型数组，只有混合存储才预留
     VertexIndices.Reserve(Capacity * 4);
-    CellOffsets.Reserve(Capacity + 1);  // +1 for end offset
-    CellTypes.Reserve(Capacity);
+    if (!bIsUniform)
+    {
+        CellOffsets.Reserve(Capacity + 1);  // +1 for end offset
+        CellTypes.Reserve(Capacity);
+    }
     ReservedCapacity = Capacity;
 }
 
+void FCellArray::Reserve(uint32 CellCapacity, uint32 VertexIndexCapacity)
+{
+    VertexIndices.Reserve(VertexIndexCapacity);
+    if (!bIsUniform)
+    {
+        CellOffsets.Reserve(CellCapacity + 1);
+        CellTypes.Reserve(CellCapacity);
+    }
+    ReservedCapacity = CellCapacity;
+}
+
 void FCellArray::Shrink()
 {
     VertexIndices.Shrink();
@@ -102,59 +175,369 @@ void FCellArray::Shrink()
     CellTypes.Shrink();
 }
 
+// ============================================================================
+// 存储模式
+// ============================================================================
+
+bool FCellArray::IsUniform() const
+{
+    return bIsUniform;
+}
+
+ECellType FCellArray::GetUniformCellType() const
+{
+    return bIsUniform ? UniformCellType : ECellType::None;
+}
+
+uint32 FCellArray::GetUniformStride() const
+{
+    return bIsUniform ? UniformStride : 0;
+}
+
+TArrayView<const FCellArray::VertexIndexType> FCellArray::GetVertexIndicesView() const
+{
+    return TArrayView<const VertexIndexType>(VertexIndices.GetData(), static_cast<uint32>(VertexIndices.Num()));
+}
+
+TArrayView<const uint32> FCellArray::GetCellOffsetsView() const
+{
+    if (bIsUniform)
+    {
+        return {};
+    }
+    return TArrayView<const uint32>(CellOffsets.GetData(), static_cast<uint32>(CellOffsets.Num()));
+}
+
+TArrayView<const ECellType> FCellArray::GetCellTypesView() const
+{
+    if (bIsUniform)
+    {
+        return {};
+    }
+    return TArrayView<const ECellType>(CellTypes.GetData(), static_cast<uint32>(CellTypes.Num()));
+}
+
+bool FCellArray::CanAppendUniform(ECellType CellType, uint32 VertexCount) const
+{
+    if (!bIsUniform)
+    {
+        return false;
+    }
+    return CellCount == 0 || (CellType == UniformCellType && VertexCount == UniformStride);
+}
+
+void FCellArray::BeginAppendCell(ECellType CellType, uint32 VertexCount)
+{
+    if (CanAppendUniform(CellType, VertexCount))
+    {
+        // 第一个单元决定均质存储的类型和步长
+        if (CellCount == 0)
+        {
+            UniformCellType = CellType;
+            UniformStride = VertexCount;
+        }
+    }
+    else
+    {
+        if (bIsUniform)
+        {
+            ConvertToMixed();
+        }
+
+        // CellOffsets 末尾始终是结束位置，追加新单元只需记录新的结束位置
+        CellOffsets.Add(static_cast<uint32>(VertexIndices.Num()) + VertexCount);
+        CellTypes.Add(CellType);
+    }
+    ++CellCount;
+}
+
+void FCellArray::ConvertToMixed()
+{
+    if (!bIsUniform)
+    {
+        return;
+    }
+
+    const uint32 Capacity = std::max(CellCount, ReservedCapacity);
+    CellOffsets.Reset();
+    CellOffsets.Reserve(Capacity + 1);
+    CellTypes.Reset();
+    CellTypes.Reserve(Capacity);
+
+    for (uint32 i = 0; i < CellCount; ++i)
+    {
+        CellOffsets.Add(i * UniformStride);
+    }
+    CellOffsets.Add(CellCount * UniformStride);
+    CellTypes.Resize(CellCount, UniformCellType);
+
+    UniformCellType = ECellType::None;
+    UniformStride = 0;
+    bIsUniform = false;
+}
+
+bool FCellArray::TryConvertToUniform()
+{
+    if (bIsUniform)
+    {
+        return true;
+    }
+
+    if (CellCount > 0)
+    {
+        const ECellType FirstType = CellTypes[0];
+        const uint32 FirstStride = CellOffsets[1] - CellOffsets[0];
+        for (uint32 i = 1; i < CellCount; ++i)
+        {
+            if (CellTypes[i] != FirstType || CellOffsets[i + 1] - CellOffsets[i] != FirstStride)
+            {
+                return false;
+            }
+        }
+        UniformCellType = FirstType;
+        UniformStride = FirstStride;
+    }
+    else
+    {
+        UniformCellType = ECellType::None;
+        UniformStride = 0;
+    }
+
+    CellOffsets.Empty();
+    CellOffsets.Shrink();
+    CellTypes.Empty();
+    CellTypes.Shrink();
+    bIsUniform = true;
+    return true;
+}
+
 // ============================================================================
 // 添加单元
 // ============================================================================
 
 void FCellArray::AddCell(ECellType CellType, const TArray<VertexIndexType>& InVertexIndices)
 {
+    MarkModified();
+
     if (InVertexIndices.IsEmpty())
     {
         return;
     }
-    
-    // 记录当前单元的起始位置
-    CellOffsets.Add(static_cast<uint32>(VertexIndices.Num()));
-    
+
+    // 记录当前单元的类型和偏移
+    BeginAppendCell(CellType, static_cast<uint32>(InVertexIndices.Num()));
+
     // 添加顶点索引
-    for (uint32 i = 0; i < InVertexIndices.Num(); ++i)
-    {
-        VertexIndices.Add(InVertexIndices[i]);
-    }
-    
-    // 记录单元类型
-    CellTypes.Add(CellType);
+    VertexIndices.Append(InVertexIndices);
 }
 
 void FCellArray::AddCell(ECellType CellType, const VertexIndexType* InVertexIndices, uint32 VertexCount)
 {
+    MarkModified();
+
     if (VertexCount == 0 || InVertexIndices == nullptr)
     {
         return;
     }
-    
-    // 记录当前单元的起始位置
-    CellOffsets.Add(static_cast<uint32>(VertexIndices.Num()));
 
-    for (uint32 i = 0; i < VertexCount; ++i)
-    {
-        VertexIndices.Add(InVertexIndices[i]);
-    }
+    // 记录当前单元的类型和偏移
+    BeginAppendCell(CellType, VertexCount);
 
-    // 记录单元类型
-    CellTypes.Add(CellType);
+    VertexIndices.Append(InVertexIndices, VertexCount);
 }
 
 void FCellArray::AddCells(const TArray<FCellInfo>& Cells)
 {
-    Reserve(GetCellCount() + Cells.Num());
-    
+    uint32 TotalVertexCount = 0;
+    for (const auto& Cell : Cells)
+    {
+        TotalVertexCount += static_cast<uint32>(Cell.Num());
+    }
+    Reserve(GetCellCount() + static_cast<uint32>(Cells.Num()), GetVertexIndexCount() + TotalVertexCount);
+
     for (const auto& Cell : Cells)
     {
         AddCell(Cell.CellType, Cell.VertexIndices);
     }
 }
 
+// ============================================================================
+// 批量导入
+// ============================================================================
+
+namespace
+{
+    /**
+     * 检查批量导入的偏移严格递增（与 AddCell 一致，每个单元至少有一个顶点）
+     */
+    void CheckCellOffsets(const uint32* InOffsets, uint32 InCellCount)
+    {
+        for (uint32 i = 0; i < InCellCount; ++i)
+        {
+            if (InOffsets[i + 1] <= InOffsets[i])
+            {
+                THROW_EXCEPTION(FInvalidArgumentException, "Cell offsets must be strictly increasing (every cell needs at least one vertex)");
+            }
+        }
+    }
+}
+
+void FCellArray::AppendCells(ECellType CellType, uint32 Stride, const VertexIndexType* InVertexIndices, uint32 InCellCount)
+{
+    MarkModified();
+
+    if (Stride == 0)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Stride must be greater than 0");
+    }
+    if (InCellCount == 0 || InVertexIndices == nullptr)
+    {
+        return;
+    }
+
+    const uint32 NewVertexIndexCount = InCellCount * Stride;
+    if (CanAppendUniform(CellType, Stride))
+    {
+        if (CellCount == 0)
+        {
+            UniformCellType = CellType;
+            UniformStride = Stride;
+        }
+    }
+    else
+    {
+        if (bIsUniform)
+        {
+            ConvertToMixed();
+        }
+
+        CellOffsets.Reserve(CellOffsets.Num() + InCellCount);
+        uint32 Offset = static_cast<uint32>(VertexIndices.Num());
+        for (uint32 i = 0; i < InCellCount; ++i)
+        {
+            Offset += Stride;
+            CellOffsets.Add(Offset);
+        }
+        CellTypes.Resize(CellTypes.Num() + InCellCount, CellType);
+    }
+
+    VertexIndices.Append(InVertexIndices, NewVertexIndexCount);
+    CellCount += InCellCount;
+}
+
+void FCellArray::AppendCells(const ECellType* InTypes, const uint32* InOffsets, const VertexIndexType* InVertexIndices, uint32 InCellCount)
+{
+    MarkModified();
+
+    if (InCellCount == 0 || InTypes == nullptr || InOffsets == nullptr || InVertexIndices == nullptr)
+    {
+        return;
+    }
+    CheckCellOffsets(InOffsets, InCellCount);
+
+    const uint32 BaseOffset = InOffsets[0];
+    const uint32 NewVertexIndexCount = InOffsets[InCellCount] - BaseOffset;
+
+    if (bIsUniform)
+    {
+        // 检查导入的单元能否保持均质存储
+        const ECellType ExpectedType = CellCount > 0 ? UniformCellType : InTypes[0];
+        const uint32 ExpectedStride = CellCount > 0 ? UniformStride : InOffsets[1] - InOffsets[0];
+        bool bKeepUniform = ExpectedStride > 0;
+        for (uint32 i = 0; i < InCellCount && bKeepUniform; ++i)
+        {
+            bKeepUniform = InTypes[i] == ExpectedType && InOffsets[i + 1] - InOffsets[i] == ExpectedStride;
+        }
+
+        if (bKeepUniform)
+        {
+            UniformCellType = ExpectedType;
+            UniformStride = ExpectedStride;
+            VertexIndices.Append(InVertexIndices + BaseOffset, NewVertexIndexCount);
+            CellCount += InCellCount;
+            return;
+        }
+
+        ConvertToMixed();
+    }
+
+    // 将调用者的偏移平移到当前顶点索引的末尾
+    const uint32 Shift = static_cast<uint32>(VertexIndices.Num()) - BaseOffset;
+    CellOffsets.Reserve(CellOffsets.Num() + InCellCount);
+    for (uint32 i = 1; i <= InCellCount; ++i)
+    {
+        CellOffsets.Add(InOffsets[i] + Shift);
+    }
+    CellTypes.Append(InTypes, InCellCount);
+    VertexIndices.Append(InVertexIndices + BaseOffset, NewVertexIndexCount);
+    CellCount += InCellCount;
+}
+
+void FCellArray::AppendCells(ECellType CellType, uint32 Stride, TArray<VertexIndexType>&& InVertexIndices)
+{
+    MarkModified();
+
+    if (Stride == 0 || InVertexIndices.Num() % Stride != 0)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "VertexIndices count must be a multiple of Stride");
+    }
+
+    const uint32 InCellCount = static_cast<uint32>(InVertexIndices.Num() / Stride);
+    if (!IsEmpty())
+    {
+        AppendCells(CellType, Stride, InVertexIndices.GetData(), InCellCount);
+        return;
+    }
+
+    // 空数组直接接管缓冲区
+    Clear();
+    if (InCellCount == 0)
+    {
+        return;
+    }
+    VertexIndices = std::move(InVertexIndices);
+    UniformCellType = CellType;
+    UniformStride = Stride;
+    CellCount = InCellCount;
+}
+
+void FCellArray::AppendCells(TArray<ECellType>&& InTypes, TArray<uint32>&& InOffsets, TArray<VertexIndexType>&& InVertexIndices)
+{
+    MarkModified();
+
+    const uint32 InCellCount = static_cast<uint32>(InTypes.Num());
+    if (InOffsets.Num() != InCellCount + 1)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Offsets count must be Types count + 1");
+    }
+    if (InOffsets[0] != 0 || InOffsets[InCellCount] != InVertexIndices.Num())
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Offsets must start at 0 and end at VertexIndices count");
+    }
+    CheckCellOffsets(InOffsets.GetData(), InCellCount);
+
+    if (!IsEmpty())
+    {
+        AppendCells(InTypes.GetData(), InOffsets.GetData(), InVertexIndices.GetData(), InCellCount);
+        return;
+    }
+
+    // 空数组直接接管缓冲区
+    Clear();
+    if (InCellCount == 0)
+    {
+        return;
+    }
+    VertexIndices = std::move(InVertexIndices);
+    CellOffsets = std::move(InOffsets);
+    CellTypes = std::move(InTypes);
+    CellCount = InCellCount;
+    bIsUniform = false;
+
+    // 如果导入的实际上是单一类型，释放偏移和类型数组
+    TryConvertToUniform();
+}
+
 // ============================================================================
 // 获取单元
 // ============================================================================
@@ -165,23 +548,22 @@ bool FCellArray::GetCell(CellIndexType CellIndex, FCellInfo& OutCellInfo) const
     {
         return false;
     }
-    
-    OutCellInfo.CellType = CellTypes[CellIndex];
-    
+
+    OutCellInfo.CellType = GetCellType(CellIndex);
+
     // 获取该单元的顶点索引范围
-    uint32 StartOffset = CellOffsets[CellIndex];
-    uint32 EndOffset = (CellIndex + 1 < CellOffsets.Num()) 
-        ? CellOffsets[CellIndex + 1] 
-        : static_cast<uint32>(VertexIndices.Num());
-    
+    uint32 StartOffset = 0;
+    uint32 VertexCount = 0;
+    GetCellRange(CellIndex, StartOffset, VertexCount);
+
     // 提取顶点索引
     OutCellInfo.VertexIndices.Reset();
-    OutCellInfo.VertexIndices.Reserve(EndOffset - StartOffset);
-    for (uint32 i = StartOffset; i < EndOffset; ++i)
+    OutCellInfo.VertexIndices.Reserve(VertexCount);
+    for (uint32 i = StartOffset; i < StartOffset + VertexCount; ++i)
     {
         OutCellInfo.VertexIndices.Add(VertexIndices[i]);
     }
-    
+
     return true;
 }
 
@@ -191,7 +573,7 @@ ECellType FCellArray::GetCellType(CellIndexType CellIndex) const
     {
         return ECellType::None;
     }
-    return CellTypes[CellIndex];
+    return bIsUniform ? UniformCellType : CellTypes[CellIndex];
 }
 
 bool FCellArray::GetCellVertexIndices(CellIndexType CellIndex, TArray<VertexIndexType>& OutVertexIndices) const
@@ -200,21 +582,20 @@ bool FCellArray::GetCellVertexIndices(CellIndexType CellIndex, TArray<VertexInde
     {
         return false;
     }
-    
+
     // 获取该单元的顶点索引范围
-    uint32 StartOffset = CellOffsets[CellIndex];
-    uint32 EndOffset = (CellIndex + 1 < CellOffsets.Num()) 
-        ? CellOffsets[CellIndex + 1] 
-        : static_cast<uint32>(VertexIndices.Num());
-    
+    uint32 StartOffset = 0;
+    uint32 VertexCount = 0;
+    GetCellRange(CellIndex, StartOffset, VertexCount);
+
     // 提取顶点索引
     OutVertexIndices.Reset();
-    OutVertexIndices.Reserve(EndOffset - StartOffset);
-    for (uint32 i = StartOffset; i < EndOffset; ++i)
+    OutVertexIndices.Reserve(VertexCount);
+    for (uint32 i = StartOffset; i < StartOffset + VertexCount; ++i)
     {
         OutVertexIndices.Add(VertexIndices[i]);
     }
-    
+
     return true;
 }
 
@@ -224,13 +605,12 @@ uint32 FCellArray::GetCellVertexCount(CellIndexType CellIndex) const
     {
         return 0;
     }
-    
-    uint32 StartOffset = CellOffsets[CellIndex];
-    uint32 EndOffset = (CellIndex + 1 < CellOffsets.Num()) 
-        ? CellOffsets[CellIndex + 1] 
-        : static_cast<uint32>(VertexIndices.Num());
-    
-    return EndOffset - StartOffset;
+
+    if (bIsUniform)
+    {
+        return UniformStride;
+    }
+    return CellOffsets[CellIndex + 1] - CellOffsets[CellIndex];
 }
 
 const FCellArray::VertexIndexType* FCellArray::GetCellVertexIndicesPtr(CellIndexType CellIndex, uint32& OutVertexCount) const
@@ -240,86 +620,79 @@ const FCellArray::VertexIndexType* FCellArray::GetCellVertexIndicesPtr(CellIndex
         OutVertexCount = 0;
         return nullptr;
     }
-    
-    uint32 StartOffset = CellOffsets[CellIndex];
-    uint32 EndOffset = (CellIndex + 1 < CellOffsets.Num()) 
-        ? CellOffsets[CellIndex + 1] 
-        : static_cast<uint32>(VertexIndices.Num());
-    
-    OutVertexCount = EndOffset - StartOffset;
+
+    uint32 StartOffset = 0;
+    GetCellRange(CellIndex, StartOffset, OutVertexCount);
     return VertexIndices.GetData() + StartOffset;
 }
 
+FCellView FCellArray::GetCellView(CellIndexType CellIndex) const
+{
+    if (!IsValidCellIndex(CellIndex))
+    {
+        return {};
+    }
+    return GetCellViewUnchecked(CellIndex);
+}
+
 // ============================================================================
 // 删除单元
 // ============================================================================
 
 bool FCellArray::RemoveCell(CellIndexType CellIndex)
 {
-    if (!IsValidCellIndex(CellIndex))
-    {
-        return false;
-    }
-    
-    // 获取要删除的单元的顶点数量
-    uint32 StartOffset = CellOffsets[CellIndex];
-    uint32 EndOffset = (CellIndex + 1 < CellOffsets.Num()) 
-        ? CellOffsets[CellIndex + 1] 
-        : static_cast<uint32>(VertexIndices.Num());
-    uint32 VertexCount = EndOffset - StartOffset;
-    
-    // 删除顶点索引
-    VertexIndices.RemoveAt(StartOffset, VertexCount);
-    
-    // 删除单元偏移和类型
-    CellOffsets.RemoveAt(CellIndex);
-    CellTypes.RemoveAt(CellIndex);
-    
-    // 更新后续单元的偏移量
-    uint32 OffsetDelta = static_cast<uint32>(VertexCount);
-    for (uint32 i = CellIndex; i < CellOffsets.Num(); ++i)
-    {
-        CellOffsets[i] -= OffsetDelta;
-    }
-    
-    return true;
+    return RemoveCells(CellIndex, 1) == 1;
 }
 
 uint32 FCellArray::RemoveCells(CellIndexType StartIndex, uint32 Count)
 {
+    MarkModified();
+
     if (!IsValidCellIndex(StartIndex))
     {
         return 0;
     }
-    
+
     uint32 EndIndex = std::min(StartIndex + Count, GetCellCount());
     uint32 ActualCount = EndIndex - StartIndex;
-    
+
     if (ActualCount == 0)
     {
         return 0;
     }
-    
+
+    if (bIsUniform)
+    {
+        // 均质存储只需删除连续的顶点索引
+        VertexIndices.RemoveAt(StartIndex * UniformStride, ActualCount * UniformStride);
+        CellCount -= ActualCount;
+        if (CellCount == 0)
+        {
+            UniformCellType = ECellType::None;
+            UniformStride = 0;
+        }
+        return ActualCount;
+    }
+
     // 计算要删除的顶点索引总数
     uint32 StartOffset = CellOffsets[StartIndex];
-    uint32 EndOffset = (EndIndex < CellOffsets.Num()) 
-        ? CellOffsets[EndIndex] 
-        : static_cast<uint32>(VertexIndices.Num());
+    uint32 EndOffset = CellOffsets[EndIndex];
     uint32 TotalVertexCount = EndOffset - StartOffset;
-    
+
     // 删除顶点索引
     VertexIndices.RemoveAt(StartOffset, TotalVertexCount);
-    
+
     // 删除单元偏移和类型
     CellOffsets.RemoveAt(StartIndex, ActualCount);
     CellTypes.RemoveAt(StartIndex, ActualCount);
-    
-    // 更新后续单元的偏移量
+    CellCount -= ActualCount;
+
+    // 更新后续单元的偏移量（包括末尾的结束位置）
     for (uint32 i = StartIndex; i < CellOffsets.Num(); ++i)
     {
         CellOffsets[i] -= TotalVertexCount;
     }
-    
+
     return ActualCount;
 }
 
@@ -329,35 +702,149 @@ uint32 FCellArray::RemoveCellsByType(ECellType CellType)
     {
         return 0;
     }
-    
-    // 收集要删除的单元索引（从后往前，避免索引变化）
-    TArray<CellIndexType> IndicesToRemove;
-    for (int32 i = static_cast<int32>(GetCellCount()) - 1; i >= 0; --i)
+
+    if (bIsUniform)
     {
-        if (CellTypes[i] == CellType)
+        if (UniformCellType != CellType)
         {
-            IndicesToRemove.Add(static_cast<CellIndexType>(i));
+            return 0;
         }
+        const uint32 RemovedCount = CellCount;
+        Clear();
+        return RemovedCount;
     }
-    
-    // 删除单元
-    uint32 RemovedCount = 0;
-    for (CellIndexType Index : IndicesToRemove)
+
+    return RemoveCellsIf([CellType](CellIndexType, const FCellView& Cell)
     {
-        if (RemoveCell(Index))
+        return Cell.CellType == CellType;
+    });
+}
+
+uint32 FCellArray::CompactCells(const TArray<uint8>& KeepMask, TArray<CellIndexType>* OutRemap)
+{
+    MarkModified();
+
+    if (KeepMask.Num() != CellCount)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "KeepMask count must match cell count");
+    }
+
+    if (OutRemap != nullptr)
+    {
+        OutRemap->Resize(CellCount);
+    }
+
+    uint32 WriteCell = 0;
+    uint32 WriteOffset = 0;
+
+    if (bIsUniform)
+    {
+        // 均质存储：按固定步长移动顶点索引块
+        for (uint32 ReadCell = 0; ReadCell < CellCount; ++ReadCell)
         {
-            ++RemovedCount;
+            if (KeepMask[ReadCell] == 0)
+            {
+                if (OutRemap != nullptr)
+                {
+                    (*OutRemap)[ReadCell] = InvalidCellIndex;
+                }
+                continue;
+            }
+
+            if (WriteCell != ReadCell)
+            {
+                std::copy_n(VertexIndices.GetData() + ReadCell * UniformStride, UniformStride, VertexIndices.GetData() + WriteOffset);
+            }
+            if (OutRemap != nullptr)
+            {
+                (*OutRemap)[ReadCell] = static_cast<CellIndexType>(WriteCell);
+            }
+            WriteOffset += UniformStride;
+            ++WriteCell;
         }
     }
-    
+    else
+    {
+        // 混合存储：同时压缩顶点索引、偏移和类型，并记录剩余单元是否为单一类型
+        bool bSingleKind = true;
+        ECellType KeptType = ECellType::None;
+        uint32 KeptStride = 0;
+
+        for (uint32 ReadCell = 0; ReadCell < CellCount; ++ReadCell)
+        {
+            const uint32 ReadStart = CellOffsets[ReadCell];
+            const uint32 ReadCount = CellOffsets[ReadCell + 1] - ReadStart;
+            if (KeepMask[ReadCell] == 0)
+            {
+                if (OutRemap != nullptr)
+                {
+                    (*OutRemap)[ReadCell] = InvalidCellIndex;
+                }
+                continue;
+            }
+
+            const ECellType Type = CellTypes[ReadCell];
+            if (WriteCell == 0)
+            {
+                KeptType = Type;
+                KeptStride = ReadCount;
+            }
+            else if (Type != KeptType || ReadCount != KeptStride)
+            {
+                bSingleKind = false;
+            }
+
+            if (WriteOffset != ReadStart)
+            {
+                std::copy_n(VertexIndices.GetData() + ReadStart, ReadCount, VertexIndices.GetData() + WriteOffset);
+            }
+            // 写入位置不会超过读取位置，可以安全地原地覆盖
+            CellOffsets[WriteCell] = WriteOffset;
+            CellTypes[WriteCell] = Type;
+            if (OutRemap != nullptr)
+            {
+                (*OutRemap)[ReadCell] = static_cast<CellIndexType>(WriteCell);
+            }
+            WriteOffset += ReadCount;
+            ++WriteCell;
+        }
+
+        CellOffsets.Resize(WriteCell + 1);
+        CellOffsets[WriteCell] = WriteOffset;
+        CellTypes.Resize(WriteCell);
+
+        if (bSingleKind)
+        {
+            UniformCellType = KeptType;
+            UniformStride = KeptStride;
+            CellOffsets.Empty();
+            CellTypes.Empty();
+            bIsUniform = true;
+        }
+    }
+
+    const uint32 RemovedCount = CellCount - WriteCell;
+    VertexIndices.Resize(WriteOffset);
+    CellCount = WriteCell;
+    if (CellCount == 0)
+    {
+        UniformCellType = ECellType::None;
+        UniformStride = 0;
+    }
     return RemovedCount;
 }
 
 void FCellArray::Clear()
 {
+    MarkModified();
+
     VertexIndices.Reset();
     CellOffsets.Reset();
     CellTypes.Reset();
+    UniformCellType = ECellType::None;
+    UniformStride = 0;
+    CellCount = 0;
+    bIsUniform = true;
 }
 
 void FCellArray::Reset()
@@ -381,6 +868,11 @@ bool FCellArray::IsValidCellIndex(CellIndexType CellIndex) const
 
 uint32 FCellArray::GetCellCountByType(ECellType CellType) const
 {
+    if (bIsUniform)
+    {
+        return (CellCount > 0 && UniformCellType == CellType) ? CellCount : 0;
+    }
+
     uint32 Count = 0;
     for (const auto& Type : CellTypes)
     {
@@ -395,6 +887,15 @@ uint32 FCellArray::GetCellCountByType(ECellType CellType) const
 void FCellArray::GetCellTypes(TArray<ECellType>& OutTypes) const
 {
     OutTypes.Reset();
+    if (bIsUniform)
+    {
+        if (CellCount > 0)
+        {
+            OutTypes.Add(UniformCellType);
+        }
+        return;
+    }
+
     for (const auto& Type : CellTypes)
     {
         if (!OutTypes.Contains(Type))
@@ -407,25 +908,15 @@ void FCellArray::GetCellTypes(TArray<ECellType>& OutTypes) const
 uint32 FCellArray::FindCellsContainingVertex(VertexIndexType VertexIndex, TArray<CellIndexType>& OutCellIndices) const
 {
     OutCellIndices.Reset();
-    
-    for (CellIndexType i = 0; i < GetCellCount(); ++i)
+
+    for (auto It = begin(); It != end(); ++It)
     {
-        uint32 VertexCount = 0;
-        const VertexIndexType* Indices = GetCellVertexIndicesPtr(i, VertexCount);
-        
-        if (Indices != nullptr)
+        if ((*It).Contains(VertexIndex))
         {
-            for (uint32 j = 0; j < VertexCount; ++j)
-            {
-                if (Indices[j] == VertexIndex)
-                {
-                    OutCellIndices.Add(i);
-                    break;
-                }
-            }
+            OutCellIndices.Add(It.GetIndex());
         }
     }
-    
+
     return static_cast<uint32>(OutCellIndices.Num());
 }
 
@@ -445,6 +936,8 @@ bool FCellArray::IsMemoryReuseEnabled() const
 
 void FCellArray::Compact()
 {
+    // 删除单元后混合存储可能只剩一种单元，此时恢复为均质存储
+    TryConvertToUniform();
     Shrink();
 }
 
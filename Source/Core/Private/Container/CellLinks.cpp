@@ -0,0 +1,127 @@
+#include "Container/CellLinks.h"
+#include "Container/CellArray.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+    /** 判断单元中第 Index 个顶点是否在之前已经出现过 */
+    bool IsDuplicateInCell(const FCellView& Cell, uint32 Index)
+    {
+        for (uint32 i = 0; i < Index; ++i)
+        {
+            if (Cell[i] == Cell[Index])
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** 对单元中每个有效且不重复的顶点调用 Func(VertexIndex) */
+    template<typename FuncType>
+    void ForEachUniqueVertex(const FCellView& Cell, uint32 VertexCount, FuncType&& Func)
+    {
+        for (uint32 i = 0; i < Cell.Num(); ++i)
+        {
+            const int32 VertexIndex = Cell[i];
+            if (VertexIndex < 0 || static_cast<uint32>(VertexIndex) >= VertexCount || IsDuplicateInCell(Cell, i))
+            {
+                continue;
+            }
+            Func(static_cast<uint32>(VertexIndex));
+        }
+    }
+
+    /** 并行构建时的单元区间粒度 */
+    constexpr uint32 CellLinksGrainSize = 16384;
+}
+
+// ============================================================================
+// 构建
+// ============================================================================
+
+void FCellLinks::Build(const FCellArray& Cells, uint32 VertexCount, bool bParallel)
+{
+    Clear();
+
+    const uint32 CellCount = Cells.GetCellCount();
+    Offsets.Resize(VertexCount + 1);
+    std::fill(Offsets.begin(), Offsets.end(), 0u);
+    if (VertexCount == 0)
+    {
+        return;
+    }
+
+    const EParallelForFlags Flags = bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+    uint32* Counts = Offsets.GetData();
+
+    // 第一遍：统计每个顶点的相邻单元数（暂存在 Offsets[v + 1]）
+    ParallelForRange(CellCount, CellLinksGrainSize, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 CellIndex = Begin; CellIndex < End; ++CellIndex)
+        {
+            ForEachUniqueVertex(Cells.GetCellViewUnchecked(CellIndex), VertexCount, [Counts](uint32 VertexIndex)
+            {
+                std::atomic_ref<uint32>(Counts[VertexIndex + 1]).fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+    }, Flags);
+
+    // 前缀和得到每个顶点的起始偏移
+    for (uint32 i = 1; i <= VertexCount; ++i)
+    {
+        Offsets[i] += Offsets[i - 1];
+    }
+
+    // 第二遍：填充单元索引，Cursor 为每个顶点的写入位置
+    Links.Resize(Offsets[VertexCount]);
+    TArray<uint32> Cursor;
+    Cursor.Resize(VertexCount);
+    std::copy(Offsets.begin(), Offsets.end() - 1, Cursor.begin());
+
+    uint32* CursorData = Cursor.GetData();
+    CellIndexType* LinkData = Links.GetData();
+    ParallelForRange(CellCount, CellLinksGrainSize, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 CellIndex = Begin; CellIndex < End; ++CellIndex)
+        {
+            ForEachUniqueVertex(Cells.GetCellViewUnchecked(CellIndex), VertexCount, [CursorData, LinkData, CellIndex](uint32 VertexIndex)
+            {
+                const uint32 Slot = std::atomic_ref<uint32>(CursorData[VertexIndex]).fetch_add(1, std::memory_order_relaxed);
+                LinkData[Slot] = static_cast<CellIndexType>(CellIndex);
+            });
+        }
+    }, Flags);
+
+    // 并行填充时同一顶点的单元顺序不确定，排序后与串行结果一致
+    if (bParallel)
+    {
+        ParallelForRange(VertexCount, CellLinksGrainSize, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 VertexIndex = Begin; VertexIndex < End; ++VertexIndex)
+            {
+                std::sort(LinkData + Offsets[VertexIndex], LinkData + Offsets[VertexIndex + 1]);
+            }
+        });
+    }
+}
+
+void FCellLinks::Clear()
+{
+    Offsets.Reset();
+    Links.Reset();
+}
+
+// ============================================================================
+// 内存管理
+// ============================================================================
+
+uint64 FCellLinks::GetMemoryUsage() const
+{
+    uint64 Usage = 0;
+    Usage += Offsets.Capacity() * sizeof(uint32);
+    Usage += Links.Capacity() * sizeof(CellIndexType);
+    return Usage;
+}
@@ -0,0 +1,269 @@
+#include "Container/CellNeighborTable.h"
+#include "Container/CellArray.h"
+#include "Cell/CellType.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+
+namespace
+{
+    /** 哈希分桶位数（256 个桶） */
+    constexpr uint32 BucketBits = 8;
+    constexpr uint32 BucketCount = 1u << BucketBits;
+
+    /** 分桶计数时每个区间的面数量（固定值保证并行结果确定） */
+    constexpr uint32 FaceChunkSize = 1u << 16;
+
+    /** 按单元并行时的区间粒度 */
+    constexpr uint32 CellGrainSize = 16384;
+
+    /** 开放寻址哈希表的空位标记 */
+    constexpr uint32 EmptySlot = ~0u;
+
+    /** 已排序的面顶点（全局索引） */
+    struct FFaceKey
+    {
+        int32 Vertices[ICellType::MaxFaceVertexCount];
+        uint32 Count = 0;
+
+        bool operator==(const FFaceKey& Other) const
+        {
+            return Count == Other.Count && std::equal(Vertices, Vertices + Count, Other.Vertices);
+        }
+    };
+
+    FFaceKey MakeFaceKey(const FCellView& Cell, uint32 FaceIndex)
+    {
+        FFaceKey Key;
+        int32 LocalIndices[ICellType::MaxFaceVertexCount];
+        Key.Count = ICellType::GetFaceLocalIndices(Cell.CellType, Cell.Num(), FaceIndex, LocalIndices);
+        for (uint32 i = 0; i < Key.Count; ++i)
+        {
+            Key.Vertices[i] = Cell[LocalIndices[i]];
+        }
+        std::sort(Key.Vertices, Key.Vertices + Key.Count);
+        return Key;
+    }
+
+    uint64 HashFaceKey(const FFaceKey& Key)
+    {
+        // SplitMix64 风格的混合，保证高位（用于分桶）和低位（用于哈希表）都分布均匀
+        uint64 Hash = 0x9E3779B97F4A7C15ull * (Key.Count + 1);
+        for (uint32 i = 0; i < Key.Count; ++i)
+        {
+            Hash ^= static_cast<uint32>(Key.Vertices[i]);
+            Hash *= 0xBF58476D1CE4E5B9ull;
+            Hash ^= Hash >> 31;
+        }
+        Hash *= 0x94D049BB133111EBull;
+        Hash ^= Hash >> 29;
+        return Hash;
+    }
+}
+
+// ============================================================================
+// 构建
+// ============================================================================
+
+void FCellNeighborTable::Build(const FCellArray& Cells, bool bParallel)
+{
+    Clear();
+
+    CellCount = Cells.GetCellCount();
+    if (CellCount == 0)
+    {
+        return;
+    }
+
+    const EParallelForFlags Flags = bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+
+    // 第一步：计算每个单元的面数及其在邻接数组中的位置
+    if (Cells.IsUniform())
+    {
+        UniformFaceCount = ICellType::GetFaceCount(Cells.GetUniformCellType(), Cells.GetUniformStride());
+    }
+    else
+    {
+        FaceOffsets.Resize(CellCount + 1);
+        FaceOffsets[0] = 0;
+        ParallelForRange(CellCount, CellGrainSize, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 CellIndex = Begin; CellIndex < End; ++CellIndex)
+            {
+                const FCellView Cell = Cells.GetCellViewUnchecked(CellIndex);
+                FaceOffsets[CellIndex + 1] = ICellType::GetFaceCount(Cell.CellType, Cell.Num());
+            }
+        }, Flags);
+        for (uint32 i = 1; i <= CellCount; ++i)
+        {
+            FaceOffsets[i] += FaceOffsets[i - 1];
+        }
+    }
+
+    const uint32 TotalFaceCount = GetFaceOffset(CellCount);
+    Neighbors.Resize(TotalFaceCount);
+    std::fill(Neighbors.begin(), Neighbors.end(), NoNeighbor);
+    if (TotalFaceCount == 0)
+    {
+        return;
+    }
+
+    // 第二步：计算每个面的哈希
+    TArray<uint64> FaceHashes;
+    FaceHashes.Resize(TotalFaceCount);
+    ParallelForRange(CellCount, CellGrainSize, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 CellIndex = Begin; CellIndex < End; ++CellIndex)
+        {
+            const FCellView Cell = Cells.GetCellViewUnchecked(CellIndex);
+            const uint32 Offset = GetFaceOffset(CellIndex);
+            const uint32 FaceCount = GetFaceOffset(CellIndex + 1) - Offset;
+            for (uint32 FaceIndex = 0; FaceIndex < FaceCount; ++FaceIndex)
+            {
+                FaceHashes[Offset + FaceIndex] = HashFaceKey(MakeFaceKey(Cell, FaceIndex));
+            }
+        }
+    }, Flags);
+
+    // 第三步：按哈希高位分桶（每个区间独立计数，桶内保持面的原始顺序）
+    const uint32 ChunkCount = (TotalFaceCount + FaceChunkSize - 1) / FaceChunkSize;
+    TArray<uint32> ChunkBucketCounts;
+    ChunkBucketCounts.Resize(ChunkCount * BucketCount);
+    ParallelForRange(ChunkCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Chunk = Begin; Chunk < End; ++Chunk)
+        {
+            uint32* Counts = ChunkBucketCounts.GetData() + Chunk * BucketCount;
+            std::fill(Counts, Counts + BucketCount, 0u);
+            const uint32 FaceEnd = std::min(TotalFaceCount, (Chunk + 1) * FaceChunkSize);
+            for (uint32 Face = Chunk * FaceChunkSize; Face < FaceEnd; ++Face)
+            {
+                ++Counts[FaceHashes[Face] >> (64 - BucketBits)];
+            }
+        }
+    }, Flags);
+
+    TArray<uint32> BucketOffsets;
+    BucketOffsets.Resize(BucketCount + 1);
+    uint32 Running = 0;
+    for (uint32 Bucket = 0; Bucket < BucketCount; ++Bucket)
+    {
+        BucketOffsets[Bucket] = Running;
+        for (uint32 Chunk = 0; Chunk < ChunkCount; ++Chunk)
+        {
+            uint32& Count = ChunkBucketCounts[Chunk * BucketCount + Bucket];
+            const uint32 ChunkCountInBucket = Count;
+            Count = Running;
+            Running += ChunkCountInBucket;
+        }
+    }
+    BucketOffsets[BucketCount] = Running;
+
+    TArray<uint32> BucketFaces;
+    BucketFaces.Resize(TotalFaceCount);
+    ParallelForRange(ChunkCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Chunk = Begin; Chunk < End; ++Chunk)
+        {
+            uint32* Cursor = ChunkBucketCounts.GetData() + Chunk * BucketCount;
+            const uint32 FaceEnd = std::min(TotalFaceCount, (Chunk + 1) * FaceChunkSize);
+            for (uint32 Face = Chunk * FaceChunkSize; Face < FaceEnd; ++Face)
+            {
+                BucketFaces[Cursor[FaceHashes[Face] >> (64 - BucketBits)]++] = Face;
+            }
+        }
+    }, Flags);
+
+    // 面索引到所属单元
+    auto GetOwnerCell = [this](uint32 Face) -> uint32
+    {
+        if (FaceOffsets.IsEmpty())
+        {
+            return Face / UniformFaceCount;
+        }
+        return static_cast<uint32>(std::upper_bound(FaceOffsets.begin(), FaceOffsets.end(), Face) - FaceOffsets.begin()) - 1;
+    };
+
+    auto GetFaceKey = [&](uint32 Face, uint32 OwnerCell)
+    {
+        return MakeFaceKey(Cells.GetCellViewUnchecked(OwnerCell), Face - GetFaceOffset(OwnerCell));
+    };
+
+    // 第四步：每个桶内使用开放寻址哈希表配对共享面（不同桶之间互不影响）
+    ParallelForRange(BucketCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        TArray<uint32> Table;
+        for (uint32 Bucket = Begin; Bucket < End; ++Bucket)
+        {
+            const uint32 BucketBegin = BucketOffsets[Bucket];
+            const uint32 BucketEnd = BucketOffsets[Bucket + 1];
+            if (BucketBegin == BucketEnd)
+            {
+                continue;
+            }
+
+            uint32 TableSize = 16;
+            while (TableSize < (BucketEnd - BucketBegin) * 2)
+            {
+                TableSize <<= 1;
+            }
+            const uint32 Mask = TableSize - 1;
+            Table.Resize(TableSize);
+            std::fill(Table.begin(), Table.end(), EmptySlot);
+
+            for (uint32 i = BucketBegin; i < BucketEnd; ++i)
+            {
+                const uint32 Face = BucketFaces[i];
+                const uint64 Hash = FaceHashes[Face];
+                const uint32 Owner = GetOwnerCell(Face);
+
+                bool bPaired = false;
+                uint32 Probe = static_cast<uint32>(Hash) & Mask;
+                for (; Table[Probe] != EmptySlot; Probe = (Probe + 1) & Mask)
+                {
+                    const uint32 Other = Table[Probe];
+                    if (FaceHashes[Other] != Hash || Neighbors[Other] != NoNeighbor)
+                    {
+                        continue;
+                    }
+                    const uint32 OtherOwner = GetOwnerCell(Other);
+                    if (OtherOwner != Owner && GetFaceKey(Other, OtherOwner) == GetFaceKey(Face, Owner))
+                    {
+                        Neighbors[Other] = static_cast<CellIndexType>(Owner);
+                        Neighbors[Face] = static_cast<CellIndexType>(OtherOwner);
+                        bPaired = true;
+                        break;
+                    }
+                }
+
+                if (!bPaired)
+                {
+                    // Probe 已停在空位上
+                    Table[Probe] = Face;
+                }
+            }
+        }
+    }, Flags);
+
+    BoundaryFaceCount = static_cast<uint32>(std::count(Neighbors.begin(), Neighbors.end(), NoNeighbor));
+}
+
+void FCellNeighborTable::Clear()
+{
+    FaceOffsets.Reset();
+    Neighbors.Reset();
+    UniformFaceCount = 0;
+    CellCount = 0;
+    BoundaryFaceCount = 0;
+}
+
+// ============================================================================
+// 内存管理
+// ============================================================================
+
+uint64 FCellNeighborTable::GetMemoryUsage() const
+{
+    uint64 Usage = 0;
+    Usage += FaceOffsets.Capacity() * sizeof(uint32);
+    Usage += Neighbors.Capacity() * sizeof(CellIndexType);
+    return Usage;
+}
@@ -178,6 +178,8 @@ std::string FException::ErrorCodeToString(EExceptionCode Code)
             return "Timeout";
         case EExceptionCode::NotSupported:
             return "NotSupported";
+        case EExceptionCode::Canceled:
+            return "Canceled";
         default:
             return "Unknown";
     }
@@ -277,3 +279,13 @@ FNotSupportedException::FNotSupportedException(
 {
 }
 
+FOperationCanceledException::FOperationCanceledException(
+    const std::string& InMessage,
+    const std::string& InFileName,
+    int32 InLineNumber,
+    const std::string& InFunctionName
+)
+    : FException(InMessage, EExceptionCode::Canceled, InFileName, InLineNumber, InFunctionName)
+{
+}
+
@@ -1,5 +1,127 @@
 #include "Field/Field.h"
+#include "Field/FieldCompression.h"
+#include "HAL/MappedFile.h"
 #include "Exception/Exception.h"
+#include "Math/VectorKernels.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// ============================================================================
+// 存储类型转换
+// ============================================================================
+
+namespace
+{
+    template<typename T>
+    struct TStorageType
+    {
+        using Type = T;
+    };
+
+    /** 按存储类型分发到对应的 C++ 类型 */
+    template<typename FuncType>
+    decltype(auto) VisitStorage(EFieldStorage Storage, FuncType&& Func)
+    {
+        switch (Storage)
+        {
+            case EFieldStorage::Float16: return Func(TStorageType<FFloat16>{});
+            case EFieldStorage::Float64: return Func(TStorageType<double>{});
+            case EFieldStorage::Int32: return Func(TStorageType<int32>{});
+            case EFieldStorage::UInt8: return Func(TStorageType<uint8>{});
+            case EFieldStorage::Float32:
+            default: return Func(TStorageType<float>{});
+        }
+    }
+
+    /** 整数类型四舍五入并截断到类型范围（NaN 转换为 0） */
+    template<typename T>
+    T RoundToInteger(double Value)
+    {
+        if (std::isnan(Value))
+        {
+            return 0;
+        }
+        const double Clamped = std::clamp(Value,
+            static_cast<double>(std::numeric_limits<T>::lowest()),
+            static_cast<double>(std::numeric_limits<T>::max()));
+        return static_cast<T>(std::llround(Clamped));
+    }
+
+    template<typename T>
+    T ConvertValue(double Value)
+    {
+        if constexpr (std::is_same_v<T, int32> || std::is_same_v<T, uint8>)
+        {
+            return RoundToInteger<T>(Value);
+        }
+        else if constexpr (std::is_same_v<T, FFloat16>)
+        {
+            return FFloat16(static_cast<float>(Value));
+        }
+        else
+        {
+            return static_cast<T>(Value);
+        }
+    }
+
+    template<typename T>
+    double ToDouble(T Value)
+    {
+        if constexpr (std::is_same_v<T, FFloat16>)
+        {
+            return static_cast<float>(Value);
+        }
+        else
+        {
+            return static_cast<double>(Value);
+        }
+    }
+
+    /** 在两种存储类型之间转换 NumValues 个分量 */
+    void ConvertValues(const void* Source, EFieldStorage SourceStorage, void* Dest, EFieldStorage DestStorage, uint32 NumValues)
+    {
+        if (SourceStorage == DestStorage)
+        {
+            std::memcpy(Dest, Source, static_cast<size_t>(NumValues) * GetFieldStorageSize(SourceStorage));
+            return;
+        }
+        VisitStorage(SourceStorage, [&](auto SourceTag)
+        {
+            using SourceType = typename decltype(SourceTag)::Type;
+            VisitStorage(DestStorage, [&](auto DestTag)
+            {
+                using DestType = typename decltype(DestTag)::Type;
+                const SourceType* Src = static_cast<const SourceType*>(Source);
+                DestType* Dst = static_cast<DestType*>(Dest);
+                for (uint32 i = 0; i < NumValues; ++i)
+                {
+                    Dst[i] = ConvertValue<DestType>(ToDouble(Src[i]));
+                }
+            });
+        });
+    }
+
+    float ReadStorageValue(const void* Base, EFieldStorage Storage, uint32 Index)
+    {
+        return VisitStorage(Storage, [&](auto Tag)
+        {
+            using Type = typename decltype(Tag)::Type;
+            return static_cast<float>(ToDouble(static_cast<const Type*>(Base)[Index]));
+        });
+    }
+
+    void WriteStorageValue(void* Base, EFieldStorage Storage, uint32 Index, float Value)
+    {
+        VisitStorage(Storage, [&](auto Tag)
+        {
+            using Type = typename decltype(Tag)::Type;
+            static_cast<Type*>(Base)[Index] = ConvertValue<Type>(Value);
+        });
+    }
+}
 
 // ============================================================================
 // 构造函数
@@ -19,6 +141,101 @@ FField::FField(const std::string& InFieldName, EFieldType InFieldType, EFieldAtt
     Initialize(InFieldName, InFieldType, InAttachment, InFieldDimension);
 }
 
+FField::FField(const FField& Other)
+    : FieldName(Other.FieldName)
+    , Data(Other.Data)
+    , TypedData(Other.TypedData)
+    , Storage(Other.Storage)
+    , CompressedData(Other.CompressedData)
+    , ExternalData(Other.ExternalData)
+    , ExternalOwner(Other.ExternalOwner)
+    , DataCount(Other.DataCount)
+    , FieldDimension(Other.FieldDimension)
+    , FieldType(Other.FieldType)
+    , Attachment(Other.Attachment)
+    , bIsValid(Other.bIsValid)
+{
+    std::lock_guard<std::mutex> Lock(Other.DataRangeMutex);
+    DataRange = Other.DataRange;
+    bDataRangeValid.store(Other.bDataRangeValid.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+FField::FField(FField&& Other) noexcept
+    : FieldName(std::move(Other.FieldName))
+    , Data(std::move(Other.Data))
+    , TypedData(std::move(Other.TypedData))
+    , Storage(Other.Storage)
+    , CompressedData(std::move(Other.CompressedData))
+    , ExternalData(Other.ExternalData)
+    , ExternalOwner(std::move(Other.ExternalOwner))
+    , DataRange(std::move(Other.DataRange))
+    , bDataRangeValid(Other.bDataRangeValid.load(std::memory_order_relaxed))
+    , DataCount(Other.DataCount)
+    , FieldDimension(Other.FieldDimension)
+    , FieldType(Other.FieldType)
+    , Attachment(Other.Attachment)
+    , bIsValid(Other.bIsValid)
+{
+    Other.DataCount = 0;
+    Other.ExternalData = nullptr;
+    Other.bDataRangeValid.store(false, std::memory_order_relaxed);
+    Other.MarkModified();
+}
+
+FField& FField::operator=(const FField& Other)
+{
+    if (this != &Other)
+    {
+        FieldName = Other.FieldName;
+        Data = Other.Data;
+        TypedData = Other.TypedData;
+        Storage = Other.Storage;
+        CompressedData = Other.CompressedData;
+        ExternalData = Other.ExternalData;
+        ExternalOwner = Other.ExternalOwner;
+        DataCount = Other.DataCount;
+        FieldDimension = Other.FieldDimension;
+        FieldType = Other.FieldType;
+        Attachment = Other.Attachment;
+        bIsValid = Other.bIsValid;
+        MarkModified();
+
+        std::scoped_lock Lock(DataRangeMutex, Other.DataRangeMutex);
+        DataRange = Other.DataRange;
+        bDataRangeValid.store(Other.bDataRangeValid.load(std::memory_order_relaxed), std::memory_order_release);
+    }
+    return *this;
+}
+
+FField& FField::operator=(FField&& Other) noexcept
+{
+    if (this != &Other)
+    {
+        FieldName = std::move(Other.FieldName);
+        Data = std::move(Other.Data);
+        TypedData = std::move(Other.TypedData);
+        Storage = Other.Storage;
+        CompressedData = std::move(Other.CompressedData);
+        ExternalData = Other.ExternalData;
+        ExternalOwner = std::move(Other.ExternalOwner);
+        Other.ExternalData = nullptr;
+        DataCount = Other.DataCount;
+        FieldDimension = Other.FieldDimension;
+        FieldType = Other.FieldType;
+        Attachment = Other.Attachment;
+        bIsValid = Other.bIsValid;
+        Other.DataCount = 0;
+        MarkModified();
+        Other.MarkModified();
+
+        std::scoped_lock Lock(DataRangeMutex, Other.DataRangeMutex);
+        DataRange = std::move(Other.DataRange);
+        bDataRangeValid.store(Other.bDataRangeValid.load(std::memory_order_relaxed), std::memory_order_release);
+        Other.bDataRangeValid.store(false, std::memory_order_relaxed);
+    }
+    return *this;
+}
+
 void FField::Initialize(const std::string &InFieldName, EFieldType InFieldType, EFieldAttachment InAttachment,
     uint32 InFieldDimension)
 {
@@ -28,6 +245,11 @@ void FField::Initialize(const std::string &InFieldName, EFieldType InFieldType,
     DataCount = 0;
     bIsValid = true;
     FieldDimension = 1;
+    TypedData.Clear();
+    Storage = EFieldStorage::Float32;
+    CompressedData.Reset();
+    ReleaseExternalData();
+    InvalidateDataRange();
     // 根据场类型设置默认维度
     switch (InFieldType)
     {
@@ -91,12 +313,68 @@ uint32 FField::GetFieldDimension() const
 
 const float* FField::GetRawDataPtr() const
 {
+    CheckStorage(EFieldStorage::Float32);
+    CheckNotCompressed();
+    if (ExternalData)
+    {
+        return static_cast<const float*>(ExternalData);
+    }
     return Data.GetData();
 }
 
+const void* FField::GetRawStorage() const
+{
+    CheckNotCompressed();
+    if (ExternalData)
+    {
+        return ExternalData;
+    }
+    if (Storage == EFieldStorage::Float32)
+    {
+        return Data.GetData();
+    }
+    return TypedData.GetData();
+}
+
+void* FField::GetRawStorage()
+{
+    MakeWritable();
+    InvalidateDataRange();
+    if (Storage == EFieldStorage::Float32)
+    {
+        return Data.GetData();
+    }
+    return TypedData.GetData();
+}
+
 size_t FField::GetRawDataSize() const
 {
-    return Data.Num() * sizeof(float);
+    if (CompressedData)
+    {
+        return CompressedData->GetUncompressedSize();
+    }
+    if (ExternalData)
+    {
+        return static_cast<size_t>(GetValueCount()) * GetFieldStorageSize(Storage);
+    }
+    if (Storage == EFieldStorage::Float32)
+    {
+        return Data.Num() * sizeof(float);
+    }
+    return TypedData.Num();
+}
+
+size_t FField::GetMemorySize() const
+{
+    if (CompressedData)
+    {
+        return CompressedData->GetCompressedSize();
+    }
+    if (ExternalData)
+    {
+        return 0;
+    }
+    return GetRawDataSize();
 }
 
 // ============================================================================
@@ -110,7 +388,7 @@ void FField::SetScalarData(const TArray<float>& InData)
         THROW_EXCEPTION(FInvalidOperationException, "Not a Scalar Data");
     }
 
-    Data = InData;
+    AssignFloatData(InData.GetData(), InData.Num());
     DataCount = static_cast<uint32>(InData.Num());
 }
 
@@ -121,24 +399,33 @@ void FField::SetScalarData(TArray<float> &&InData)
         THROW_EXCEPTION(FInvalidOperationException, "Not a Scalar Data");
     }
 
-    Data = std::move(InData);
-    DataCount = static_cast<uint32>(Data.Num());
+    DataCount = static_cast<uint32>(InData.Num());
+    if (Storage == EFieldStorage::Float32)
+    {
+        Data = std::move(InData);
+        CompressedData.Reset();
+        ReleaseExternalData();
+        InvalidateDataRange();
+    }
+    else
+    {
+        AssignFloatData(InData.GetData(), InData.Num());
+    }
 }
 
 void FField::AddScalar(float Value)
 {
-    Data.Add(Value);
-    DataCount = static_cast<uint32>(Data.Num());
+    AppendValues(&Value, 1);
 }
 
 float FField::GetScalar(uint32 Index) const
 {
-    return Data[Index];
+    return ReadValue(Index);
 }
 
 void FField::SetScalar(uint32 Index, float Value)
 {
-    Data[Index] = Value;
+    WriteValues(Index, &Value, 1);
 }
 
 // ============================================================================
@@ -158,7 +445,7 @@ void FField::SetVectorData(const TArray<float>& InData)
         THROW_EXCEPTION(FInvalidOperationException, "DataCount must be a multiple of 3");
     }
 
-    Data = InData;
+    AssignFloatData(InData.GetData(), InData.Num());
     DataCount = static_cast<uint32>(InData.Num() / 3);
 }
 
@@ -170,36 +457,41 @@ void FField::SetVectorData(TArray<float>&& InData)
     }
 
     // 验证数据量必须是 3 的倍数
-    if (Data.Num() % 3 != 0)
+    if (InData.Num() % 3 != 0)
     {
         THROW_EXCEPTION(FInvalidOperationException, "DataCount must be a multiple of 3");
     }
 
-    Data = std::move(InData);
-    DataCount = static_cast<uint32>(Data.Num() / 3);
+    DataCount = static_cast<uint32>(InData.Num() / 3);
+    if (Storage == EFieldStorage::Float32)
+    {
+        Data = std::move(InData);
+        CompressedData.Reset();
+        ReleaseExternalData();
+        InvalidateDataRange();
+    }
+    else
+    {
+        AssignFloatData(InData.GetData(), InData.Num());
+    }
 }
 
 void FField::AddVector(const FVector& Value)
 {
-    Data.Add(Value.X);
-    Data.Add(Value.Y);
-    Data.Add(Value.Z);
-    DataCount = static_cast<uint32>(Data.Num() / 3);
+    const float Values[3] = {Value.X, Value.Y, Value.Z};
+    AppendValues(Values, 3);
 }
 
 FVector FField::GetVector(uint32 Index) const
 {
     const uint32 Offset = Index * 3;
-    return FVector{Data[Offset], Data[Offset + 1], Data[Offset + 2]};
+    return FVector{ReadValue(Offset), ReadValue(Offset + 1), ReadValue(Offset + 2)};
 }
 
 void FField::SetVector(uint32 Index, const FVector& Value)
 {
-    uint32 Offset = Index * 3;
-
-    Data[Offset] = Value.X;
-    Data[Offset + 1] = Value.Y;
-    Data[Offset + 2] = Value.Z;
+    const float Values[3] = {Value.X, Value.Y, Value.Z};
+    WriteValues(Index * 3, Values, 3);
 }
 
 // ============================================================================
@@ -219,7 +511,7 @@ void FField::SetTensorData(const TArray<float>& InData)
         THROW_EXCEPTION(FInvalidOperationException, "DataCount must be a multiple of 9");
     }
 
-    Data = InData;
+    AssignFloatData(InData.GetData(), InData.Num());
     DataCount = static_cast<uint32>(InData.Num() / 9);
 }
 
@@ -236,17 +528,23 @@ void FField::SetTensorData(TArray<float>&& InData)
         THROW_EXCEPTION(FInvalidOperationException, "DataCount must be a multiple of 9");
     }
 
-    Data = std::move(InData);
-    DataCount = static_cast<uint32>(Data.Num() / 9);
+    DataCount = static_cast<uint32>(InData.Num() / 9);
+    if (Storage == EFieldStorage::Float32)
+    {
+        Data = std::move(InData);
+        CompressedData.Reset();
+        ReleaseExternalData();
+        InvalidateDataRange();
+    }
+    else
+    {
+        AssignFloatData(InData.GetData(), InData.Num());
+    }
 }
 
 void FField::AddTensor(const TArray<float>& Value)
 {
-    for (uint32 i = 0; i < 9; ++i)
-    {
-        Data.Add(Value[i]);
-    }
-    DataCount = static_cast<uint32>(Data.Num() / 9);
+    AppendValues(Value.GetData(), 9);
 }
 
 void FField::GetTensor(uint32 Index, TArray<float>& OutValue) const
@@ -256,18 +554,13 @@ void FField::GetTensor(uint32 Index, TArray<float>& OutValue) const
     OutValue.Reset();
     for (uint32 i = 0; i < 9; ++i)
     {
-        OutValue.Add(Data[Offset + i]);
+        OutValue.Add(ReadValue(Offset + i));
     }
 }
 
 void FField::SetTensor(uint32 Index, const TArray<float>& Value)
 {
-    const uint32 Offset = Index * 9;
-
-    for (uint32 i = 0; i < 9; ++i)
-    {
-        Data[Offset + i] = Value[i];
-    }
+    WriteValues(Index * 9, Value.GetData(), 9);
 }
 
 // ============================================================================
@@ -282,7 +575,7 @@ void FField::SetFieldData(const TArray<float>& InData)
         THROW_EXCEPTION(FInvalidOperationException, "DataCount must be a multiple of FieldDimension");
     }
 
-    Data = InData;
+    AssignFloatData(InData.GetData(), InData.Num());
     DataCount = static_cast<uint32>(InData.Num() / FieldDimension);
 }
 
@@ -294,18 +587,23 @@ void FField::SetFieldData(TArray<float>&& InData)
         THROW_EXCEPTION(FInvalidOperationException, "DataCount must be a multiple of FieldDimension");
     }
 
-    Data = std::move(InData);
-    DataCount = static_cast<uint32>(Data.Num() / FieldDimension);
+    DataCount = static_cast<uint32>(InData.Num() / FieldDimension);
+    if (Storage == EFieldStorage::Float32)
+    {
+        Data = std::move(InData);
+        CompressedData.Reset();
+        ReleaseExternalData();
+        InvalidateDataRange();
+    }
+    else
+    {
+        AssignFloatData(InData.GetData(), InData.Num());
+    }
 }
 
 void FField::AddData(const TArray<float>& Value)
 {
-    for (uint32 i = 0; i < FieldDimension; ++i)
-    {
-        Data.Add(Value[i]);
-    }
-    
-    DataCount = static_cast<uint32>(Data.Num() / FieldDimension);
+    AppendValues(Value.GetData(), FieldDimension);
 }
 
 void FField::GetData(uint32 Index, TArray<float>& OutValue) const
@@ -315,34 +613,43 @@ void FField::GetData(uint32 Index, TArray<float>& OutValue) const
     OutValue.Reset();
     for (uint32 i = 0; i < FieldDimension; ++i)
     {
-        OutValue.Add(Data[Offset + i]);
+        OutValue.Add(ReadValue(Offset + i));
     }
 }
 
 void FField::SetData(uint32 Index, const TArray<float>& Value)
 {
-    const uint32 Offset = Index * FieldDimension;
-
-    for (uint32 i = 0; i < FieldDimension; ++i)
-    {
-        Data[Offset + i] = Value[i];
-    }
+    WriteValues(Index * FieldDimension, Value.GetData(), FieldDimension);
 }
 
 TArray<float>& FField::GetFieldData()
 {
+    CheckStorage(EFieldStorage::Float32);
+    MakeWritable();
+    // 调用方可能通过返回的引用任意修改数据，只能保守地使缓存失效
+    InvalidateDataRange();
     return Data;
 }
 
 const TArray<float>& FField::GetFieldData() const
 {
+    CheckStorage(EFieldStorage::Float32);
+    CheckNotCompressed();
+    if (ExternalData)
+    {
+        THROW_EXCEPTION(FInvalidOperationException, "Field data is external, use GetRawDataPtr or MakeWritable");
+    }
     return Data;
 }
 
 void FField::Clear()
 {
     Data.Clear();
+    TypedData.Clear();
+    CompressedData.Reset();
+    ReleaseExternalData();
     DataCount = 0;
+    InvalidateDataRange();
 }
 
 void FField::Reset()
@@ -352,6 +659,7 @@ void FField::Reset()
     FieldType = EFieldType::Custom;
     Attachment = EFieldAttachment::Vertex;
     FieldDimension = 1;
+    Storage = EFieldStorage::Float32;
     bIsValid = false;
 }
 
@@ -361,9 +669,17 @@ void FField::Reserve(uint32 Capacity)
     {
         return;
     }
-    
-    Data.Reserve(Capacity * FieldDimension);
-    DataCount = static_cast<uint32>(Data.Num() / FieldDimension);
+
+    MakeWritable();
+    if (Storage == EFieldStorage::Float32)
+    {
+        Data.Reserve(Capacity * FieldDimension);
+    }
+    else
+    {
+        TypedData.Reserve(Capacity * FieldDimension * GetFieldStorageSize(Storage));
+    }
+    DataCount = static_cast<uint32>(GetRawDataSize() / GetFieldStorageSize(Storage) / FieldDimension);
 }
 
 void FField::Resize(uint32 Size)
@@ -373,6 +689,695 @@ void FField::Resize(uint32 Size)
         return;
     }
 
-    Data.Resize(Size * FieldDimension);
-    DataCount = static_cast<uint32>(Data.Num() / FieldDimension);
+    MakeWritable();
+    if (Storage == EFieldStorage::Float32)
+    {
+        Data.Resize(Size * FieldDimension);
+    }
+    else
+    {
+        TypedData.Resize(Size * FieldDimension * GetFieldStorageSize(Storage));
+    }
+    DataCount = Size;
+    InvalidateDataRange();
+}
+
+void FField::CompactData(const TArray<int32>& OldToNew)
+{
+    if (OldToNew.Num() != DataCount)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Remap count must match DataCount");
+    }
+
+    // 按字节移动元素，与存储类型无关
+    const size_t ElementSize = static_cast<size_t>(FieldDimension) * GetFieldStorageSize(Storage);
+    uint8* Bytes = static_cast<uint8*>(GetRawStorage());
+    uint32 NewCount = 0;
+    for (uint32 i = 0; i < DataCount; ++i)
+    {
+        const int32 NewIndex = OldToNew[i];
+        if (NewIndex < 0)
+        {
+            continue;
+        }
+        if (static_cast<uint32>(NewIndex) > i || static_cast<uint32>(NewIndex) < NewCount)
+        {
+            THROW_EXCEPTION(FInvalidArgumentException, "Remap must preserve element order");
+        }
+
+        // 新位置不会超过旧位置，可以原地前移
+        if (static_cast<uint32>(NewIndex) != i)
+        {
+            std::memmove(Bytes + NewIndex * ElementSize, Bytes + i * ElementSize, ElementSize);
+        }
+        NewCount = static_cast<uint32>(NewIndex) + 1;
+    }
+
+    if (Storage == EFieldStorage::Float32)
+    {
+        Data.Resize(NewCount * FieldDimension);
+    }
+    else
+    {
+        TypedData.Resize(NewCount * ElementSize);
+    }
+    DataCount = NewCount;
+    InvalidateDataRange();
+}
+
+// ============================================================================
+// 存储类型
+// ============================================================================
+
+EFieldStorage FField::GetStorage() const
+{
+    return Storage;
+}
+
+void FField::SetStorage(EFieldStorage NewStorage)
+{
+    if (NewStorage == Storage)
+    {
+        return;
+    }
+
+    MakeWritable();
+    const uint32 NumValues = GetValueCount();
+    if (NewStorage == EFieldStorage::Float32)
+    {
+        Data.Resize(NumValues);
+        ConvertValues(TypedData.GetData(), Storage, Data.GetData(), NewStorage, NumValues);
+        TypedData = TAlignedArray<uint8, 16>();
+    }
+    else
+    {
+        TAlignedArray<uint8, 16> NewData;
+        NewData.Resize(NumValues * GetFieldStorageSize(NewStorage));
+        ConvertValues(GetRawStorage(), Storage, NewData.GetData(), NewStorage, NumValues);
+        TypedData = std::move(NewData);
+        Data = TArray<float>();
+    }
+    Storage = NewStorage;
+    InvalidateDataRange();
+}
+
+void FField::CopyToFloat(TArray<float>& OutData) const
+{
+    const uint32 NumValues = GetValueCount();
+    OutData.Resize(NumValues);
+    if (CompressedData)
+    {
+        if (Storage == EFieldStorage::Float32)
+        {
+            CompressedData->Decode(OutData.GetData());
+            return;
+        }
+        TAlignedArray<uint8, 16> Decoded;
+        Decoded.Resize(static_cast<uint32>(CompressedData->GetUncompressedSize()));
+        CompressedData->Decode(Decoded.GetData());
+        ConvertValues(Decoded.GetData(), Storage, OutData.GetData(), EFieldStorage::Float32, NumValues);
+        return;
+    }
+    ConvertValues(GetRawStorage(), Storage, OutData.GetData(), EFieldStorage::Float32, NumValues);
+}
+
+const float* FField::GetFloatData(TArray<float>& ConversionBuffer) const
+{
+    if (Storage == EFieldStorage::Float32 && !CompressedData)
+    {
+        return ExternalData ? static_cast<const float*>(ExternalData) : Data.GetData();
+    }
+    CopyToFloat(ConversionBuffer);
+    return ConversionBuffer.GetData();
+}
+
+void FField::DecodeFloatBlock(uint32 BlockIndex, TArray<float>& OutValues) const
+{
+    if (!CompressedData)
+    {
+        THROW_EXCEPTION(FInvalidOperationException, "Field data is not compressed");
+    }
+
+    const uint32 NumBlockValues = CompressedData->GetBlockNumValues(BlockIndex);
+    OutValues.Resize(NumBlockValues);
+    if (Storage == EFieldStorage::Float32)
+    {
+        CompressedData->DecodeBlock(BlockIndex, OutValues.GetData());
+        return;
+    }
+    TArray<uint8> Decoded;
+    Decoded.Resize(NumBlockValues * GetFieldStorageSize(Storage));
+    CompressedData->DecodeBlock(BlockIndex, Decoded.GetData());
+    ConvertValues(Decoded.GetData(), Storage, OutValues.GetData(), EFieldStorage::Float32, NumBlockValues);
+}
+
+uint32 FField::GetValueCount() const
+{
+    return DataCount * FieldDimension;
+}
+
+void FField::ReleaseExternalData()
+{
+    ExternalData = nullptr;
+    ExternalOwner.Reset();
+}
+
+void FField::CheckNotCompressed() const
+{
+    if (CompressedData)
+    {
+        THROW_EXCEPTION(FInvalidOperationException, "Field data is compressed, call Decompress first");
+    }
+}
+
+void FField::CheckStorage(EFieldStorage Expected) const
+{
+    if (Storage != Expected)
+    {
+        THROW_EXCEPTION(FInvalidOperationException, "Field storage is " + EnumToString(Storage) + ", expected " + EnumToString(Expected));
+    }
+}
+
+void FField::SetRawStorage(EFieldStorage NewStorage, const void* InData, uint32 NumValues)
+{
+    if (FieldDimension == 0 || NumValues % FieldDimension != 0)
+    {
+        THROW_EXCEPTION(FInvalidOperationException, "DataCount must be a multiple of FieldDimension");
+    }
+
+    CompressedData.Reset();
+    ReleaseExternalData();
+
+    const size_t NumBytes = static_cast<size_t>(NumValues) * GetFieldStorageSize(NewStorage);
+    if (NewStorage == EFieldStorage::Float32)
+    {
+        Data.Resize(NumValues);
+        std::memcpy(Data.GetData(), InData, NumBytes);
+        TypedData = TAlignedArray<uint8, 16>();
+    }
+    else
+    {
+        TypedData.Resize(static_cast<uint32>(NumBytes));
+        std::memcpy(TypedData.GetData(), InData, NumBytes);
+        Data = TArray<float>();
+    }
+    Storage = NewStorage;
+    DataCount = NumValues / FieldDimension;
+    InvalidateDataRange();
+}
+
+void FField::AssignFloatData(const float* InData, uint32 NumValues)
+{
+    CompressedData.Reset();
+    ReleaseExternalData();
+    if (Storage == EFieldStorage::Float32)
+    {
+        Data.Resize(NumValues);
+        std::copy(InData, InData + NumValues, Data.GetData());
+    }
+    else
+    {
+        TypedData.Resize(NumValues * GetFieldStorageSize(Storage));
+        ConvertValues(InData, EFieldStorage::Float32, TypedData.GetData(), Storage, NumValues);
+    }
+    InvalidateDataRange();
+}
+
+float FField::ReadValue(uint32 ValueIndex) const
+{
+    if (CompressedData)
+    {
+        return ReadStorageValue(CompressedData->GetValuePtr(ValueIndex), Storage, 0);
+    }
+    if (ExternalData)
+    {
+        return ReadStorageValue(ExternalData, Storage, ValueIndex);
+    }
+    if (Storage == EFieldStorage::Float32)
+    {
+        return Data[ValueIndex];
+    }
+    return ReadStorageValue(TypedData.GetData(), Storage, ValueIndex);
+}
+
+void FField::WriteValues(uint32 Offset, const float* Values, uint32 Count)
+{
+    MakeWritable();
+    MarkModified();
+
+    // 只有完整元素的修改才能增量更新数据范围
+    if (Count != FieldDimension)
+    {
+        InvalidateDataRange();
+    }
+    const bool bTrackRange = Count == FieldDimension && IsDataRangeValid();
+
+    if (Storage == EFieldStorage::Float32)
+    {
+        if (bTrackRange)
+        {
+            UpdateDataRange(&Data[Offset], Values);
+        }
+        std::copy(Values, Values + Count, &Data[Offset]);
+        return;
+    }
+
+    // 其他存储类型按转换后的实际存储值维护数据范围
+    TArray<float> OldValues;
+    if (bTrackRange)
+    {
+        OldValues.Resize(Count);
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            OldValues[i] = ReadValue(Offset + i);
+        }
+    }
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        WriteStorageValue(TypedData.GetData(), Storage, Offset + i, Values[i]);
+    }
+    if (bTrackRange)
+    {
+        TArray<float> NewValues;
+        NewValues.Resize(Count);
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            NewValues[i] = ReadValue(Offset + i);
+        }
+        UpdateDataRange(OldValues.GetData(), NewValues.GetData());
+    }
+}
+
+void FField::AppendValues(const float* Values, uint32 Count)
+{
+    MakeWritable();
+    MarkModified();
+
+    uint32 NumValues = 0;
+    if (Storage == EFieldStorage::Float32)
+    {
+        Data.Append(Values, Count);
+        NumValues = Data.Num();
+    }
+    else
+    {
+        const uint32 ValueSize = GetFieldStorageSize(Storage);
+        const uint32 Offset = TypedData.Num() / ValueSize;
+        TypedData.Resize(TypedData.Num() + Count * ValueSize);
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            WriteStorageValue(TypedData.GetData(), Storage, Offset + i, Values[i]);
+        }
+        NumValues = Offset + Count;
+    }
+    DataCount = FieldDimension == 0 ? 0 : NumValues / FieldDimension;
+
+    if (Count != FieldDimension)
+    {
+        InvalidateDataRange();
+    }
+    else if (Storage == EFieldStorage::Float32)
+    {
+        UpdateDataRange(nullptr, Values);
+    }
+    else if (IsDataRangeValid())
+    {
+        TArray<float> NewValues;
+        NewValues.Resize(Count);
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            NewValues[i] = ReadValue(NumValues - Count + i);
+        }
+        UpdateDataRange(nullptr, NewValues.GetData());
+    }
+}
+
+// ============================================================================
+// 压缩
+// ============================================================================
+
+bool FField::IsCompressed() const
+{
+    return CompressedData.IsValid();
+}
+
+void FField::Compress(const FFieldCompressionOptions& Options)
+{
+    Decompress();
+
+    const void* RawData = static_cast<const FField&>(*this).GetRawStorage();
+    TSharedPtr<const FCompressedFieldData> Compressed = FCompressedFieldData::Compress(RawData, Storage, GetValueCount(), FieldDimension, Options);
+    if (Options.Method == EFieldCompression::Lossy)
+    {
+        InvalidateDataRange();
+    }
+
+    // 释放未压缩的存储
+    Data = TArray<float>();
+    TypedData = TAlignedArray<uint8, 16>();
+    ReleaseExternalData();
+    CompressedData = std::move(Compressed);
+}
+
+void FField::Decompress()
+{
+    if (!CompressedData)
+    {
+        return;
+    }
+
+    TSharedPtr<const FCompressedFieldData> Compressed = std::move(CompressedData);
+    CompressedData.Reset();
+    if (Storage == EFieldStorage::Float32)
+    {
+        Data.Resize(Compressed->GetNumValues());
+        Compressed->Decode(Data.GetData());
+    }
+    else
+    {
+        TypedData.Resize(static_cast<uint32>(Compressed->GetUncompressedSize()));
+        Compressed->Decode(TypedData.GetData());
+    }
+}
+
+const FCompressedFieldData* FField::GetCompressedData() const
+{
+    return CompressedData.Get();
+}
+
+// ============================================================================
+// 外部存储
+// ============================================================================
+
+void FField::SetExternalData(EFieldStorage InStorage, const void* InData, uint32 NumValues, TSharedPtr<const FMappedFile> Owner)
+{
+    if (FieldDimension == 0 || NumValues % FieldDimension != 0)
+    {
+        THROW_EXCEPTION(FInvalidOperationException, "DataCount must be a multiple of FieldDimension");
+    }
+
+    Data = TArray<float>();
+    TypedData = TAlignedArray<uint8, 16>();
+    CompressedData.Reset();
+    Storage = InStorage;
+    ExternalData = InData;
+    ExternalOwner = std::move(Owner);
+    DataCount = NumValues / FieldDimension;
+    InvalidateDataRange();
+}
+
+bool FField::IsExternal() const
+{
+    return ExternalData != nullptr;
+}
+
+void FField::MakeWritable()
+{
+    Decompress();
+    if (!ExternalData)
+    {
+        return;
+    }
+
+    const uint32 NumValues = GetValueCount();
+    const size_t NumBytes = static_cast<size_t>(NumValues) * GetFieldStorageSize(Storage);
+    if (Storage == EFieldStorage::Float32)
+    {
+        Data.Resize(NumValues);
+        std::memcpy(Data.GetData(), ExternalData, NumBytes);
+    }
+    else
+    {
+        TypedData.Resize(static_cast<uint32>(NumBytes));
+        std::memcpy(TypedData.GetData(), ExternalData, NumBytes);
+    }
+    ReleaseExternalData();
+}
+
+// ============================================================================
+// 数据范围
+// ============================================================================
+
+namespace
+{
+    /** 模长分块计算的元素数量（缓冲区放在栈上） */
+    constexpr uint32 MagnitudeBlockSize = 1024;
+
+    /** 计算单个元素的模长 */
+    float ComputeElementMagnitude(const float* Value, uint32 Dimension)
+    {
+        if (Dimension == 1)
+        {
+            return std::fabs(Value[0]);
+        }
+        float SquaredSum = 0.0f;
+        for (uint32 c = 0; c < Dimension; ++c)
+        {
+            SquaredSum += Value[c] * Value[c];
+        }
+        return std::sqrt(SquaredSum);
+    }
+
+    /**
+     * 计算 [Begin, End) 区间内元素模长的范围
+     * 维度为 3 时使用向量长度内核，其余维度先求平方和的范围再开方（平方根单调）
+     */
+    void ComputeMagnitudeBounds(const float* Data, uint32 Dimension, uint32 Begin, uint32 End, float& OutMin, float& OutMax)
+    {
+        static_assert(sizeof(FVector) == 3 * sizeof(float), "FVector must be tightly packed");
+
+        float Buffer[MagnitudeBlockSize];
+        OutMin = std::numeric_limits<float>::max();
+        OutMax = 0.0f;
+        for (uint32 BlockBegin = Begin; BlockBegin < End; BlockBegin += MagnitudeBlockSize)
+        {
+            const uint32 Count = std::min(End - BlockBegin, MagnitudeBlockSize);
+            const float* Block = Data + static_cast<size_t>(BlockBegin) * Dimension;
+            if (Dimension == 3)
+            {
+                FVectorKernels::Length(
+                    TArrayView<const FVector>(reinterpret_cast<const FVector*>(Block), Count),
+                    TArrayView<float>(Buffer, Count));
+            }
+            else
+            {
+                for (uint32 i = 0; i < Count; ++i)
+                {
+                    float SquaredSum = 0.0f;
+                    for (uint32 c = 0; c < Dimension; ++c)
+                    {
+                        const float Value = Block[i * Dimension + c];
+                        SquaredSum += Value * Value;
+                    }
+                    Buffer[i] = SquaredSum;
+                }
+            }
+
+            float BlockMin = 0.0f;
+            float BlockMax = 0.0f;
+            FVectorKernels::ComputeComponentBounds(TArrayView<const float>(Buffer, Count), 1, &BlockMin, &BlockMax);
+            if (Dimension != 3)
+            {
+                BlockMin = std::sqrt(BlockMin);
+                BlockMax = std::sqrt(BlockMax);
+            }
+            OutMin = std::min(OutMin, BlockMin);
+            OutMax = std::max(OutMax, BlockMax);
+        }
+    }
+
+    /**
+     * 计算 [Begin, End) 区间内元素的数据范围
+     * @param OutPartial 输出每个分量的 [Min, Max]，最后一对为模长范围（(Dimension + 1) * 2 个）
+     */
+    void ComputePartialRange(const float* Data, uint32 Dimension, uint32 Begin, uint32 End, float* OutPartial)
+    {
+        TArray<float> ComponentMin;
+        TArray<float> ComponentMax;
+        ComponentMin.Resize(Dimension);
+        ComponentMax.Resize(Dimension);
+        FVectorKernels::ComputeComponentBounds(
+            TArrayView<const float>(Data + static_cast<size_t>(Begin) * Dimension, (End - Begin) * Dimension),
+            Dimension, ComponentMin.GetData(), ComponentMax.GetData());
+        for (uint32 c = 0; c < Dimension; ++c)
+        {
+            OutPartial[c * 2] = ComponentMin[c];
+            OutPartial[c * 2 + 1] = ComponentMax[c];
+        }
+        ComputeMagnitudeBounds(Data, Dimension, Begin, End, OutPartial[Dimension * 2], OutPartial[Dimension * 2 + 1]);
+    }
+}
+
+bool FField::GetDataRange(int32 Component, float& OutMin, float& OutMax) const
+{
+    if (Component != MagnitudeComponent && (Component < 0 || static_cast<uint32>(Component) >= FieldDimension))
+    {
+        return false;
+    }
+
+    const uint32 Slot = Component == MagnitudeComponent ? FieldDimension : static_cast<uint32>(Component);
+    uint64 ComputedVersion = 0;
+    {
+        std::lock_guard<std::mutex> Lock(DataRangeMutex);
+        if (bDataRangeValid.load(std::memory_order_acquire))
+        {
+            OutMin = DataRange[Slot * 2];
+            OutMax = DataRange[Slot * 2 + 1];
+            return true;
+        }
+        if (DataCount == 0 || FieldDimension == 0)
+        {
+            return false;
+        }
+        ComputedVersion = Version;
+    }
+
+    // 在锁外计算：并行归约的等待期间本线程可能执行其他任务，其中的查询会再次获取该锁
+    const TArray<float> Range = ComputeDataRange();
+
+    // 计算期间数据未变化时写入缓存（其他线程已写入时保留已有的结果）
+    std::lock_guard<std::mutex> Lock(DataRangeMutex);
+    if (!bDataRangeValid.load(std::memory_order_relaxed) && Version == ComputedVersion)
+    {
+        DataRange = Range;
+        bDataRangeValid.store(true, std::memory_order_release);
+    }
+    OutMin = Range[Slot * 2];
+    OutMax = Range[Slot * 2 + 1];
+    return true;
+}
+
+uint64 FField::AllocateVersion()
+{
+    // 全局递增，保证不同实例之间的版本号也不会重复
+    static std::atomic<uint64> GlobalVersion{0};
+    return ++GlobalVersion;
+}
+
+bool FField::IsDataRangeValid() const
+{
+    return bDataRangeValid.load(std::memory_order_acquire);
+}
+
+void FField::InvalidateDataRange()
+{
+    MarkModified();
+    bDataRangeValid.store(false, std::memory_order_release);
+}
+
+TArray<float> FField::ComputeDataRange() const
+{
+    const uint32 Dimension = FieldDimension;
+    const uint32 RangeSize = (Dimension + 1) * 2;
+
+    TArray<float> Identity;
+    Identity.Resize(RangeSize);
+    for (uint32 Slot = 0; Slot <= Dimension; ++Slot)
+    {
+        Identity[Slot * 2] = std::numeric_limits<float>::max();
+        Identity[Slot * 2 + 1] = -std::numeric_limits<float>::max();
+    }
+    auto Combine = [RangeSize](const TArray<float>& A, const TArray<float>& B)
+    {
+        TArray<float> Result;
+        Result.Resize(RangeSize);
+        for (uint32 i = 0; i < RangeSize; i += 2)
+        {
+            Result[i] = std::min(A[i], B[i]);
+            Result[i + 1] = std::max(A[i + 1], B[i + 1]);
+        }
+        return Result;
+    };
+
+    // 压缩的场逐块解码，不分配整个场的解压副本；每个区间的 float 数量同样保持在 DefaultReduceGrainSize 左右
+    if (CompressedData)
+    {
+        const uint32 BlockGrainSize = std::max(1u, DefaultReduceGrainSize / CompressedData->GetBlockValueCount());
+        return ParallelReduce(CompressedData->GetNumBlocks(), BlockGrainSize, Identity,
+            [&](uint32 Begin, uint32 End)
+            {
+                TArray<float> Partial = Identity;
+                TArray<float> BlockPartial;
+                BlockPartial.Resize(RangeSize);
+                TArray<float> Values;
+                for (uint32 Block = Begin; Block < End; ++Block)
+                {
+                    DecodeFloatBlock(Block, Values);
+                    ComputePartialRange(Values.GetData(), Dimension, 0, Values.Num() / Dimension, BlockPartial.GetData());
+                    Partial = Combine(Partial, BlockPartial);
+                }
+                return Partial;
+            },
+            Combine);
+    }
+
+    TArray<float> ConversionBuffer;
+    const float* RawData = GetFloatData(ConversionBuffer);
+
+    // 每个区间的 float 数量保持在 DefaultReduceGrainSize 左右，与维度无关
+    const uint32 GrainSize = std::max(1u, DefaultReduceGrainSize / Dimension);
+    return ParallelReduce(DataCount, GrainSize, Identity,
+        [&](uint32 Begin, uint32 End)
+        {
+            TArray<float> Partial;
+            Partial.Resize(RangeSize);
+            ComputePartialRange(RawData, Dimension, Begin, End, Partial.GetData());
+            return Partial;
+        },
+        Combine);
+}
+
+void FField::UpdateDataRange(const float* OldValue, const float* NewValue)
+{
+    // 缓存无效时无需维护，下次查询会重新计算
+    if (!bDataRangeValid.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> Lock(DataRangeMutex);
+    if (!bDataRangeValid.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    const uint32 Dimension = FieldDimension;
+    auto UpdateSlot = [this](uint32 Slot, const float* Old, float New)
+    {
+        float& Min = DataRange[Slot * 2];
+        float& Max = DataRange[Slot * 2 + 1];
+
+        // 旧值位于边界且向内移动时，无法得知新的边界，只能重新计算
+        if (Old && ((*Old == Min && New > Min) || (*Old == Max && New < Max)))
+        {
+            return false;
+        }
+        Min = std::min(Min, New);
+        Max = std::max(Max, New);
+        return true;
+    };
+
+    bool bUpdated = true;
+    for (uint32 c = 0; c < Dimension && bUpdated; ++c)
+    {
+        bUpdated = UpdateSlot(c, OldValue ? &OldValue[c] : nullptr, NewValue[c]);
+    }
+    if (bUpdated)
+    {
+        const float NewMagnitude = ComputeElementMagnitude(NewValue, Dimension);
+        if (OldValue)
+        {
+            const float OldMagnitude = ComputeElementMagnitude(OldValue, Dimension);
+            bUpdated = UpdateSlot(Dimension, &OldMagnitude, NewMagnitude);
+        }
+        else
+        {
+            bUpdated = UpdateSlot(Dimension, nullptr, NewMagnitude);
+        }
+    }
+
+    if (!bUpdated)
+    {
+        bDataRangeValid.store(false, std::memory_order_release);
+    }
 }
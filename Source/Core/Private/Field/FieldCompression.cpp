@@ -0,0 +1,356 @@
+#include "Field/FieldCompression.h"
+#include "Exception/Exception.h"
+#include "Threading/ParallelFor.h"
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    /** 块的编码方式（每个块的第一个字节） */
+    enum class EBlockEncoding : uint8
+    {
+        BytePlane = 0,
+        Quantized = 1,
+    };
+
+    /** 零游程编码中单个控制字节能表示的最大长度 */
+    constexpr uint32 MaxRunLength = 128;
+
+    /** 量化值的绝对值上限（保证差分不会溢出，且 double 能精确表示） */
+    constexpr double MaxQuantizedMagnitude = 4503599627370496.0; // 2^52
+
+    std::atomic<uint64> NextCompressedDataId{1};
+
+    // ============================================================================
+    // 零游程编码：控制字节 < 128 表示其后 (c + 1) 个原样字节，>= 128 表示 (c - 127) 个 0
+    // ============================================================================
+
+    void EncodeZeroRuns(const uint8* Bytes, uint32 Num, TArray<uint8>& Out)
+    {
+        uint32 i = 0;
+        while (i < Num)
+        {
+            if (Bytes[i] == 0)
+            {
+                uint32 Run = 1;
+                while (i + Run < Num && Run < MaxRunLength && Bytes[i + Run] == 0)
+                {
+                    ++Run;
+                }
+                Out.Add(static_cast<uint8>(127 + Run));
+                i += Run;
+                continue;
+            }
+
+            // 原样字节一直延续到出现至少两个连续的 0
+            uint32 Literal = 1;
+            while (i + Literal < Num && Literal < MaxRunLength &&
+                !(Bytes[i + Literal] == 0 && (i + Literal + 1 >= Num || Bytes[i + Literal + 1] == 0)))
+            {
+                ++Literal;
+            }
+            Out.Add(static_cast<uint8>(Literal - 1));
+            Out.Append(Bytes + i, Literal);
+            i += Literal;
+        }
+    }
+
+    const uint8* DecodeZeroRuns(const uint8* Stream, uint8* Bytes, uint32 Num)
+    {
+        uint32 i = 0;
+        while (i < Num)
+        {
+            const uint8 Control = *Stream++;
+            if (Control >= 128)
+            {
+                const uint32 Run = Control - 127u;
+                std::memset(Bytes + i, 0, Run);
+                i += Run;
+            }
+            else
+            {
+                const uint32 Literal = Control + 1u;
+                std::memcpy(Bytes + i, Stream, Literal);
+                Stream += Literal;
+                i += Literal;
+            }
+        }
+        return Stream;
+    }
+
+    // ============================================================================
+    // 无损编码：同分量相邻值按位异或，拆分为字节平面后做零游程编码
+    // 平滑数据的符号位、指数位和高位尾数在异或后大多为 0
+    // ============================================================================
+
+    void EncodeBytePlanes(const uint8* Values, uint32 Num, uint32 ValueSize, uint32 Dimension, TArray<uint8>& Out)
+    {
+        TArray<uint8> Plane;
+        Plane.Resize(Num);
+        for (uint32 Byte = 0; Byte < ValueSize; ++Byte)
+        {
+            for (uint32 i = 0; i < Num; ++i)
+            {
+                const uint8 Previous = i >= Dimension ? Values[(i - Dimension) * ValueSize + Byte] : 0;
+                Plane[i] = Values[i * ValueSize + Byte] ^ Previous;
+            }
+            EncodeZeroRuns(Plane.GetData(), Num, Out);
+        }
+    }
+
+    void DecodeBytePlanes(const uint8* Stream, uint8* Values, uint32 Num, uint32 ValueSize, uint32 Dimension)
+    {
+        TArray<uint8> Plane;
+        Plane.Resize(Num);
+        for (uint32 Byte = 0; Byte < ValueSize; ++Byte)
+        {
+            Stream = DecodeZeroRuns(Stream, Plane.GetData(), Num);
+            for (uint32 i = 0; i < Num; ++i)
+            {
+                const uint8 Previous = i >= Dimension ? Values[(i - Dimension) * ValueSize + Byte] : 0;
+                Values[i * ValueSize + Byte] = Plane[i] ^ Previous;
+            }
+        }
+    }
+
+    // ============================================================================
+    // 有损编码：按 2 * ErrorBound 的步长量化，同分量差分后 zigzag + 变长整数编码
+    // ============================================================================
+
+    void WriteVarint(uint64 Value, TArray<uint8>& Out)
+    {
+        while (Value >= 0x80)
+        {
+            Out.Add(static_cast<uint8>(Value | 0x80));
+            Value >>= 7;
+        }
+        Out.Add(static_cast<uint8>(Value));
+    }
+
+    uint64 ReadVarint(const uint8*& Stream)
+    {
+        uint64 Value = 0;
+        uint32 Shift = 0;
+        uint8 Byte;
+        do
+        {
+            Byte = *Stream++;
+            Value |= static_cast<uint64>(Byte & 0x7F) << Shift;
+            Shift += 7;
+        } while (Byte & 0x80);
+        return Value;
+    }
+
+    /** 量化并编码，存在无法在误差界内表示的值时返回 false */
+    template<typename T>
+    bool EncodeQuantized(const T* Values, uint32 Num, uint32 Dimension, double ErrorBound, TArray<uint8>& Out)
+    {
+        const double Step = 2.0 * ErrorBound;
+        TArray<int64> Quantized;
+        Quantized.Resize(Num);
+        for (uint32 i = 0; i < Num; ++i)
+        {
+            const double Value = Values[i];
+            const double Scaled = Value / Step;
+            if (!std::isfinite(Scaled) || std::fabs(Scaled) >= MaxQuantizedMagnitude)
+            {
+                return false;
+            }
+            const int64 Q = std::llround(Scaled);
+            // 转换回存储类型时的舍入也必须在误差界内
+            if (std::fabs(static_cast<double>(static_cast<T>(static_cast<double>(Q) * Step)) - Value) > ErrorBound)
+            {
+                return false;
+            }
+            Quantized[i] = Q;
+        }
+
+        for (uint32 i = 0; i < Num; ++i)
+        {
+            const int64 Delta = Quantized[i] - (i >= Dimension ? Quantized[i - Dimension] : 0);
+            WriteVarint((static_cast<uint64>(Delta) << 1) ^ static_cast<uint64>(Delta >> 63), Out);
+        }
+        return true;
+    }
+
+    template<typename T>
+    void DecodeQuantized(const uint8* Stream, T* Values, uint32 Num, uint32 Dimension, double ErrorBound)
+    {
+        const double Step = 2.0 * ErrorBound;
+        TArray<int64> Quantized;
+        Quantized.Resize(Num);
+        for (uint32 i = 0; i < Num; ++i)
+        {
+            const uint64 ZigZag = ReadVarint(Stream);
+            const int64 Delta = static_cast<int64>(ZigZag >> 1) ^ -static_cast<int64>(ZigZag & 1);
+            Quantized[i] = Delta + (i >= Dimension ? Quantized[i - Dimension] : 0);
+            Values[i] = static_cast<T>(static_cast<double>(Quantized[i]) * Step);
+        }
+    }
+
+    /** 线程局部的最近解码块 */
+    struct FDecodedBlockCache
+    {
+        uint64 OwnerId = 0;
+        uint32 BlockIndex = 0;
+        TArray<uint8> Values;
+    };
+}
+
+// ============================================================================
+// 压缩
+// ============================================================================
+
+TSharedPtr<FCompressedFieldData> FCompressedFieldData::Compress(const void* Data, EFieldStorage Storage, uint32 NumValues, uint32 Dimension,
+    const FFieldCompressionOptions& Options)
+{
+    if (Dimension == 0 || NumValues % Dimension != 0)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "NumValues must be a multiple of Dimension");
+    }
+    if (Options.BlockElementCount == 0)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "BlockElementCount must be positive");
+    }
+    if (Options.Method == EFieldCompression::Lossy && !(Options.ErrorBound > 0.0))
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Lossy compression requires a positive ErrorBound");
+    }
+
+    TSharedPtr<FCompressedFieldData> Result = MakeShared<FCompressedFieldData>();
+    Result->Id = NextCompressedDataId.fetch_add(1, std::memory_order_relaxed);
+    Result->Storage = Storage;
+    Result->Method = Options.Method;
+    Result->ErrorBound = Options.Method == EFieldCompression::Lossy ? Options.ErrorBound : 0.0;
+    Result->NumValues = NumValues;
+    Result->Dimension = Dimension;
+    Result->BlockValueCount = Options.BlockElementCount * Dimension;
+
+    const uint32 NumBlocks = Result->GetNumBlocks();
+    const uint32 ValueSize = GetFieldStorageSize(Storage);
+    const bool bQuantize = Options.Method == EFieldCompression::Lossy &&
+        (Storage == EFieldStorage::Float32 || Storage == EFieldStorage::Float64);
+
+    // 各块独立编码后按顺序拼接
+    TArray<TArray<uint8>> Blocks;
+    Blocks.Resize(NumBlocks);
+    const FCompressedFieldData& Compressed = *Result;
+    ParallelForRange(NumBlocks, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Block = Begin; Block < End; ++Block)
+        {
+            const uint32 Num = Compressed.GetBlockNumValues(Block);
+            const uint8* Values = static_cast<const uint8*>(Data) + static_cast<size_t>(Block) * Compressed.BlockValueCount * ValueSize;
+            TArray<uint8>& Out = Blocks[Block];
+            Out.Reserve(Num * ValueSize / 2 + 1);
+
+            if (bQuantize)
+            {
+                Out.Add(static_cast<uint8>(EBlockEncoding::Quantized));
+                const bool bEncoded = Storage == EFieldStorage::Float32
+                    ? EncodeQuantized(reinterpret_cast<const float*>(Values), Num, Dimension, Compressed.ErrorBound, Out)
+                    : EncodeQuantized(reinterpret_cast<const double*>(Values), Num, Dimension, Compressed.ErrorBound, Out);
+                if (bEncoded)
+                {
+                    continue;
+                }
+                Out.Reset();
+            }
+            Out.Add(static_cast<uint8>(EBlockEncoding::BytePlane));
+            EncodeBytePlanes(Values, Num, ValueSize, Dimension, Out);
+        }
+    }, Options.bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+    Result->BlockOffsets.Resize(NumBlocks + 1);
+    uint64 Offset = 0;
+    for (uint32 Block = 0; Block < NumBlocks; ++Block)
+    {
+        Result->BlockOffsets[Block] = Offset;
+        Offset += Blocks[Block].Num();
+    }
+    Result->BlockOffsets[NumBlocks] = Offset;
+
+    Result->Stream.Reserve(static_cast<size_t>(Offset));
+    for (uint32 Block = 0; Block < NumBlocks; ++Block)
+    {
+        Result->Stream.Append(Blocks[Block]);
+    }
+    return Result;
+}
+
+// ============================================================================
+// 查询
+// ============================================================================
+
+uint32 FCompressedFieldData::GetNumBlocks() const
+{
+    return BlockValueCount == 0 ? 0 : (NumValues + BlockValueCount - 1) / BlockValueCount;
+}
+
+uint32 FCompressedFieldData::GetBlockNumValues(uint32 BlockIndex) const
+{
+    const uint32 First = BlockIndex * BlockValueCount;
+    return NumValues - First > BlockValueCount ? BlockValueCount : NumValues - First;
+}
+
+size_t FCompressedFieldData::GetCompressedSize() const
+{
+    return Stream.Num() + BlockOffsets.Num() * sizeof(uint64);
+}
+
+size_t FCompressedFieldData::GetUncompressedSize() const
+{
+    return static_cast<size_t>(NumValues) * GetFieldStorageSize(Storage);
+}
+
+// ============================================================================
+// 解码
+// ============================================================================
+
+void FCompressedFieldData::DecodeBlock(uint32 BlockIndex, void* OutValues) const
+{
+    const uint32 Num = GetBlockNumValues(BlockIndex);
+    const uint8* BlockStream = Stream.GetData() + BlockOffsets[BlockIndex];
+    const EBlockEncoding Encoding = static_cast<EBlockEncoding>(*BlockStream++);
+    if (Encoding == EBlockEncoding::Quantized)
+    {
+        if (Storage == EFieldStorage::Float32)
+        {
+            DecodeQuantized(BlockStream, static_cast<float*>(OutValues), Num, Dimension, ErrorBound);
+        }
+        else
+        {
+            DecodeQuantized(BlockStream, static_cast<double*>(OutValues), Num, Dimension, ErrorBound);
+        }
+        return;
+    }
+    DecodeBytePlanes(BlockStream, static_cast<uint8*>(OutValues), Num, GetFieldStorageSize(Storage), Dimension);
+}
+
+void FCompressedFieldData::Decode(void* OutValues, bool bParallel) const
+{
+    const size_t BlockBytes = static_cast<size_t>(BlockValueCount) * GetFieldStorageSize(Storage);
+    ParallelForRange(GetNumBlocks(), 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Block = Begin; Block < End; ++Block)
+        {
+            DecodeBlock(Block, static_cast<uint8*>(OutValues) + Block * BlockBytes);
+        }
+    }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+const void* FCompressedFieldData::GetValuePtr(uint32 ValueIndex) const
+{
+    thread_local FDecodedBlockCache Cache;
+
+    const uint32 Block = ValueIndex / BlockValueCount;
+    if (Cache.OwnerId != Id || Cache.BlockIndex != Block)
+    {
+        Cache.Values.Resize(BlockValueCount * GetFieldStorageSize(Storage));
+        DecodeBlock(Block, Cache.Values.GetData());
+        Cache.OwnerId = Id;
+        Cache.BlockIndex = Block;
+    }
+    return Cache.Values.GetData() + static_cast<size_t>(ValueIndex - Block * BlockValueCount) * GetFieldStorageSize(Storage);
+}
@@ -0,0 +1,218 @@
+#include "Field/FieldOperations.h"
+#include "Field/Field.h"
+#include "Exception/Exception.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    /** 逐元素运算的区间粒度（元素数量） */
+    constexpr uint32 ElementGrainSize = 16384;
+
+    /** 统计归约的区间粒度（元素数量），固定值保证结果与线程数无关 */
+    constexpr uint32 StatisticsGrainSize = 65536;
+
+    EParallelForFlags GetFlags(bool bParallel)
+    {
+        return bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+    }
+
+    void CheckTensorField(const FField& Field)
+    {
+        if (Field.GetFieldType() != EFieldType::Tensor)
+        {
+            THROW_EXCEPTION(FInvalidOperationException, "Not a Tensor Data");
+        }
+    }
+
+    /** 初始化输出场（保留已有名称，名称为空时使用 输入场名称 + 后缀） */
+    void InitializeOutput(const FField& Input, FField& OutField, EFieldType Type, const char* Suffix)
+    {
+        if (&Input == &OutField)
+        {
+            THROW_EXCEPTION(FInvalidArgumentException, "Output field must differ from input field");
+        }
+
+        const std::string Name = OutField.GetFieldName().empty() ? Input.GetFieldName() + Suffix : OutField.GetFieldName();
+        OutField.Initialize(Name, Type, Input.GetAttachment());
+        OutField.Resize(Input.GetDataCount());
+    }
+
+    /** 3x3 对称矩阵（由张量的对称部分得到） */
+    struct FSymmetricTensor
+    {
+        double XX, YY, ZZ, XY, YZ, ZX;
+
+        explicit FSymmetricTensor(const float* T)
+            : XX(T[0]), YY(T[4]), ZZ(T[8])
+            , XY(0.5 * (double(T[1]) + double(T[3])))
+            , YZ(0.5 * (double(T[5]) + double(T[7])))
+            , ZX(0.5 * (double(T[2]) + double(T[6])))
+        {
+        }
+    };
+
+    /** 单个分量区间的统计部分结果 */
+    struct FStatisticsPartial
+    {
+        TArray<float> Min;
+        TArray<float> Max;
+        TArray<double> Sum;
+    };
+}
+
+FFieldStatistics FFieldOperations::ComputeStatistics(const FField& Field, bool bParallel)
+{
+    FFieldStatistics Result;
+    const uint32 Count = Field.GetDataCount();
+    const uint32 Dimension = Field.GetFieldDimension();
+    if (Count == 0 || Dimension == 0)
+    {
+        return Result;
+    }
+
+    TArray<float> ConversionBuffer;
+    const float* Data = Field.GetFloatData(ConversionBuffer);
+    FStatisticsPartial Identity;
+    Identity.Min.Resize(Dimension, std::numeric_limits<float>::max());
+    Identity.Max.Resize(Dimension, std::numeric_limits<float>::lowest());
+    Identity.Sum.Resize(Dimension, 0.0);
+
+    const FStatisticsPartial Total = ParallelReduce<FStatisticsPartial>(Count, StatisticsGrainSize, Identity,
+        [&](uint32 Begin, uint32 End)
+        {
+            FStatisticsPartial Partial = Identity;
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                const float* Element = Data + static_cast<size_t>(i) * Dimension;
+                for (uint32 c = 0; c < Dimension; ++c)
+                {
+                    Partial.Min[c] = std::min(Partial.Min[c], Element[c]);
+                    Partial.Max[c] = std::max(Partial.Max[c], Element[c]);
+                    Partial.Sum[c] += Element[c];
+                }
+            }
+            return Partial;
+        },
+        [Dimension](const FStatisticsPartial& A, const FStatisticsPartial& B)
+        {
+            FStatisticsPartial Combined = A;
+            for (uint32 c = 0; c < Dimension; ++c)
+            {
+                Combined.Min[c] = std::min(A.Min[c], B.Min[c]);
+                Combined.Max[c] = std::max(A.Max[c], B.Max[c]);
+                Combined.Sum[c] = A.Sum[c] + B.Sum[c];
+            }
+            return Combined;
+        }, GetFlags(bParallel));
+
+    Result.Count = Count;
+    Result.Min = Total.Min;
+    Result.Max = Total.Max;
+    Result.Mean.Resize(Dimension);
+    for (uint32 c = 0; c < Dimension; ++c)
+    {
+        Result.Mean[c] = Total.Sum[c] / static_cast<double>(Count);
+    }
+    return Result;
+}
+
+void FFieldOperations::ComputeMagnitude(const FField& Field, FField& OutField, bool bParallel)
+{
+    InitializeOutput(Field, OutField, EFieldType::Scalar, "_Magnitude");
+
+    const uint32 Dimension = Field.GetFieldDimension();
+    TArray<float> ConversionBuffer;
+    const float* Data = Field.GetFloatData(ConversionBuffer);
+    float* Out = OutField.GetFieldData().GetData();
+    ParallelForRange(Field.GetDataCount(), ElementGrainSize, [=](uint32 Begin, uint32 End)
+    {
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            const float* Element = Data + static_cast<size_t>(i) * Dimension;
+            float SumSquared = 0.0f;
+            for (uint32 c = 0; c < Dimension; ++c)
+            {
+                SumSquared += Element[c] * Element[c];
+            }
+            Out[i] = std::sqrt(SumSquared);
+        }
+    }, GetFlags(bParallel));
+}
+
+void FFieldOperations::ComputeVonMises(const FField& TensorField, FField& OutField, bool bParallel)
+{
+    CheckTensorField(TensorField);
+    InitializeOutput(TensorField, OutField, EFieldType::Scalar, "_VonMises");
+
+    TArray<float> ConversionBuffer;
+    const float* Data = TensorField.GetFloatData(ConversionBuffer);
+    float* Out = OutField.GetFieldData().GetData();
+    ParallelForRange(TensorField.GetDataCount(), ElementGrainSize, [=](uint32 Begin, uint32 End)
+    {
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            const FSymmetricTensor S(Data + static_cast<size_t>(i) * 9);
+            const double D0 = S.XX - S.YY;
+            const double D1 = S.YY - S.ZZ;
+            const double D2 = S.ZZ - S.XX;
+            const double Shear = S.XY * S.XY + S.YZ * S.YZ + S.ZX * S.ZX;
+            Out[i] = static_cast<float>(std::sqrt(0.5 * (D0 * D0 + D1 * D1 + D2 * D2) + 3.0 * Shear));
+        }
+    }, GetFlags(bParallel));
+}
+
+void FFieldOperations::ComputePrincipalValues(const FField& TensorField, FField& OutField, bool bParallel)
+{
+    CheckTensorField(TensorField);
+    InitializeOutput(TensorField, OutField, EFieldType::Vector, "_Principal");
+
+    TArray<float> ConversionBuffer;
+    const float* Data = TensorField.GetFloatData(ConversionBuffer);
+    float* Out = OutField.GetFieldData().GetData();
+    ParallelForRange(TensorField.GetDataCount(), ElementGrainSize, [=](uint32 Begin, uint32 End)
+    {
+        constexpr double TwoThirdsPi = 2.0943951023931954923;
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            // 对称 3x3 矩阵特征值的三角函数解法
+            const FSymmetricTensor S(Data + static_cast<size_t>(i) * 9);
+            const double OffDiagonal = S.XY * S.XY + S.YZ * S.YZ + S.ZX * S.ZX;
+            const double Mean = (S.XX + S.YY + S.ZZ) / 3.0;
+            double E1, E2, E3;
+            if (OffDiagonal <= 0.0)
+            {
+                double Values[3] = { S.XX, S.YY, S.ZZ };
+                std::sort(Values, Values + 3);
+                E1 = Values[2];
+                E2 = Values[1];
+                E3 = Values[0];
+            }
+            else
+            {
+                const double AXX = S.XX - Mean;
+                const double AYY = S.YY - Mean;
+                const double AZZ = S.ZZ - Mean;
+                const double P = std::sqrt((AXX * AXX + AYY * AYY + AZZ * AZZ + 2.0 * OffDiagonal) / 6.0);
+
+                // B = (A - Mean * I) / P，R = det(B) / 2
+                const double Det = AXX * (AYY * AZZ - S.YZ * S.YZ)
+                                 - S.XY * (S.XY * AZZ - S.YZ * S.ZX)
+                                 + S.ZX * (S.XY * S.YZ - AYY * S.ZX);
+                const double R = std::clamp(Det / (2.0 * P * P * P), -1.0, 1.0);
+                const double Phi = std::acos(R) / 3.0;
+
+                E1 = Mean + 2.0 * P * std::cos(Phi);
+                E3 = Mean + 2.0 * P * std::cos(Phi + TwoThirdsPi);
+                E2 = 3.0 * Mean - E1 - E3;
+            }
+
+            float* Dest = Out + static_cast<size_t>(i) * 3;
+            Dest[0] = static_cast<float>(E1);
+            Dest[1] = static_cast<float>(E2);
+            Dest[2] = static_cast<float>(E3);
+        }
+    }, GetFlags(bParallel));
+}
@@ -0,0 +1,129 @@
+#include "HAL/MappedFile.h"
+#include "Exception/Exception.h"
+#include <algorithm>
+
+#if PLATFORM_WINDOWS
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+TSharedPtr<FMappedFile> FMappedFile::Open(const std::string& Path)
+{
+    TSharedPtr<FMappedFile> File(new FMappedFile());
+    File->Path = Path;
+
+#if PLATFORM_WINDOWS
+    HANDLE FileHandle = CreateFileA(Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (FileHandle == INVALID_HANDLE_VALUE)
+    {
+        THROW_EXCEPTION(FFileIOException, "Failed to open file: " + Path);
+    }
+    File->FileHandle = FileHandle;
+
+    LARGE_INTEGER FileSize;
+    if (!GetFileSizeEx(FileHandle, &FileSize))
+    {
+        THROW_EXCEPTION(FFileIOException, "Failed to query file size: " + Path);
+    }
+    File->Size = static_cast<uint64>(FileSize.QuadPart);
+    if (File->Size == 0)
+    {
+        return File;
+    }
+
+    HANDLE MappingHandle = CreateFileMappingA(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!MappingHandle)
+    {
+        THROW_EXCEPTION(FFileIOException, "Failed to map file: " + Path);
+    }
+    File->MappingHandle = MappingHandle;
+
+    File->Data = static_cast<const uint8*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (!File->Data)
+    {
+        THROW_EXCEPTION(FFileIOException, "Failed to map file: " + Path);
+    }
+#else
+    const int Descriptor = open(Path.c_str(), O_RDONLY);
+    if (Descriptor < 0)
+    {
+        THROW_EXCEPTION(FFileIOException, "Failed to open file: " + Path);
+    }
+
+    struct stat Status {};
+    if (fstat(Descriptor, &Status) != 0)
+    {
+        close(Descriptor);
+        THROW_EXCEPTION(FFileIOException, "Failed to query file size: " + Path);
+    }
+    File->Size = static_cast<uint64>(Status.st_size);
+    if (File->Size == 0)
+    {
+        close(Descriptor);
+        return File;
+    }
+
+    void* Mapped = mmap(nullptr, File->Size, PROT_READ, MAP_PRIVATE, Descriptor, 0);
+    // 映射建立后文件描述符不再需要
+    close(Descriptor);
+    if (Mapped == MAP_FAILED)
+    {
+        THROW_EXCEPTION(FFileIOException, "Failed to map file: " + Path);
+    }
+    File->Data = static_cast<const uint8*>(Mapped);
+#endif
+
+    return File;
+}
+
+void FMappedFile::Prefetch(uint64 Offset, uint64 Length) const
+{
+    if (!Data || Offset >= Size)
+    {
+        return;
+    }
+    Length = std::min(Length, Size - Offset);
+
+    // 预读只是提示，失败时由之后的访问按需换入，不报告错误
+#if PLATFORM_WINDOWS
+    WIN32_MEMORY_RANGE_ENTRY Range;
+    Range.VirtualAddress = const_cast<uint8*>(Data + Offset);
+    Range.NumberOfBytes = static_cast<SIZE_T>(Length);
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &Range, 0);
+#else
+    // madvise 要求起始地址按页对齐（映射首地址按页对齐）
+    const uint64 PageSize = static_cast<uint64>(sysconf(_SC_PAGESIZE));
+    const uint64 AlignedOffset = Offset / PageSize * PageSize;
+    madvise(const_cast<uint8*>(Data + AlignedOffset), static_cast<size_t>(Length + (Offset - AlignedOffset)), MADV_WILLNEED);
+#endif
+}
+
+FMappedFile::~FMappedFile()
+{
+#if PLATFORM_WINDOWS
+    if (Data)
+    {
+        UnmapViewOfFile(Data);
+    }
+    if (MappingHandle)
+    {
+        CloseHandle(MappingHandle);
+    }
+    if (FileHandle)
+    {
+        CloseHandle(FileHandle);
+    }
+#else
+    if (Data)
+    {
+        munmap(const_cast<uint8*>(Data), Size);
+    }
+#endif
+}
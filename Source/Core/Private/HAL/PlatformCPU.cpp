@@ -0,0 +1,57 @@
+#include "HAL/PlatformCPU.h"
+
+#if PLATFORM_CPU_X86_FAMILY && defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace
+{
+    struct FCPUFeatures
+    {
+        bool bSSE42 = false;
+        bool bAVX2 = false;
+
+        FCPUFeatures()
+        {
+#if PLATFORM_CPU_X86_FAMILY
+    #if defined(_MSC_VER)
+            int Info[4] = {};
+            __cpuid(Info, 0);
+            const int MaxLeaf = Info[0];
+
+            __cpuid(Info, 1);
+            bSSE42 = (Info[2] & (1 << 20)) != 0;
+            const bool bOSXSave = (Info[2] & (1 << 27)) != 0;
+            const bool bAVX = (Info[2] & (1 << 28)) != 0;
+            const bool bYmmEnabled = bOSXSave && (_xgetbv(0) & 0x6) == 0x6;
+
+            if (MaxLeaf >= 7 && bAVX && bYmmEnabled)
+            {
+                __cpuidex(Info, 7, 0);
+                bAVX2 = (Info[1] & (1 << 5)) != 0;
+            }
+    #else
+            __builtin_cpu_init();
+            bSSE42 = __builtin_cpu_supports("sse4.2");
+            bAVX2 = __builtin_cpu_supports("avx2");
+    #endif
+#endif
+        }
+    };
+
+    const FCPUFeatures& GetCPUFeatures()
+    {
+        static const FCPUFeatures Features;
+        return Features;
+    }
+}
+
+bool FPlatformCPU::HasSSE42()
+{
+    return GetCPUFeatures().bSSE42;
+}
+
+bool FPlatformCPU::HasAVX2()
+{
+    return GetCPUFeatures().bAVX2;
+}
@@ -0,0 +1,97 @@
+#include "Math/VectorArraySoA.h"
+#include "Threading/ParallelFor.h"
+
+namespace
+{
+    /** 并行转换时的区间粒度（元素数量） */
+    constexpr uint32 ConvertGrainSize = 65536;
+}
+
+// ============================================================================
+// 容量相关
+// ============================================================================
+
+void FVectorArraySoA::Resize(uint32 Count)
+{
+    X.Resize(Count);
+    Y.Resize(Count);
+    Z.Resize(Count);
+}
+
+void FVectorArraySoA::Reserve(uint32 Capacity)
+{
+    X.Reserve(Capacity);
+    Y.Reserve(Capacity);
+    Z.Reserve(Capacity);
+}
+
+void FVectorArraySoA::Reset()
+{
+    X.Reset();
+    Y.Reset();
+    Z.Reset();
+}
+
+void FVectorArraySoA::Shrink()
+{
+    X.Shrink();
+    Y.Shrink();
+    Z.Shrink();
+}
+
+// ============================================================================
+// 与 AoS 布局相互转换
+// ============================================================================
+
+void FVectorArraySoA::CopyFrom(const FVector* Source, uint32 Count, bool bParallel)
+{
+    Resize(Count);
+
+    float* OutX = X.GetData();
+    float* OutY = Y.GetData();
+    float* OutZ = Z.GetData();
+    ParallelForRange(Count, ConvertGrainSize, [=](uint32 Begin, uint32 End)
+    {
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            OutX[i] = Source[i].X;
+            OutY[i] = Source[i].Y;
+            OutZ[i] = Source[i].Z;
+        }
+    }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void FVectorArraySoA::Append(const FVector* Source, uint32 Count)
+{
+    const uint32 Start = Num();
+    Resize(Start + Count);
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        Set(Start + i, Source[i]);
+    }
+}
+
+void FVectorArraySoA::CopyTo(FVector* Dest, bool bParallel) const
+{
+    const float* InX = X.GetData();
+    const float* InY = Y.GetData();
+    const float* InZ = Z.GetData();
+    ParallelForRange(Num(), ConvertGrainSize, [=](uint32 Begin, uint32 End)
+    {
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            Dest[i] = FVector(InX[i], InY[i], InZ[i]);
+        }
+    }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void FVectorArraySoA::CopyTo(TArray<FVector>& OutArray, bool bParallel) const
+{
+    OutArray.Resize(Num());
+    CopyTo(OutArray.GetData(), bParallel);
+}
+
+uint64 FVectorArraySoA::GetMemoryUsage() const
+{
+    return (X.Capacity() + Y.Capacity() + Z.Capacity()) * sizeof(float);
+}
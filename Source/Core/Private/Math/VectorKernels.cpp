@@ -0,0 +1,328 @@
+#include "Math/VectorKernels.h"
+#include "Math/VectorArraySoA.h"
+#include "HAL/PlatformCPU.h"
+#include "Exception/Exception.h"
+#include "VectorKernelsImpl.h"
+#include <atomic>
+#include <bit>
+#include <limits>
+
+static_assert(sizeof(FVector) == sizeof(float) * 3, "FVector must be tightly packed for the AoS kernels");
+
+namespace
+{
+    ESimdLevel DetectSupportedLevel()
+    {
+        if (FPlatformCPU::HasAVX2() && GetAVX2VectorKernels() != nullptr)
+        {
+            return ESimdLevel::AVX2;
+        }
+        if (FPlatformCPU::HasSSE42() && GetSSE42VectorKernels() != nullptr)
+        {
+            return ESimdLevel::SSE42;
+        }
+        return ESimdLevel::Scalar;
+    }
+
+    std::atomic<ESimdLevel>& GetActiveLevelStorage()
+    {
+        static std::atomic<ESimdLevel> ActiveLevel{ FVectorKernels::GetSupportedLevel() };
+        return ActiveLevel;
+    }
+
+    const FVectorKernelTable& GetKernels()
+    {
+        switch (FVectorKernels::GetActiveLevel())
+        {
+            case ESimdLevel::AVX2: return *GetAVX2VectorKernels();
+            case ESimdLevel::SSE42: return *GetSSE42VectorKernels();
+            default: return VectorKernelsScalar::GetTable();
+        }
+    }
+
+    void CheckSameNum(uint32 Expected, uint32 Actual)
+    {
+        if (Expected != Actual)
+        {
+            THROW_EXCEPTION(FInvalidArgumentException, "Vector array sizes do not match");
+        }
+    }
+
+    float* AsFloats(FVector* Data) { return &Data->X; }
+    const float* AsFloats(const FVector* Data) { return &Data->X; }
+
+    // ============================================================================
+    // 标量模板实现（用于 FVector3d）
+    // ============================================================================
+
+    template<typename T>
+    bool ComputeBoundsScalar(TArrayView<const TVector<T>> Data, TVector<T>& OutMin, TVector<T>& OutMax)
+    {
+        if (Data.IsEmpty())
+        {
+            return false;
+        }
+
+        TVector<T> Min = Data[0];
+        TVector<T> Max = Data[0];
+        for (const TVector<T>& Value : Data)
+        {
+            for (uint32 Axis = 0; Axis < 3; ++Axis)
+            {
+                Min.XYZ[Axis] = Value.XYZ[Axis] < Min.XYZ[Axis] ? Value.XYZ[Axis] : Min.XYZ[Axis];
+                Max.XYZ[Axis] = Value.XYZ[Axis] > Max.XYZ[Axis] ? Value.XYZ[Axis] : Max.XYZ[Axis];
+            }
+        }
+        OutMin = Min;
+        OutMax = Max;
+        return true;
+    }
+}
+
+// ============================================================================
+// 指令集选择
+// ============================================================================
+
+ESimdLevel FVectorKernels::GetSupportedLevel()
+{
+    static const ESimdLevel SupportedLevel = DetectSupportedLevel();
+    return SupportedLevel;
+}
+
+ESimdLevel FVectorKernels::GetActiveLevel()
+{
+    return GetActiveLevelStorage().load(std::memory_order_relaxed);
+}
+
+ESimdLevel FVectorKernels::SetActiveLevel(ESimdLevel Level)
+{
+    const ESimdLevel Supported = GetSupportedLevel();
+    const ESimdLevel Actual = static_cast<uint8>(Level) > static_cast<uint8>(Supported) ? Supported : Level;
+    GetActiveLevelStorage().store(Actual, std::memory_order_relaxed);
+    return Actual;
+}
+
+// ============================================================================
+// FVector 数组（AoS）
+// ============================================================================
+
+void FVectorKernels::Translate(TArrayView<FVector> Data, const FVector& Offset)
+{
+    GetKernels().AoSTranslate(AsFloats(Data.GetData()), Data.Num(), Offset.XYZ);
+}
+
+void FVectorKernels::Scale(TArrayView<FVector> Data, float Scale)
+{
+    GetKernels().StreamMul(AsFloats(Data.GetData()), Data.Num() * 3, Scale);
+}
+
+void FVectorKernels::Scale(TArrayView<FVector> Data, const FVector& Scale)
+{
+    GetKernels().AoSScale(AsFloats(Data.GetData()), Data.Num(), Scale.XYZ);
+}
+
+void FVectorKernels::Dot(TArrayView<const FVector> A, TArrayView<const FVector> B, TArrayView<float> Out)
+{
+    CheckSameNum(A.Num(), B.Num());
+    CheckSameNum(A.Num(), Out.Num());
+    GetKernels().AoSDot(AsFloats(A.GetData()), AsFloats(B.GetData()), Out.GetData(), A.Num());
+}
+
+void FVectorKernels::Cross(TArrayView<const FVector> A, TArrayView<const FVector> B, TArrayView<FVector> Out)
+{
+    CheckSameNum(A.Num(), B.Num());
+    CheckSameNum(A.Num(), Out.Num());
+    GetKernels().AoSCross(AsFloats(A.GetData()), AsFloats(B.GetData()), AsFloats(Out.GetData()), A.Num());
+}
+
+void FVectorKernels::Length(TArrayView<const FVector> Data, TArrayView<float> Out)
+{
+    CheckSameNum(Data.Num(), Out.Num());
+    GetKernels().AoSLength(AsFloats(Data.GetData()), Out.GetData(), Data.Num());
+}
+
+void FVectorKernels::Normalize(TArrayView<FVector> Data)
+{
+    GetKernels().AoSNormalize(AsFloats(Data.GetData()), Data.Num());
+}
+
+bool FVectorKernels::ComputeBounds(TArrayView<const FVector> Data, FVector& OutMin, FVector& OutMax)
+{
+    if (Data.IsEmpty())
+    {
+        return false;
+    }
+
+    FVector Min(Data[0]);
+    FVector Max(Data[0]);
+    GetKernels().AoSBounds(AsFloats(Data.GetData()), Data.Num(), Min.XYZ, Max.XYZ);
+    OutMin = Min;
+    OutMax = Max;
+    return true;
+}
+
+// ============================================================================
+// 交错存储的多分量数据
+// ============================================================================
+
+bool FVectorKernels::ComputeComponentBounds(TArrayView<const float> Data, uint32 Dimension, float* OutMin, float* OutMax)
+{
+    if (Dimension == 0 || Data.Num() < Dimension)
+    {
+        return false;
+    }
+    if (Data.Num() % Dimension != 0)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Data size must be a multiple of Dimension");
+    }
+
+    for (uint32 c = 0; c < Dimension; ++c)
+    {
+        OutMin[c] = OutMax[c] = Data[c];
+    }
+    GetKernels().StridedMinMax(Data.GetData(), Data.Num() / Dimension, Dimension, OutMin, OutMax);
+    return true;
+}
+
+uint32 FVectorKernels::RangeMask(TArrayView<const float> Data, float Min, float Max, TArrayView<uint64> OutBits)
+{
+    CheckSameNum((Data.Num() + 63) / 64, OutBits.Num());
+    GetKernels().StreamRangeMask(Data.GetData(), Data.Num(), Min, Max, OutBits.GetData());
+
+    uint32 Count = 0;
+    for (const uint64 Bits : OutBits)
+    {
+        Count += static_cast<uint32>(std::popcount(Bits));
+    }
+    return Count;
+}
+
+// ============================================================================
+// FVector3d 数组（AoS，标量实现）
+// ============================================================================
+
+void FVectorKernels::Translate(TArrayView<FVector3d> Data, const FVector3d& Offset)
+{
+    for (FVector3d& Value : Data)
+    {
+        Value += Offset;
+    }
+}
+
+void FVectorKernels::Scale(TArrayView<FVector3d> Data, double Scale)
+{
+    for (FVector3d& Value : Data)
+    {
+        Value *= Scale;
+    }
+}
+
+void FVectorKernels::Scale(TArrayView<FVector3d> Data, const FVector3d& Scale)
+{
+    for (FVector3d& Value : Data)
+    {
+        Value.X *= Scale.X;
+        Value.Y *= Scale.Y;
+        Value.Z *= Scale.Z;
+    }
+}
+
+void FVectorKernels::Dot(TArrayView<const FVector3d> A, TArrayView<const FVector3d> B, TArrayView<double> Out)
+{
+    CheckSameNum(A.Num(), B.Num());
+    CheckSameNum(A.Num(), Out.Num());
+    for (uint32 i = 0; i < A.Num(); ++i)
+    {
+        Out[i] = A[i].Dot(B[i]);
+    }
+}
+
+void FVectorKernels::Cross(TArrayView<const FVector3d> A, TArrayView<const FVector3d> B, TArrayView<FVector3d> Out)
+{
+    CheckSameNum(A.Num(), B.Num());
+    CheckSameNum(A.Num(), Out.Num());
+    for (uint32 i = 0; i < A.Num(); ++i)
+    {
+        Out[i] = A[i].Cross(B[i]);
+    }
+}
+
+void FVectorKernels::Length(TArrayView<const FVector3d> Data, TArrayView<double> Out)
+{
+    CheckSameNum(Data.Num(), Out.Num());
+    for (uint32 i = 0; i < Data.Num(); ++i)
+    {
+        Out[i] = Data[i].Size();
+    }
+}
+
+void FVectorKernels::Normalize(TArrayView<FVector3d> Data)
+{
+    for (FVector3d& Value : Data)
+    {
+        Value.Normalize();
+    }
+}
+
+bool FVectorKernels::ComputeBounds(TArrayView<const FVector3d> Data, FVector3d& OutMin, FVector3d& OutMax)
+{
+    return ComputeBoundsScalar(Data, OutMin, OutMax);
+}
+
+// ============================================================================
+// FVectorArraySoA
+// ============================================================================
+
+void FVectorKernels::Translate(FVectorArraySoA& Data, const FVector& Offset)
+{
+    const FVectorKernelTable& Kernels = GetKernels();
+    Kernels.StreamAdd(Data.GetX(), Data.Num(), Offset.X);
+    Kernels.StreamAdd(Data.GetY(), Data.Num(), Offset.Y);
+    Kernels.StreamAdd(Data.GetZ(), Data.Num(), Offset.Z);
+}
+
+void FVectorKernels::Scale(FVectorArraySoA& Data, float Scale)
+{
+    FVectorKernels::Scale(Data, FVector(Scale));
+}
+
+void FVectorKernels::Scale(FVectorArraySoA& Data, const FVector& Scale)
+{
+    const FVectorKernelTable& Kernels = GetKernels();
+    Kernels.StreamMul(Data.GetX(), Data.Num(), Scale.X);
+    Kernels.StreamMul(Data.GetY(), Data.Num(), Scale.Y);
+    Kernels.StreamMul(Data.GetZ(), Data.Num(), Scale.Z);
+}
+
+void FVectorKernels::Dot(const FVectorArraySoA& A, const FVectorArraySoA& B, TArrayView<float> Out)
+{
+    CheckSameNum(A.Num(), B.Num());
+    CheckSameNum(A.Num(), Out.Num());
+    GetKernels().SoADot(A.GetX(), A.GetY(), A.GetZ(), B.GetX(), B.GetY(), B.GetZ(), Out.GetData(), A.Num());
+}
+
+void FVectorKernels::Length(const FVectorArraySoA& Data, TArrayView<float> Out)
+{
+    CheckSameNum(Data.Num(), Out.Num());
+    GetKernels().SoALength(Data.GetX(), Data.GetY(), Data.GetZ(), Out.GetData(), Data.Num());
+}
+
+void FVectorKernels::Normalize(FVectorArraySoA& Data)
+{
+    GetKernels().SoANormalize(Data.GetX(), Data.GetY(), Data.GetZ(), Data.Num());
+}
+
+bool FVectorKernels::ComputeBounds(const FVectorArraySoA& Data, FVector& OutMin, FVector& OutMax)
+{
+    if (Data.IsEmpty())
+    {
+        return false;
+    }
+
+    FVector Min = Data.Get(0);
+    FVector Max = Min;
+    GetKernels().SoABounds(Data.GetX(), Data.GetY(), Data.GetZ(), Data.Num(), Min.XYZ, Max.XYZ);
+    OutMin = Min;
+    OutMax = Max;
+    return true;
+}
@@ -0,0 +1,377 @@
+// AVX2 版本的向量批量内核
+// 此文件使用 -mavx2 编译，只能包含 VectorKernelsImpl.h 和指令集头文件（原因见 VectorKernelsImpl.h）
+
+#include "VectorKernelsImpl.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+
+#include <immintrin.h>
+
+namespace
+{
+    /**
+     * 8 个 AoS 向量（24 个 float）转置为 X/Y/Z 三个寄存器
+     * 先把两个 128 位通道重排为与 SSE 版本相同的 4 向量布局，再在通道内做相同的 shuffle
+     */
+    inline void LoadAoS8(const float* Data, __m256& OutX, __m256& OutY, __m256& OutZ)
+    {
+        const __m256 R0 = _mm256_loadu_ps(Data);
+        const __m256 R1 = _mm256_loadu_ps(Data + 8);
+        const __m256 R2 = _mm256_loadu_ps(Data + 16);
+        const __m256 A = _mm256_permute2f128_ps(R0, R1, 0x30);
+        const __m256 B = _mm256_permute2f128_ps(R0, R2, 0x21);
+        const __m256 C = _mm256_permute2f128_ps(R1, R2, 0x30);
+        OutX = _mm256_shuffle_ps(_mm256_shuffle_ps(A, A, _MM_SHUFFLE(3, 3, 0, 0)), _mm256_shuffle_ps(B, C, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        OutY = _mm256_shuffle_ps(_mm256_shuffle_ps(A, B, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(B, C, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        OutZ = _mm256_shuffle_ps(_mm256_shuffle_ps(A, B, _MM_SHUFFLE(1, 1, 2, 2)), _mm256_shuffle_ps(C, C, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    /** X/Y/Z 三个寄存器转置回 8 个 AoS 向量 */
+    inline void StoreAoS8(float* Data, __m256 X, __m256 Y, __m256 Z)
+    {
+        const __m256 A = _mm256_shuffle_ps(_mm256_shuffle_ps(X, Y, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_shuffle_ps(Z, X, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 B = _mm256_shuffle_ps(_mm256_shuffle_ps(Y, Z, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(X, Y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 C = _mm256_shuffle_ps(_mm256_shuffle_ps(Z, X, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(Y, Z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        _mm256_storeu_ps(Data, _mm256_permute2f128_ps(A, B, 0x20));
+        _mm256_storeu_ps(Data + 8, _mm256_permute2f128_ps(C, A, 0x30));
+        _mm256_storeu_ps(Data + 16, _mm256_permute2f128_ps(B, C, 0x31));
+    }
+
+    inline __m256 Length8(__m256 X, __m256 Y, __m256 Z)
+    {
+        return _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(X, X), _mm256_mul_ps(Y, Y)), _mm256_mul_ps(Z, Z)));
+    }
+
+    /** 长度大于容差时为 1 / Length，否则为 0 */
+    inline __m256 NormalizeScale8(__m256 Length)
+    {
+        const __m256 Mask = _mm256_cmp_ps(Length, _mm256_set1_ps(VectorKernelNormalizeTolerance), _CMP_GT_OQ);
+        return _mm256_and_ps(_mm256_div_ps(_mm256_set1_ps(1.0f), Length), Mask);
+    }
+
+    inline void ReduceBounds8(__m256 Min, __m256 Max, float& InOutMin, float& InOutMax)
+    {
+        alignas(32) float MinValues[8];
+        alignas(32) float MaxValues[8];
+        _mm256_store_ps(MinValues, Min);
+        _mm256_store_ps(MaxValues, Max);
+        for (int i = 0; i < 8; ++i)
+        {
+            InOutMin = MinValues[i] < InOutMin ? MinValues[i] : InOutMin;
+            InOutMax = MaxValues[i] > InOutMax ? MaxValues[i] : InOutMax;
+        }
+    }
+
+    inline uint32 LeastCommonMultiple(uint32 A, uint32 B)
+    {
+        uint32 X = A, Y = B;
+        while (Y != 0)
+        {
+            const uint32 T = X % Y;
+            X = Y;
+            Y = T;
+        }
+        return X == 0 ? 0 : A / X * B;
+    }
+
+    // ============================================================================
+    // 单个分量流
+    // ============================================================================
+
+    void StreamAdd(float* Data, uint32 Count, float Value)
+    {
+        const __m256 V = _mm256_set1_ps(Value);
+        uint32 i = 0;
+        for (; i + 8 <= Count; i += 8)
+        {
+            _mm256_storeu_ps(Data + i, _mm256_add_ps(_mm256_loadu_ps(Data + i), V));
+        }
+        VectorKernelsScalar::StreamAdd(Data + i, Count - i, Value);
+    }
+
+    void StreamMul(float* Data, uint32 Count, float Value)
+    {
+        const __m256 V = _mm256_set1_ps(Value);
+        uint32 i = 0;
+        for (; i + 8 <= Count; i += 8)
+        {
+            _mm256_storeu_ps(Data + i, _mm256_mul_ps(_mm256_loadu_ps(Data + i), V));
+        }
+        VectorKernelsScalar::StreamMul(Data + i, Count - i, Value);
+    }
+
+    void StridedMinMax(const float* Data, uint32 Count, uint32 Dimension, float* InOutMin, float* InOutMax)
+    {
+        // 每块 LCM(Dimension, 8) 个 float，寄存器 r 的通道 l 对应分量 (r * 8 + l) % Dimension
+        if (Dimension == 0)
+        {
+            return;
+        }
+
+        const uint32 BlockFloats = LeastCommonMultiple(Dimension, 8);
+        const uint32 NumRegisters = BlockFloats / 8;
+        const uint32 BlockElements = BlockFloats / Dimension;
+        if (NumRegisters > VectorKernelMaxStridedRegisters || Count < BlockElements)
+        {
+            VectorKernelsScalar::StridedMinMax(Data, Count, Dimension, InOutMin, InOutMax);
+            return;
+        }
+
+        __m256 Min[VectorKernelMaxStridedRegisters];
+        __m256 Max[VectorKernelMaxStridedRegisters];
+        for (uint32 r = 0; r < NumRegisters; ++r)
+        {
+            Min[r] = Max[r] = _mm256_loadu_ps(Data + r * 8);
+        }
+
+        const uint32 NumBlocks = Count / BlockElements;
+        for (uint32 Block = 1; Block < NumBlocks; ++Block)
+        {
+            const float* BlockData = Data + static_cast<size_t>(Block) * BlockFloats;
+            for (uint32 r = 0; r < NumRegisters; ++r)
+            {
+                const __m256 V = _mm256_loadu_ps(BlockData + r * 8);
+                Min[r] = _mm256_min_ps(Min[r], V);
+                Max[r] = _mm256_max_ps(Max[r], V);
+            }
+        }
+
+        alignas(32) float MinValues[8];
+        alignas(32) float MaxValues[8];
+        for (uint32 r = 0; r < NumRegisters; ++r)
+        {
+            _mm256_store_ps(MinValues, Min[r]);
+            _mm256_store_ps(MaxValues, Max[r]);
+            for (uint32 l = 0; l < 8; ++l)
+            {
+                const uint32 c = (r * 8 + l) % Dimension;
+                InOutMin[c] = MinValues[l] < InOutMin[c] ? MinValues[l] : InOutMin[c];
+                InOutMax[c] = MaxValues[l] > InOutMax[c] ? MaxValues[l] : InOutMax[c];
+            }
+        }
+
+        const uint32 Processed = NumBlocks * BlockElements;
+        VectorKernelsScalar::StridedMinMax(Data + static_cast<size_t>(Processed) * Dimension, Count - Processed, Dimension, InOutMin, InOutMax);
+    }
+
+    void StreamRangeMask(const float* Data, uint32 Count, float Min, float Max, uint64* OutBits)
+    {
+        // 每个字 64 个元素，每次比较 8 个，比较结果的符号位经 movemask 拼接为位图
+        const __m256 VMin = _mm256_set1_ps(Min);
+        const __m256 VMax = _mm256_set1_ps(Max);
+        uint32 i = 0;
+        for (; i + 64 <= Count; i += 64)
+        {
+            uint64 Bits = 0;
+            for (uint32 j = 0; j < 64; j += 8)
+            {
+                const __m256 V = _mm256_loadu_ps(Data + i + j);
+                const __m256 Mask = _mm256_and_ps(_mm256_cmp_ps(V, VMin, _CMP_GE_OQ), _mm256_cmp_ps(V, VMax, _CMP_LE_OQ));
+                Bits |= static_cast<uint64>(static_cast<uint32>(_mm256_movemask_ps(Mask))) << j;
+            }
+            OutBits[i / 64] = Bits;
+        }
+        VectorKernelsScalar::StreamRangeMask(Data + i, Count - i, Min, Max, OutBits + i / 64);
+    }
+
+    // ============================================================================
+    // AoS
+    // ============================================================================
+
+    void AoSTranslate(float* Data, uint32 Num, const float* Offset)
+    {
+        // 24 个 float 一组，偏移量按 x y z 循环排列
+        const float X = Offset[0], Y = Offset[1], Z = Offset[2];
+        const __m256 P0 = _mm256_setr_ps(X, Y, Z, X, Y, Z, X, Y);
+        const __m256 P1 = _mm256_setr_ps(Z, X, Y, Z, X, Y, Z, X);
+        const __m256 P2 = _mm256_setr_ps(Y, Z, X, Y, Z, X, Y, Z);
+        uint32 i = 0;
+        for (; i + 8 <= Num; i += 8)
+        {
+            float* Block = Data + i * 3;
+            _mm256_storeu_ps(Block, _mm256_add_ps(_mm256_loadu_ps(Block), P0));
+            _mm256_storeu_ps(Block + 8, _mm256_add_ps(_mm256_loadu_ps(Block + 8), P1));
+            _mm256_storeu_ps(Block + 16, _mm256_add_ps(_mm256_loadu_ps(Block + 16), P2));
+        }
+        VectorKernelsScalar::AoSTranslate(Data + i * 3, Num - i, Offset);
+    }
+
+    void AoSScale(float* Data, uint32 Num, const float* Scale)
+    {
+        const float X = Scale[0], Y = Scale[1], Z = Scale[2];
+        const __m256 P0 = _mm256_setr_ps(X, Y, Z, X, Y, Z, X, Y);
+        const __m256 P1 = _mm256_setr_ps(Z, X, Y, Z, X, Y, Z, X);
+        const __m256 P2 = _mm256_setr_ps(Y, Z, X, Y, Z, X, Y, Z);
+        uint32 i = 0;
+        for (; i + 8 <= Num; i += 8)
+        {
+            float* Block = Data + i * 3;
+            _mm256_storeu_ps(Block, _mm256_mul_ps(_mm256_loadu_ps(Block), P0));
+            _mm256_storeu_ps(Block + 8, _mm256_mul_ps(_mm256_loadu_ps(Block + 8), P1));
+            _mm256_storeu_ps(Block + 16, _mm256_mul_ps(_mm256_loadu_ps(Block + 16), P2));
+        }
+        VectorKernelsScalar::AoSScale(Data + i * 3, Num - i, Scale);
+    }
+
+    void AoSDot(const float* A, const float* B, float* Out, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 8 <= Num; i += 8)
+        {
+            __m256 AX, AY, AZ, BX, BY, BZ;
+            LoadAoS8(A + i * 3, AX, AY, AZ);
+            LoadAoS8(B + i * 3, BX, BY, BZ);
+            _mm256_storeu_ps(Out + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(AX, BX), _mm256_mul_ps(AY, BY)), _mm256_mul_ps(AZ, BZ)));
+        }
+        VectorKernelsScalar::AoSDot(A + i * 3, B + i * 3, Out + i, Num - i);
+    }
+
+    void AoSCross(const float* A, const float* B, float* Out, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 8 <= Num; i += 8)
+        {
+            __m256 AX, AY, AZ, BX, BY, BZ;
+            LoadAoS8(A + i * 3, AX, AY, AZ);
+            LoadAoS8(B + i * 3, BX, BY, BZ);
+            const __m256 CX = _mm256_sub_ps(_mm256_mul_ps(AY, BZ), _mm256_mul_ps(AZ, BY));
+            const __m256 CY = _mm256_sub_ps(_mm256_mul_ps(AZ, BX), _mm256_mul_ps(AX, BZ));
+            const __m256 CZ = _mm256_sub_ps(_mm256_mul_ps(AX, BY), _mm256_mul_ps(AY, BX));
+            StoreAoS8(Out + i * 3, CX, CY, CZ);
+        }
+        VectorKernelsScalar::AoSCross(A + i * 3, B + i * 3, Out + i * 3, Num - i);
+    }
+
+    void AoSLength(const float* Data, float* Out, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 8 <= Num; i += 8)
+        {
+            __m256 X, Y, Z;
+            LoadAoS8(Data + i * 3, X, Y, Z);
+            _mm256_storeu_ps(Out + i, Length8(X, Y, Z));
+        }
+        VectorKernelsScalar::AoSLength(Data + i * 3, Out + i, Num - i);
+    }
+
+    void AoSNormalize(float* Data, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 8 <= Num; i += 8)
+        {
+            __m256 X, Y, Z;
+            LoadAoS8(Data + i * 3, X, Y, Z);
+            const __m256 Scale = NormalizeScale8(Length8(X, Y, Z));
+            StoreAoS8(Data + i * 3, _mm256_mul_ps(X, Scale), _mm256_mul_ps(Y, Scale), _mm256_mul_ps(Z, Scale));
+        }
+        VectorKernelsScalar::AoSNormalize(Data + i * 3, Num - i);
+    }
+
+    void AoSBounds(const float* Data, uint32 Num, float* InOutMin, float* InOutMax)
+    {
+        if (Num < 8)
+        {
+            VectorKernelsScalar::AoSBounds(Data, Num, InOutMin, InOutMax);
+            return;
+        }
+
+        __m256 MinX, MinY, MinZ;
+        LoadAoS8(Data, MinX, MinY, MinZ);
+        __m256 MaxX = MinX, MaxY = MinY, MaxZ = MinZ;
+        uint32 i = 8;
+        for (; i + 8 <= Num; i += 8)
+        {
+            __m256 X, Y, Z;
+            LoadAoS8(Data + i * 3, X, Y, Z);
+            MinX = _mm256_min_ps(MinX, X); MaxX = _mm256_max_ps(MaxX, X);
+            MinY = _mm256_min_ps(MinY, Y); MaxY = _mm256_max_ps(MaxY, Y);
+            MinZ = _mm256_min_ps(MinZ, Z); MaxZ = _mm256_max_ps(MaxZ, Z);
+        }
+        ReduceBounds8(MinX, MaxX, InOutMin[0], InOutMax[0]);
+        ReduceBounds8(MinY, MaxY, InOutMin[1], InOutMax[1]);
+        ReduceBounds8(MinZ, MaxZ, InOutMin[2], InOutMax[2]);
+        VectorKernelsScalar::AoSBounds(Data + i * 3, Num - i, InOutMin, InOutMax);
+    }
+
+    // ============================================================================
+    // SoA
+    // ============================================================================
+
+    void SoADot(const float* AX, const float* AY, const float* AZ, const float* BX, const float* BY, const float* BZ, float* Out, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 8 <= Num; i += 8)
+        {
+            const __m256 XX = _mm256_mul_ps(_mm256_loadu_ps(AX + i), _mm256_loadu_ps(BX + i));
+            const __m256 YY = _mm256_mul_ps(_mm256_loadu_ps(AY + i), _mm256_loadu_ps(BY + i));
+            const __m256 ZZ = _mm256_mul_ps(_mm256_loadu_ps(AZ + i), _mm256_loadu_ps(BZ + i));
+            _mm256_storeu_ps(Out + i, _mm256_add_ps(_mm256_add_ps(XX, YY), ZZ));
+        }
+        VectorKernelsScalar::SoADot(AX + i, AY + i, AZ + i, BX + i, BY + i, BZ + i, Out + i, Num - i);
+    }
+
+    void SoALength(const float* X, const float* Y, const float* Z, float* Out, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 8 <= Num; i += 8)
+        {
+            _mm256_storeu_ps(Out + i, Length8(_mm256_loadu_ps(X + i), _mm256_loadu_ps(Y + i), _mm256_loadu_ps(Z + i)));
+        }
+        VectorKernelsScalar::SoALength(X + i, Y + i, Z + i, Out + i, Num - i);
+    }
+
+    void SoANormalize(float* X, float* Y, float* Z, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 8 <= Num; i += 8)
+        {
+            const __m256 VX = _mm256_loadu_ps(X + i);
+            const __m256 VY = _mm256_loadu_ps(Y + i);
+            const __m256 VZ = _mm256_loadu_ps(Z + i);
+            const __m256 Scale = NormalizeScale8(Length8(VX, VY, VZ));
+            _mm256_storeu_ps(X + i, _mm256_mul_ps(VX, Scale));
+            _mm256_storeu_ps(Y + i, _mm256_mul_ps(VY, Scale));
+            _mm256_storeu_ps(Z + i, _mm256_mul_ps(VZ, Scale));
+        }
+        VectorKernelsScalar::SoANormalize(X + i, Y + i, Z + i, Num - i);
+    }
+
+    void SoABounds(const float* X, const float* Y, const float* Z, uint32 Num, float* InOutMin, float* InOutMax)
+    {
+        const float* Components[3] = { X, Y, Z };
+        const uint32 VectorNum = Num & ~7u;
+        for (uint32 Axis = 0; Axis < 3 && VectorNum > 0; ++Axis)
+        {
+            const float* Data = Components[Axis];
+            __m256 Min = _mm256_loadu_ps(Data);
+            __m256 Max = Min;
+            for (uint32 i = 8; i < VectorNum; i += 8)
+            {
+                const __m256 V = _mm256_loadu_ps(Data + i);
+                Min = _mm256_min_ps(Min, V);
+                Max = _mm256_max_ps(Max, V);
+            }
+            ReduceBounds8(Min, Max, InOutMin[Axis], InOutMax[Axis]);
+        }
+        VectorKernelsScalar::SoABounds(X + VectorNum, Y + VectorNum, Z + VectorNum, Num - VectorNum, InOutMin, InOutMax);
+    }
+}
+
+const FVectorKernelTable* GetAVX2VectorKernels()
+{
+    static const FVectorKernelTable Table = {
+        &StreamAdd, &StreamMul, &StridedMinMax, &StreamRangeMask,
+        &AoSTranslate, &AoSScale, &AoSDot, &AoSCross, &AoSLength, &AoSNormalize, &AoSBounds,
+        &SoADot, &SoALength, &SoANormalize, &SoABounds
+    };
+    return &Table;
+}
+
+#else
+
+const FVectorKernelTable* GetAVX2VectorKernels()
+{
+    return nullptr;
+}
+
+#endif
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "HAL/Platform.h"
+
+/**
+ * 向量批量内核的内部实现接口（仅供 VectorKernels*.cpp 使用）
+ * 
+ * 各指令集版本分别在独立的编译单元中实现（使用对应的编译选项），
+ * 由 FVectorKernels 在运行时根据 CPU 支持情况选择
+ * 
+ * 注意：使用特定指令集编译的文件不能包含带有内联函数或模板的头文件，
+ * 否则链接器可能选中使用高级指令集编译的版本，在不支持的 CPU 上崩溃
+ * 
+ * 所有 AoS 数据以 float 流的形式传入：[x0, y0, z0, x1, y1, z1, ...]
+ * StreamRangeMask 写入 ceil(Count / 64) 个字，Min <= Data[i] <= Max 时第 i 位为 1，最后一个字的多余位为 0
+ */
+struct FVectorKernelTable
+{
+    // 单个分量流
+    void (*StreamAdd)(float* Data, uint32 Count, float Value);
+    void (*StreamMul)(float* Data, uint32 Count, float Value);
+    void (*StridedMinMax)(const float* Data, uint32 Count, uint32 Dimension, float* InOutMin, float* InOutMax);
+    void (*StreamRangeMask)(const float* Data, uint32 Count, float Min, float Max, uint64* OutBits);
+
+    // AoS
+    void (*AoSTranslate)(float* Data, uint32 Num, const float* Offset);
+    void (*AoSScale)(float* Data, uint32 Num, const float* Scale);
+    void (*AoSDot)(const float* A, const float* B, float* Out, uint32 Num);
+    void (*AoSCross)(const float* A, const float* B, float* Out, uint32 Num);
+    void (*AoSLength)(const float* Data, float* Out, uint32 Num);
+    void (*AoSNormalize)(float* Data, uint32 Num);
+    void (*AoSBounds)(const float* Data, uint32 Num, float* InOutMin, float* InOutMax);
+
+    // SoA
+    void (*SoADot)(const float* AX, const float* AY, const float* AZ, const float* BX, const float* BY, const float* BZ, float* Out, uint32 Num);
+    void (*SoALength)(const float* X, const float* Y, const float* Z, float* Out, uint32 Num);
+    void (*SoANormalize)(float* X, float* Y, float* Z, uint32 Num);
+    void (*SoABounds)(const float* X, const float* Y, const float* Z, uint32 Num, float* InOutMin, float* InOutMax);
+};
+
+/**
+ * StridedMinMax 使用的寄存器块数量上限
+ * 每 LCM(Dimension, 寄存器宽度) 个 float 为一块，块内每个通道对应固定的分量，超过上限时使用标量实现
+ */
+constexpr uint32 VectorKernelMaxStridedRegisters = 16;
+
+/** 归一化时的长度容差（与 TVector::Normalize 默认值 std::numeric_limits<float>::epsilon() 一致） */
+constexpr float VectorKernelNormalizeTolerance = 1.1920928955078125e-7f;
+
+/**
+ * 标量实现（参考实现，同时用于 SIMD 版本处理尾部元素）
+ */
+namespace VectorKernelsScalar
+{
+    void StreamAdd(float* Data, uint32 Count, float Value);
+    void StreamMul(float* Data, uint32 Count, float Value);
+    void StridedMinMax(const float* Data, uint32 Count, uint32 Dimension, float* InOutMin, float* InOutMax);
+    void StreamRangeMask(const float* Data, uint32 Count, float Min, float Max, uint64* OutBits);
+    void AoSTranslate(float* Data, uint32 Num, const float* Offset);
+    void AoSScale(float* Data, uint32 Num, const float* Scale);
+    void AoSDot(const float* A, const float* B, float* Out, uint32 Num);
+    void AoSCross(const float* A, const float* B, float* Out, uint32 Num);
+    void AoSLength(const float* Data, float* Out, uint32 Num);
+    void AoSNormalize(float* Data, uint32 Num);
+    void AoSBounds(const float* Data, uint32 Num, float* InOutMin, float* InOutMax);
+    void SoADot(const float* AX, const float* AY, const float* AZ, const float* BX, const float* BY, const float* BZ, float* Out, uint32 Num);
+    void SoALength(const float* X, const float* Y, const float* Z, float* Out, uint32 Num);
+    void SoANormalize(float* X, float* Y, float* Z, uint32 Num);
+    void SoABounds(const float* X, const float* Y, const float* Z, uint32 Num, float* InOutMin, float* InOutMax);
+
+    const FVectorKernelTable& GetTable();
+}
+
+/** SSE4.2 实现，当前平台未编译时返回 nullptr */
+const FVectorKernelTable* GetSSE42VectorKernels();
+
+/** AVX2 实现，当前平台未编译时返回 nullptr */
+const FVectorKernelTable* GetAVX2VectorKernels();
@@ -0,0 +1,370 @@
+// SSE4.2 版本的向量批量内核
+// 此文件使用 -msse4.2 编译，只能包含 VectorKernelsImpl.h 和指令集头文件（原因见 VectorKernelsImpl.h）
+
+#include "VectorKernelsImpl.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+
+#include <nmmintrin.h>
+
+namespace
+{
+    /** 4 个 AoS 向量（12 个 float）转置为 X/Y/Z 三个寄存器 */
+    inline void LoadAoS4(const float* Data, __m128& OutX, __m128& OutY, __m128& OutZ)
+    {
+        // A = x0 y0 z0 x1, B = y1 z1 x2 y2, C = z2 x3 y3 z3
+        const __m128 A = _mm_loadu_ps(Data);
+        const __m128 B = _mm_loadu_ps(Data + 4);
+        const __m128 C = _mm_loadu_ps(Data + 8);
+        OutX = _mm_shuffle_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 3, 0, 0)), _mm_shuffle_ps(B, C, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        OutY = _mm_shuffle_ps(_mm_shuffle_ps(A, B, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(B, C, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        OutZ = _mm_shuffle_ps(_mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(C, C, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    /** X/Y/Z 三个寄存器转置回 4 个 AoS 向量 */
+    inline void StoreAoS4(float* Data, __m128 X, __m128 Y, __m128 Z)
+    {
+        const __m128 A = _mm_shuffle_ps(_mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(Z, X, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 B = _mm_shuffle_ps(_mm_shuffle_ps(Y, Z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(X, Y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 C = _mm_shuffle_ps(_mm_shuffle_ps(Z, X, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(Y, Z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        _mm_storeu_ps(Data, A);
+        _mm_storeu_ps(Data + 4, B);
+        _mm_storeu_ps(Data + 8, C);
+    }
+
+    inline __m128 Length4(__m128 X, __m128 Y, __m128 Z)
+    {
+        return _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(X, X), _mm_mul_ps(Y, Y)), _mm_mul_ps(Z, Z)));
+    }
+
+    /** 长度大于容差时为 1 / Length，否则为 0 */
+    inline __m128 NormalizeScale4(__m128 Length)
+    {
+        const __m128 Mask = _mm_cmpgt_ps(Length, _mm_set1_ps(VectorKernelNormalizeTolerance));
+        return _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.0f), Length), Mask);
+    }
+
+    inline void ReduceBounds4(__m128 Min, __m128 Max, float& InOutMin, float& InOutMax)
+    {
+        alignas(16) float MinValues[4];
+        alignas(16) float MaxValues[4];
+        _mm_store_ps(MinValues, Min);
+        _mm_store_ps(MaxValues, Max);
+        for (int i = 0; i < 4; ++i)
+        {
+            InOutMin = MinValues[i] < InOutMin ? MinValues[i] : InOutMin;
+            InOutMax = MaxValues[i] > InOutMax ? MaxValues[i] : InOutMax;
+        }
+    }
+
+    inline uint32 LeastCommonMultiple(uint32 A, uint32 B)
+    {
+        uint32 X = A, Y = B;
+        while (Y != 0)
+        {
+            const uint32 T = X % Y;
+            X = Y;
+            Y = T;
+        }
+        return X == 0 ? 0 : A / X * B;
+    }
+
+    // ============================================================================
+    // 单个分量流
+    // ============================================================================
+
+    void StreamAdd(float* Data, uint32 Count, float Value)
+    {
+        const __m128 V = _mm_set1_ps(Value);
+        uint32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            _mm_storeu_ps(Data + i, _mm_add_ps(_mm_loadu_ps(Data + i), V));
+        }
+        VectorKernelsScalar::StreamAdd(Data + i, Count - i, Value);
+    }
+
+    void StreamMul(float* Data, uint32 Count, float Value)
+    {
+        const __m128 V = _mm_set1_ps(Value);
+        uint32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            _mm_storeu_ps(Data + i, _mm_mul_ps(_mm_loadu_ps(Data + i), V));
+        }
+        VectorKernelsScalar::StreamMul(Data + i, Count - i, Value);
+    }
+
+    void StridedMinMax(const float* Data, uint32 Count, uint32 Dimension, float* InOutMin, float* InOutMax)
+    {
+        // 每块 LCM(Dimension, 4) 个 float，寄存器 r 的通道 l 对应分量 (r * 4 + l) % Dimension
+        if (Dimension == 0)
+        {
+            return;
+        }
+
+        const uint32 BlockFloats = LeastCommonMultiple(Dimension, 4);
+        const uint32 NumRegisters = BlockFloats / 4;
+        const uint32 BlockElements = BlockFloats / Dimension;
+        if (NumRegisters > VectorKernelMaxStridedRegisters || Count < BlockElements)
+        {
+            VectorKernelsScalar::StridedMinMax(Data, Count, Dimension, InOutMin, InOutMax);
+            return;
+        }
+
+        __m128 Min[VectorKernelMaxStridedRegisters];
+        __m128 Max[VectorKernelMaxStridedRegisters];
+        for (uint32 r = 0; r < NumRegisters; ++r)
+        {
+            Min[r] = Max[r] = _mm_loadu_ps(Data + r * 4);
+        }
+
+        const uint32 NumBlocks = Count / BlockElements;
+        for (uint32 Block = 1; Block < NumBlocks; ++Block)
+        {
+            const float* BlockData = Data + static_cast<size_t>(Block) * BlockFloats;
+            for (uint32 r = 0; r < NumRegisters; ++r)
+            {
+                const __m128 V = _mm_loadu_ps(BlockData + r * 4);
+                Min[r] = _mm_min_ps(Min[r], V);
+                Max[r] = _mm_max_ps(Max[r], V);
+            }
+        }
+
+        alignas(32) float MinValues[4];
+        alignas(32) float MaxValues[4];
+        for (uint32 r = 0; r < NumRegisters; ++r)
+        {
+            _mm_store_ps(MinValues, Min[r]);
+            _mm_store_ps(MaxValues, Max[r]);
+            for (uint32 l = 0; l < 4; ++l)
+            {
+                const uint32 c = (r * 4 + l) % Dimension;
+                InOutMin[c] = MinValues[l] < InOutMin[c] ? MinValues[l] : InOutMin[c];
+                InOutMax[c] = MaxValues[l] > InOutMax[c] ? MaxValues[l] : InOutMax[c];
+            }
+        }
+
+        const uint32 Processed = NumBlocks * BlockElements;
+        VectorKernelsScalar::StridedMinMax(Data + static_cast<size_t>(Processed) * Dimension, Count - Processed, Dimension, InOutMin, InOutMax);
+    }
+
+    void StreamRangeMask(const float* Data, uint32 Count, float Min, float Max, uint64* OutBits)
+    {
+        // 每个字 64 个元素，每次比较 4 个，比较结果的符号位经 movemask 拼接为位图
+        const __m128 VMin = _mm_set1_ps(Min);
+        const __m128 VMax = _mm_set1_ps(Max);
+        uint32 i = 0;
+        for (; i + 64 <= Count; i += 64)
+        {
+            uint64 Bits = 0;
+            for (uint32 j = 0; j < 64; j += 4)
+            {
+                const __m128 V = _mm_loadu_ps(Data + i + j);
+                const __m128 Mask = _mm_and_ps(_mm_cmpge_ps(V, VMin), _mm_cmple_ps(V, VMax));
+                Bits |= static_cast<uint64>(static_cast<uint32>(_mm_movemask_ps(Mask))) << j;
+            }
+            OutBits[i / 64] = Bits;
+        }
+        VectorKernelsScalar::StreamRangeMask(Data + i, Count - i, Min, Max, OutBits + i / 64);
+    }
+
+    // ============================================================================
+    // AoS
+    // ============================================================================
+
+    void AoSTranslate(float* Data, uint32 Num, const float* Offset)
+    {
+        // 12 个 float 一组，偏移量按 x y z 循环排列
+        const __m128 P0 = _mm_setr_ps(Offset[0], Offset[1], Offset[2], Offset[0]);
+        const __m128 P1 = _mm_setr_ps(Offset[1], Offset[2], Offset[0], Offset[1]);
+        const __m128 P2 = _mm_setr_ps(Offset[2], Offset[0], Offset[1], Offset[2]);
+        uint32 i = 0;
+        for (; i + 4 <= Num; i += 4)
+        {
+            float* Block = Data + i * 3;
+            _mm_storeu_ps(Block, _mm_add_ps(_mm_loadu_ps(Block), P0));
+            _mm_storeu_ps(Block + 4, _mm_add_ps(_mm_loadu_ps(Block + 4), P1));
+            _mm_storeu_ps(Block + 8, _mm_add_ps(_mm_loadu_ps(Block + 8), P2));
+        }
+        VectorKernelsScalar::AoSTranslate(Data + i * 3, Num - i, Offset);
+    }
+
+    void AoSScale(float* Data, uint32 Num, const float* Scale)
+    {
+        const __m128 P0 = _mm_setr_ps(Scale[0], Scale[1], Scale[2], Scale[0]);
+        const __m128 P1 = _mm_setr_ps(Scale[1], Scale[2], Scale[0], Scale[1]);
+        const __m128 P2 = _mm_setr_ps(Scale[2], Scale[0], Scale[1], Scale[2]);
+        uint32 i = 0;
+        for (; i + 4 <= Num; i += 4)
+        {
+            float* Block = Data + i * 3;
+            _mm_storeu_ps(Block, _mm_mul_ps(_mm_loadu_ps(Block), P0));
+            _mm_storeu_ps(Block + 4, _mm_mul_ps(_mm_loadu_ps(Block + 4), P1));
+            _mm_storeu_ps(Block + 8, _mm_mul_ps(_mm_loadu_ps(Block + 8), P2));
+        }
+        VectorKernelsScalar::AoSScale(Data + i * 3, Num - i, Scale);
+    }
+
+    void AoSDot(const float* A, const float* B, float* Out, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 4 <= Num; i += 4)
+        {
+            __m128 AX, AY, AZ, BX, BY, BZ;
+            LoadAoS4(A + i * 3, AX, AY, AZ);
+            LoadAoS4(B + i * 3, BX, BY, BZ);
+            _mm_storeu_ps(Out + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(AX, BX), _mm_mul_ps(AY, BY)), _mm_mul_ps(AZ, BZ)));
+        }
+        VectorKernelsScalar::AoSDot(A + i * 3, B + i * 3, Out + i, Num - i);
+    }
+
+    void AoSCross(const float* A, const float* B, float* Out, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 4 <= Num; i += 4)
+        {
+            __m128 AX, AY, AZ, BX, BY, BZ;
+            LoadAoS4(A + i * 3, AX, AY, AZ);
+            LoadAoS4(B + i * 3, BX, BY, BZ);
+            const __m128 CX = _mm_sub_ps(_mm_mul_ps(AY, BZ), _mm_mul_ps(AZ, BY));
+            const __m128 CY = _mm_sub_ps(_mm_mul_ps(AZ, BX), _mm_mul_ps(AX, BZ));
+            const __m128 CZ = _mm_sub_ps(_mm_mul_ps(AX, BY), _mm_mul_ps(AY, BX));
+            StoreAoS4(Out + i * 3, CX, CY, CZ);
+        }
+        VectorKernelsScalar::AoSCross(A + i * 3, B + i * 3, Out + i * 3, Num - i);
+    }
+
+    void AoSLength(const float* Data, float* Out, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 4 <= Num; i += 4)
+        {
+            __m128 X, Y, Z;
+            LoadAoS4(Data + i * 3, X, Y, Z);
+            _mm_storeu_ps(Out + i, Length4(X, Y, Z));
+        }
+        VectorKernelsScalar::AoSLength(Data + i * 3, Out + i, Num - i);
+    }
+
+    void AoSNormalize(float* Data, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 4 <= Num; i += 4)
+        {
+            __m128 X, Y, Z;
+            LoadAoS4(Data + i * 3, X, Y, Z);
+            const __m128 Scale = NormalizeScale4(Length4(X, Y, Z));
+            StoreAoS4(Data + i * 3, _mm_mul_ps(X, Scale), _mm_mul_ps(Y, Scale), _mm_mul_ps(Z, Scale));
+        }
+        VectorKernelsScalar::AoSNormalize(Data + i * 3, Num - i);
+    }
+
+    void AoSBounds(const float* Data, uint32 Num, float* InOutMin, float* InOutMax)
+    {
+        if (Num < 4)
+        {
+            VectorKernelsScalar::AoSBounds(Data, Num, InOutMin, InOutMax);
+            return;
+        }
+
+        __m128 MinX, MinY, MinZ;
+        LoadAoS4(Data, MinX, MinY, MinZ);
+        __m128 MaxX = MinX, MaxY = MinY, MaxZ = MinZ;
+        uint32 i = 4;
+        for (; i + 4 <= Num; i += 4)
+        {
+            __m128 X, Y, Z;
+            LoadAoS4(Data + i * 3, X, Y, Z);
+            MinX = _mm_min_ps(MinX, X); MaxX = _mm_max_ps(MaxX, X);
+            MinY = _mm_min_ps(MinY, Y); MaxY = _mm_max_ps(MaxY, Y);
+            MinZ = _mm_min_ps(MinZ, Z); MaxZ = _mm_max_ps(MaxZ, Z);
+        }
+        ReduceBounds4(MinX, MaxX, InOutMin[0], InOutMax[0]);
+        ReduceBounds4(MinY, MaxY, InOutMin[1], InOutMax[1]);
+        ReduceBounds4(MinZ, MaxZ, InOutMin[2], InOutMax[2]);
+        VectorKernelsScalar::AoSBounds(Data + i * 3, Num - i, InOutMin, InOutMax);
+    }
+
+    // ============================================================================
+    // SoA
+    // ============================================================================
+
+    void SoADot(const float* AX, const float* AY, const float* AZ, const float* BX, const float* BY, const float* BZ, float* Out, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 4 <= Num; i += 4)
+        {
+            const __m128 XX = _mm_mul_ps(_mm_loadu_ps(AX + i), _mm_loadu_ps(BX + i));
+            const __m128 YY = _mm_mul_ps(_mm_loadu_ps(AY + i), _mm_loadu_ps(BY + i));
+            const __m128 ZZ = _mm_mul_ps(_mm_loadu_ps(AZ + i), _mm_loadu_ps(BZ + i));
+            _mm_storeu_ps(Out + i, _mm_add_ps(_mm_add_ps(XX, YY), ZZ));
+        }
+        VectorKernelsScalar::SoADot(AX + i, AY + i, AZ + i, BX + i, BY + i, BZ + i, Out + i, Num - i);
+    }
+
+    void SoALength(const float* X, const float* Y, const float* Z, float* Out, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 4 <= Num; i += 4)
+        {
+            _mm_storeu_ps(Out + i, Length4(_mm_loadu_ps(X + i), _mm_loadu_ps(Y + i), _mm_loadu_ps(Z + i)));
+        }
+        VectorKernelsScalar::SoALength(X + i, Y + i, Z + i, Out + i, Num - i);
+    }
+
+    void SoANormalize(float* X, float* Y, float* Z, uint32 Num)
+    {
+        uint32 i = 0;
+        for (; i + 4 <= Num; i += 4)
+        {
+            const __m128 VX = _mm_loadu_ps(X + i);
+            const __m128 VY = _mm_loadu_ps(Y + i);
+            const __m128 VZ = _mm_loadu_ps(Z + i);
+            const __m128 Scale = NormalizeScale4(Length4(VX, VY, VZ));
+            _mm_storeu_ps(X + i, _mm_mul_ps(VX, Scale));
+            _mm_storeu_ps(Y + i, _mm_mul_ps(VY, Scale));
+            _mm_storeu_ps(Z + i, _mm_mul_ps(VZ, Scale));
+        }
+        VectorKernelsScalar::SoANormalize(X + i, Y + i, Z + i, Num - i);
+    }
+
+    void SoABounds(const float* X, const float* Y, const float* Z, uint32 Num, float* InOutMin, float* InOutMax)
+    {
+        const float* Components[3] = { X, Y, Z };
+        const uint32 VectorNum = Num & ~3u;
+        for (uint32 Axis = 0; Axis < 3 && VectorNum > 0; ++Axis)
+        {
+            const float* Data = Components[Axis];
+            __m128 Min = _mm_loadu_ps(Data);
+            __m128 Max = Min;
+            for (uint32 i = 4; i < VectorNum; i += 4)
+            {
+                const __m128 V = _mm_loadu_ps(Data + i);
+                Min = _mm_min_ps(Min, V);
+                Max = _mm_max_ps(Max, V);
+            }
+            ReduceBounds4(Min, Max, InOutMin[Axis], InOutMax[Axis]);
+        }
+        VectorKernelsScalar::SoABounds(X + VectorNum, Y + VectorNum, Z + VectorNum, Num - VectorNum, InOutMin, InOutMax);
+    }
+}
+
+const FVectorKernelTable* GetSSE42VectorKernels()
+{
+    static const FVectorKernelTable Table = {
+        &StreamAdd, &StreamMul, &StridedMinMax, &StreamRangeMask,
+        &AoSTranslate, &AoSScale, &AoSDot, &AoSCross, &AoSLength, &AoSNormalize, &AoSBounds,
+        &SoADot, &SoALength, &SoANormalize, &SoABounds
+    };
+    return &Table;
+}
+
+#else
+
+const FVectorKernelTable* GetSSE42VectorKernels()
+{
+    return nullptr;
+}
+
+#endif
@@ -0,0 +1,177 @@
+#include "VectorKernelsImpl.h"
+#include <cmath>
+
+namespace VectorKernelsScalar
+{
+    void StreamAdd(float* Data, uint32 Count, float Value)
+    {
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            Data[i] += Value;
+        }
+    }
+
+    void StreamMul(float* Data, uint32 Count, float Value)
+    {
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            Data[i] *= Value;
+        }
+    }
+
+    void StridedMinMax(const float* Data, uint32 Count, uint32 Dimension, float* InOutMin, float* InOutMax)
+    {
+        for (uint32 i = 0; i < Count; ++i, Data += Dimension)
+        {
+            for (uint32 c = 0; c < Dimension; ++c)
+            {
+                InOutMin[c] = Data[c] < InOutMin[c] ? Data[c] : InOutMin[c];
+                InOutMax[c] = Data[c] > InOutMax[c] ? Data[c] : InOutMax[c];
+            }
+        }
+    }
+
+    void StreamRangeMask(const float* Data, uint32 Count, float Min, float Max, uint64* OutBits)
+    {
+        for (uint32 Word = 0; Word * 64 < Count; ++Word)
+        {
+            uint64 Bits = 0;
+            const uint32 End = Count - Word * 64 < 64 ? Count - Word * 64 : 64;
+            for (uint32 j = 0; j < End; ++j)
+            {
+                const float Value = Data[Word * 64 + j];
+                Bits |= static_cast<uint64>(Value >= Min && Value <= Max) << j;
+            }
+            OutBits[Word] = Bits;
+        }
+    }
+
+    void AoSTranslate(float* Data, uint32 Num, const float* Offset)
+    {
+        for (uint32 i = 0; i < Num; ++i, Data += 3)
+        {
+            Data[0] += Offset[0];
+            Data[1] += Offset[1];
+            Data[2] += Offset[2];
+        }
+    }
+
+    void AoSScale(float* Data, uint32 Num, const float* Scale)
+    {
+        for (uint32 i = 0; i < Num; ++i, Data += 3)
+        {
+            Data[0] *= Scale[0];
+            Data[1] *= Scale[1];
+            Data[2] *= Scale[2];
+        }
+    }
+
+    void AoSDot(const float* A, const float* B, float* Out, uint32 Num)
+    {
+        for (uint32 i = 0; i < Num; ++i, A += 3, B += 3)
+        {
+            Out[i] = A[0] * B[0] + A[1] * B[1] + A[2] * B[2];
+        }
+    }
+
+    void AoSCross(const float* A, const float* B, float* Out, uint32 Num)
+    {
+        for (uint32 i = 0; i < Num; ++i, A += 3, B += 3, Out += 3)
+        {
+            // 先读取全部输入，允许输出与输入重叠
+            const float AX = A[0], AY = A[1], AZ = A[2];
+            const float BX = B[0], BY = B[1], BZ = B[2];
+            Out[0] = AY * BZ - AZ * BY;
+            Out[1] = AZ * BX - AX * BZ;
+            Out[2] = AX * BY - AY * BX;
+        }
+    }
+
+    void AoSLength(const float* Data, float* Out, uint32 Num)
+    {
+        for (uint32 i = 0; i < Num; ++i, Data += 3)
+        {
+            Out[i] = std::sqrt(Data[0] * Data[0] + Data[1] * Data[1] + Data[2] * Data[2]);
+        }
+    }
+
+    void AoSNormalize(float* Data, uint32 Num)
+    {
+        for (uint32 i = 0; i < Num; ++i, Data += 3)
+        {
+            const float Length = std::sqrt(Data[0] * Data[0] + Data[1] * Data[1] + Data[2] * Data[2]);
+            const float Scale = Length > VectorKernelNormalizeTolerance ? 1.0f / Length : 0.0f;
+            Data[0] *= Scale;
+            Data[1] *= Scale;
+            Data[2] *= Scale;
+        }
+    }
+
+    void AoSBounds(const float* Data, uint32 Num, float* InOutMin, float* InOutMax)
+    {
+        for (uint32 i = 0; i < Num; ++i, Data += 3)
+        {
+            for (uint32 Axis = 0; Axis < 3; ++Axis)
+            {
+                InOutMin[Axis] = Data[Axis] < InOutMin[Axis] ? Data[Axis] : InOutMin[Axis];
+                InOutMax[Axis] = Data[Axis] > InOutMax[Axis] ? Data[Axis] : InOutMax[Axis];
+            }
+        }
+    }
+
+    void SoADot(const float* AX, const float* AY, const float* AZ, const float* BX, const float* BY, const float* BZ, float* Out, uint32 Num)
+    {
+        for (uint32 i = 0; i < Num; ++i)
+        {
+            Out[i] = AX[i] * BX[i] + AY[i] * BY[i] + AZ[i] * BZ[i];
+        }
+    }
+
+    void SoALength(const float* X, const float* Y, const float* Z, float* Out, uint32 Num)
+    {
+        for (uint32 i = 0; i < Num; ++i)
+        {
+            Out[i] = std::sqrt(X[i] * X[i] + Y[i] * Y[i] + Z[i] * Z[i]);
+        }
+    }
+
+    void SoANormalize(float* X, float* Y, float* Z, uint32 Num)
+    {
+        for (uint32 i = 0; i < Num; ++i)
+        {
+            const float Length = std::sqrt(X[i] * X[i] + Y[i] * Y[i] + Z[i] * Z[i]);
+            const float Scale = Length > VectorKernelNormalizeTolerance ? 1.0f / Length : 0.0f;
+            X[i] *= Scale;
+            Y[i] *= Scale;
+            Z[i] *= Scale;
+        }
+    }
+
+    void SoABounds(const float* X, const float* Y, const float* Z, uint32 Num, float* InOutMin, float* InOutMax)
+    {
+        const float* Components[3] = { X, Y, Z };
+        for (uint32 Axis = 0; Axis < 3; ++Axis)
+        {
+            float Min = InOutMin[Axis];
+            float Max = InOutMax[Axis];
+            const float* Data = Components[Axis];
+            for (uint32 i = 0; i < Num; ++i)
+            {
+                Min = Data[i] < Min ? Data[i] : Min;
+                Max = Data[i] > Max ? Data[i] : Max;
+            }
+            InOutMin[Axis] = Min;
+            InOutMax[Axis] = Max;
+        }
+    }
+
+    const FVectorKernelTable& GetTable()
+    {
+        static const FVectorKernelTable Table = {
+            &StreamAdd, &StreamMul, &StridedMinMax, &StreamRangeMask,
+            &AoSTranslate, &AoSScale, &AoSDot, &AoSCross, &AoSLength, &AoSNormalize, &AoSBounds,
+            &SoADot, &SoALength, &SoANormalize, &SoABounds
+        };
+        return Table;
+    }
+}
@@ -0,0 +1,80 @@
+#include "Threading/ParallelFor.h"
+#include "Threading/TaskGraph.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+
+uint32 FParallelFor::GetNumWorkers()
+{
+    // 任务调度器的工作线程 + 调用线程
+    return FTaskGraph::Get().GetNumWorkerThreads() + 1;
+}
+
+void FParallelFor::Range(uint32 Num, uint32 GrainSize, const std::function<void(uint32, uint32)>& Body, EParallelForFlags Flags)
+{
+    if (Num == 0)
+    {
+        return;
+    }
+
+    const uint32 NumWorkers = GetNumWorkers();
+    if (GrainSize == 0)
+    {
+        // 默认每个线程分到约 4 个区间，便于负载均衡
+        GrainSize = std::max<uint32>(1, Num / (NumWorkers * 4));
+    }
+
+    const uint32 NumChunks = (Num + GrainSize - 1) / GrainSize;
+    const bool bSingleThread = (static_cast<uint8>(Flags) & static_cast<uint8>(EParallelForFlags::ForceSingleThread)) != 0;
+    if (bSingleThread || NumChunks == 1 || NumWorkers == 1)
+    {
+        Body(0, Num);
+        return;
+    }
+
+    // 各线程从共享计数器领取区间，直到全部完成
+    std::atomic<uint32> NextChunk{0};
+    std::exception_ptr FirstException;
+    std::mutex ExceptionMutex;
+
+    auto Worker = [&]()
+    {
+        for (uint32 Chunk = NextChunk.fetch_add(1); Chunk < NumChunks; Chunk = NextChunk.fetch_add(1))
+        {
+            const uint32 Begin = Chunk * GrainSize;
+            const uint32 End = std::min(Begin + GrainSize, Num);
+            try
+            {
+                Body(Begin, End);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> Lock(ExceptionMutex);
+                if (!FirstException)
+                {
+                    FirstException = std::current_exception();
+                }
+            }
+        }
+    };
+
+    // 在任务调度器上启动辅助任务，未被及时执行的辅助任务领取不到区间会立即结束
+    FTaskGraph& Graph = FTaskGraph::Get();
+    const uint32 NumHelpers = std::min(NumWorkers, NumChunks) - 1;
+    TArray<FTaskHandle> Helpers;
+    Helpers.Reserve(NumHelpers);
+    for (uint32 i = 0; i < NumHelpers; ++i)
+    {
+        Helpers.Add(Graph.Launch(Worker));
+    }
+
+    // 调用线程同样参与计算，之后等待辅助任务结束（等待期间帮助执行其他任务，嵌套调用不会死锁）
+    Worker();
+    Graph.WaitAll(TArrayView<const FTaskHandle>(Helpers.GetData(), Helpers.Num()));
+
+    if (FirstException)
+    {
+        std::rethrow_exception(FirstException);
+    }
+}
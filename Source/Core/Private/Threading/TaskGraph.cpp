@@ -0,0 +1,371 @@
+#include "Threading/TaskGraph.h"
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <exception>
+#include <thread>
+#include <vector>
+
+/**
+ * 任务内部状态
+ */
+struct FTaskState
+{
+    /** 任务函数（执行后释放，避免长期持有捕获的资源） */
+    std::function<void()> Body;
+
+    /** 尚未完成的前置任务数量 + 1（提交保护，提交完成后释放） */
+    std::atomic<int32> PendingPrerequisites{1};
+
+    /** 是否已完成 */
+    std::atomic<bool> bCompleted{false};
+
+    /** 保护 Dependents 与完成状态的切换 */
+    std::mutex Mutex;
+
+    /** 依赖本任务的后续任务 */
+    std::vector<TSharedPtr<FTaskState>> Dependents;
+
+    /** 任务抛出的异常 */
+    std::exception_ptr Exception;
+};
+
+/**
+ * 工作线程（或注入队列）的任务队列
+ */
+struct FTaskGraphWorker
+{
+    std::mutex Mutex;
+    std::deque<TSharedPtr<FTaskState>> Queue;
+    std::thread Thread;
+
+    void PushBack(TSharedPtr<FTaskState> Task)
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        Queue.push_back(std::move(Task));
+    }
+
+    TSharedPtr<FTaskState> PopBack()
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        if (Queue.empty())
+        {
+            return TSharedPtr<FTaskState>();
+        }
+        TSharedPtr<FTaskState> Task = std::move(Queue.back());
+        Queue.pop_back();
+        return Task;
+    }
+
+    TSharedPtr<FTaskState> PopFront()
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        if (Queue.empty())
+        {
+            return TSharedPtr<FTaskState>();
+        }
+        TSharedPtr<FTaskState> Task = std::move(Queue.front());
+        Queue.pop_front();
+        return Task;
+    }
+};
+
+namespace
+{
+    /** 当前线程所属的调度器与工作线程索引 */
+    thread_local const FTaskGraph* GCurrentGraph = nullptr;
+    thread_local uint32 GCurrentWorkerIndex = 0;
+
+    /** Wait 休眠的最长时间（任务完成时会提前唤醒） */
+    constexpr std::chrono::microseconds WaitSleepInterval(200);
+}
+
+// ============================================================================
+// FTaskHandle
+// ============================================================================
+
+bool FTaskHandle::IsCompleted() const
+{
+    return !State.IsValid() || State->bCompleted.load(std::memory_order_acquire);
+}
+
+// ============================================================================
+// 构造与析构
+// ============================================================================
+
+FTaskGraph::FTaskGraph(uint32 NumWorkerThreads)
+{
+    if (NumWorkerThreads == 0)
+    {
+        const uint32 HardwareThreads = std::thread::hardware_concurrency();
+        NumWorkerThreads = HardwareThreads > 1 ? HardwareThreads - 1 : 1;
+    }
+
+    InjectionQueue = MakeUnique<FTaskGraphWorker>();
+    Workers.Reserve(NumWorkerThreads);
+    for (uint32 i = 0; i < NumWorkerThreads; ++i)
+    {
+        Workers.Add(MakeUnique<FTaskGraphWorker>());
+    }
+
+    // 所有队列创建完成后再启动线程，工作线程窃取时会遍历 Workers
+    for (uint32 i = 0; i < NumWorkerThreads; ++i)
+    {
+        Workers[i]->Thread = std::thread([this, i]() { WorkerLoop(i); });
+    }
+}
+
+FTaskGraph::~FTaskGraph()
+{
+    {
+        std::lock_guard<std::mutex> Lock(WakeMutex);
+        bShutdown.store(true);
+    }
+    WakeCondition.notify_all();
+
+    for (auto& Worker : Workers)
+    {
+        if (Worker->Thread.joinable())
+        {
+            Worker->Thread.join();
+        }
+    }
+}
+
+FTaskGraph& FTaskGraph::Get()
+{
+    static FTaskGraph Instance;
+    return Instance;
+}
+
+uint32 FTaskGraph::GetNumWorkerThreads() const
+{
+    return Workers.Num();
+}
+
+bool FTaskGraph::IsWorkerThread() const
+{
+    return GCurrentGraph == this;
+}
+
+// ============================================================================
+// 任务提交与等待
+// ============================================================================
+
+FTaskHandle FTaskGraph::Launch(std::function<void()> Body, TArrayView<const FTaskHandle> Prerequisites)
+{
+    TSharedPtr<FTaskState> Task = MakeShared<FTaskState>();
+    Task->Body = std::move(Body);
+
+    for (const FTaskHandle& Prerequisite : Prerequisites)
+    {
+        if (!Prerequisite.IsValid())
+        {
+            continue;
+        }
+
+        FTaskState& State = *Prerequisite.State;
+        std::lock_guard<std::mutex> Lock(State.Mutex);
+        if (!State.bCompleted.load(std::memory_order_acquire))
+        {
+            Task->PendingPrerequisites.fetch_add(1, std::memory_order_relaxed);
+            State.Dependents.push_back(Task);
+        }
+    }
+
+    FTaskHandle Handle(Task);
+
+    // 释放提交保护，所有前置任务都已完成时直接入队
+    if (Task->PendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        Enqueue(std::move(Task));
+    }
+    return Handle;
+}
+
+FTaskHandle FTaskGraph::Launch(std::function<void()> Body, std::initializer_list<FTaskHandle> Prerequisites)
+{
+    return Launch(std::move(Body), TArrayView<const FTaskHandle>(Prerequisites.begin(), static_cast<uint32>(Prerequisites.size())));
+}
+
+void FTaskGraph::Wait(const FTaskHandle& Task)
+{
+    while (!Task.IsCompleted())
+    {
+        if (TryExecuteTask())
+        {
+            continue;
+        }
+
+        // 没有可帮助执行的任务：短暂休眠，任务完成或有新任务入队时被唤醒
+        std::unique_lock<std::mutex> Lock(CompletionMutex);
+        SleepingWaiterCount.fetch_add(1);
+        CompletionCondition.wait_for(Lock, WaitSleepInterval, [&]()
+        {
+            return Task.IsCompleted() || QueuedTaskCount.load() > 0;
+        });
+        SleepingWaiterCount.fetch_sub(1);
+    }
+
+    if (Task.State.IsValid() && Task.State->Exception)
+    {
+        std::rethrow_exception(Task.State->Exception);
+    }
+}
+
+void FTaskGraph::WaitAll(TArrayView<const FTaskHandle> Tasks)
+{
+    std::exception_ptr FirstException;
+    for (const FTaskHandle& Task : Tasks)
+    {
+        try
+        {
+            Wait(Task);
+        }
+        catch (...)
+        {
+            if (!FirstException)
+            {
+                FirstException = std::current_exception();
+            }
+        }
+    }
+
+    if (FirstException)
+    {
+        std::rethrow_exception(FirstException);
+    }
+}
+
+bool FTaskGraph::TryExecuteTask()
+{
+    TSharedPtr<FTaskState> Task = Dequeue();
+    if (!Task.IsValid())
+    {
+        return false;
+    }
+    Execute(Task);
+    return true;
+}
+
+// ============================================================================
+// 内部实现
+// ============================================================================
+
+void FTaskGraph::Enqueue(TSharedPtr<FTaskState> Task)
+{
+    {
+        std::lock_guard<std::mutex> Lock(WakeMutex);
+        QueuedTaskCount.fetch_add(1);
+    }
+
+    if (IsWorkerThread())
+    {
+        Workers[GCurrentWorkerIndex]->PushBack(std::move(Task));
+    }
+    else
+    {
+        InjectionQueue->PushBack(std::move(Task));
+    }
+
+    WakeCondition.notify_one();
+    if (SleepingWaiterCount.load() > 0)
+    {
+        CompletionCondition.notify_all();
+    }
+}
+
+TSharedPtr<FTaskState> FTaskGraph::Dequeue()
+{
+    if (QueuedTaskCount.load() <= 0)
+    {
+        return TSharedPtr<FTaskState>();
+    }
+
+    TSharedPtr<FTaskState> Task;
+    if (IsWorkerThread())
+    {
+        Task = Workers[GCurrentWorkerIndex]->PopBack();
+    }
+    if (!Task.IsValid())
+    {
+        Task = InjectionQueue->PopFront();
+    }
+    if (!Task.IsValid())
+    {
+        const uint32 NumWorkers = Workers.Num();
+        const uint32 Start = StealCursor.fetch_add(1, std::memory_order_relaxed);
+        for (uint32 i = 0; i < NumWorkers && !Task.IsValid(); ++i)
+        {
+            Task = Workers[(Start + i) % NumWorkers]->PopFront();
+        }
+    }
+
+    if (Task.IsValid())
+    {
+        QueuedTaskCount.fetch_sub(1);
+    }
+    return Task;
+}
+
+void FTaskGraph::Execute(const TSharedPtr<FTaskState>& Task)
+{
+    try
+    {
+        Task->Body();
+    }
+    catch (...)
+    {
+        Task->Exception = std::current_exception();
+    }
+    Task->Body = nullptr;
+
+    std::vector<TSharedPtr<FTaskState>> Dependents;
+    {
+        std::lock_guard<std::mutex> Lock(Task->Mutex);
+        Task->bCompleted.store(true, std::memory_order_release);
+        Dependents.swap(Task->Dependents);
+    }
+
+    for (TSharedPtr<FTaskState>& Dependent : Dependents)
+    {
+        if (Dependent->PendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            Enqueue(std::move(Dependent));
+        }
+    }
+
+    if (SleepingWaiterCount.load() > 0)
+    {
+        std::lock_guard<std::mutex> Lock(CompletionMutex);
+        CompletionCondition.notify_all();
+    }
+}
+
+void FTaskGraph::WorkerLoop(uint32 WorkerIndex)
+{
+    GCurrentGraph = this;
+    GCurrentWorkerIndex = WorkerIndex;
+
+    while (true)
+    {
+        if (TryExecuteTask())
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> Lock(WakeMutex);
+        WakeCondition.wait(Lock, [this]()
+        {
+            return bShutdown.load() || QueuedTaskCount.load() > 0;
+        });
+
+        // 关闭时先执行完所有已入队的任务
+        if (bShutdown.load() && QueuedTaskCount.load() <= 0)
+        {
+            break;
+        }
+    }
+
+    GCurrentGraph = nullptr;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include "Container/ArrayView.h"
+#include "Field/Field.h"
+#include "Math/Math.h"
+#include "HAL/Platform.h"
+
+class FCellArray;
+
+/**
+ * 单元几何量类型
+ */
+enum class ECellGeometryQuantity : uint8
+{
+    Size,       // 按单元维度取长度 / 面积 / 体积（标量）
+    Area,       // 二维单元面积，其余单元为 0（标量）
+    Volume,     // 三维单元体积，其余单元为 0（标量）
+    Centroid,   // 顶点平均值（向量）
+    Normal,     // 二维单元的单位法线，其余单元为零向量（向量）
+};
+
+inline std::string EnumToString(ECellGeometryQuantity Quantity)
+{
+    switch (Quantity)
+    {
+        case ECellGeometryQuantity::Size: return "Size";
+        case ECellGeometryQuantity::Area: return "Area";
+        case ECellGeometryQuantity::Volume: return "Volume";
+        case ECellGeometryQuantity::Centroid: return "Centroid";
+        case ECellGeometryQuantity::Normal: return "Normal";
+        default: return "Unknown";
+    }
+}
+
+/**
+ * FCellGeometry - 整个单元数组的批量几何计算
+ * 
+ * 设计特点：
+ * 1. 一次计算所有单元的面积 / 体积 / 中心 / 法线，结果写入单元场，不为单个单元分配临时数组
+ * 2. 混合单元数组先按单元类型分组，每种类型使用固定顶点数的内联内核，循环内没有类型分支
+ * 3. 每个分组按单元区间并行计算
+ * 
+ * 计算公式与 ICellTriangle / ICellQuad / ICellPolygon / ICellTetra / ICellPyramid / ICellPrism 的静态函数一致：
+ * - 四边形面积按 (0,1,2)+(0,2,3) 分割，多边形面积按顶点 0 三角形扇分割
+ * - 四边形、多边形法线为中心点与每条边构成的三角形法线之和再归一化
+ * - 六面体体积按对角线 0-6 分割为 6 个四面体
+ * - 多面体没有面信息，体积为 0，中心为顶点平均值
+ * - 顶点数少于单元类型要求的单元视为退化单元，几何量为 0
+ * 
+ * 注意：单元的顶点索引必须在 Positions 范围内
+ * 
+ * 使用示例：
+ *   FField Volumes;
+ *   FCellGeometry::Compute(Positions, Cells, ECellGeometryQuantity::Volume, Volumes);
+ */
+struct FCellGeometry
+{
+    /** 获取几何量对应的场类型（标量或向量） */
+    static EFieldType GetFieldType(ECellGeometryQuantity Quantity);
+
+    /**
+     * 计算所有单元的几何量
+     * @param Positions 顶点坐标
+     * @param Cells 单元数组
+     * @param Quantity 几何量类型
+     * @param OutField 输出单元场（重新初始化为对应类型，场名称为空时使用 EnumToString(Quantity)）
+     * @param bParallel 是否并行计算
+     */
+    static void Compute(TArrayView<const FVector> Positions, const FCellArray& Cells, ECellGeometryQuantity Quantity, FField& OutField, bool bParallel = true);
+};
@@ -17,6 +17,12 @@ public:
     // 维度：3
     [[nodiscard]] int32 GetCellDimension() const override;
 
+    /**
+     * 六面体的面索引定义（从外部看为逆时针，法线朝外）
+     * 假设底面 (0,1,2,3) 的法线指向顶面 (4,5,6,7)，顶点 i + 4 位于顶点 i 上方
+     */
+    static constexpr int32 Faces[6][4] = { { 0, 4, 7, 3 }, { 1, 2, 6, 5 }, { 0, 1, 5, 4 }, { 3, 7, 6, 2 }, { 0, 3, 2, 1 }, { 4, 5, 6, 7 } };
+
     // ============================================================================
     // 静态辅助函数
     // ============================================================================
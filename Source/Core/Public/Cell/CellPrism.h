@@ -16,6 +16,16 @@ public:
     // 维度：3
     [[nodiscard]] int32 GetCellDimension() const override;
 
+    /**
+     * 三棱柱的面索引定义（从外部看为逆时针，法线朝外）
+     * 假设底面 (0,1,2) 的法线指向顶面 (3,4,5)
+     * 前两个面为三角形（第 4 个索引为 -1），其余为四边形
+     */
+    static constexpr int32 Faces[5][4] = { { 0, 2, 1, -1 }, { 3, 4, 5, -1 }, { 0, 1, 4, 3 }, { 1, 2, 5, 4 }, { 2, 0, 3, 5 } };
+
+    /** 每个面的顶点数量 */
+    static constexpr int32 FaceVertexCounts[5] = { 3, 3, 4, 4, 4 };
+
     // ============================================================================
     // 静态辅助函数
     // ============================================================================
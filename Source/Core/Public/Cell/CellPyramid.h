@@ -16,6 +16,16 @@ public:
     // 维度：3
     [[nodiscard]] int32 GetCellDimension() const override;
 
+    /**
+     * 金字塔的面索引定义（从外部看为逆时针，法线朝外）
+     * 假设底面 (0,1,2,3) 的法线指向顶点 4
+     * 第一个面为四边形底面，其余为三角形（第 4 个索引为 -1）
+     */
+    static constexpr int32 Faces[5][4] = { { 0, 3, 2, 1 }, { 0, 1, 4, -1 }, { 1, 2, 4, -1 }, { 2, 3, 4, -1 }, { 3, 0, 4, -1 } };
+
+    /** 每个面的顶点数量 */
+    static constexpr int32 FaceVertexCounts[5] = { 4, 3, 3, 3, 3 };
+
     // ============================================================================
     // 静态辅助函数
     // ============================================================================
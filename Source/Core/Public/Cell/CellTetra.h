@@ -16,6 +16,12 @@ public:
     // 维度：3
     [[nodiscard]] int32 GetCellDimension() const override;
 
+    /**
+     * 四面体的面索引定义（从外部看为逆时针，法线朝外）
+     * 假设底面 (0,1,2)，顶点 3 位于底面法线一侧
+     */
+    static constexpr int32 Faces[4][3] = { { 0, 1, 3 }, { 1, 2, 3 }, { 2, 0, 3 }, { 0, 2, 1 } };
+
     // ============================================================================
     // 静态辅助函数
     // ============================================================================
@@ -59,6 +59,32 @@ public:
      * @return 维度（0=点，1=线，2=面，3=体），如果类型未知返回 -1
      */
     static int32 GetCellDimension(ECellType CellType);
+
+    // ============================================================================
+    // 边界面（三维单元的面、二维单元的边、一维单元的端点）
+    // ============================================================================
+
+    /** 单个边界面的最大顶点数量 */
+    static constexpr uint32 MaxFaceVertexCount = 4;
+
+    /**
+     * 获取单元的边界面数量
+     * 三维单元返回面数，二维单元返回边数，一维单元返回端点数（2），多面体返回 0
+     * @param CellType 单元类型
+     * @param VertexCount 单元的顶点数量（多边形、折线需要）
+     * @return 边界面数量
+     */
+    static uint32 GetFaceCount(ECellType CellType, uint32 VertexCount);
+
+    /**
+     * 获取单元指定边界面的局部顶点索引（三维单元的面法线朝外）
+     * @param CellType 单元类型
+     * @param VertexCount 单元的顶点数量（多边形、折线需要）
+     * @param FaceIndex 边界面索引，范围 [0, GetFaceCount)
+     * @param OutLocalIndices 输出的局部顶点索引，至少 MaxFaceVertexCount 个元素
+     * @return 边界面的顶点数量，索引无效时返回 0
+     */
+    static uint32 GetFaceLocalIndices(ECellType CellType, uint32 VertexCount, uint32 FaceIndex, int32* OutLocalIndices);
 };
 
 // ============================================================================
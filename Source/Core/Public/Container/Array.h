@@ -4,14 +4,16 @@
 #include <algorithm>
 #include <cstdint>
 #include "HAL/Platform.h"
+#include "Memory/AlignedAllocator.h"
 
 /**
  * TArray - 动态数组容器类
  * 使用 UE 风格的接口命名，底层使用 std::vector 实现
  * 
  * @tparam T 元素类型
+ * @tparam AllocatorType 分配器类型（默认 std::allocator，需要对齐内存时使用 TAlignedAllocator）
  */
-template<typename T>
+template<typename T, typename AllocatorType = std::allocator<T>>
 class TArray
 {
 public:
@@ -19,9 +21,9 @@ public:
     // 类型定义
     // ============================================================================
     using ElementType = T;
-    using SizeType = typename std::vector<T>::size_type;
-    using Iterator = typename std::vector<T>::iterator;
-    using ConstIterator = typename std::vector<T>::const_iterator;
+    using SizeType = typename std::vector<T, AllocatorType>::size_type;
+    using Iterator = typename std::vector<T, AllocatorType>::iterator;
+    using ConstIterator = typename std::vector<T, AllocatorType>::const_iterator;
 
     // ============================================================================
     // 构造函数和析构函数
@@ -283,6 +285,15 @@ public:
         Data.insert(Data.end(), Other.Data.begin(), Other.Data.end());
     }
     
+    /** 追加连续内存中的多个元素（一次性拷贝） */
+    void Append(const T* Ptr, SizeType Count)
+    {
+        if (Ptr != nullptr && Count > 0)
+        {
+            Data.insert(Data.end(), Ptr, Ptr + Count);
+        }
+    }
+    
     /** 追加另一个数组的所有元素（移动语义） */
     void Append(TArray&& Other)
     {
@@ -403,5 +414,11 @@ public:
 
 private:
     // 底层使用 std::vector 存储数据
-    std::vector<T> Data;
+    std::vector<T, AllocatorType> Data;
 };
+
+/**
+ * TAlignedArray - 数据首地址按指定字节对齐的动态数组（用于 SIMD 批量计算）
+ */
+template<typename T, std::size_t Alignment = 64>
+using TAlignedArray = TArray<T, TAlignedAllocator<T, Alignment>>;
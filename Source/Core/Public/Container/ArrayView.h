@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include "HAL/Platform.h"
+
+/**
+ * TArrayView - 非拥有的连续数组视图
+ * 使用 UE 风格的接口命名，只记录指针和元素数量，不分配内存
+ *
+ * 注意：视图不管理底层数据的生命周期，底层容器修改或销毁后视图失效
+ *
+ * 使用示例：
+ *   TArray<int32> Array{1, 2, 3};
+ *   TArrayView<const int32> View(Array.GetData(), Array.Num());
+ *   for (int32 Value : View) { ... }
+ *
+ * @tparam T 元素类型（通常为 const 限定类型）
+ */
+template<typename T>
+class TArrayView
+{
+public:
+    // ============================================================================
+    // 类型定义
+    // ============================================================================
+    using ElementType = T;
+    using SizeType = uint32;
+
+    // ============================================================================
+    // 构造函数
+    // ============================================================================
+
+    /** 默认构造函数（空视图） */
+    TArrayView() : DataPtr(nullptr), ArrayNum(0) {}
+
+    /** 使用指针和数量构造 */
+    TArrayView(T* InData, SizeType InNum) : DataPtr(InData), ArrayNum(InNum) {}
+
+    // ============================================================================
+    // 元素访问
+    // ============================================================================
+
+    /** 获取指定索引的元素（不检查边界） */
+    T& operator[](SizeType Index) const { return DataPtr[Index]; }
+
+    /** 获取第一个元素 */
+    T& First() const { return DataPtr[0]; }
+
+    /** 获取最后一个元素 */
+    T& Last() const { return DataPtr[ArrayNum - 1]; }
+
+    /** 获取底层数据指针 */
+    T* GetData() const { return DataPtr; }
+
+    // ============================================================================
+    // 容量相关
+    // ============================================================================
+
+    /** 获取元素数量 */
+    SizeType Num() const { return ArrayNum; }
+
+    /** 检查是否为空 */
+    [[nodiscard]] bool IsEmpty() const { return ArrayNum == 0; }
+
+    /** 检查索引是否有效 */
+    bool IsValidIndex(SizeType Index) const { return Index < ArrayNum; }
+
+    // ============================================================================
+    // 查找操作
+    // ============================================================================
+
+    /** 检查是否包含元素 */
+    template<typename ValueType>
+    bool Contains(const ValueType& Item) const
+    {
+        for (SizeType i = 0; i < ArrayNum; ++i)
+        {
+            if (DataPtr[i] == Item)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // ============================================================================
+    // 迭代器（用于范围 for 循环）
+    // ============================================================================
+
+    T* begin() const { return DataPtr; }
+    T* end() const { return DataPtr + ArrayNum; }
+
+private:
+    /** 数据指针 */
+    T* DataPtr;
+
+    /** 元素数量 */
+    SizeType ArrayNum;
+};
@@ -2,6 +2,7 @@
 
 #include "Cell/CellType.h"
 #include "Container/Array.h"
+#include "Container/ArrayView.h"
 #include "HAL/Platform.h"
 
 class FCellArray;
@@ -36,6 +37,58 @@ struct FCellInfo
     [[nodiscard]] SizeType Num() const { return VertexIndices.Num(); }
 };
 
+/**
+ * 单元视图结构体
+ * 
+ * 非拥有的单元访问方式（指针 + 顶点数 + 类型），按值返回，不分配内存
+ * 视图直接指向 FCellArray 的内部存储，单元数组修改后视图失效
+ */
+struct FCellView
+{
+    /** 顶点索引类型 */
+    using VertexIndexType = FCellInfo::VertexIndexType;
+
+    /** 单元类型 */
+    ECellType CellType;
+
+    /** 顶点索引指针 */
+    const VertexIndexType* VertexIndices;
+
+    /** 顶点数量 */
+    uint32 VertexCount;
+
+    FCellView() : CellType(ECellType::None), VertexIndices(nullptr), VertexCount(0) {}
+    FCellView(const ECellType InType, const VertexIndexType* InIndices, const uint32 InCount)
+        : CellType(InType), VertexIndices(InIndices), VertexCount(InCount) {}
+
+    /** 获取指定索引的顶点索引（不检查边界） */
+    const VertexIndexType& operator[](const uint32 Index) const { return VertexIndices[Index]; }
+
+    [[nodiscard]] uint32 Num() const { return VertexCount; }
+
+    /** 视图是否指向有效单元 */
+    [[nodiscard]] bool IsValid() const { return VertexIndices != nullptr; }
+
+    /** 检查单元是否包含指定顶点 */
+    [[nodiscard]] bool Contains(const VertexIndexType VertexIndex) const
+    {
+        for (uint32 i = 0; i < VertexCount; ++i)
+        {
+            if (VertexIndices[i] == VertexIndex)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** 获取顶点索引的数组视图 */
+    [[nodiscard]] TArrayView<const VertexIndexType> GetVertexIndices() const { return { VertexIndices, VertexCount }; }
+
+    const VertexIndexType* begin() const { return VertexIndices; }
+    const VertexIndexType* end() const { return VertexIndices + VertexCount; }
+};
+
 /**
  * FCellArray - 单元数组类
  * 
@@ -56,9 +109,28 @@ struct FCellInfo
  *   三角形单元3: [7, 8, 9]
  * 
  *   VertexIndices = [0, 1, 2, 3, 4, 5, 6, 7, 8, 9]
- *   CellOffsets = [0, 3, 7, 10]  // 每个单元的起始位置
+ *   CellOffsets = [0, 3, 7, 10]  // 每个单元的起始位置，末尾额外记录结束位置
  *   CellTypes = [Triangle, Quad, Triangle]
  * 
+ * 遍历方式：
+ *   for (const FCellView Cell : CellArray)
+ *   {
+ *       for (int32 VertexIndex : Cell) { ... }
+ *   }
+ * 
+ * 均质存储模式：
+ * - 当所有单元类型相同且顶点数相同时（如纯四面体、纯六面体网格），
+ *   只记录一次 UniformCellType 和 UniformStride，不分配 CellOffsets/CellTypes
+ * - 单元偏移隐式计算：Offset = CellIndex * UniformStride
+ * - 添加不同类型（或不同顶点数）的单元时自动转换为混合存储
+ * - Compact() 会在混合存储实际只含一种单元时尝试恢复均质存储
+ * 
+ *   四面体单元1: [0, 1, 2, 3]
+ *   四面体单元2: [4, 5, 6, 7]
+ * 
+ *   VertexIndices = [0, 1, 2, 3, 4, 5, 6, 7]
+ *   UniformCellType = Tetra, UniformStride = 4
+ * 
  */
 class FCellArray {
 public:
@@ -71,6 +143,37 @@ public:
     /** 单元索引类型 */
     using CellIndexType = FCellInfo::CellIndexType;
 
+    /** 重映射表中表示单元已被删除的索引 */
+    static constexpr CellIndexType InvalidCellIndex = -1;
+
+    /**
+     * 单元只读迭代器，解引用得到 FCellView
+     */
+    class FConstIterator
+    {
+    public:
+        FConstIterator(const FCellArray* InArray, const CellIndexType InIndex) : Array(InArray), Index(InIndex) {}
+
+        /** 获取当前单元视图 */
+        FCellView operator*() const { return Array->GetCellViewUnchecked(Index); }
+
+        FConstIterator& operator++()
+        {
+            ++Index;
+            return *this;
+        }
+
+        bool operator==(const FConstIterator& Other) const { return Index == Other.Index; }
+        bool operator!=(const FConstIterator& Other) const { return Index != Other.Index; }
+
+        /** 获取当前单元索引 */
+        [[nodiscard]] CellIndexType GetIndex() const { return Index; }
+
+    private:
+        const FCellArray* Array;
+        CellIndexType Index;
+    };
+
 
 private:
     // ============================================================================
@@ -80,17 +183,32 @@ private:
     /** 所有单元的顶点索引（连续存储） */
     TArray<VertexIndexType> VertexIndices;
     
-    /** 每个单元在VertexIndices中的起始偏移位置 */
+    /** 每个单元在VertexIndices中的起始偏移位置（仅混合存储，长度为单元数 + 1） */
     TArray<uint32> CellOffsets;
     
-    /** 每个单元的类型 */
+    /** 每个单元的类型（仅混合存储） */
     TArray<ECellType> CellTypes;
     
+    /** 均质存储时的单元类型 */
+    ECellType UniformCellType;
+    
+    /** 均质存储时每个单元的顶点数 */
+    uint32 UniformStride;
+    
+    /** 单元数量 */
+    uint32 CellCount;
+    
+    /** 是否为均质存储（所有单元类型和顶点数相同） */
+    bool bIsUniform;
+    
     /** 当前容量（用于内存预分配） */
     uint32 ReservedCapacity;
     
     /** 是否启用内存重用 */
     bool bEnableMemoryReuse;
+    
+    /** 内容版本号（单元内容每次变化时更新，全局唯一） */
+    uint64 Version;
 
 public:
     // ============================================================================
@@ -134,9 +252,56 @@ public:
     /** 预留容量（优化内存分配） */
     void Reserve(uint32 Capacity);
     
+    /**
+     * 按精确的单元数和顶点索引数预留容量
+     * @param CellCapacity 单元容量
+     * @param VertexIndexCapacity 顶点索引容量
+     */
+    void Reserve(uint32 CellCapacity, uint32 VertexIndexCapacity);
+    
     /** 收缩容量以匹配实际大小 */
     void Shrink();
 
+    // ============================================================================
+    // 存储模式
+    // ============================================================================
+    
+    /**
+     * 是否为均质存储（单一单元类型，偏移隐式计算）
+     * 空数组视为均质存储
+     */
+    [[nodiscard]] bool IsUniform() const;
+    
+    /**
+     * 获取均质存储时的单元类型
+     * @return 单元类型，混合存储或为空时返回 None
+     */
+    [[nodiscard]] ECellType GetUniformCellType() const;
+    
+    /**
+     * 获取均质存储时每个单元的顶点数
+     * @return 顶点数，混合存储或为空时返回 0
+     */
+    [[nodiscard]] uint32 GetUniformStride() const;
+
+    /**
+     * 获取连续存储的全部顶点索引（用于序列化、批量处理）
+     * @return 顶点索引视图（在下一次修改单元数组前有效）
+     */
+    [[nodiscard]] TArrayView<const VertexIndexType> GetVertexIndicesView() const;
+
+    /**
+     * 获取单元偏移数组
+     * @return 长度为单元数 + 1 的偏移视图，均质存储时为空
+     */
+    [[nodiscard]] TArrayView<const uint32> GetCellOffsetsView() const;
+
+    /**
+     * 获取每个单元的类型
+     * @return 长度为单元数的类型视图，均质存储时为空
+     */
+    [[nodiscard]] TArrayView<const ECellType> GetCellTypesView() const;
+
     // ============================================================================
     // 添加单元
     // ============================================================================
@@ -162,6 +327,51 @@ public:
      */
     void AddCells(const TArray<FCellInfo>& Cells);
 
+    // ============================================================================
+    // 批量导入
+    // ============================================================================
+    
+    /**
+     * 批量添加同一类型的单元（一次性拷贝连续的顶点索引）
+     * @param CellType 单元类型
+     * @param Stride 每个单元的顶点数（为 0 时抛出 FInvalidArgumentException）
+     * @param InVertexIndices 连续存储的顶点索引，长度为 InCellCount * Stride
+     * @param InCellCount 单元数量
+     */
+    void AppendCells(ECellType CellType, uint32 Stride, const VertexIndexType* InVertexIndices, uint32 InCellCount);
+    
+    /**
+     * 批量添加混合类型的单元（一次性拷贝连续的顶点索引）
+     * 
+     * 偏移数组长度为 InCellCount + 1，第 i 个单元的顶点索引为
+     * InVertexIndices[InOffsets[i], InOffsets[i + 1])，InOffsets 不必从 0 开始，
+     * 但必须严格递增（每个单元至少一个顶点），否则抛出 FInvalidArgumentException
+     * 
+     * @param InTypes 单元类型数组，长度为 InCellCount
+     * @param InOffsets 单元偏移数组，长度为 InCellCount + 1
+     * @param InVertexIndices 连续存储的顶点索引
+     * @param InCellCount 单元数量
+     */
+    void AppendCells(const ECellType* InTypes, const uint32* InOffsets, const VertexIndexType* InVertexIndices, uint32 InCellCount);
+    
+    /**
+     * 批量添加同一类型的单元（移动语义）
+     * 如果当前数组为空，直接接管调用者的缓冲区，不发生拷贝
+     * @param CellType 单元类型
+     * @param Stride 每个单元的顶点数
+     * @param InVertexIndices 连续存储的顶点索引，长度必须是 Stride 的倍数
+     */
+    void AppendCells(ECellType CellType, uint32 Stride, TArray<VertexIndexType>&& InVertexIndices);
+    
+    /**
+     * 批量添加混合类型的单元（移动语义）
+     * 如果当前数组为空，直接接管调用者的缓冲区，不发生拷贝
+     * @param InTypes 单元类型数组
+     * @param InOffsets 单元偏移数组，长度为 InTypes.Num() + 1，首元素为 0，末元素为顶点索引总数，严格递增
+     * @param InVertexIndices 连续存储的顶点索引
+     */
+    void AppendCells(TArray<ECellType>&& InTypes, TArray<uint32>&& InOffsets, TArray<VertexIndexType>&& InVertexIndices);
+
     // ============================================================================
     // 获取单元
     // ============================================================================
@@ -203,6 +413,33 @@ public:
      * @return 顶点索引数组的指针，如果索引无效返回 nullptr
      */
     const VertexIndexType* GetCellVertexIndicesPtr(CellIndexType CellIndex, uint32& OutVertexCount) const;
+    
+    /**
+     * 获取指定索引的单元视图（不拷贝、不分配内存）
+     * @param CellIndex 单元索引
+     * @return 单元视图，如果索引无效返回无效视图（IsValid() 为 false）
+     */
+    [[nodiscard]] FCellView GetCellView(CellIndexType CellIndex) const;
+    
+    /**
+     * 获取指定索引的单元视图（不检查索引，用于遍历热路径）
+     * @param CellIndex 单元索引
+     * @return 单元视图
+     */
+    [[nodiscard]] FCellView GetCellViewUnchecked(CellIndexType CellIndex) const
+    {
+        uint32 StartOffset = 0;
+        uint32 VertexCount = 0;
+        GetCellRange(CellIndex, StartOffset, VertexCount);
+        return { bIsUniform ? UniformCellType : CellTypes[CellIndex], VertexIndices.GetData() + StartOffset, VertexCount };
+    }
+
+    // ============================================================================
+    // 迭代器（用于范围 for 循环）
+    // ============================================================================
+    
+    [[nodiscard]] FConstIterator begin() const { return { this, 0 }; }
+    [[nodiscard]] FConstIterator end() const { return { this, static_cast<CellIndexType>(CellCount) }; }
 
     // ============================================================================
     // 删除单元
@@ -230,6 +467,57 @@ public:
      */
     uint32 RemoveCellsByType(ECellType CellType);
     
+    /**
+     * 删除所有满足条件的单元（单次遍历原地压缩，O(N)）
+     * 
+     * 谓词签名：bool(CellIndexType CellIndex, const FCellView& Cell)，返回 true 表示删除
+     * 
+     * @param Predicate 删除条件
+     * @param OutRemap 可选，输出旧单元索引到新单元索引的映射，已删除的单元映射为 InvalidCellIndex
+     * @return 删除的单元数量
+     */
+    template<typename PredicateType>
+    uint32 RemoveCellsIf(PredicateType&& Predicate, TArray<CellIndexType>* OutRemap = nullptr)
+    {
+        TArray<uint8> KeepMask;
+        KeepMask.Resize(CellCount);
+        for (CellIndexType i = 0; i < static_cast<CellIndexType>(CellCount); ++i)
+        {
+            KeepMask[i] = Predicate(i, GetCellViewUnchecked(i)) ? 0 : 1;
+        }
+        return CompactCells(KeepMask, OutRemap);
+    }
+    
+    /**
+     * 只保留满足条件的单元（单次遍历原地压缩，O(N)）
+     * 
+     * 谓词签名：bool(CellIndexType CellIndex, const FCellView& Cell)，返回 true 表示保留
+     * 
+     * @param Predicate 保留条件
+     * @param OutRemap 可选，输出旧单元索引到新单元索引的映射，已删除的单元映射为 InvalidCellIndex
+     * @return 删除的单元数量
+     */
+    template<typename PredicateType>
+    uint32 KeepCellsIf(PredicateType&& Predicate, TArray<CellIndexType>* OutRemap = nullptr)
+    {
+        TArray<uint8> KeepMask;
+        KeepMask.Resize(CellCount);
+        for (CellIndexType i = 0; i < static_cast<CellIndexType>(CellCount); ++i)
+        {
+            KeepMask[i] = Predicate(i, GetCellViewUnchecked(i)) ? 1 : 0;
+        }
+        return CompactCells(KeepMask, OutRemap);
+    }
+    
+    /**
+     * 按掩码压缩单元（单次遍历原地压缩，O(N)）
+     * 压缩后如果只剩一种单元类型，自动恢复为均质存储
+     * @param KeepMask 每个单元一个字节，非 0 表示保留，长度必须等于单元数量
+     * @param OutRemap 可选，输出旧单元索引到新单元索引的映射，已删除的单元映射为 InvalidCellIndex
+     * @return 删除的单元数量
+     */
+    uint32 CompactCells(const TArray<uint8>& KeepMask, TArray<CellIndexType>* OutRemap = nullptr);
+    
     /**
      * 清空所有单元
      */
@@ -267,6 +555,7 @@ public:
     
     /**
      * 查找包含指定顶点的所有单元
+     * 每次查询都会扫描全部单元，需要大量查询时请使用 FCellLinks（或 IMesh::GetCellsUsingVertex）
      * @param VertexIndex 顶点索引
      * @param OutCellIndices 输出的单元索引列表
      * @return 找到的单元数量
@@ -299,4 +588,50 @@ public:
      * @return 内存使用量（字节）
      */
     [[nodiscard]] uint64 GetMemoryUsage() const;
+    
+    /**
+     * 获取内容版本号
+     * 单元内容每次变化（添加、删除、清空、赋值）后都会得到一个新的全局唯一版本号，
+     * 缓存（如顶点到单元的邻接表）可以据此判断是否需要重建
+     * @return 版本号
+     */
+    [[nodiscard]] uint64 GetVersion() const;
+
+private:
+    // ============================================================================
+    // 内部辅助函数
+    // ============================================================================
+    
+    /** 获取单元在 VertexIndices 中的起始位置和顶点数（不检查索引） */
+    void GetCellRange(CellIndexType CellIndex, uint32& OutStart, uint32& OutCount) const
+    {
+        if (bIsUniform)
+        {
+            OutStart = static_cast<uint32>(CellIndex) * UniformStride;
+            OutCount = UniformStride;
+        }
+        else
+        {
+            OutStart = CellOffsets[CellIndex];
+            OutCount = CellOffsets[CellIndex + 1] - OutStart;
+        }
+    }
+    
+    /** 检查添加的单元能否保持均质存储 */
+    [[nodiscard]] bool CanAppendUniform(ECellType CellType, uint32 VertexCount) const;
+    
+    /** 为即将添加的单元记录类型与偏移（必须在追加顶点索引之前调用） */
+    void BeginAppendCell(ECellType CellType, uint32 VertexCount);
+    
+    /** 将均质存储转换为混合存储（显式生成 CellOffsets 和 CellTypes） */
+    void ConvertToMixed();
+    
+    /** 如果混合存储中只有一种单元类型和顶点数，则转换为均质存储 */
+    bool TryConvertToUniform();
+    
+    /** 分配一个新的全局唯一版本号 */
+    static uint64 AllocateVersion();
+    
+    /** 标记单元内容已修改 */
+    void MarkModified() { Version = AllocateVersion(); }
 };
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "Container/ArrayView.h"
+#include "HAL/Platform.h"
+
+class FCellArray;
+
+/**
+ * FCellLinks - 顶点到单元的邻接表（向上链接）
+ * 
+ * 使用 CSR（压缩稀疏行）格式存储：
+ * - Offsets：长度为顶点数 + 1，Offsets[v] 到 Offsets[v + 1] 是顶点 v 的单元区间
+ * - Links：所有顶点相邻单元索引的连续存储，每个顶点内部按单元索引升序排列
+ * 
+ * 构建过程为两遍计数：第一遍统计每个顶点的相邻单元数，前缀和得到偏移，
+ * 第二遍填充单元索引。两遍都可以按单元并行执行
+ * 
+ * 使用示例：
+ *   FCellLinks Links;
+ *   Links.Build(Cells, VertexCount);
+ *   for (int32 CellIndex : Links.GetCells(VertexIndex)) { ... }
+ */
+class FCellLinks
+{
+public:
+    using CellIndexType = int32;
+
+    // ============================================================================
+    // 构造函数
+    // ============================================================================
+    
+    /** 默认构造函数（空邻接表） */
+    FCellLinks() = default;
+    
+    /**
+     * 构建顶点到单元的邻接表
+     * 同一单元中重复出现的顶点只记录一次，超出 [0, VertexCount) 的顶点索引被忽略
+     * @param Cells 单元数组
+     * @param VertexCount 顶点数量
+     * @param bParallel 是否并行构建（结果与串行构建完全一致）
+     */
+    void Build(const FCellArray& Cells, uint32 VertexCount, bool bParallel = true);
+    
+    /**
+     * 清空邻接表
+     */
+    void Clear();
+
+    // ============================================================================
+    // 查询
+    // ============================================================================
+    
+    /**
+     * 获取使用指定顶点的所有单元（按单元索引升序）
+     * @param VertexIndex 顶点索引
+     * @return 单元索引视图，顶点索引无效时返回空视图
+     */
+    [[nodiscard]] TArrayView<const CellIndexType> GetCells(uint32 VertexIndex) const
+    {
+        if (VertexIndex >= GetVertexCount())
+        {
+            return {};
+        }
+        return TArrayView<const CellIndexType>(Links.GetData() + Offsets[VertexIndex], Offsets[VertexIndex + 1] - Offsets[VertexIndex]);
+    }
+    
+    /**
+     * 获取使用指定顶点的单元数量
+     * @param VertexIndex 顶点索引
+     * @return 单元数量
+     */
+    [[nodiscard]] uint32 GetCellCount(uint32 VertexIndex) const
+    {
+        return VertexIndex < GetVertexCount() ? Offsets[VertexIndex + 1] - Offsets[VertexIndex] : 0;
+    }
+    
+    /** 获取顶点数量 */
+    [[nodiscard]] uint32 GetVertexCount() const { return Offsets.IsEmpty() ? 0 : Offsets.Num() - 1; }
+    
+    /** 获取链接总数 */
+    [[nodiscard]] uint32 GetLinkCount() const { return Links.Num(); }
+    
+    /** 检查是否为空 */
+    [[nodiscard]] bool IsEmpty() const { return Offsets.IsEmpty(); }
+    
+    /** 获取偏移数组 */
+    [[nodiscard]] const TArray<uint32>& GetOffsets() const { return Offsets; }
+    
+    /** 获取链接数组 */
+    [[nodiscard]] const TArray<CellIndexType>& GetLinks() const { return Links; }
+    
+    /**
+     * 获取当前内存使用情况（估算）
+     * @return 内存使用量（字节）
+     */
+    [[nodiscard]] uint64 GetMemoryUsage() const;
+
+private:
+    /** 每个顶点在 Links 中的起始偏移（长度为顶点数 + 1） */
+    TArray<uint32> Offsets;
+    
+    /** 相邻单元索引 */
+    TArray<CellIndexType> Links;
+};
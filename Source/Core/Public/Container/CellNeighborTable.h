@@ -0,0 +1,153 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "Container/ArrayView.h"
+#include "HAL/Platform.h"
+
+class FCellArray;
+
+/**
+ * FCellNeighborTable - 单元到单元的邻接表（通过共享边界面相邻）
+ * 
+ * 边界面的定义见 ICellType::GetFaceLocalIndices：
+ * - 三维单元通过共享面相邻
+ * - 二维单元通过共享边相邻
+ * - 一维单元通过共享端点相邻
+ * 
+ * 存储格式：
+ * 每个单元的每个边界面对应 Neighbors 中的一个元素，记录该面另一侧的单元索引，
+ * 边界面（没有相邻单元）记为 NoNeighbor。均质单元数组每个单元的面数相同，不需要偏移数组
+ * 
+ * 构建算法：
+ * 1. 对每个面的已排序全局顶点索引计算 64 位哈希
+ * 2. 按哈希高位分桶，每个桶内使用开放寻址哈希表配对共享面
+ * 各步骤都可以并行执行，且结果与串行构建完全一致。额外内存约为每个面 12 字节（构建完成后释放）
+ * 
+ * 注意：同一个面被三个及以上单元共享（非流形）时，按单元顺序两两配对
+ * 
+ * 使用示例：
+ *   FCellNeighborTable Table;
+ *   Table.Build(Cells);
+ *   for (int32 Neighbor : Table.GetNeighbors(CellIndex)) { ... }
+ */
+class FCellNeighborTable
+{
+public:
+    using CellIndexType = int32;
+
+    /** 边界面（没有相邻单元）的标记 */
+    static constexpr CellIndexType NoNeighbor = -1;
+
+    // ============================================================================
+    // 构造函数
+    // ============================================================================
+    
+    /** 默认构造函数（空邻接表） */
+    FCellNeighborTable() = default;
+    
+    /**
+     * 构建单元邻接表
+     * @param Cells 单元数组
+     * @param bParallel 是否并行构建
+     */
+    void Build(const FCellArray& Cells, bool bParallel = true);
+    
+    /**
+     * 清空邻接表
+     */
+    void Clear();
+
+    // ============================================================================
+    // 查询
+    // ============================================================================
+    
+    /** 获取单元数量 */
+    [[nodiscard]] uint32 GetCellCount() const { return CellCount; }
+    
+    /** 获取所有单元的边界面总数 */
+    [[nodiscard]] uint32 GetTotalFaceCount() const { return Neighbors.Num(); }
+    
+    /** 获取没有相邻单元的边界面数量 */
+    [[nodiscard]] uint32 GetBoundaryFaceCount() const { return BoundaryFaceCount; }
+    
+    /**
+     * 获取单元第一个面在邻接数组中的位置
+     * @param CellIndex 单元索引（不检查边界）
+     */
+    [[nodiscard]] uint32 GetFaceOffset(uint32 CellIndex) const
+    {
+        return FaceOffsets.IsEmpty() ? CellIndex * UniformFaceCount : FaceOffsets[CellIndex];
+    }
+    
+    /**
+     * 获取单元的边界面数量
+     * @param CellIndex 单元索引
+     * @return 面数量，单元索引无效时返回 0
+     */
+    [[nodiscard]] uint32 GetFaceCount(uint32 CellIndex) const
+    {
+        return CellIndex < CellCount ? GetFaceOffset(CellIndex + 1) - GetFaceOffset(CellIndex) : 0;
+    }
+    
+    /**
+     * 获取单元各个面的相邻单元（按面索引排列，边界面为 NoNeighbor）
+     * @param CellIndex 单元索引
+     * @return 相邻单元视图，单元索引无效时返回空视图
+     */
+    [[nodiscard]] TArrayView<const CellIndexType> GetNeighbors(uint32 CellIndex) const
+    {
+        if (CellIndex >= CellCount)
+        {
+            return {};
+        }
+        const uint32 Offset = GetFaceOffset(CellIndex);
+        return TArrayView<const CellIndexType>(Neighbors.GetData() + Offset, GetFaceOffset(CellIndex + 1) - Offset);
+    }
+    
+    /**
+     * 获取单元指定面的相邻单元
+     * @param CellIndex 单元索引
+     * @param FaceIndex 面索引
+     * @return 相邻单元索引，边界面或索引无效时返回 NoNeighbor
+     */
+    [[nodiscard]] CellIndexType GetNeighbor(uint32 CellIndex, uint32 FaceIndex) const
+    {
+        return FaceIndex < GetFaceCount(CellIndex) ? Neighbors[GetFaceOffset(CellIndex) + FaceIndex] : NoNeighbor;
+    }
+    
+    /**
+     * 检查单元指定面是否为边界面
+     */
+    [[nodiscard]] bool IsBoundaryFace(uint32 CellIndex, uint32 FaceIndex) const
+    {
+        return GetNeighbor(CellIndex, FaceIndex) == NoNeighbor;
+    }
+    
+    /** 获取所有面的相邻单元数组 */
+    [[nodiscard]] const TArray<CellIndexType>& GetNeighborArray() const { return Neighbors; }
+    
+    /** 检查是否为空 */
+    [[nodiscard]] bool IsEmpty() const { return CellCount == 0; }
+    
+    /**
+     * 获取当前内存使用情况（估算）
+     * @return 内存使用量（字节）
+     */
+    [[nodiscard]] uint64 GetMemoryUsage() const;
+
+private:
+    /** 每个单元第一个面在 Neighbors 中的位置（长度为单元数 + 1，均质单元数组时为空） */
+    TArray<uint32> FaceOffsets;
+    
+    /** 均质单元数组时每个单元的面数 */
+    uint32 UniformFaceCount = 0;
+    
+    /** 单元数量 */
+    uint32 CellCount = 0;
+    
+    /** 没有相邻单元的边界面数量 */
+    uint32 BoundaryFaceCount = 0;
+    
+    /** 每个面另一侧的单元索引 */
+    TArray<CellIndexType> Neighbors;
+};
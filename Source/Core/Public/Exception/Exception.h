@@ -21,7 +21,8 @@ enum class EExceptionCode : int32
     AlreadyExists,       // 资源已存在
     InvalidState,        // 无效状态
     Timeout,             // 超时
-    NotSupported         // 不支持的操作
+    NotSupported,        // 不支持的操作
+    Canceled             // 操作被取消
 };
 
 /**
@@ -279,6 +280,20 @@ public:
     );
 };
 
+/**
+ * FOperationCanceledException - 操作取消异常（长时间运行的操作响应取消请求时抛出）
+ */
+class FOperationCanceledException : public FException
+{
+public:
+    FOperationCanceledException(
+        const std::string& InMessage,
+        const std::string& InFileName = "",
+        int32 InLineNumber = 0,
+        const std::string& InFunctionName = ""
+    );
+};
+
 // ============================================================================
 // 辅助宏
 // ============================================================================
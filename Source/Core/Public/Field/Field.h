@@ -1,8 +1,13 @@
 #pragma once
 
 #include "Container/Array.h"
+#include "Container/ArrayView.h"
 #include "Math/Vector.h"
+#include "Math/Float16.h"
+#include "Memory/SharedPtr.h"
 #include "HAL/Platform.h"
+#include <atomic>
+#include <mutex>
 #include <string>
 
 #include "Math/Math.h"
@@ -27,17 +32,74 @@ enum class EFieldType : uint8
     Tensor,     // 张量场（如应力、应变）- 每个元素 9 个 float (3x3 矩阵)
 };
 
+/**
+ * 场数据的存储类型
+ * 与 EFieldType 无关：场类型决定每个元素的分量数量，存储类型决定每个分量占用的字节
+ */
+enum class EFieldStorage : uint8
+{
+    Float32,    // 单精度浮点（默认）
+    Float16,    // 半精度浮点（结果场的紧凑存储）
+    Float64,    // 双精度浮点（求解器的高精度输出）
+    Int32,      // 32 位整数（材料 ID、部件 ID）
+    UInt8,      // 8 位无符号整数（标记、分类）
+};
+
+inline std::string EnumToString(EFieldStorage Storage)
+{
+    switch (Storage)
+    {
+        case EFieldStorage::Float32: return "Float32";
+        case EFieldStorage::Float16: return "Float16";
+        case EFieldStorage::Float64: return "Float64";
+        case EFieldStorage::Int32: return "Int32";
+        case EFieldStorage::UInt8: return "UInt8";
+        default: return "Unknown";
+    }
+}
+
+/** 获取存储类型每个分量的字节数 */
+inline uint32 GetFieldStorageSize(EFieldStorage Storage)
+{
+    switch (Storage)
+    {
+        case EFieldStorage::Float16: return 2;
+        case EFieldStorage::Float64: return 8;
+        case EFieldStorage::UInt8: return 1;
+        case EFieldStorage::Float32:
+        case EFieldStorage::Int32:
+        default: return 4;
+    }
+}
+
+class FCompressedFieldData;
+struct FFieldCompressionOptions;
+class FMappedFile;
+
+/** C++ 类型到存储类型的映射（用于类型化的数据视图） */
+template<typename T> struct TFieldStorageTraits;
+template<> struct TFieldStorageTraits<float> { static constexpr EFieldStorage Storage = EFieldStorage::Float32; };
+template<> struct TFieldStorageTraits<FFloat16> { static constexpr EFieldStorage Storage = EFieldStorage::Float16; };
+template<> struct TFieldStorageTraits<double> { static constexpr EFieldStorage Storage = EFieldStorage::Float64; };
+template<> struct TFieldStorageTraits<int32> { static constexpr EFieldStorage Storage = EFieldStorage::Int32; };
+template<> struct TFieldStorageTraits<uint8> { static constexpr EFieldStorage Storage = EFieldStorage::UInt8; };
+
 /**
  * FField - 场数据类
  * 
  * 设计特点：
- * 1. 统一使用连续存储：所有数据存储在 TArray<float> 中
+ * 1. 数据以连续数组存储，每个场任一时刻只有一种存储形式：
+ *    - Float32 存储（默认）：TArray<float>
+ *    - 其他存储类型（EFieldStorage，如 Float16、Int32）：按存储类型解释的字节数组
+ *    - 分块压缩存储（Compress）：读取接口按块透明解码，修改数据时自动解压
+ *    - 外部只读存储（如内存映射文件）：读取时零拷贝，修改数据时自动复制
  * 2. 支持标量、向量、张量三种数据类型
  * 3. 明确区分节点场和单元场
- * 4. 提供统一的数据访问接口
- * 5. 支持获取底层指针（用于 GPU 上传等）
+ * 4. float 访问接口（GetScalar、GetFloatData 等）适用于所有存储形式，按需转换或解码
+ * 5. 底层指针（GetRawDataPtr、GetRawStorage）直接暴露存储，只适用于对应的未压缩存储
+ * 6. 缓存每个分量和模长的数据范围（用于颜色映射），只在数据被修改后重新计算
  * 
- * 存储格式：
+ * 存储格式（分量的排列与存储类型无关）：
  * - Scalar: [v0, v1, v2, ...] (每个元素 1 个 float)
  * - Vector: [x0, y0, z0, x1, y1, z1, ...] (每个元素 3 个 float)
  * - Tensor: [t0_00, t0_01, ..., t0_22, t1_00, ...] (每个元素 9 个 float，按行优先)
@@ -48,11 +110,38 @@ private:
     /** 场名称 */
     std::string FieldName;
 
-    /** 数据数组（连续存储） */
+    /** 数据数组（连续存储，存储类型为 Float32 时使用） */
     TArray<float> Data;
 
-    /** TODO:数据范围 */
-    TArray<float> DataRange;
+    /** 其他存储类型的数据（按存储类型解释的字节，Float32 时为空） */
+    TAlignedArray<uint8, 16> TypedData;
+
+    /** 存储类型 */
+    EFieldStorage Storage = EFieldStorage::Float32;
+
+    /** 压缩数据（不为空时 Data 与 TypedData 为空；压缩数据不可修改，拷贝时共享） */
+    TSharedPtr<const FCompressedFieldData> CompressedData;
+
+    /** 外部只读数据（不为空时 Data 与 TypedData 为空，按存储类型解释） */
+    const void* ExternalData = nullptr;
+
+    /** 外部数据的所有者（保证外部数据在场的生命周期内有效） */
+    TSharedPtr<const FMappedFile> ExternalOwner;
+
+    /**
+     * 数据范围缓存：[Min0, Max0, Min1, Max1, ..., MagnitudeMin, MagnitudeMax]
+     * 首次查询时计算；整体修改数据的操作使其失效，单个元素的修改和添加增量更新
+     */
+    mutable TArray<float> DataRange;
+
+    /** 数据范围缓存是否有效 */
+    mutable std::atomic<bool> bDataRangeValid{false};
+
+    /** 保护数据范围缓存的计算与更新 */
+    mutable std::mutex DataRangeMutex;
+
+    /** 内容版本号（数据每次变化时更新，全局唯一；拷贝得到新的版本号） */
+    uint64 Version = AllocateVersion();
 
     /** 数据数量（节点数或单元数） */
     uint32 DataCount;
@@ -74,6 +163,12 @@ public:
     FField();
     FField(const std::string& InFieldName, EFieldType InFieldType, EFieldAttachment InAttachment, uint32 FieldDimension = 1);
     
+    /** 拷贝与移动（数据范围缓存随数据一起拷贝） */
+    FField(const FField& Other);
+    FField(FField&& Other) noexcept;
+    FField& operator=(const FField& Other);
+    FField& operator=(FField&& Other) noexcept;
+
     /** 析构函数 */
     ~FField() = default;
 
@@ -104,12 +199,23 @@ public:
     /** 获取每个元素包含的 float 数量 */
     uint32 GetFieldDimension() const;
     
-    /** 获取底层数据指针（用于 GPU 上传等） */
+    /**
+     * 获取底层 float 数据指针（用于 GPU 上传等）
+     * 注意：只适用于未压缩的 Float32 存储，存储类型不是 Float32 或数据被压缩时抛出 FInvalidOperationException；
+     * 不确定存储形式时使用 GetFloatData(ConversionBuffer)，它对所有存储形式都返回 float 数据
+     */
     const float* GetRawDataPtr() const;
+
+    /** 获取底层数据指针（按 GetStorage() 解释；const 版本要求未压缩，非 const 版本会自动解压并使数据范围缓存失效） */
+    const void* GetRawStorage() const;
+    void* GetRawStorage();
     
-    /** 获取底层数据大小（字节） */
+    /** 获取底层数据大小（字节，与存储类型相关，压缩时为解压后的大小） */
     size_t GetRawDataSize() const;
 
+    /** 获取数据实际占用的内存（字节，压缩时为压缩后的大小，引用外部存储时为 0） */
+    size_t GetMemorySize() const;
+
     // ============================================================================
     // 标量场操作
     // ============================================================================
@@ -178,7 +284,7 @@ public:
     /** 设置指定索引的张量数据 */
     void SetData(uint32 Index, const TArray<float>& Value);
 
-    /** 获取所有数据 */
+    /** 获取所有数据（仅限 Float32 存储；const 版本要求未压缩，非 const 版本会自动解压并使数据范围缓存失效） */
     TArray<float>& GetFieldData();
     const TArray<float>& GetFieldData() const;
 
@@ -193,5 +299,182 @@ public:
 
     /** 设置大小，实际大小与 FieldDimension 相关 */
     void Resize(uint32 Size);
+
+    /**
+     * 按索引映射表原地压缩数据（用于单元/顶点删除后同步场数据）
+     * @param OldToNew 旧索引到新索引的映射，负值表示删除；保留的元素必须保持原有顺序
+     */
+    void CompactData(const TArray<int32>& OldToNew);
+
+    // ============================================================================
+    // 存储类型
+    // ============================================================================
+
+    /** 获取存储类型 */
+    EFieldStorage GetStorage() const;
+
+    /**
+     * 修改存储类型，已有数据按新类型转换
+     * 转换为整数时四舍五入并截断到类型范围，转换为 Float16 时超出范围的值变为无穷大
+     */
+    void SetStorage(EFieldStorage NewStorage);
+
+    /**
+     * 获取类型化的只读数据视图
+     * @tparam T 必须与当前存储类型一致（float/FFloat16/double/int32/uint8），否则抛出异常
+     */
+    template<typename T>
+    TArrayView<const T> GetTypedData() const
+    {
+        CheckStorage(TFieldStorageTraits<T>::Storage);
+        return TArrayView<const T>(static_cast<const T*>(GetRawStorage()), GetValueCount());
+    }
+
+    /** 获取类型化的可写数据视图（会使数据范围缓存失效） */
+    template<typename T>
+    TArrayView<T> GetTypedData()
+    {
+        CheckStorage(TFieldStorageTraits<T>::Storage);
+        return TArrayView<T>(static_cast<T*>(GetRawStorage()), GetValueCount());
+    }
+
+    /** 设置类型化数据，存储类型切换为 T 对应的类型 */
+    template<typename T>
+    void SetTypedData(const TArray<T>& InData)
+    {
+        SetRawStorage(TFieldStorageTraits<T>::Storage, InData.GetData(), InData.Num());
+    }
+
+    /** 将数据转换为 float 输出（Float32 存储时直接拷贝，压缩时并行解码） */
+    void CopyToFloat(TArray<float>& OutData) const;
+
+    /**
+     * 获取 float 数据指针，非 Float32 存储或压缩时转换到 ConversionBuffer 中
+     * @return 未压缩的 Float32 存储时为底层指针，否则为 ConversionBuffer 的数据指针
+     */
+    const float* GetFloatData(TArray<float>& ConversionBuffer) const;
+
+    // ============================================================================
+    // 压缩
+    // ============================================================================
+
+    /** 是否以压缩形式存储 */
+    [[nodiscard]] bool IsCompressed() const;
+
+    /**
+     * 压缩数据，释放未压缩的存储（已压缩时先解压再按新选项压缩）
+     * 有损压缩会改变数据，数据范围缓存随之失效
+     */
+    void Compress(const FFieldCompressionOptions& Options);
+
+    /** 解压数据（未压缩时不做任何操作） */
+    void Decompress();
+
+    /** 获取压缩数据（未压缩时为 nullptr） */
+    const FCompressedFieldData* GetCompressedData() const;
+
+    /**
+     * 解码压缩数据的一个块并转换为 float（全场运算逐块处理压缩场，不分配整个场的解压副本）
+     * 块的划分由 GetCompressedData() 的 GetNumBlocks / GetBlockValueCount 给出，块的边界与元素对齐
+     * @param BlockIndex 块编号
+     * @param OutValues 输出该块的分量（调整为块的分量数，重复使用同一数组可避免重新分配）
+     * 未压缩时抛出 FInvalidOperationException
+     */
+    void DecodeFloatBlock(uint32 BlockIndex, TArray<float>& OutValues) const;
+
+    // ============================================================================
+    // 外部存储
+    // ============================================================================
+
+    /**
+     * 引用外部只读数据（不拷贝），替换当前数据
+     * @param InStorage 外部数据的存储类型
+     * @param InData 外部数据（NumValues 个分量，按 InStorage 解释）
+     * @param NumValues 分量总数（必须是 FieldDimension 的倍数）
+     * @param Owner 外部数据的所有者，场持有其引用直到数据被替换或复制
+     */
+    void SetExternalData(EFieldStorage InStorage, const void* InData, uint32 NumValues, TSharedPtr<const FMappedFile> Owner);
+
+    /** 是否引用外部存储 */
+    [[nodiscard]] bool IsExternal() const;
+
+    /** 将压缩或外部数据转换为自有的可修改存储（修改数据的接口会自动调用） */
+    void MakeWritable();
+
+    // ============================================================================
+    // 数据范围
+    // ============================================================================
+
+    /** GetDataRange 中表示模长（所有分量平方和的平方根）的分量索引 */
+    static constexpr int32 MagnitudeComponent = -1;
+
+    /**
+     * 获取数据范围（首次调用时使用 SIMD 归约计算并缓存，之后为 O(1)）
+     * @param Component 分量索引，MagnitudeComponent 表示模长
+     * @param OutMin 输出最小值
+     * @param OutMax 输出最大值
+     * @return 场为空或分量索引无效时返回 false
+     */
+    bool GetDataRange(int32 Component, float& OutMin, float& OutMax) const;
+
+    /** 数据范围缓存是否有效 */
+    [[nodiscard]] bool IsDataRangeValid() const;
+
+    /** 使数据范围缓存失效并更新版本号（通过 GetRawDataPtr 等方式直接修改数据后调用） */
+    void InvalidateDataRange();
+
+    /**
+     * 获取内容版本号
+     * 数据每次变化（设置、修改、添加、转换存储类型、有损压缩、获取可写指针）后都会得到一个新的全局唯一版本号，
+     * 依赖场数据的缓存（如等值面的区间索引）可以据此判断是否需要重建
+     */
+    [[nodiscard]] uint64 GetVersion() const { return Version; }
+
+private:
+    /** 分配一个新的全局唯一版本号 */
+    static uint64 AllocateVersion();
+
+    /** 标记数据已修改 */
+    void MarkModified() { Version = AllocateVersion(); }
+
+    /** 当前存储的分量总数（DataCount * FieldDimension） */
+    uint32 GetValueCount() const;
+
+    /** 检查存储类型是否一致，不一致时抛出异常 */
+    void CheckStorage(EFieldStorage Expected) const;
+
+    /** 检查数据未压缩，否则抛出异常 */
+    void CheckNotCompressed() const;
+
+    /** 释放对外部数据的引用 */
+    void ReleaseExternalData();
+
+    /** 设置存储类型与原始数据（NumValues 个分量） */
+    void SetRawStorage(EFieldStorage NewStorage, const void* InData, uint32 NumValues);
+
+    /** 整体替换为 float 数据（按当前存储类型转换） */
+    void AssignFloatData(const float* InData, uint32 NumValues);
+
+    /** 读取第 ValueIndex 个分量并转换为 float */
+    float ReadValue(uint32 ValueIndex) const;
+
+    /** 从 Offset 开始写入 Count 个分量（按存储类型转换，并维护数据范围） */
+    void WriteValues(uint32 Offset, const float* Values, uint32 Count);
+
+    /** 在末尾追加 Count 个分量（按存储类型转换，并维护数据范围） */
+    void AppendValues(const float* Values, uint32 Count);
+
+    /**
+     * 计算数据范围（格式与 DataRange 相同，不写入缓存）
+     * 调用时不能持有 DataRangeMutex：并行归约的等待期间本线程可能执行其他任务，其中的查询会再次获取该锁
+     */
+    TArray<float> ComputeDataRange() const;
+
+    /**
+     * 单个元素修改时增量更新数据范围
+     * @param OldValue 旧值（为 nullptr 表示新增元素）
+     * @param NewValue 新值（FieldDimension 个 float）
+     */
+    void UpdateDataRange(const float* OldValue, const float* NewValue);
 };
 
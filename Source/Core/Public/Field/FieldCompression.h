@@ -0,0 +1,165 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "Field/Field.h"
+#include "HAL/Platform.h"
+#include "Memory/SharedPtr.h"
+
+/**
+ * 场数据压缩方法
+ */
+enum class EFieldCompression : uint8
+{
+    Lossless,   // 无损：同分量相邻值异或后按字节平面做零游程编码，适用于所有存储类型
+    Lossy,      // 有损：按误差界量化后做差分变长编码，仅用于浮点存储（其他存储类型回退为无损）
+};
+
+inline std::string EnumToString(EFieldCompression Compression)
+{
+    switch (Compression)
+    {
+        case EFieldCompression::Lossless: return "Lossless";
+        case EFieldCompression::Lossy: return "Lossy";
+        default: return "Unknown";
+    }
+}
+
+/**
+ * 场数据压缩选项
+ */
+struct FFieldCompressionOptions
+{
+    /** 压缩方法 */
+    EFieldCompression Method = EFieldCompression::Lossless;
+
+    /** 有损压缩允许的最大绝对误差（必须大于 0） */
+    double ErrorBound = 0.0;
+
+    /** 每个块的元素数量（块是随机访问和并行解码的单位） */
+    uint32 BlockElementCount = 1024;
+
+    /** 是否并行压缩 */
+    bool bParallel = true;
+};
+
+/**
+ * FCompressedFieldData - 分块压缩的场数据（创建后不可修改，可在多个场之间共享）
+ *
+ * 设计特点：
+ * 1. 数据按固定元素数量分块，每个块独立编码，可以单独解码（随机访问）和并行解码
+ * 2. 每个块记录自己的编码方式：有损量化失败（非有限值、超出量化范围）的块回退为无损编码
+ * 3. 按分量索引读取时在线程局部缓存中保留最近解码的块，同一块内的连续访问只解码一次
+ * 4. 全场运算逐块解码（ForEachBlock、DecodeBlock 或 FField::DecodeFloatBlock），每个任务的内存占用只有一个块
+ *
+ * 使用示例：
+ *   TSharedPtr<FCompressedFieldData> Compressed = FCompressedFieldData::Compress(Data, EFieldStorage::Float32, Num, 3, Options);
+ *   Compressed->ForEachBlock([&](uint32 FirstValue, const void* Values, uint32 NumValues) { ... });
+ */
+class FCompressedFieldData
+{
+public:
+    /** 构造空数据（使用 Compress 创建） */
+    FCompressedFieldData() = default;
+
+    /**
+     * 压缩数据
+     * @param Data 原始数据（按 Storage 解释）
+     * @param Storage 存储类型
+     * @param NumValues 分量总数
+     * @param Dimension 每个元素的分量数（同一分量的相邻值一起编码）
+     * @param Options 压缩选项
+     */
+    static TSharedPtr<FCompressedFieldData> Compress(const void* Data, EFieldStorage Storage, uint32 NumValues, uint32 Dimension,
+        const FFieldCompressionOptions& Options = FFieldCompressionOptions());
+
+    /** 获取存储类型 */
+    EFieldStorage GetStorage() const { return Storage; }
+
+    /** 获取压缩方法 */
+    EFieldCompression GetMethod() const { return Method; }
+
+    /** 获取有损压缩的误差界（无损时为 0） */
+    double GetErrorBound() const { return ErrorBound; }
+
+    /** 获取分量总数 */
+    uint32 GetNumValues() const { return NumValues; }
+
+    /** 获取每个块的分量数量（最后一个块可能更少） */
+    uint32 GetBlockValueCount() const { return BlockValueCount; }
+
+    /** 获取块数量 */
+    uint32 GetNumBlocks() const;
+
+    /** 获取指定块的分量数量 */
+    uint32 GetBlockNumValues(uint32 BlockIndex) const;
+
+    /** 获取压缩后的字节数 */
+    size_t GetCompressedSize() const;
+
+    /** 获取解压后的字节数 */
+    size_t GetUncompressedSize() const;
+
+    /**
+     * 解码单个块
+     * @param OutValues 输出（至少 GetBlockNumValues(BlockIndex) 个存储类型的分量）
+     */
+    void DecodeBlock(uint32 BlockIndex, void* OutValues) const;
+
+    /**
+     * 解码全部数据
+     * @param OutValues 输出（GetUncompressedSize() 字节）
+     * @param bParallel 是否并行解码
+     */
+    void Decode(void* OutValues, bool bParallel = true) const;
+
+    /**
+     * 获取指定分量的指针（解码所在的块到线程局部缓存）
+     * @return 指向存储类型分量的指针，在同一线程下一次调用前有效
+     */
+    const void* GetValuePtr(uint32 ValueIndex) const;
+
+    /**
+     * 按顺序流式解码每个块
+     * @param Func 签名 void(uint32 FirstValue, const void* Values, uint32 NumValues)
+     */
+    template<typename FuncType>
+    void ForEachBlock(FuncType&& Func) const
+    {
+        TArray<uint8> Buffer;
+        Buffer.Resize(BlockValueCount * GetFieldStorageSize(Storage));
+        const uint32 NumBlocks = GetNumBlocks();
+        for (uint32 Block = 0; Block < NumBlocks; ++Block)
+        {
+            DecodeBlock(Block, Buffer.GetData());
+            Func(Block * BlockValueCount, static_cast<const void*>(Buffer.GetData()), GetBlockNumValues(Block));
+        }
+    }
+
+private:
+    /** 全局唯一标识（用于线程局部解码缓存） */
+    uint64 Id = 0;
+
+    /** 存储类型 */
+    EFieldStorage Storage = EFieldStorage::Float32;
+
+    /** 压缩方法 */
+    EFieldCompression Method = EFieldCompression::Lossless;
+
+    /** 有损压缩的量化步长为 2 * ErrorBound */
+    double ErrorBound = 0.0;
+
+    /** 分量总数 */
+    uint32 NumValues = 0;
+
+    /** 每个元素的分量数 */
+    uint32 Dimension = 1;
+
+    /** 每个块的分量数量（Dimension 的倍数） */
+    uint32 BlockValueCount = 0;
+
+    /** 编码后的数据流 */
+    TArray<uint8> Stream;
+
+    /** 每个块在数据流中的起始位置（NumBlocks + 1 个） */
+    TArray<uint64> BlockOffsets;
+};
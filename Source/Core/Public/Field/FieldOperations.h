@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "HAL/Platform.h"
+
+class FField;
+
+/**
+ * 场统计结果
+ */
+struct FFieldStatistics
+{
+    /** 参与统计的元素数量 */
+    uint32 Count = 0;
+
+    /** 每个分量的最小值（Count 为 0 时为空） */
+    TArray<float> Min;
+
+    /** 每个分量的最大值 */
+    TArray<float> Max;
+
+    /** 每个分量的平均值（使用 double 累加） */
+    TArray<double> Mean;
+};
+
+/**
+ * FFieldOperations - 整个场的并行运算
+ * 
+ * 设计特点：
+ * 1. 逐元素运算（模长、张量不变量）按区间并行，每个元素的结果与线程数无关
+ * 2. 归约运算（统计）使用 ParallelReduce 按固定区间合并，结果与线程数无关（逐位一致）
+ * 3. 输出场与输入场绑定位置相同；输出场名称为空时使用 输入场名称 + 后缀；输出场不能与输入场相同
+ * 
+ * 张量约定：每个元素 9 个 float，3x3 矩阵按行优先存储，计算前取对称部分 (T + T^T) / 2
+ * 
+ * 使用示例：
+ *   FField VonMises;
+ *   FFieldOperations::ComputeVonMises(StressField, VonMises);
+ *   FFieldStatistics Stats = FFieldOperations::ComputeStatistics(VonMises);
+ */
+struct FFieldOperations
+{
+    /**
+     * 计算每个分量的最小值、最大值、平均值
+     * @param Field 输入场
+     * @param bParallel 是否并行计算
+     */
+    static FFieldStatistics ComputeStatistics(const FField& Field, bool bParallel = true);
+
+    /**
+     * 计算每个元素的模长（所有分量平方和的平方根，张量场即 Frobenius 范数）
+     * @param Field 输入场
+     * @param OutField 输出标量场（名称后缀 "_Magnitude"）
+     * @param bParallel 是否并行计算
+     */
+    static void ComputeMagnitude(const FField& Field, FField& OutField, bool bParallel = true);
+
+    /**
+     * 计算张量场的 von Mises 等效应力
+     * sqrt(((s11 - s22)^2 + (s22 - s33)^2 + (s33 - s11)^2) / 2 + 3 (s12^2 + s23^2 + s31^2))
+     * @param TensorField 输入张量场（非张量场抛出 FInvalidOperationException）
+     * @param OutField 输出标量场（名称后缀 "_VonMises"）
+     * @param bParallel 是否并行计算
+     */
+    static void ComputeVonMises(const FField& TensorField, FField& OutField, bool bParallel = true);
+
+    /**
+     * 计算张量场的三个主值（对称部分的特征值，按从大到小排列）
+     * @param TensorField 输入张量场（非张量场抛出 FInvalidOperationException）
+     * @param OutField 输出向量场 (S1, S2, S3)（名称后缀 "_Principal"）
+     * @param bParallel 是否并行计算
+     */
+    static void ComputePrincipalValues(const FField& TensorField, FField& OutField, bool bParallel = true);
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "HAL/Platform.h"
+#include "Memory/SharedPtr.h"
+#include <string>
+
+/**
+ * FMappedFile - 只读内存映射文件
+ *
+ * 文件内容按需由操作系统分页加载，映射在对象销毁时解除
+ * 通过 TSharedPtr 共享，指向映射内存的对象（如外部存储的 FField）持有引用以保证映射有效
+ *
+ * 使用示例：
+ *   TSharedPtr<FMappedFile> File = FMappedFile::Open("Mesh.ivm");
+ *   const uint8* Bytes = File->GetData();
+ */
+class FMappedFile
+{
+public:
+    /**
+     * 映射文件
+     * @param Path 文件路径
+     * @return 映射文件（空文件的数据指针为 nullptr），无法打开或映射时抛出 FFileIOException
+     */
+    static TSharedPtr<FMappedFile> Open(const std::string& Path);
+
+    ~FMappedFile();
+
+    FMappedFile(const FMappedFile&) = delete;
+    FMappedFile& operator=(const FMappedFile&) = delete;
+
+    /** 获取映射内存的首地址（按页对齐） */
+    const uint8* GetData() const { return Data; }
+
+    /** 获取文件大小（字节） */
+    uint64 GetSize() const { return Size; }
+
+    /** 获取文件路径 */
+    const std::string& GetPath() const { return Path; }
+
+    /**
+     * 提示操作系统异步预读指定范围（POSIX 使用 madvise(MADV_WILLNEED)，Windows 使用 PrefetchVirtualMemory）
+     * 立即返回，磁盘读取由操作系统在后台进行，与调用线程和任务调度无关；范围超出文件时截断到文件末尾
+     * @param Offset 起始偏移（字节）
+     * @param Length 长度（字节）
+     */
+    void Prefetch(uint64 Offset, uint64 Length) const;
+
+private:
+    FMappedFile() = default;
+
+    /** 映射内存首地址 */
+    const uint8* Data = nullptr;
+
+    /** 文件大小 */
+    uint64 Size = 0;
+
+    /** 文件路径 */
+    std::string Path;
+
+#if PLATFORM_WINDOWS
+    /** 文件句柄与映射句柄（避免在头文件中包含 windows.h） */
+    void* FileHandle = nullptr;
+    void* MappingHandle = nullptr;
+#endif
+};
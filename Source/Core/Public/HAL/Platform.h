@@ -55,3 +55,23 @@ typedef FPlatformTypes::int16		int16;
 typedef FPlatformTypes::int32		int32;
 /// A 64-bit signed integer.
 typedef FPlatformTypes::int64		int64;
+
+//------------------------------------------------------------------
+// CPU architecture
+//------------------------------------------------------------------
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define PLATFORM_CPU_X86_FAMILY 1
+#else
+    #define PLATFORM_CPU_X86_FAMILY 0
+#endif
+
+//------------------------------------------------------------------
+// Operating system
+//------------------------------------------------------------------
+
+#if defined(_WIN32)
+    #define PLATFORM_WINDOWS 1
+#else
+    #define PLATFORM_WINDOWS 0
+#endif
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "HAL/Platform.h"
+
+/**
+ * FPlatformCPU - 运行时 CPU 特性检测
+ * 
+ * 检测结果在首次调用时计算并缓存，非 x86 平台上所有 x86 指令集均返回 false
+ */
+struct FPlatformCPU
+{
+    /** 是否支持 SSE4.2 指令集 */
+    static bool HasSSE42();
+
+    /** 是否支持 AVX2 指令集（同时检查操作系统是否保存 YMM 寄存器） */
+    static bool HasAVX2();
+};
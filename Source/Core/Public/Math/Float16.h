@@ -0,0 +1,110 @@
+#pragma once
+
+#include "HAL/Platform.h"
+#include <cstring>
+
+/**
+ * FFloat16 - IEEE 754 半精度浮点数（1 位符号，5 位指数，10 位尾数）
+ * 只用于存储，运算前转换为 float；float 转换为半精度时按就近舍入（偶数优先）
+ *
+ * 可表示范围约为 ±65504，超出范围的值转换为无穷大，小于 2^-24 的值转换为 0
+ */
+struct FFloat16
+{
+    /** 编码后的位模式 */
+    uint16 Encoded = 0;
+
+    FFloat16() = default;
+
+    FFloat16(float Value) : Encoded(FromFloat(Value)) {}
+
+    operator float() const { return ToFloat(Encoded); }
+
+    /** float 转换为半精度位模式 */
+    static uint16 FromFloat(float Value)
+    {
+        uint32 Bits;
+        std::memcpy(&Bits, &Value, sizeof(Bits));
+
+        const uint32 Sign = (Bits >> 16) & 0x8000u;
+        const uint32 Abs = Bits & 0x7FFFFFFFu;
+
+        // 无穷大与 NaN（NaN 保留为静默 NaN）
+        if (Abs >= 0x7F800000u)
+        {
+            return static_cast<uint16>(Sign | 0x7C00u | (Abs > 0x7F800000u ? 0x0200u : 0u));
+        }
+        // 不小于 65520 的值舍入后超出范围
+        if (Abs >= 0x477FF000u)
+        {
+            return static_cast<uint16>(Sign | 0x7C00u);
+        }
+        // 小于 2^-14 的值转换为非规格化数
+        if (Abs < 0x38800000u)
+        {
+            if (Abs < 0x33000000u)
+            {
+                return static_cast<uint16>(Sign);
+            }
+            const uint32 Exponent = Abs >> 23;
+            const uint32 Mantissa = (Abs & 0x007FFFFFu) | 0x00800000u;
+            const uint32 Shift = 126u - Exponent;
+            uint32 Half = Mantissa >> Shift;
+            const uint32 Remainder = Mantissa & ((1u << Shift) - 1u);
+            const uint32 Halfway = 1u << (Shift - 1u);
+            if (Remainder > Halfway || (Remainder == Halfway && (Half & 1u)))
+            {
+                ++Half;
+            }
+            return static_cast<uint16>(Sign | Half);
+        }
+
+        // 规格化数：指数偏移从 127 调整为 15，尾数舍去低 13 位（进位可以自然进入指数）
+        uint32 Half = (Abs - 0x38000000u) >> 13;
+        const uint32 Remainder = Abs & 0x1FFFu;
+        if (Remainder > 0x1000u || (Remainder == 0x1000u && (Half & 1u)))
+        {
+            ++Half;
+        }
+        return static_cast<uint16>(Sign | Half);
+    }
+
+    /** 半精度位模式转换为 float（精确转换） */
+    static float ToFloat(uint16 Half)
+    {
+        const uint32 Sign = (static_cast<uint32>(Half) & 0x8000u) << 16;
+        const uint32 Exponent = (Half >> 10) & 0x1Fu;
+        uint32 Mantissa = Half & 0x03FFu;
+
+        uint32 Bits;
+        if (Exponent == 0x1Fu)
+        {
+            Bits = Sign | 0x7F800000u | (Mantissa << 13);
+        }
+        else if (Exponent != 0)
+        {
+            Bits = Sign | ((Exponent + 112u) << 23) | (Mantissa << 13);
+        }
+        else if (Mantissa == 0)
+        {
+            Bits = Sign;
+        }
+        else
+        {
+            // 非规格化数：移位直到出现隐含的最高位
+            uint32 NormalizedExponent = 113u;
+            while ((Mantissa & 0x0400u) == 0)
+            {
+                Mantissa <<= 1;
+                --NormalizedExponent;
+            }
+            Bits = Sign | (NormalizedExponent << 23) | ((Mantissa & 0x03FFu) << 13);
+        }
+
+        float Result;
+        std::memcpy(&Result, &Bits, sizeof(Result));
+        return Result;
+    }
+};
+
+static_assert(sizeof(FFloat16) == 2, "FFloat16 must be 2 bytes");
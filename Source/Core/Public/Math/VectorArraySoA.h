@@ -0,0 +1,143 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "Math/Math.h"
+#include "HAL/Platform.h"
+
+/**
+ * FVectorArraySoA - 结构数组（SoA）布局的 FVector 数组
+ * 
+ * X、Y、Z 分量分别连续存储在 64 字节对齐的 float 数组中，
+ * 便于包围盒、坐标变换、距离等批量计算使用 SIMD 指令
+ * 
+ * 存储格式：
+ * - X: [x0, x1, x2, ...]
+ * - Y: [y0, y1, y2, ...]
+ * - Z: [z0, z1, z2, ...]
+ * 
+ * 使用示例：
+ *   FVectorArraySoA Positions;
+ *   Positions.CopyFrom(Vertices.GetData(), Vertices.Num());
+ *   float* X = Positions.GetX();
+ *   for (uint32 i = 0; i < Positions.Num(); ++i) { X[i] += 1.0f; }
+ */
+class FVectorArraySoA
+{
+public:
+    /** SoA 分量数组的对齐字节数 */
+    static constexpr uint32 Alignment = 64;
+
+    using ComponentArray = TAlignedArray<float, Alignment>;
+
+    // ============================================================================
+    // 构造函数
+    // ============================================================================
+
+    /** 默认构造函数（空数组） */
+    FVectorArraySoA() = default;
+
+    /** 创建指定数量的元素（分量初始化为 0） */
+    explicit FVectorArraySoA(uint32 Count) { Resize(Count); }
+
+    // ============================================================================
+    // 容量相关
+    // ============================================================================
+
+    /** 获取元素数量 */
+    [[nodiscard]] uint32 Num() const { return static_cast<uint32>(X.Num()); }
+
+    /** 检查是否为空 */
+    [[nodiscard]] bool IsEmpty() const { return X.IsEmpty(); }
+
+    /** 设置元素数量 */
+    void Resize(uint32 Count);
+
+    /** 预留容量 */
+    void Reserve(uint32 Capacity);
+
+    /** 清空所有元素 */
+    void Reset();
+
+    /** 收缩内存以匹配实际大小 */
+    void Shrink();
+
+    // ============================================================================
+    // 元素访问
+    // ============================================================================
+
+    /** 获取指定索引的向量（不检查边界） */
+    [[nodiscard]] FVector Get(uint32 Index) const { return FVector(X[Index], Y[Index], Z[Index]); }
+
+    /** 设置指定索引的向量（不检查边界） */
+    void Set(uint32 Index, const FVector& Value)
+    {
+        X[Index] = Value.X;
+        Y[Index] = Value.Y;
+        Z[Index] = Value.Z;
+    }
+
+    /** 在末尾添加向量 */
+    void Add(const FVector& Value)
+    {
+        X.Add(Value.X);
+        Y.Add(Value.Y);
+        Z.Add(Value.Z);
+    }
+
+    /** 获取分量数组指针（64 字节对齐） */
+    [[nodiscard]] float* GetX() { return X.GetData(); }
+    [[nodiscard]] float* GetY() { return Y.GetData(); }
+    [[nodiscard]] float* GetZ() { return Z.GetData(); }
+    [[nodiscard]] const float* GetX() const { return X.GetData(); }
+    [[nodiscard]] const float* GetY() const { return Y.GetData(); }
+    [[nodiscard]] const float* GetZ() const { return Z.GetData(); }
+
+    // ============================================================================
+    // 与 AoS 布局相互转换
+    // ============================================================================
+
+    /**
+     * 从 AoS 数组拷贝（覆盖现有数据）
+     * @param Source AoS 数据
+     * @param Count 元素数量
+     * @param bParallel 是否并行拷贝
+     */
+    void CopyFrom(const FVector* Source, uint32 Count, bool bParallel = true);
+
+    /**
+     * 在末尾追加 AoS 数据
+     * @param Source AoS 数据
+     * @param Count 元素数量
+     */
+    void Append(const FVector* Source, uint32 Count);
+
+    /**
+     * 拷贝到 AoS 数组
+     * @param Dest 输出缓冲区，至少 Num() 个元素
+     * @param bParallel 是否并行拷贝
+     */
+    void CopyTo(FVector* Dest, bool bParallel = true) const;
+
+    /**
+     * 转换为 AoS 数组
+     * @param OutArray 输出数组（大小会被设置为 Num()）
+     * @param bParallel 是否并行拷贝
+     */
+    void CopyTo(TArray<FVector>& OutArray, bool bParallel = true) const;
+
+    /**
+     * 获取当前内存使用情况（估算）
+     * @return 内存使用量（字节）
+     */
+    [[nodiscard]] uint64 GetMemoryUsage() const;
+
+private:
+    /** X 分量 */
+    ComponentArray X;
+
+    /** Y 分量 */
+    ComponentArray Y;
+
+    /** Z 分量 */
+    ComponentArray Z;
+};
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "Container/ArrayView.h"
+#include "Math/Math.h"
+#include "HAL/Platform.h"
+#include <string>
+
+class FVectorArraySoA;
+
+/**
+ * SIMD 指令集级别
+ */
+enum class ESimdLevel : uint8
+{
+    Scalar,     // 标量实现（所有平台可用）
+    SSE42,      // SSE4.2，每次处理 4 个向量
+    AVX2        // AVX2，每次处理 8 个向量
+};
+
+inline std::string EnumToString(ESimdLevel Level)
+{
+    switch (Level)
+    {
+        case ESimdLevel::Scalar: return "Scalar";
+        case ESimdLevel::SSE42: return "SSE42";
+        case ESimdLevel::AVX2: return "AVX2";
+        default: return "Unknown";
+    }
+}
+
+/**
+ * FVectorKernels - 向量数组批量计算内核
+ * 
+ * 设计特点：
+ * 1. 对整个 FVector 数组（AoS）或 FVectorArraySoA 进行平移、缩放、点积、叉积、长度、归一化、包围盒计算
+ * 2. 运行时根据 CPU 支持情况在 AVX2 / SSE4.2 / 标量实现之间分发，结果与 TVector 逐元素运算一致
+ * 3. FVector3d 数组使用标量实现
+ * 
+ * 注意：
+ * - 输出视图的元素数量必须与输入一致，否则抛出 FInvalidArgumentException
+ * - 叉积的输出可以与输入为同一数组
+ * - 归一化与 TVector::Normalize 一致：长度不大于 epsilon 的向量被置为零向量
+ * 
+ * 使用示例：
+ *   TArray<FVector> Positions = ...;
+ *   FVectorKernels::Translate(TArrayView<FVector>(Positions.GetData(), Positions.Num()), FVector(1.0f, 0.0f, 0.0f));
+ */
+class FVectorKernels
+{
+public:
+    // ============================================================================
+    // 指令集选择
+    // ============================================================================
+
+    /** 获取当前 CPU 支持的最高指令集级别 */
+    static ESimdLevel GetSupportedLevel();
+
+    /** 获取当前使用的指令集级别（默认为支持的最高级别） */
+    static ESimdLevel GetActiveLevel();
+
+    /**
+     * 设置使用的指令集级别（用于测试和性能对比）
+     * @param Level 指令集级别，超过 CPU 支持的级别时使用支持的最高级别
+     * @return 实际生效的级别
+     */
+    static ESimdLevel SetActiveLevel(ESimdLevel Level);
+
+    // ============================================================================
+    // FVector 数组（AoS）
+    // ============================================================================
+
+    /** 所有向量加上 Offset */
+    static void Translate(TArrayView<FVector> Data, const FVector& Offset);
+
+    /** 所有向量乘以 Scale */
+    static void Scale(TArrayView<FVector> Data, float Scale);
+
+    /** 所有向量按分量乘以 Scale */
+    static void Scale(TArrayView<FVector> Data, const FVector& Scale);
+
+    /** Out[i] = A[i] · B[i] */
+    static void Dot(TArrayView<const FVector> A, TArrayView<const FVector> B, TArrayView<float> Out);
+
+    /** Out[i] = A[i] × B[i] */
+    static void Cross(TArrayView<const FVector> A, TArrayView<const FVector> B, TArrayView<FVector> Out);
+
+    /** Out[i] = |Data[i]| */
+    static void Length(TArrayView<const FVector> Data, TArrayView<float> Out);
+
+    /** 原地归一化所有向量 */
+    static void Normalize(TArrayView<FVector> Data);
+
+    /**
+     * 计算轴对齐包围盒
+     * @return 数组为空时返回 false，且不修改输出
+     */
+    static bool ComputeBounds(TArrayView<const FVector> Data, FVector& OutMin, FVector& OutMax);
+
+    // ============================================================================
+    // 交错存储的多分量数据
+    // ============================================================================
+
+    /**
+     * 计算每个分量的范围
+     * @param Data 交错存储的数据 [e0c0, e0c1, ..., e1c0, ...]，长度必须为 Dimension 的倍数
+     * @param Dimension 每个元素的分量数量
+     * @param OutMin 输出每个分量的最小值（至少 Dimension 个 float）
+     * @param OutMax 输出每个分量的最大值（至少 Dimension 个 float）
+     * @return 数据为空时返回 false，且不修改输出
+     */
+    static bool ComputeComponentBounds(TArrayView<const float> Data, uint32 Dimension, float* OutMin, float* OutMax);
+
+    /**
+     * 生成范围选择位图：Min <= Data[i] <= Max 时第 i 位（字 i / 64 的第 i % 64 位）为 1，NaN 不被选中
+     * @param Data 标量数据
+     * @param Min 下界
+     * @param Max 上界
+     * @param OutBits 输出位图，字数必须为 ceil(Data.Num() / 64)，否则抛出 FInvalidArgumentException；最后一个字的多余位为 0
+     * @return 被选中的元素数量
+     */
+    static uint32 RangeMask(TArrayView<const float> Data, float Min, float Max, TArrayView<uint64> OutBits);
+
+    // ============================================================================
+    // FVector3d 数组（AoS，标量实现）
+    // ============================================================================
+
+    static void Translate(TArrayView<FVector3d> Data, const FVector3d& Offset);
+    static void Scale(TArrayView<FVector3d> Data, double Scale);
+    static void Scale(TArrayView<FVector3d> Data, const FVector3d& Scale);
+    static void Dot(TArrayView<const FVector3d> A, TArrayView<const FVector3d> B, TArrayView<double> Out);
+    static void Cross(TArrayView<const FVector3d> A, TArrayView<const FVector3d> B, TArrayView<FVector3d> Out);
+    static void Length(TArrayView<const FVector3d> Data, TArrayView<double> Out);
+    static void Normalize(TArrayView<FVector3d> Data);
+    static bool ComputeBounds(TArrayView<const FVector3d> Data, FVector3d& OutMin, FVector3d& OutMax);
+
+    // ============================================================================
+    // FVectorArraySoA
+    // ============================================================================
+
+    static void Translate(FVectorArraySoA& Data, const FVector& Offset);
+    static void Scale(FVectorArraySoA& Data, float Scale);
+    static void Scale(FVectorArraySoA& Data, const FVector& Scale);
+    static void Dot(const FVectorArraySoA& A, const FVectorArraySoA& B, TArrayView<float> Out);
+    static void Length(const FVectorArraySoA& Data, TArrayView<float> Out);
+    static void Normalize(FVectorArraySoA& Data);
+    static bool ComputeBounds(const FVectorArraySoA& Data, FVector& OutMin, FVector& OutMax);
+};
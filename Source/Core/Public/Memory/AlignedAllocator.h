@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+/**
+ * TAlignedAllocator - 按指定字节对齐分配内存的分配器
+ * 满足标准分配器要求，可作为 TArray / std::vector 的分配器参数
+ * 
+ * 使用示例：
+ *   TArray<float, TAlignedAllocator<float, 64>> Buffer;   // 数据首地址按 64 字节对齐
+ * 
+ * @tparam T 元素类型
+ * @tparam Alignment 对齐字节数（必须为 2 的幂，且不小于 alignof(T)）
+ */
+template<typename T, std::size_t Alignment = 64>
+class TAlignedAllocator
+{
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(T), "Alignment must not be smaller than alignof(T)");
+
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = TAlignedAllocator<U, Alignment>;
+    };
+
+    TAlignedAllocator() noexcept = default;
+
+    template<typename U>
+    TAlignedAllocator(const TAlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t Count)
+    {
+        return static_cast<T*>(::operator new(Count * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* Ptr, std::size_t) noexcept
+    {
+        ::operator delete(Ptr, std::align_val_t(Alignment));
+    }
+
+    template<typename U>
+    bool operator==(const TAlignedAllocator<U, Alignment>&) const noexcept { return true; }
+
+    template<typename U>
+    bool operator!=(const TAlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <functional>
+#include "Container/Array.h"
+#include "HAL/Platform.h"
+
+/**
+ * 并行循环标志
+ */
+enum class EParallelForFlags : uint8
+{
+    None = 0,
+    ForceSingleThread = 1 << 0,    // 强制在调用线程上串行执行（用于调试或小数据量）
+};
+
+/**
+ * FParallelFor - 数据并行循环工具
+ * 
+ * 将 [0, Num) 切分为若干大小为 GrainSize 的区间，由 FTaskGraph 的工作线程执行，
+ * 调用线程同样参与计算，所有区间完成后才返回（可在任务内部嵌套调用）
+ * 
+ * 注意：调用线程等待期间会帮助执行任务图中的任意任务（见 FTaskGraph::Wait），
+ * 因此不能在持有锁时调用 ParallelFor / ParallelForRange / ParallelReduce，
+ * 否则被帮助执行的任务再次获取同一把锁时会自我死锁；必须持锁时使用 EParallelForFlags::ForceSingleThread
+ * 
+ * 使用示例：
+ *   ParallelForRange(CellCount, 4096, [&](uint32 Begin, uint32 End)
+ *   {
+ *       for (uint32 i = Begin; i < End; ++i) { ... }
+ *   });
+ */
+struct FParallelFor
+{
+    /**
+     * 获取并行循环使用的工作线程数量（包括调用线程）
+     */
+    static uint32 GetNumWorkers();
+
+    /**
+     * 按区间并行执行
+     * @param Num 元素数量
+     * @param GrainSize 每个区间的最小元素数量（为 0 时自动选择）
+     * @param Body 区间函数，签名 void(uint32 Begin, uint32 End)
+     * @param Flags 执行标志
+     */
+    static void Range(uint32 Num, uint32 GrainSize, const std::function<void(uint32, uint32)>& Body, EParallelForFlags Flags = EParallelForFlags::None);
+};
+
+/**
+ * 按区间并行执行（全局函数版本）
+ * Body 签名：void(uint32 Begin, uint32 End)
+ */
+inline void ParallelForRange(uint32 Num, uint32 GrainSize, const std::function<void(uint32, uint32)>& Body, EParallelForFlags Flags = EParallelForFlags::None)
+{
+    FParallelFor::Range(Num, GrainSize, Body, Flags);
+}
+
+/**
+ * 按元素并行执行
+ * Body 签名：void(uint32 Index)
+ */
+template<typename BodyType>
+void ParallelFor(uint32 Num, BodyType&& Body, EParallelForFlags Flags = EParallelForFlags::None)
+{
+    FParallelFor::Range(Num, 0, [&Body](uint32 Begin, uint32 End)
+    {
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            Body(i);
+        }
+    }, Flags);
+}
+
+/**
+ * 并行归约（结果确定）
+ * 
+ * 按固定的 GrainSize 切分区间，每个区间独立计算部分结果，最后按区间顺序合并，
+ * 因此浮点运算的结合顺序只与 GrainSize 有关，与线程数量和调度顺序无关
+ * 与 FParallelFor 相同，调用时不能持有锁（必须持锁时使用 EParallelForFlags::ForceSingleThread）
+ * 
+ * @param Num 元素数量
+ * @param GrainSize 每个区间的元素数量（为 0 时使用 DefaultReduceGrainSize，不随线程数变化）
+ * @param Identity 初始值（Num 为 0 时直接返回）
+ * @param Map 区间函数，签名 T(uint32 Begin, uint32 End)
+ * @param Combine 合并函数，签名 T(const T& A, const T& B)
+ * @param Flags 执行标志
+ * 
+ * 使用示例：
+ *   double Sum = ParallelReduce<double>(Num, 0, 0.0,
+ *       [&](uint32 Begin, uint32 End) { double S = 0; for (uint32 i = Begin; i < End; ++i) S += Data[i]; return S; },
+ *       [](double A, double B) { return A + B; });
+ */
+constexpr uint32 DefaultReduceGrainSize = 65536;
+
+template<typename T, typename MapType, typename CombineType>
+T ParallelReduce(uint32 Num, uint32 GrainSize, const T& Identity, MapType&& Map, CombineType&& Combine, EParallelForFlags Flags = EParallelForFlags::None)
+{
+    if (Num == 0)
+    {
+        return Identity;
+    }
+    if (GrainSize == 0)
+    {
+        GrainSize = DefaultReduceGrainSize;
+    }
+
+    const uint32 NumChunks = (Num + GrainSize - 1) / GrainSize;
+    TArray<T> Partials;
+    Partials.Resize(NumChunks, Identity);
+    FParallelFor::Range(NumChunks, 1, [&](uint32 ChunkBegin, uint32 ChunkEnd)
+    {
+        for (uint32 Chunk = ChunkBegin; Chunk < ChunkEnd; ++Chunk)
+        {
+            const uint32 Begin = Chunk * GrainSize;
+            const uint32 End = Num - Begin > GrainSize ? Begin + GrainSize : Num;
+            Partials[Chunk] = Map(Begin, End);
+        }
+    }, Flags);
+
+    T Result = Identity;
+    for (uint32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+    {
+        Result = Combine(Result, Partials[Chunk]);
+    }
+    return Result;
+}
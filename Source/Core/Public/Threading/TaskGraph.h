@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include "Container/Array.h"
+#include "Container/ArrayView.h"
+#include "Memory/SharedPtr.h"
+#include "Memory/UniquePtr.h"
+#include "HAL/Platform.h"
+
+struct FTaskState;
+struct FTaskGraphWorker;
+
+/**
+ * FTaskHandle - 任务句柄
+ * 
+ * 引用一个已提交的任务，用于查询完成状态、作为其他任务的前置依赖或等待任务完成
+ */
+class FTaskHandle
+{
+public:
+    FTaskHandle() = default;
+
+    /** 是否引用了任务 */
+    [[nodiscard]] bool IsValid() const { return State.IsValid(); }
+
+    /** 任务是否已执行完毕（无效句柄视为已完成） */
+    [[nodiscard]] bool IsCompleted() const;
+
+private:
+    friend class FTaskGraph;
+
+    explicit FTaskHandle(TSharedPtr<FTaskState> InState) : State(std::move(InState)) {}
+
+    TSharedPtr<FTaskState> State;
+};
+
+/**
+ * FTaskGraph - 工作窃取任务调度器
+ * 
+ * 设计特点：
+ * 1. 每个工作线程拥有一个双端队列：本线程从尾部取任务（LIFO，缓存友好），空闲线程从其他队列头部窃取
+ * 2. 非工作线程（Framework / Renderer 线程等）提交的任务进入共享注入队列
+ * 3. 任务可以声明前置依赖，所有前置任务完成后才会进入队列
+ * 4. Wait 在等待期间帮助执行队列中的任务，任务内部嵌套等待不会死锁
+ * 
+ * 注意：
+ * - 任务抛出的异常会被保存，在 Wait 该任务时重新抛出；前置任务失败不会阻止后续任务执行
+ * - Wait 帮助执行的可以是队列中的任意任务，而不只是被等待任务的子任务：
+ *   不能在持有锁时调用 Wait / WaitAll（以及内部会等待的 ParallelFor / ParallelReduce），
+ *   否则被帮助执行的任务再次获取同一把锁时会自我死锁。按需构建的缓存应在锁外计算，只在发布结果时加锁
+ * - 提交到全局实例的任务不能依赖静态对象的析构顺序
+ * 
+ * 使用示例：
+ *   FTaskGraph& Graph = FTaskGraph::Get();
+ *   FTaskHandle A = Graph.Launch([]() { LoadMesh(); });
+ *   FTaskHandle B = Graph.Launch([]() { BuildLinks(); }, { A });
+ *   Graph.Wait(B);
+ */
+class FTaskGraph
+{
+public:
+    /**
+     * 创建调度器并启动工作线程
+     * @param NumWorkerThreads 工作线程数量（为 0 时使用硬件线程数 - 1，至少为 1）
+     */
+    explicit FTaskGraph(uint32 NumWorkerThreads = 0);
+
+    /** 析构函数：执行完所有已提交的任务后停止工作线程 */
+    ~FTaskGraph();
+
+    FTaskGraph(const FTaskGraph&) = delete;
+    FTaskGraph& operator=(const FTaskGraph&) = delete;
+
+    /** 获取全局调度器（首次调用时创建） */
+    static FTaskGraph& Get();
+
+    /** 获取工作线程数量（不包括调用 Wait 帮助执行的线程） */
+    [[nodiscard]] uint32 GetNumWorkerThreads() const;
+
+    /** 当前线程是否为本调度器的工作线程 */
+    [[nodiscard]] bool IsWorkerThread() const;
+
+    // ============================================================================
+    // 任务提交与等待
+    // ============================================================================
+
+    /**
+     * 提交任务
+     * @param Body 任务函数
+     * @param Prerequisites 前置任务，全部完成后才执行本任务
+     * @return 任务句柄
+     */
+    FTaskHandle Launch(std::function<void()> Body, TArrayView<const FTaskHandle> Prerequisites = TArrayView<const FTaskHandle>());
+    FTaskHandle Launch(std::function<void()> Body, std::initializer_list<FTaskHandle> Prerequisites);
+
+    /**
+     * 等待任务完成，等待期间帮助执行其他任务（可能是队列中任意无关的任务，调用时不能持有锁）
+     * 任务抛出异常时在此重新抛出
+     */
+    void Wait(const FTaskHandle& Task);
+
+    /** 等待所有任务完成，抛出第一个失败任务的异常（与 Wait 相同，调用时不能持有锁） */
+    void WaitAll(TArrayView<const FTaskHandle> Tasks);
+
+    /**
+     * 在调用线程上执行一个待执行的任务（用于其他线程的主循环在空闲时参与计算）
+     * @return 是否执行了任务
+     */
+    bool TryExecuteTask();
+
+private:
+    /** 将依赖已满足的任务放入队列 */
+    void Enqueue(TSharedPtr<FTaskState> Task);
+
+    /** 取出一个任务：本线程队列尾部 -> 注入队列 -> 窃取其他线程队列头部 */
+    TSharedPtr<FTaskState> Dequeue();
+
+    /** 执行任务并释放依赖它的任务 */
+    void Execute(const TSharedPtr<FTaskState>& Task);
+
+    /** 工作线程主循环 */
+    void WorkerLoop(uint32 WorkerIndex);
+
+    /** 工作线程 */
+    TArray<TUniquePtr<FTaskGraphWorker>> Workers;
+
+    /** 注入队列（非工作线程提交的任务） */
+    TUniquePtr<FTaskGraphWorker> InjectionQueue;
+
+    /** 已入队但尚未取出的任务数量 */
+    std::atomic<int64> QueuedTaskCount{0};
+
+    /** 正在 Wait 中休眠的线程数量 */
+    std::atomic<uint32> SleepingWaiterCount{0};
+
+    /** 工作线程休眠与唤醒 */
+    std::mutex WakeMutex;
+    std::condition_variable WakeCondition;
+
+    /** 等待线程休眠与唤醒（任务完成时通知） */
+    std::mutex CompletionMutex;
+    std::condition_variable CompletionCondition;
+
+    /** 窃取时的起始位置（分散窃取目标） */
+    std::atomic<uint32> StealCursor{0};
+
+    /** 是否正在关闭 */
+    std::atomic<bool> bShutdown{false};
+};
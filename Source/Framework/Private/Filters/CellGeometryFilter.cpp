@@ -0,0 +1,21 @@
+#include "Filters/CellGeometryFilter.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+
+FField* FCellGeometryFilter::Execute(IMesh& Mesh, ECellGeometryQuantity Quantity, const std::string& FieldName, bool bParallel)
+{
+    TUniquePtr<FField> Field = MakeUnique<FField>();
+    Field->Initialize(FieldName.empty() ? EnumToString(Quantity) : FieldName, FCellGeometry::GetFieldType(Quantity), EFieldAttachment::Cell);
+    Execute(static_cast<const IMesh&>(Mesh), Quantity, *Field, bParallel);
+
+    const std::string ResultName = Field->GetFieldName();
+    Mesh.SetField(std::move(Field));
+    return Mesh.GetCellField(ResultName);
+}
+
+void FCellGeometryFilter::Execute(const IMesh& Mesh, ECellGeometryQuantity Quantity, FField& OutField, bool bParallel)
+{
+    const TArray<FVector>& Positions = Mesh.GetVerticesPositions();
+    FCellGeometry::Compute(TArrayView<const FVector>(Positions.GetData(), Positions.Num()), Mesh.GetCells(), Quantity, OutField, bParallel);
+}
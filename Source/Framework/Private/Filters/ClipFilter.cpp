@@ -0,0 +1,784 @@
+#include "Filters/ClipFilter.h"
+#include "ContourCaseTables.h"
+#include "FilterUtils.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace
+{
+    /** 每个任务处理的单元数 */
+    constexpr uint32 CellGrainSize = 16384;
+
+    /** 按顶点并行时的区间粒度 */
+    constexpr uint32 VertexGrainSize = 65536;
+
+    /** 单元的裁剪状态 */
+    enum class ECellClip : uint8
+    {
+        Discard,
+        Keep,
+        Split,
+    };
+
+    /** 单个任务的输出 */
+    struct FTaskOutput
+    {
+        /** 完整保留的单元 */
+        TArray<uint32> KeptCells;
+
+        /** 完整保留的单元的顶点索引总数 */
+        uint32 KeptIndexCount = 0;
+
+        /** 分解产生的单元类型 */
+        TArray<ECellType> PieceTypes;
+
+        /** 分解产生的单元的角点数 */
+        TArray<uint32> PieceCornerCounts;
+
+        /** 分解产生的单元的角点：输入顶点 V 为 (V, V) 的边键，裁剪点为所在边的键 */
+        TArray<uint64> PieceCornerKeys;
+
+        /** 分解产生的单元的父单元 */
+        TArray<int32> PieceParents;
+    };
+
+    /** 计算每个顶点的裁剪值（保留侧 >= 0） */
+    void ComputeClipValues(const IMesh& Input, const FClipFunction& Function, bool bInvert, TArray<float>& OutValues, EParallelForFlags Flags)
+    {
+        const uint32 VertexCount = Input.GetVertexCount();
+        OutValues.Resize(VertexCount);
+        const FVector* Positions = Input.GetVerticesPositionsPtr();
+        const float Sign = bInvert ? -1.0f : 1.0f;
+
+        switch (Function.Type)
+        {
+            case EClipFunction::Plane:
+            {
+                const FVector UnitNormal = Function.Normal.GetSafeNormal();
+                if (UnitNormal.IsZero())
+                {
+                    THROW_EXCEPTION(FInvalidArgumentException, "Clip plane normal must not be zero");
+                }
+                ParallelForRange(VertexCount, VertexGrainSize, [&](uint32 Begin, uint32 End)
+                {
+                    for (uint32 i = Begin; i < End; ++i)
+                    {
+                        OutValues[i] = Sign * UnitNormal.Dot(Positions[i] - Function.Origin);
+                    }
+                }, Flags);
+                break;
+            }
+            case EClipFunction::Box:
+            {
+                const FVector& Min = Function.BoxMin;
+                const FVector& Max = Function.BoxMax;
+                if (!(Min.X <= Max.X && Min.Y <= Max.Y && Min.Z <= Max.Z))
+                {
+                    THROW_EXCEPTION(FInvalidArgumentException, "Clip box minimum must not exceed maximum");
+                }
+                ParallelForRange(VertexCount, VertexGrainSize, [&](uint32 Begin, uint32 End)
+                {
+                    for (uint32 i = Begin; i < End; ++i)
+                    {
+                        const FVector& P = Positions[i];
+                        const float Inside = std::min({ P.X - Min.X, Max.X - P.X, P.Y - Min.Y, Max.Y - P.Y, P.Z - Min.Z, Max.Z - P.Z });
+                        OutValues[i] = Sign * Inside;
+                    }
+                }, Flags);
+                break;
+            }
+            case EClipFunction::Scalar:
+            {
+                const FField* Field = Input.GetVertexField(Function.FieldName);
+                if (!Field)
+                {
+                    THROW_EXCEPTION(FInvalidArgumentException, "Vertex field not found: " + Function.FieldName);
+                }
+                if (Field->GetFieldType() != EFieldType::Scalar || Field->GetDataCount() != VertexCount)
+                {
+                    THROW_EXCEPTION(FInvalidArgumentException, "Clip field must be a vertex scalar field: " + Function.FieldName);
+                }
+                TArray<float> ConversionBuffer;
+                const float* Scalars = Field->GetFloatData(ConversionBuffer);
+                const float Threshold = Function.Threshold;
+                ParallelForRange(VertexCount, VertexGrainSize, [&](uint32 Begin, uint32 End)
+                {
+                    for (uint32 i = Begin; i < End; ++i)
+                    {
+                        OutValues[i] = Sign * (Scalars[i] - Threshold);
+                    }
+                }, Flags);
+                break;
+            }
+        }
+    }
+
+    /**
+     * 边 (In, Out) 上裁剪点的角点键（In 在保留侧，Out 在另一侧）
+     * In 的裁剪值为 0 时裁剪点与 In 重合，返回 In 的角点键，使裁剪点与该顶点合并
+     */
+    uint64 MakeClipPointKey(int32 In, int32 Out, const float* Values)
+    {
+        return Values[In] == 0.0f ? FFilterUtils::MakeEdgeKey(In, In) : FFilterUtils::MakeEdgeKey(In, Out);
+    }
+
+    /** 单元是否按多边形或折线裁剪 */
+    bool IsPolygonOrPolyLine(ECellType CellType)
+    {
+        switch (CellType)
+        {
+            case ECellType::Triangle:
+            case ECellType::Quad:
+            case ECellType::Polygon:
+            case ECellType::Line:
+            case ECellType::PolyLine:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /** 输出一个分解产生的单元 */
+    void AddPiece(ECellType CellType, const uint64* Keys, uint32 CornerCount, int32 ParentCell, FTaskOutput& TaskOutput)
+    {
+        TaskOutput.PieceTypes.Add(CellType);
+        TaskOutput.PieceCornerCounts.Add(CornerCount);
+        TaskOutput.PieceCornerKeys.Append(Keys, CornerCount);
+        TaskOutput.PieceParents.Add(ParentCell);
+    }
+
+    /** 带符号的四面体体积的 6 倍（P1 - P0、P2 - P0、P3 - P0 构成右手系时为正） */
+    float SignedTetraVolume(const FVector& P0, const FVector& P1, const FVector& P2, const FVector& P3)
+    {
+        return (P1 - P0).Cross(P2 - P0).Dot(P3 - P0);
+    }
+
+    /**
+     * 裁剪一个四面体，保留侧的部分输出为 Tetra（一个顶点在保留侧）或 Prism（两个或三个顶点在保留侧）；
+     * 保留侧的顶点在裁剪面上时 Prism 退化为 Pyramid 或 Tetra
+     * 输出单元的顶点顺序符合单元定义（底面法线指向其余顶点，带符号的体积为正）
+     */
+    void ClipTetra(const int32 Tet[4], const float* Values, const FVector* Positions, int32 ParentCell, FTaskOutput& TaskOutput)
+    {
+        int32 Inside[4];
+        int32 Outside[4];
+        uint32 InsideCount = 0;
+        uint32 OutsideCount = 0;
+        bool bAllInsideOnSurface = true;
+        for (uint32 k = 0; k < 4; ++k)
+        {
+            if (Values[Tet[k]] >= 0.0f)
+            {
+                Inside[InsideCount++] = Tet[k];
+                bAllInsideOnSurface &= Values[Tet[k]] == 0.0f;
+            }
+            else
+            {
+                Outside[OutsideCount++] = Tet[k];
+            }
+        }
+        // 保留侧的顶点都在裁剪面上时保留部分的体积为 0
+        if (InsideCount == 0 || bAllInsideOnSurface)
+        {
+            return;
+        }
+
+        // 角点以边键表示，同时计算坐标用于确定顶点顺序
+        uint64 Keys[6];
+        FVector Points[6];
+        uint32 CornerCount = 0;
+        auto AddVertex = [&](int32 V)
+        {
+            Keys[CornerCount] = FFilterUtils::MakeEdgeKey(V, V);
+            Points[CornerCount++] = Positions[V];
+        };
+        auto AddEdge = [&](int32 In, int32 Out)
+        {
+            const float T = Values[In] / (Values[In] - Values[Out]);
+            Keys[CornerCount] = MakeClipPointKey(In, Out, Values);
+            Points[CornerCount++] = Positions[In] + (Positions[Out] - Positions[In]) * T;
+        };
+
+        ECellType CellType = ECellType::Prism;
+        switch (InsideCount)
+        {
+            case 1:
+                CellType = ECellType::Tetra;
+                AddVertex(Inside[0]);
+                AddEdge(Inside[0], Outside[0]);
+                AddEdge(Inside[0], Outside[1]);
+                AddEdge(Inside[0], Outside[2]);
+                break;
+            case 2:
+                // 两个三角形 (In0, In0-Out0, In0-Out1) 与 (In1, In1-Out0, In1-Out1)
+                AddVertex(Inside[0]);
+                AddEdge(Inside[0], Outside[0]);
+                AddEdge(Inside[0], Outside[1]);
+                AddVertex(Inside[1]);
+                AddEdge(Inside[1], Outside[0]);
+                AddEdge(Inside[1], Outside[1]);
+                break;
+            case 3:
+                // 裁剪面上的三角形为底面，保留侧的三个顶点为顶面
+                AddEdge(Inside[0], Outside[0]);
+                AddEdge(Inside[1], Outside[0]);
+                AddEdge(Inside[2], Outside[0]);
+                AddVertex(Inside[0]);
+                AddVertex(Inside[1]);
+                AddVertex(Inside[2]);
+                break;
+            default:
+                CellType = ECellType::Tetra;
+                AddVertex(Tet[0]);
+                AddVertex(Tet[1]);
+                AddVertex(Tet[2]);
+                AddVertex(Tet[3]);
+                break;
+        }
+
+        // 裁剪点与裁剪面上的顶点合并后 Prism 退化：一个三角形收缩为一点时为 Tetra，
+        // 一条侧棱收缩为一点时为 Pyramid（另两条侧棱构成底面），两条侧棱收缩时为 Tetra
+        if (CellType == ECellType::Prism)
+        {
+            uint32 Order[5];
+            uint32 OrderCount = 0;
+            if (Keys[0] == Keys[1] && Keys[1] == Keys[2])
+            {
+                CellType = ECellType::Tetra;
+                Order[OrderCount++] = 3; Order[OrderCount++] = 4; Order[OrderCount++] = 5; Order[OrderCount++] = 0;
+            }
+            else if (Keys[3] == Keys[4] && Keys[4] == Keys[5])
+            {
+                CellType = ECellType::Tetra;
+                Order[OrderCount++] = 0; Order[OrderCount++] = 1; Order[OrderCount++] = 2; Order[OrderCount++] = 3;
+            }
+            else
+            {
+                uint32 Open[3];
+                uint32 Collapsed[3];
+                uint32 OpenCount = 0;
+                uint32 CollapsedCount = 0;
+                for (uint32 k = 0; k < 3; ++k)
+                {
+                    if (Keys[k] == Keys[k + 3])
+                    {
+                        Collapsed[CollapsedCount++] = k;
+                    }
+                    else
+                    {
+                        Open[OpenCount++] = k;
+                    }
+                }
+                if (CollapsedCount == 1)
+                {
+                    CellType = ECellType::Pyramid;
+                    Order[OrderCount++] = Open[0]; Order[OrderCount++] = Open[1]; Order[OrderCount++] = Open[1] + 3; Order[OrderCount++] = Open[0] + 3;
+                    Order[OrderCount++] = Collapsed[0];
+                }
+                else if (CollapsedCount == 2)
+                {
+                    CellType = ECellType::Tetra;
+                    Order[OrderCount++] = Open[0]; Order[OrderCount++] = Open[0] + 3; Order[OrderCount++] = Collapsed[0]; Order[OrderCount++] = Collapsed[1];
+                }
+            }
+
+            if (OrderCount > 0)
+            {
+                uint64 PrismKeys[6];
+                FVector PrismPoints[6];
+                std::copy(Keys, Keys + 6, PrismKeys);
+                std::copy(Points, Points + 6, PrismPoints);
+                for (uint32 k = 0; k < OrderCount; ++k)
+                {
+                    Keys[k] = PrismKeys[Order[k]];
+                    Points[k] = PrismPoints[Order[k]];
+                }
+                CornerCount = OrderCount;
+            }
+        }
+
+        // 带符号的体积为负时翻转底面（Prism 顶面同步翻转，保持上下对应）；
+        // 顶点在裁剪面上时底面可能退化，因此按体积而不是底面法线判断
+        float Volume = 0.0f;
+        switch (CellType)
+        {
+            case ECellType::Tetra:
+                Volume = SignedTetraVolume(Points[0], Points[1], Points[2], Points[3]);
+                if (Volume < 0.0f)
+                {
+                    std::swap(Keys[1], Keys[2]);
+                }
+                break;
+            case ECellType::Pyramid:
+                Volume = SignedTetraVolume(Points[0], Points[1], Points[2], Points[4]) + SignedTetraVolume(Points[0], Points[2], Points[3], Points[4]);
+                if (Volume < 0.0f)
+                {
+                    std::swap(Keys[1], Keys[3]);
+                }
+                break;
+            default:
+                Volume = SignedTetraVolume(Points[0], Points[1], Points[2], Points[3])
+                    + SignedTetraVolume(Points[1], Points[2], Points[3], Points[4]) + SignedTetraVolume(Points[2], Points[3], Points[4], Points[5]);
+                if (Volume < 0.0f)
+                {
+                    std::swap(Keys[1], Keys[2]);
+                    std::swap(Keys[4], Keys[5]);
+                }
+                break;
+        }
+
+        AddPiece(CellType, Keys, CornerCount, ParentCell, TaskOutput);
+    }
+
+    /**
+     * 裁剪一个多边形（Triangle、Quad 或 Polygon），保留侧的部分按原顶点顺序输出（法线方向不变），
+     * 三个角点为 Triangle，四个为 Quad，更多为 Polygon；面积为 0 的部分不输出
+     * 非凸多边形的保留部分不连通时仍输出为一个多边形，各部分之间以裁剪线上的零宽度边相连
+     */
+    void ClipPolygon(const FCellView& Cell, const float* Values, int32 ParentCell, TArray<uint64>& Corners, FTaskOutput& TaskOutput)
+    {
+        // 相邻的重复角点（裁剪面上的顶点与其边上的裁剪点合并）只保留一个
+        Corners.Reset();
+        auto AddCorner = [&Corners](uint64 Key)
+        {
+            if (Corners.IsEmpty() || Corners.Last() != Key)
+            {
+                Corners.Add(Key);
+            }
+        };
+        for (uint32 k = 0; k < Cell.Num(); ++k)
+        {
+            const int32 V0 = Cell[k];
+            const int32 V1 = Cell[(k + 1) % Cell.Num()];
+            const bool bInside0 = Values[V0] >= 0.0f;
+            const bool bInside1 = Values[V1] >= 0.0f;
+            if (bInside0)
+            {
+                AddCorner(FFilterUtils::MakeEdgeKey(V0, V0));
+            }
+            if (bInside0 != bInside1)
+            {
+                AddCorner(bInside0 ? MakeClipPointKey(V0, V1, Values) : MakeClipPointKey(V1, V0, Values));
+            }
+        }
+        if (Corners.Num() > 1 && Corners[0] == Corners.Last())
+        {
+            Corners.Pop();
+        }
+        if (Corners.Num() < 3)
+        {
+            return;
+        }
+
+        const ECellType CellType = Corners.Num() == 3 ? ECellType::Triangle : Corners.Num() == 4 ? ECellType::Quad : ECellType::Polygon;
+        AddPiece(CellType, Corners.GetData(), Corners.Num(), ParentCell, TaskOutput);
+    }
+
+    /**
+     * 裁剪一条折线（Line 或 PolyLine），保留侧的每一段连续部分输出为一个单元，
+     * 两个角点为 Line，更多为 PolyLine；长度为 0 的部分不输出
+     */
+    void ClipPolyLine(const FCellView& Cell, const float* Values, int32 ParentCell, TArray<uint64>& Corners, FTaskOutput& TaskOutput)
+    {
+        Corners.Reset();
+        auto AddCorner = [&Corners](uint64 Key)
+        {
+            if (Corners.IsEmpty() || Corners.Last() != Key)
+            {
+                Corners.Add(Key);
+            }
+        };
+        auto EndRun = [&]()
+        {
+            if (Corners.Num() >= 2)
+            {
+                AddPiece(Corners.Num() == 2 ? ECellType::Line : ECellType::PolyLine, Corners.GetData(), Corners.Num(), ParentCell, TaskOutput);
+            }
+            Corners.Reset();
+        };
+        for (uint32 k = 0; k + 1 < Cell.Num(); ++k)
+        {
+            const int32 V0 = Cell[k];
+            const int32 V1 = Cell[k + 1];
+            const bool bInside0 = Values[V0] >= 0.0f;
+            const bool bInside1 = Values[V1] >= 0.0f;
+            if (bInside0)
+            {
+                AddCorner(FFilterUtils::MakeEdgeKey(V0, V0));
+            }
+            if (bInside0 != bInside1)
+            {
+                AddCorner(bInside0 ? MakeClipPointKey(V0, V1, Values) : MakeClipPointKey(V1, V0, Values));
+                if (bInside0)
+                {
+                    EndRun();
+                }
+            }
+        }
+        if (Cell.Num() > 0 && Values[Cell[Cell.Num() - 1]] >= 0.0f)
+        {
+            AddCorner(FFilterUtils::MakeEdgeKey(Cell[Cell.Num() - 1], Cell[Cell.Num() - 1]));
+        }
+        EndRun();
+    }
+}
+
+// ============================================================================
+// FClipFunction
+// ============================================================================
+
+FClipFunction FClipFunction::MakePlane(const FVector& InOrigin, const FVector& InNormal)
+{
+    FClipFunction Function;
+    Function.Type = EClipFunction::Plane;
+    Function.Origin = InOrigin;
+    Function.Normal = InNormal;
+    return Function;
+}
+
+FClipFunction FClipFunction::MakeBox(const FVector& InMin, const FVector& InMax)
+{
+    FClipFunction Function;
+    Function.Type = EClipFunction::Box;
+    Function.BoxMin = InMin;
+    Function.BoxMax = InMax;
+    return Function;
+}
+
+FClipFunction FClipFunction::MakeScalar(const std::string& InFieldName, float InThreshold)
+{
+    FClipFunction Function;
+    Function.Type = EClipFunction::Scalar;
+    Function.FieldName = InFieldName;
+    Function.Threshold = InThreshold;
+    return Function;
+}
+
+// ============================================================================
+// FClipFilter
+// ============================================================================
+
+void FClipFilter::Execute(const IMesh& Input, const FClipFunction& Function, IMesh& Output,
+    const FClipOptions& Options, TArray<int32>* OutParentCells)
+{
+    if (&Input == &Output)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Output mesh must differ from input mesh");
+    }
+
+    const EParallelForFlags Flags = Options.bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+    const FCellArray& InCells = Input.GetCells();
+    const uint32 InCellCount = InCells.GetCellCount();
+    const uint32 VertexCount = Input.GetVertexCount();
+
+    TArray<float> Values;
+    ComputeClipValues(Input, Function, Options.bInvert, Values, Flags);
+
+    Output.Clear();
+    Output.SetMeshName(Input.GetMeshName());
+
+    // ============================================================================
+    // 逐块分类单元，分解跨越裁剪面的单元
+    // ============================================================================
+
+    const FContourCaseTables& CaseTables = FContourCaseTables::Get();
+    const FVector* Positions = Input.GetVerticesPositionsPtr();
+    const uint32 TaskCount = (InCellCount + CellGrainSize - 1) / CellGrainSize;
+    TArray<FTaskOutput> TaskOutputs;
+    TaskOutputs.Resize(TaskCount);
+    ParallelForRange(TaskCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Task = Begin; Task < End; ++Task)
+        {
+            FTaskOutput& TaskOutput = TaskOutputs[Task];
+            TArray<uint64> Corners;
+            const uint32 CellEnd = std::min(InCellCount, (Task + 1) * CellGrainSize);
+            for (uint32 CellIndex = Task * CellGrainSize; CellIndex < CellEnd; ++CellIndex)
+            {
+                const FCellView Cell = InCells.GetCellViewUnchecked(CellIndex);
+                uint32 InsideCount = 0;
+                bool bNaN = false;
+                for (const int32 VertexIndex : Cell)
+                {
+                    const float Value = Values[VertexIndex];
+                    InsideCount += Value >= 0.0f ? 1u : 0u;
+                    bNaN |= std::isnan(Value);
+                }
+
+                ECellClip Clip = ECellClip::Split;
+                if (bNaN || InsideCount == 0)
+                {
+                    Clip = ECellClip::Discard;
+                }
+                else if (InsideCount == Cell.Num())
+                {
+                    Clip = ECellClip::Keep;
+                }
+
+                // 无法分解的单元（多面体、顶点数与类型不符的单元）跨越裁剪面时整体保留
+                const FContourCaseTable* Table = nullptr;
+                if (Clip == ECellClip::Split && !IsPolygonOrPolyLine(Cell.CellType))
+                {
+                    Table = CaseTables.Find(Cell.CellType);
+                    if (!Table || Cell.Num() != Table->VertexCount)
+                    {
+                        Clip = ECellClip::Keep;
+                    }
+                }
+
+                if (Clip == ECellClip::Keep)
+                {
+                    TaskOutput.KeptCells.Add(CellIndex);
+                    TaskOutput.KeptIndexCount += Cell.Num();
+                }
+                else if (Clip == ECellClip::Split)
+                {
+                    const int32 ParentCell = static_cast<int32>(CellIndex);
+                    switch (Cell.CellType)
+                    {
+                        case ECellType::Triangle:
+                        case ECellType::Quad:
+                        case ECellType::Polygon:
+                            ClipPolygon(Cell, Values.GetData(), ParentCell, Corners, TaskOutput);
+                            break;
+                        case ECellType::Line:
+                        case ECellType::PolyLine:
+                            ClipPolyLine(Cell, Values.GetData(), ParentCell, Corners, TaskOutput);
+                            break;
+                        default:
+                            for (uint32 t = 0; t < Table->TetCount; ++t)
+                            {
+                                const int32 Tet[4] = { Cell[Table->Tets[t][0]], Cell[Table->Tets[t][1]], Cell[Table->Tets[t][2]], Cell[Table->Tets[t][3]] };
+                                ClipTetra(Tet, Values.GetData(), Positions, ParentCell, TaskOutput);
+                            }
+                            break;
+                    }
+                }
+            }
+        }
+    }, Flags);
+
+    // 每个任务的输出位置
+    TArray<uint32> KeptStarts;
+    TArray<uint32> KeptIndexStarts;
+    TArray<uint32> PieceStarts;
+    TArray<uint32> CornerStarts;
+    KeptStarts.Resize(TaskCount + 1);
+    KeptIndexStarts.Resize(TaskCount + 1);
+    PieceStarts.Resize(TaskCount + 1);
+    CornerStarts.Resize(TaskCount + 1);
+    KeptStarts[0] = KeptIndexStarts[0] = PieceStarts[0] = CornerStarts[0] = 0;
+    for (uint32 Task = 0; Task < TaskCount; ++Task)
+    {
+        const FTaskOutput& TaskOutput = TaskOutputs[Task];
+        KeptStarts[Task + 1] = KeptStarts[Task] + TaskOutput.KeptCells.Num();
+        KeptIndexStarts[Task + 1] = KeptIndexStarts[Task] + TaskOutput.KeptIndexCount;
+        PieceStarts[Task + 1] = PieceStarts[Task] + TaskOutput.PieceTypes.Num();
+        CornerStarts[Task + 1] = CornerStarts[Task] + TaskOutput.PieceCornerKeys.Num();
+    }
+    const uint32 KeptCount = KeptStarts[TaskCount];
+    const uint32 PieceCount = PieceStarts[TaskCount];
+
+    TArray<uint64> CornerKeys;
+    TArray<ECellType> PieceTypes;
+    TArray<uint32> PieceOffsets;
+    TArray<int32> ParentCells;
+    CornerKeys.Resize(CornerStarts[TaskCount]);
+    PieceTypes.Resize(PieceCount);
+    PieceOffsets.Resize(PieceCount + 1);
+    PieceOffsets[PieceCount] = CornerStarts[TaskCount];
+    ParentCells.Resize(KeptCount + PieceCount);
+    ParallelForRange(TaskCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Task = Begin; Task < End; ++Task)
+        {
+            const FTaskOutput& TaskOutput = TaskOutputs[Task];
+            std::copy(TaskOutput.KeptCells.begin(), TaskOutput.KeptCells.end(), ParentCells.GetData() + KeptStarts[Task]);
+            std::copy(TaskOutput.PieceParents.begin(), TaskOutput.PieceParents.end(), ParentCells.GetData() + KeptCount + PieceStarts[Task]);
+            std::copy(TaskOutput.PieceTypes.begin(), TaskOutput.PieceTypes.end(), PieceTypes.GetData() + PieceStarts[Task]);
+            std::copy(TaskOutput.PieceCornerKeys.begin(), TaskOutput.PieceCornerKeys.end(), CornerKeys.GetData() + CornerStarts[Task]);
+            uint32 Offset = CornerStarts[Task];
+            for (uint32 i = 0; i < TaskOutput.PieceCornerCounts.Num(); ++i)
+            {
+                PieceOffsets[PieceStarts[Task] + i] = Offset;
+                Offset += TaskOutput.PieceCornerCounts[i];
+            }
+        }
+    }, Flags);
+
+    // ============================================================================
+    // 输出顶点：被使用的输入顶点在前（保持原顺序），裁剪点在后
+    // ============================================================================
+
+    TArray<uint64> UniqueKeys;
+    TArray<int32> CornerUnique;
+    FFilterUtils::MergeEdgeKeys(CornerKeys, UniqueKeys, CornerUnique, Flags);
+    CornerKeys.Reset();
+
+    // 标记被使用的输入顶点，压缩得到新编号
+    TArray<int32> VertexRemap;
+    VertexRemap.Resize(VertexCount);
+    uint32 UsedCount = VertexCount;
+    if (Options.bCompactVertices)
+    {
+        std::fill(VertexRemap.begin(), VertexRemap.end(), 0);
+        int32* RemapData = VertexRemap.GetData();
+        ParallelForRange(TaskCount, 1, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 Task = Begin; Task < End; ++Task)
+            {
+                for (const uint32 CellIndex : TaskOutputs[Task].KeptCells)
+                {
+                    for (const int32 VertexIndex : InCells.GetCellViewUnchecked(CellIndex))
+                    {
+                        std::atomic_ref<int32>(RemapData[VertexIndex]).store(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        }, Flags);
+        for (const uint64 Key : UniqueKeys)
+        {
+            if (FFilterUtils::GetEdgeKeyLo(Key) == FFilterUtils::GetEdgeKeyHi(Key))
+            {
+                VertexRemap[FFilterUtils::GetEdgeKeyLo(Key)] = 1;
+            }
+        }
+
+        UsedCount = FFilterUtils::CompactVertices(VertexRemap, nullptr, Flags);
+    }
+    else
+    {
+        for (uint32 i = 0; i < VertexCount; ++i)
+        {
+            VertexRemap[i] = static_cast<int32>(i);
+        }
+    }
+
+    // 去重后的角点对应的输出顶点
+    TArray<int32> UniqueVertices;
+    UniqueVertices.Resize(UniqueKeys.Num());
+    uint32 ClipPointCount = 0;
+    for (uint32 i = 0; i < UniqueKeys.Num(); ++i)
+    {
+        const int32 Lo = FFilterUtils::GetEdgeKeyLo(UniqueKeys[i]);
+        const bool bInputVertex = Lo == FFilterUtils::GetEdgeKeyHi(UniqueKeys[i]);
+        UniqueVertices[i] = bInputVertex ? VertexRemap[Lo] : static_cast<int32>(UsedCount + ClipPointCount++);
+    }
+
+    TArray<FEdgePoint> Points;
+    Points.Resize(UsedCount + ClipPointCount);
+    ParallelForRange(VertexCount, VertexGrainSize, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            if (VertexRemap[i] >= 0)
+            {
+                Points[VertexRemap[i]] = FEdgePoint{ static_cast<int32>(i), static_cast<int32>(i), 0.0f };
+            }
+        }
+    }, Flags);
+    ParallelForRange(UniqueKeys.Num(), 0, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            // 边的两端位于裁剪面两侧，分母不为 0
+            FEdgePoint Point;
+            Point.V0 = FFilterUtils::GetEdgeKeyLo(UniqueKeys[i]);
+            Point.V1 = FFilterUtils::GetEdgeKeyHi(UniqueKeys[i]);
+            if (Point.V0 != Point.V1)
+            {
+                Point.T = Values[Point.V0] / (Values[Point.V0] - Values[Point.V1]);
+                Points[UniqueVertices[i]] = Point;
+            }
+        }
+    }, Flags);
+
+    FFilterUtils::InterpolateVertices(Input, Output, Points, Options.bPassVertexFields, Flags);
+    Points.Reset();
+
+    // ============================================================================
+    // 输出单元：完整保留的单元在前，分解产生的单元在后
+    // ============================================================================
+
+    FCellArray& OutCells = Output.GetCells();
+    if (KeptCount == InCellCount && !Options.bCompactVertices)
+    {
+        // 全部单元完整保留且顶点编号不变：直接拷贝单元数组
+        OutCells = InCells;
+    }
+    else if (KeptCount > 0)
+    {
+        const bool bUniform = InCells.IsUniform();
+        TArray<int32> KeptIndices;
+        TArray<ECellType> KeptTypes;
+        TArray<uint32> KeptOffsets;
+        KeptIndices.Resize(KeptIndexStarts[TaskCount]);
+        if (!bUniform)
+        {
+            KeptTypes.Resize(KeptCount);
+            KeptOffsets.Resize(KeptCount + 1);
+            KeptOffsets[KeptCount] = KeptIndexStarts[TaskCount];
+        }
+        ParallelForRange(TaskCount, 1, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 Task = Begin; Task < End; ++Task)
+            {
+                uint32 OutCell = KeptStarts[Task];
+                uint32 OutIndex = KeptIndexStarts[Task];
+                for (const uint32 CellIndex : TaskOutputs[Task].KeptCells)
+                {
+                    const FCellView Cell = InCells.GetCellViewUnchecked(CellIndex);
+                    if (!bUniform)
+                    {
+                        KeptTypes[OutCell] = Cell.CellType;
+                        KeptOffsets[OutCell] = OutIndex;
+                    }
+                    ++OutCell;
+                    for (const int32 VertexIndex : Cell)
+                    {
+                        KeptIndices[OutIndex++] = VertexRemap[VertexIndex];
+                    }
+                }
+            }
+        }, Flags);
+
+        if (bUniform)
+        {
+            OutCells.AppendCells(InCells.GetUniformCellType(), InCells.GetUniformStride(), std::move(KeptIndices));
+        }
+        else
+        {
+            OutCells.AppendCells(std::move(KeptTypes), std::move(KeptOffsets), std::move(KeptIndices));
+        }
+    }
+    TaskOutputs.Reset();
+
+    if (PieceCount > 0)
+    {
+        TArray<int32> PieceIndices;
+        PieceIndices.Resize(CornerUnique.Num());
+        ParallelForRange(CornerUnique.Num(), 0, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                PieceIndices[i] = UniqueVertices[CornerUnique[i]];
+            }
+        }, Flags);
+        OutCells.AppendCells(std::move(PieceTypes), std::move(PieceOffsets), std::move(PieceIndices));
+    }
+
+    if (Options.bPassCellFields)
+    {
+        FFilterUtils::CopyCellFields(Input, Output, ParentCells, Flags);
+    }
+    if (OutParentCells)
+    {
+        *OutParentCells = std::move(ParentCells);
+    }
+}
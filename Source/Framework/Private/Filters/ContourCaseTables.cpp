@@ -0,0 +1,139 @@
+#include "ContourCaseTables.h"
+#include "Math/Math.h"
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+    /** 各单元类型分解出的四面体（单元局部顶点索引） */
+    constexpr uint8 TetraTets[1][4] = { { 0, 1, 2, 3 } };
+    constexpr uint8 PyramidTets[2][4] = { { 0, 1, 2, 4 }, { 0, 2, 3, 4 } };
+    constexpr uint8 PrismTets[3][4] = { { 0, 1, 2, 3 }, { 1, 2, 3, 4 }, { 2, 3, 4, 5 } };
+    constexpr uint8 HexTets[6][4] = { { 0, 1, 2, 6 }, { 0, 1, 5, 6 }, { 0, 3, 2, 6 }, { 0, 3, 7, 6 }, { 0, 4, 5, 6 }, { 0, 4, 7, 6 } };
+
+    /** 参考单元的顶点坐标（顶点顺序与单元定义一致，用于确定三角形的朝向） */
+    const FVector TetraReference[4] = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(0, 1, 0), FVector(0, 0, 1) };
+    const FVector PyramidReference[5] = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(1, 1, 0), FVector(0, 1, 0), FVector(0.5f, 0.5f, 1) };
+    const FVector PrismReference[6] = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(0, 1, 0), FVector(0, 0, 1), FVector(1, 0, 1), FVector(0, 1, 1) };
+    const FVector HexReference[8] = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(1, 1, 0), FVector(0, 1, 0),
+                                      FVector(0, 0, 1), FVector(1, 0, 1), FVector(1, 1, 1), FVector(0, 1, 1) };
+
+    /** 按四面体分解组合出单元类型的情况表 */
+    FContourCaseTable BuildCaseTable(const uint8 (*Tets)[4], uint32 TetCount, const FVector* Reference, uint32 VertexCount)
+    {
+        FContourCaseTable Table;
+        Table.VertexCount = VertexCount;
+        Table.Tets = Tets;
+        Table.TetCount = TetCount;
+        const uint32 CaseCount = 1u << VertexCount;
+        Table.CaseStarts.Resize(CaseCount + 1);
+
+        for (uint32 Case = 0; Case < CaseCount; ++Case)
+        {
+            Table.CaseStarts[Case] = static_cast<uint16>(Table.TriangleEdges.Num() / 6);
+            for (uint32 t = 0; t < TetCount; ++t)
+            {
+                const uint8* Tet = Tets[t];
+                uint32 Above = 0;
+                for (uint32 k = 0; k < 4; ++k)
+                {
+                    Above |= ((Case >> Tet[k]) & 1u) << k;
+                }
+
+                // 四面体局部的三角形：一个顶点与其余三个不同时为一个三角形，二比二时为一个四边形
+                uint8 Triangles[2][3][2];
+                uint32 TriangleCount = 0;
+                const int32 AboveCount = std::popcount(Above);
+                if (AboveCount == 1 || AboveCount == 3)
+                {
+                    const uint32 Isolated = static_cast<uint32>(std::countr_zero(AboveCount == 1 ? Above : (~Above & 0xFu)));
+                    uint32 Corner = 0;
+                    for (uint32 k = 0; k < 4; ++k)
+                    {
+                        if (k != Isolated)
+                        {
+                            Triangles[0][Corner][0] = static_cast<uint8>(Isolated);
+                            Triangles[0][Corner][1] = static_cast<uint8>(k);
+                            ++Corner;
+                        }
+                    }
+                    TriangleCount = 1;
+                }
+                else if (AboveCount == 2)
+                {
+                    uint8 Up[2];
+                    uint8 Down[2];
+                    uint32 UpCount = 0;
+                    uint32 DownCount = 0;
+                    for (uint32 k = 0; k < 4; ++k)
+                    {
+                        if ((Above >> k) & 1u)
+                        {
+                            Up[UpCount++] = static_cast<uint8>(k);
+                        }
+                        else
+                        {
+                            Down[DownCount++] = static_cast<uint8>(k);
+                        }
+                    }
+                    // 四边形 (Up0,Down0) -> (Up0,Down1) -> (Up1,Down1) -> (Up1,Down0)
+                    const uint8 Quad[4][2] = { { Up[0], Down[0] }, { Up[0], Down[1] }, { Up[1], Down[1] }, { Up[1], Down[0] } };
+                    const uint32 Split[2][3] = { { 0, 1, 2 }, { 0, 2, 3 } };
+                    for (uint32 Tri = 0; Tri < 2; ++Tri)
+                    {
+                        for (uint32 Corner = 0; Corner < 3; ++Corner)
+                        {
+                            Triangles[Tri][Corner][0] = Quad[Split[Tri][Corner]][0];
+                            Triangles[Tri][Corner][1] = Quad[Split[Tri][Corner]][1];
+                        }
+                    }
+                    TriangleCount = 2;
+                }
+
+                for (uint32 Tri = 0; Tri < TriangleCount; ++Tri)
+                {
+                    uint8 Edges[3][2];
+                    FVector Midpoints[3];
+                    for (uint32 Corner = 0; Corner < 3; ++Corner)
+                    {
+                        Edges[Corner][0] = Tet[Triangles[Tri][Corner][0]];
+                        Edges[Corner][1] = Tet[Triangles[Tri][Corner][1]];
+                        Midpoints[Corner] = (Reference[Edges[Corner][0]] + Reference[Edges[Corner][1]]) * 0.5f;
+                    }
+
+                    // 在参考单元中让法线指向上方顶点
+                    const uint8 UpVertex = ((Case >> Edges[0][0]) & 1u) ? Edges[0][0] : Edges[0][1];
+                    const uint8 DownVertex = UpVertex == Edges[0][0] ? Edges[0][1] : Edges[0][0];
+                    const FVector Normal = (Midpoints[1] - Midpoints[0]).Cross(Midpoints[2] - Midpoints[0]);
+                    if (Normal.Dot(Reference[UpVertex] - Reference[DownVertex]) < 0.0f)
+                    {
+                        std::swap(Edges[1][0], Edges[2][0]);
+                        std::swap(Edges[1][1], Edges[2][1]);
+                    }
+
+                    for (uint32 Corner = 0; Corner < 3; ++Corner)
+                    {
+                        Table.TriangleEdges.Add(Edges[Corner][0]);
+                        Table.TriangleEdges.Add(Edges[Corner][1]);
+                    }
+                }
+            }
+        }
+        Table.CaseStarts[CaseCount] = static_cast<uint16>(Table.TriangleEdges.Num() / 6);
+        return Table;
+    }
+}
+
+FContourCaseTables::FContourCaseTables()
+    : Tetra(BuildCaseTable(TetraTets, 1, TetraReference, 4))
+    , Pyramid(BuildCaseTable(PyramidTets, 2, PyramidReference, 5))
+    , Prism(BuildCaseTable(PrismTets, 3, PrismReference, 6))
+    , Hex(BuildCaseTable(HexTets, 6, HexReference, 8))
+{
+}
+
+const FContourCaseTables& FContourCaseTables::Get()
+{
+    static const FContourCaseTables Tables;
+    return Tables;
+}
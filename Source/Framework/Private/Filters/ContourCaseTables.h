@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "Cell/CellType.h"
+#include "HAL/Platform.h"
+
+/**
+ * 单元类型的等值面情况表（Marching Tetrahedra）
+ *
+ * 情况编号的第 i 位表示局部顶点 i 位于等值面上方（标量 >= 等值）。
+ * Hex / Prism / Pyramid 按固定方式分解为四面体（6 / 3 / 2 个），分解后的三角形按情况预先组合；
+ * 三角形的法线指向上方顶点（对于顶点顺序符合单元定义的单元）
+ */
+struct FContourCaseTable
+{
+    /** 单元顶点数 */
+    uint32 VertexCount = 0;
+
+    /** 单元分解出的四面体（单元局部顶点索引，裁剪过滤器按同样的方式分解单元） */
+    const uint8 (*Tets)[4] = nullptr;
+
+    /** 分解出的四面体数 */
+    uint32 TetCount = 0;
+
+    /** 每种情况的第一个三角形（长度为情况数 + 1） */
+    TArray<uint16> CaseStarts;
+
+    /** 每个三角形 3 条边，每条边 2 个局部顶点索引 */
+    TArray<uint8> TriangleEdges;
+};
+
+/**
+ * FContourCaseTables - 所有支持的单元类型的情况表（等值面、切片、裁剪过滤器共用，首次使用时构建）
+ */
+struct FContourCaseTables
+{
+    FContourCaseTable Tetra;
+    FContourCaseTable Pyramid;
+    FContourCaseTable Prism;
+    FContourCaseTable Hex;
+
+    /** 获取全局实例 */
+    static const FContourCaseTables& Get();
+
+    /** 获取单元类型的情况表（不支持的类型返回 nullptr） */
+    [[nodiscard]] const FContourCaseTable* Find(ECellType CellType) const
+    {
+        switch (CellType)
+        {
+            case ECellType::Tetra: return &Tetra;
+            case ECellType::Pyramid: return &Pyramid;
+            case ECellType::Prism: return &Prism;
+            case ECellType::Hex: return &Hex;
+            default: return nullptr;
+        }
+    }
+
+private:
+    FContourCaseTables();
+};
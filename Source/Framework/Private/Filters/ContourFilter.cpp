@@ -0,0 +1,282 @@
+#include "Filters/ContourFilter.h"
+#include "Filters/ScalarSpanIndex.h"
+#include "ContourCaseTables.h"
+#include "FilterUtils.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    /** 使用区间索引时每个任务处理的候选单元数 */
+    constexpr uint32 CandidateGrainSize = 4096;
+
+    /** 单个块的输出 */
+    struct FChunkOutput
+    {
+        /** 每个三角形 3 个角点所在边的键 */
+        TArray<uint64> CornerKeys;
+
+        /** 每个三角形的父单元 */
+        TArray<int32> ParentCells;
+    };
+}
+
+// ============================================================================
+// FScalarChunkRanges
+// ============================================================================
+
+void FScalarChunkRanges::Build(const IMesh& Mesh, const FField& Field, uint32 InCellsPerChunk, bool bParallel)
+{
+    if (InCellsPerChunk == 0)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "CellsPerChunk must be greater than zero");
+    }
+    if (Field.GetDataCount() != Mesh.GetVertexCount() || Field.GetFieldDimension() != 1)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Chunk ranges require a vertex scalar field: " + Field.GetFieldName());
+    }
+
+    const FCellArray& Cells = Mesh.GetCells();
+    CellsPerChunk = InCellsPerChunk;
+    CellCount = Cells.GetCellCount();
+    CellsVersion = Cells.GetVersion();
+    FieldVersion = Field.GetVersion();
+    SourceField = &Field;
+
+    const uint32 ChunkCount = (CellCount + CellsPerChunk - 1) / CellsPerChunk;
+    Ranges.Resize(ChunkCount * 2);
+
+    TArray<float> ConversionBuffer;
+    const float* Scalars = Field.GetFloatData(ConversionBuffer);
+    ParallelForRange(ChunkCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Chunk = Begin; Chunk < End; ++Chunk)
+        {
+            float Min = std::numeric_limits<float>::infinity();
+            float Max = -std::numeric_limits<float>::infinity();
+            const uint32 CellEnd = std::min(CellCount, (Chunk + 1) * CellsPerChunk);
+            for (uint32 CellIndex = Chunk * CellsPerChunk; CellIndex < CellEnd; ++CellIndex)
+            {
+                for (const int32 VertexIndex : Cells.GetCellViewUnchecked(CellIndex))
+                {
+                    const float Value = Scalars[VertexIndex];
+                    Min = std::min(Min, Value);
+                    Max = std::max(Max, Value);
+                }
+            }
+            Ranges[Chunk * 2] = Min;
+            Ranges[Chunk * 2 + 1] = Max;
+        }
+    }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void FScalarChunkRanges::Clear()
+{
+    Ranges.Reset();
+    CellsVersion = 0;
+    CellCount = 0;
+    FieldVersion = 0;
+    SourceField = nullptr;
+}
+
+bool FScalarChunkRanges::IsBuiltFor(const IMesh& Mesh, const FField& Field) const
+{
+    const FCellArray& Cells = Mesh.GetCells();
+    return SourceField == &Field
+        && FieldVersion == Field.GetVersion()
+        && CellsVersion == Cells.GetVersion()
+        && CellCount == Cells.GetCellCount()
+        && Field.GetDataCount() == Mesh.GetVertexCount();
+}
+
+// ============================================================================
+// FContourFilter
+// ============================================================================
+
+void FContourFilter::Execute(const IMesh& Input, const std::string& FieldName, float IsoValue, IMesh& Output,
+    const FContourOptions& Options, TArray<int32>* OutParentCells)
+{
+    if (&Input == &Output)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Output mesh must differ from input mesh");
+    }
+
+    const FField* Field = Input.GetVertexField(FieldName);
+    if (!Field)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Vertex field not found: " + FieldName);
+    }
+    if (Field->GetFieldType() != EFieldType::Scalar || Field->GetDataCount() != Input.GetVertexCount())
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Contour field must be a vertex scalar field: " + FieldName);
+    }
+
+    const EParallelForFlags Flags = Options.bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+    const FCellArray& InCells = Input.GetCells();
+    const uint32 InCellCount = InCells.GetCellCount();
+
+    Output.Clear();
+    Output.SetMeshName(Input.GetMeshName());
+
+    TArray<float> ConversionBuffer;
+    const float* Scalars = Field->GetFloatData(ConversionBuffer);
+
+    // ============================================================================
+    // 待处理的单元：区间索引的候选单元，或标量范围包含等值的块
+    // ============================================================================
+
+    TArray<uint32> Candidates;
+    TArray<uint32> ActiveChunks;
+    uint32 CellsPerChunk = 0;
+    const bool bUseSpanIndex = Options.SpanIndex != nullptr;
+    if (bUseSpanIndex)
+    {
+        Options.SpanIndex->Update(Input, *Field, Options.bParallel);
+        Options.SpanIndex->Query(IsoValue, Candidates, Options.bParallel);
+    }
+    else
+    {
+        FScalarChunkRanges LocalRanges;
+        const FScalarChunkRanges* Ranges = Options.ChunkRanges;
+        if (!Ranges || !Ranges->IsBuiltFor(Input, *Field))
+        {
+            LocalRanges.Build(Input, *Field, FScalarChunkRanges::DefaultCellsPerChunk, Options.bParallel);
+            Ranges = &LocalRanges;
+        }
+        CellsPerChunk = Ranges->GetCellsPerChunk();
+        for (uint32 Chunk = 0; Chunk < Ranges->GetChunkCount(); ++Chunk)
+        {
+            if (Ranges->MayIntersect(Chunk, IsoValue))
+            {
+                ActiveChunks.Add(Chunk);
+            }
+        }
+    }
+    const uint32 TaskCount = bUseSpanIndex ? (Candidates.Num() + CandidateGrainSize - 1) / CandidateGrainSize : ActiveChunks.Num();
+
+    // ============================================================================
+    // 逐个任务生成三角形（角点以边键表示）
+    // ============================================================================
+
+    const FContourCaseTables& CaseTables = FContourCaseTables::Get();
+    auto ProcessCell = [&](uint32 CellIndex, FChunkOutput& ChunkOutput)
+    {
+        const FCellView Cell = InCells.GetCellViewUnchecked(CellIndex);
+        const FContourCaseTable* Table = CaseTables.Find(Cell.CellType);
+        if (!Table || Cell.Num() != Table->VertexCount)
+        {
+            return;
+        }
+
+        uint32 Case = 0;
+        for (uint32 k = 0; k < Table->VertexCount; ++k)
+        {
+            Case |= (Scalars[Cell[k]] >= IsoValue ? 1u : 0u) << k;
+        }
+
+        const uint32 TriangleEnd = Table->CaseStarts[Case + 1];
+        for (uint32 Triangle = Table->CaseStarts[Case]; Triangle < TriangleEnd; ++Triangle)
+        {
+            const uint8* Edges = Table->TriangleEdges.GetData() + Triangle * 6;
+            for (uint32 Corner = 0; Corner < 3; ++Corner)
+            {
+                ChunkOutput.CornerKeys.Add(FFilterUtils::MakeEdgeKey(Cell[Edges[Corner * 2]], Cell[Edges[Corner * 2 + 1]]));
+            }
+            ChunkOutput.ParentCells.Add(static_cast<int32>(CellIndex));
+        }
+    };
+
+    TArray<FChunkOutput> ChunkOutputs;
+    ChunkOutputs.Resize(TaskCount);
+    ParallelForRange(TaskCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Task = Begin; Task < End; ++Task)
+        {
+            FChunkOutput& ChunkOutput = ChunkOutputs[Task];
+            if (bUseSpanIndex)
+            {
+                const uint32 CandidateEnd = std::min<uint32>(Candidates.Num(), (Task + 1) * CandidateGrainSize);
+                for (uint32 i = Task * CandidateGrainSize; i < CandidateEnd; ++i)
+                {
+                    ProcessCell(Candidates[i], ChunkOutput);
+                }
+            }
+            else
+            {
+                const uint32 CellBegin = ActiveChunks[Task] * CellsPerChunk;
+                const uint32 CellEnd = std::min(InCellCount, CellBegin + CellsPerChunk);
+                for (uint32 CellIndex = CellBegin; CellIndex < CellEnd; ++CellIndex)
+                {
+                    ProcessCell(CellIndex, ChunkOutput);
+                }
+            }
+        }
+    }, Flags);
+
+    // 按任务顺序拼接
+    TArray<uint32> TriangleStarts;
+    TriangleStarts.Resize(TaskCount + 1);
+    TriangleStarts[0] = 0;
+    for (uint32 Task = 0; Task < TaskCount; ++Task)
+    {
+        TriangleStarts[Task + 1] = TriangleStarts[Task] + ChunkOutputs[Task].ParentCells.Num();
+    }
+    const uint32 TriangleCount = TriangleStarts[TaskCount];
+
+    TArray<uint64> CornerKeys;
+    TArray<int32> ParentCells;
+    CornerKeys.Resize(TriangleCount * 3);
+    ParentCells.Resize(TriangleCount);
+    ParallelForRange(TaskCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Task = Begin; Task < End; ++Task)
+        {
+            FChunkOutput& ChunkOutput = ChunkOutputs[Task];
+            std::copy(ChunkOutput.CornerKeys.begin(), ChunkOutput.CornerKeys.end(), CornerKeys.GetData() + TriangleStarts[Task] * 3);
+            std::copy(ChunkOutput.ParentCells.begin(), ChunkOutput.ParentCells.end(), ParentCells.GetData() + TriangleStarts[Task]);
+            ChunkOutput = FChunkOutput();
+        }
+    }, Flags);
+
+    // ============================================================================
+    // 合并共享边上的等值点并插值
+    // ============================================================================
+
+    TArray<uint64> EdgeKeys;
+    TArray<int32> Indices;
+    FFilterUtils::MergeEdgeKeys(CornerKeys, EdgeKeys, Indices, Flags);
+    CornerKeys.Reset();
+
+    TArray<FEdgePoint> Points;
+    Points.Resize(EdgeKeys.Num());
+    ParallelForRange(EdgeKeys.Num(), 0, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            // 边的一端在等值之下、另一端不低于等值，分母不为 0
+            FEdgePoint& Point = Points[i];
+            Point.V0 = FFilterUtils::GetEdgeKeyLo(EdgeKeys[i]);
+            Point.V1 = FFilterUtils::GetEdgeKeyHi(EdgeKeys[i]);
+            const float S0 = Scalars[Point.V0];
+            const float S1 = Scalars[Point.V1];
+            Point.T = (IsoValue - S0) / (S1 - S0);
+        }
+    }, Flags);
+
+    FFilterUtils::InterpolateVertices(Input, Output, Points, Options.bPassVertexFields, Flags);
+    if (Options.bPassCellFields)
+    {
+        FFilterUtils::CopyCellFields(Input, Output, ParentCells, Flags);
+    }
+    Output.GetCells().AppendCells(ECellType::Triangle, 3, std::move(Indices));
+
+    if (OutParentCells)
+    {
+        *OutParentCells = std::move(ParentCells);
+    }
+}
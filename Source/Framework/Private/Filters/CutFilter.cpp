@@ -0,0 +1,270 @@
+#include "Filters/CutFilter.h"
+#include "ContourCaseTables.h"
+#include "FilterUtils.h"
+#include "Mesh/Mesh.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace
+{
+    /** 每个任务处理的单元数 */
+    constexpr uint32 CellGrainSize = 16384;
+
+    /** 计算顶点距离时的并行粒度 */
+    constexpr uint32 VertexGrainSize = 65536;
+
+    /** 单个任务的输出 */
+    struct FTaskOutput
+    {
+        /** 每个三角形 3 个角点所在边的键 */
+        TArray<uint64> CornerKeys;
+
+        /** 每个三角形的父单元 */
+        TArray<int32> ParentCells;
+
+        /** 每个三角形所属的平面 */
+        TArray<uint32> Planes;
+    };
+}
+
+void FCutFilter::Execute(const IMesh& Input, const FVector& Origin, const FVector& Normal, IMesh& Output,
+    const FCutOptions& Options, TArray<int32>* OutParentCells)
+{
+    Execute(Input, Origin, Normal, TArray<float>{ 0.0f }, Output, Options, OutParentCells);
+}
+
+void FCutFilter::Execute(const IMesh& Input, const FVector& Origin, const FVector& Normal, const TArray<float>& Offsets, IMesh& Output,
+    const FCutOptions& Options, TArray<int32>* OutParentCells, TArray<uint32>* OutPlaneStarts)
+{
+    if (&Input == &Output)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Output mesh must differ from input mesh");
+    }
+    const FVector UnitNormal = Normal.GetSafeNormal();
+    if (UnitNormal.IsZero())
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Cut plane normal must not be zero");
+    }
+    if (!std::all_of(Offsets.begin(), Offsets.end(), [](float Offset) { return std::isfinite(Offset); }))
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Cut plane offsets must be finite");
+    }
+
+    const EParallelForFlags Flags = Options.bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+    const FCellArray& InCells = Input.GetCells();
+    const uint32 InCellCount = InCells.GetCellCount();
+    const uint32 VertexCount = Input.GetVertexCount();
+    const uint32 PlaneCount = Offsets.Num();
+
+    Output.Clear();
+    Output.SetMeshName(Input.GetMeshName());
+
+    // ============================================================================
+    // 顶点到基准平面的有符号距离
+    // ============================================================================
+
+    TArray<float> Distances;
+    Distances.Resize(VertexCount);
+    const FVector* Positions = Input.GetVerticesPositionsPtr();
+    ParallelForRange(VertexCount, VertexGrainSize, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            Distances[i] = UnitNormal.Dot(Positions[i] - Origin);
+        }
+    }, Flags);
+
+    // 平面按偏移排序，单元只需二分查找与其距离范围相交的平面
+    TArray<uint32> SortedPlanes;
+    SortedPlanes.Resize(PlaneCount);
+    std::iota(SortedPlanes.begin(), SortedPlanes.end(), 0u);
+    std::stable_sort(SortedPlanes.begin(), SortedPlanes.end(), [&](uint32 A, uint32 B) { return Offsets[A] < Offsets[B]; });
+    TArray<float> SortedOffsets;
+    SortedOffsets.Resize(PlaneCount);
+    for (uint32 i = 0; i < PlaneCount; ++i)
+    {
+        SortedOffsets[i] = Offsets[SortedPlanes[i]];
+    }
+
+    // ============================================================================
+    // 逐块生成三角形（角点以边键表示）
+    // ============================================================================
+
+    const FContourCaseTables& CaseTables = FContourCaseTables::Get();
+    const uint32 TaskCount = PlaneCount > 0 ? (InCellCount + CellGrainSize - 1) / CellGrainSize : 0;
+    TArray<FTaskOutput> TaskOutputs;
+    TaskOutputs.Resize(TaskCount);
+    ParallelForRange(TaskCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Task = Begin; Task < End; ++Task)
+        {
+            FTaskOutput& TaskOutput = TaskOutputs[Task];
+            const uint32 CellEnd = std::min(InCellCount, (Task + 1) * CellGrainSize);
+            for (uint32 CellIndex = Task * CellGrainSize; CellIndex < CellEnd; ++CellIndex)
+            {
+                const FCellView Cell = InCells.GetCellViewUnchecked(CellIndex);
+                const FContourCaseTable* Table = CaseTables.Find(Cell.CellType);
+                if (!Table || Cell.Num() != Table->VertexCount)
+                {
+                    continue;
+                }
+
+                // 符号测试：距离范围 (Min, Max] 内没有平面的单元不与任何平面相交
+                float Min = std::numeric_limits<float>::infinity();
+                float Max = -std::numeric_limits<float>::infinity();
+                for (uint32 k = 0; k < Table->VertexCount; ++k)
+                {
+                    Min = std::min(Min, Distances[Cell[k]]);
+                    Max = std::max(Max, Distances[Cell[k]]);
+                }
+                const uint32 First = static_cast<uint32>(std::upper_bound(SortedOffsets.begin(), SortedOffsets.end(), Min) - SortedOffsets.begin());
+                const uint32 Last = static_cast<uint32>(std::upper_bound(SortedOffsets.begin() + First, SortedOffsets.end(), Max) - SortedOffsets.begin());
+
+                for (uint32 Sorted = First; Sorted < Last; ++Sorted)
+                {
+                    const float Offset = SortedOffsets[Sorted];
+                    uint32 Case = 0;
+                    for (uint32 k = 0; k < Table->VertexCount; ++k)
+                    {
+                        Case |= (Distances[Cell[k]] >= Offset ? 1u : 0u) << k;
+                    }
+
+                    const uint32 TriangleEnd = Table->CaseStarts[Case + 1];
+                    for (uint32 Triangle = Table->CaseStarts[Case]; Triangle < TriangleEnd; ++Triangle)
+                    {
+                        const uint8* Edges = Table->TriangleEdges.GetData() + Triangle * 6;
+                        for (uint32 Corner = 0; Corner < 3; ++Corner)
+                        {
+                            TaskOutput.CornerKeys.Add(FFilterUtils::MakeEdgeKey(Cell[Edges[Corner * 2]], Cell[Edges[Corner * 2 + 1]]));
+                        }
+                        TaskOutput.ParentCells.Add(static_cast<int32>(CellIndex));
+                        TaskOutput.Planes.Add(SortedPlanes[Sorted]);
+                    }
+                }
+            }
+        }
+    }, Flags);
+
+    // ============================================================================
+    // 按平面分组：每个平面内按任务顺序拼接
+    // ============================================================================
+
+    // TaskPlaneStarts[Task * PlaneCount + Plane]：任务在平面内的写入位置
+    TArray<uint32> TaskPlaneStarts;
+    TaskPlaneStarts.Resize(TaskCount * PlaneCount);
+    std::fill(TaskPlaneStarts.begin(), TaskPlaneStarts.end(), 0u);
+    ParallelForRange(TaskCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Task = Begin; Task < End; ++Task)
+        {
+            for (const uint32 Plane : TaskOutputs[Task].Planes)
+            {
+                ++TaskPlaneStarts[Task * PlaneCount + Plane];
+            }
+        }
+    }, Flags);
+
+    TArray<uint32> PlaneTriangleCounts;
+    PlaneTriangleCounts.Resize(PlaneCount);
+    for (uint32 Plane = 0; Plane < PlaneCount; ++Plane)
+    {
+        uint32 Running = 0;
+        for (uint32 Task = 0; Task < TaskCount; ++Task)
+        {
+            const uint32 Count = TaskPlaneStarts[Task * PlaneCount + Plane];
+            TaskPlaneStarts[Task * PlaneCount + Plane] = Running;
+            Running += Count;
+        }
+        PlaneTriangleCounts[Plane] = Running;
+    }
+
+    TArray<TArray<uint64>> PlaneCornerKeys;
+    TArray<TArray<int32>> PlaneParentCells;
+    PlaneCornerKeys.Resize(PlaneCount);
+    PlaneParentCells.Resize(PlaneCount);
+    for (uint32 Plane = 0; Plane < PlaneCount; ++Plane)
+    {
+        PlaneCornerKeys[Plane].Resize(PlaneTriangleCounts[Plane] * 3);
+        PlaneParentCells[Plane].Resize(PlaneTriangleCounts[Plane]);
+    }
+    ParallelForRange(TaskCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Task = Begin; Task < End; ++Task)
+        {
+            FTaskOutput& TaskOutput = TaskOutputs[Task];
+            uint32* Cursors = TaskPlaneStarts.GetData() + Task * PlaneCount;
+            for (uint32 Triangle = 0; Triangle < TaskOutput.Planes.Num(); ++Triangle)
+            {
+                const uint32 Plane = TaskOutput.Planes[Triangle];
+                const uint32 Out = Cursors[Plane]++;
+                std::copy_n(TaskOutput.CornerKeys.GetData() + Triangle * 3, 3, PlaneCornerKeys[Plane].GetData() + Out * 3);
+                PlaneParentCells[Plane][Out] = TaskOutput.ParentCells[Triangle];
+            }
+            TaskOutput = FTaskOutput();
+        }
+    }, Flags);
+
+    // ============================================================================
+    // 每个平面合并共享边上的截面点并插值
+    // ============================================================================
+
+    TArray<FEdgePoint> Points;
+    TArray<int32> Indices;
+    TArray<int32> ParentCells;
+    TArray<uint32> PlaneStarts;
+    PlaneStarts.Resize(PlaneCount + 1);
+    PlaneStarts[0] = 0;
+    for (uint32 Plane = 0; Plane < PlaneCount; ++Plane)
+    {
+        TArray<uint64> EdgeKeys;
+        TArray<int32> PlaneIndices;
+        FFilterUtils::MergeEdgeKeys(PlaneCornerKeys[Plane], EdgeKeys, PlaneIndices, Flags);
+        PlaneCornerKeys[Plane] = TArray<uint64>();
+
+        const uint32 PointBase = Points.Num();
+        const float Offset = Offsets[Plane];
+        Points.Resize(PointBase + EdgeKeys.Num());
+        ParallelForRange(EdgeKeys.Num(), 0, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                // 边的两端位于平面两侧，分母不为 0
+                FEdgePoint& Point = Points[PointBase + i];
+                Point.V0 = FFilterUtils::GetEdgeKeyLo(EdgeKeys[i]);
+                Point.V1 = FFilterUtils::GetEdgeKeyHi(EdgeKeys[i]);
+                const float D0 = Distances[Point.V0];
+                const float D1 = Distances[Point.V1];
+                Point.T = (Offset - D0) / (D1 - D0);
+            }
+        }, Flags);
+
+        for (int32& Index : PlaneIndices)
+        {
+            Index += static_cast<int32>(PointBase);
+        }
+        Indices.Append(std::move(PlaneIndices));
+        ParentCells.Append(std::move(PlaneParentCells[Plane]));
+        PlaneStarts[Plane + 1] = ParentCells.Num();
+    }
+
+    FFilterUtils::InterpolateVertices(Input, Output, Points, Options.bPassVertexFields, Flags);
+    if (Options.bPassCellFields)
+    {
+        FFilterUtils::CopyCellFields(Input, Output, ParentCells, Flags);
+    }
+    Output.GetCells().AppendCells(ECellType::Triangle, 3, std::move(Indices));
+
+    if (OutParentCells)
+    {
+        *OutParentCells = std::move(ParentCells);
+    }
+    if (OutPlaneStarts)
+    {
+        *OutPlaneStarts = std::move(PlaneStarts);
+    }
+}
@@ -0,0 +1,269 @@
+#include "Filters/ExtractSurfaceFilter.h"
+#include "FilterUtils.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Cell/CellType.h"
+#include "Container/CellArray.h"
+#include "Container/CellNeighborTable.h"
+#include "Exception/Exception.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+    /** 按单元并行时的区间粒度 */
+    constexpr uint32 CellGrainSize = 16384;
+
+    /** 判断单元是否作为整体原样输出 */
+    bool IsPassThroughCell(ECellType CellType, const FExtractSurfaceOptions& Options)
+    {
+        const int32 Dimension = ICellType::GetCellDimension(CellType);
+        return Options.bPassLowerDimensionCells && (Dimension == 1 || Dimension == 2);
+    }
+
+    /** 判断单元是否需要提取边界面 */
+    bool IsVolumeCell(ECellType CellType)
+    {
+        return ICellType::GetCellDimension(CellType) == 3 && CellType != ECellType::Polyhedron;
+    }
+}
+
+void FExtractSurfaceFilter::Execute(const IMesh& Input, IMesh& Output, const FExtractSurfaceOptions& Options, TArray<int32>* OutParentCells)
+{
+    if (&Input == &Output)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Output mesh must differ from input mesh");
+    }
+
+    Output.Clear();
+    Output.SetMeshName(Input.GetMeshName());
+
+    const FCellArray& InCells = Input.GetCells();
+    const uint32 InCellCount = InCells.GetCellCount();
+    const uint32 InVertexCount = Input.GetVertexCount();
+    const EParallelForFlags Flags = Options.bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+
+    // ============================================================================
+    // 找出边界面（只属于一个单元的面）
+    // ============================================================================
+
+    FCellNeighborTable NeighborTable;
+    NeighborTable.Build(InCells, Options.bParallel);
+
+    // 第一遍：统计每个输入单元产生的表面单元数和顶点索引数
+    TArray<uint32> CellStarts;
+    TArray<uint32> IndexStarts;
+    CellStarts.Resize(InCellCount + 1);
+    IndexStarts.Resize(InCellCount + 1);
+    CellStarts[0] = 0;
+    IndexStarts[0] = 0;
+
+    ParallelForRange(InCellCount, CellGrainSize, [&](uint32 Begin, uint32 End)
+    {
+        int32 Local[ICellType::MaxFaceVertexCount];
+        for (uint32 CellIndex = Begin; CellIndex < End; ++CellIndex)
+        {
+            const FCellView Cell = InCells.GetCellViewUnchecked(CellIndex);
+            uint32 SurfaceCellCount = 0;
+            uint32 SurfaceIndexCount = 0;
+            if (IsVolumeCell(Cell.CellType))
+            {
+                const uint32 FaceCount = NeighborTable.GetFaceCount(CellIndex);
+                for (uint32 FaceIndex = 0; FaceIndex < FaceCount; ++FaceIndex)
+                {
+                    if (NeighborTable.IsBoundaryFace(CellIndex, FaceIndex))
+                    {
+                        ++SurfaceCellCount;
+                        SurfaceIndexCount += ICellType::GetFaceLocalIndices(Cell.CellType, Cell.Num(), FaceIndex, Local);
+                    }
+                }
+            }
+            else if (IsPassThroughCell(Cell.CellType, Options))
+            {
+                SurfaceCellCount = 1;
+                SurfaceIndexCount = Cell.Num();
+            }
+            CellStarts[CellIndex + 1] = SurfaceCellCount;
+            IndexStarts[CellIndex + 1] = SurfaceIndexCount;
+        }
+    }, Flags);
+
+    for (uint32 i = 1; i <= InCellCount; ++i)
+    {
+        CellStarts[i] += CellStarts[i - 1];
+        IndexStarts[i] += IndexStarts[i - 1];
+    }
+
+    const uint32 OutCellCount = CellStarts[InCellCount];
+    const uint32 OutIndexCount = IndexStarts[InCellCount];
+
+    // 第二遍：写出表面单元
+    TArray<ECellType> OutTypes;
+    TArray<uint32> OutOffsets;
+    TArray<int32> OutIndices;
+    TArray<int32> ParentCells;
+    OutTypes.Resize(OutCellCount);
+    OutOffsets.Resize(OutCellCount + 1);
+    OutIndices.Resize(OutIndexCount);
+    ParentCells.Resize(OutCellCount);
+    OutOffsets[OutCellCount] = OutIndexCount;
+
+    ParallelForRange(InCellCount, CellGrainSize, [&](uint32 Begin, uint32 End)
+    {
+        int32 Local[ICellType::MaxFaceVertexCount];
+        for (uint32 CellIndex = Begin; CellIndex < End; ++CellIndex)
+        {
+            uint32 OutCell = CellStarts[CellIndex];
+            if (OutCell == CellStarts[CellIndex + 1])
+            {
+                continue;
+            }
+
+            const FCellView Cell = InCells.GetCellViewUnchecked(CellIndex);
+            uint32 OutIndex = IndexStarts[CellIndex];
+            if (IsVolumeCell(Cell.CellType))
+            {
+                const uint32 FaceCount = NeighborTable.GetFaceCount(CellIndex);
+                for (uint32 FaceIndex = 0; FaceIndex < FaceCount; ++FaceIndex)
+                {
+                    if (!NeighborTable.IsBoundaryFace(CellIndex, FaceIndex))
+                    {
+                        continue;
+                    }
+                    const uint32 FaceVertexCount = ICellType::GetFaceLocalIndices(Cell.CellType, Cell.Num(), FaceIndex, Local);
+                    OutTypes[OutCell] = FaceVertexCount == 3 ? ECellType::Triangle : ECellType::Quad;
+                    OutOffsets[OutCell] = OutIndex;
+                    ParentCells[OutCell] = static_cast<int32>(CellIndex);
+                    for (uint32 i = 0; i < FaceVertexCount; ++i)
+                    {
+                        OutIndices[OutIndex++] = Cell[Local[i]];
+                    }
+                    ++OutCell;
+                }
+            }
+            else
+            {
+                OutTypes[OutCell] = Cell.CellType;
+                OutOffsets[OutCell] = OutIndex;
+                ParentCells[OutCell] = static_cast<int32>(CellIndex);
+                std::copy(Cell.begin(), Cell.end(), OutIndices.GetData() + OutIndex);
+            }
+        }
+    }, Flags);
+
+    NeighborTable.Clear();
+
+    // ============================================================================
+    // 顶点和顶点场
+    // ============================================================================
+
+    TArray<std::string> FieldNames;
+    if (Options.bCompactVertices)
+    {
+        // 标记表面使用的顶点
+        TArray<uint8> Used;
+        Used.Resize(InVertexCount);
+        std::fill(Used.begin(), Used.end(), static_cast<uint8>(0));
+        uint8* UsedData = Used.GetData();
+        ParallelForRange(OutIndexCount, 0, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                const int32 VertexIndex = OutIndices[i];
+                if (VertexIndex >= 0 && static_cast<uint32>(VertexIndex) < InVertexCount)
+                {
+                    std::atomic_ref<uint8>(UsedData[VertexIndex]).store(1, std::memory_order_relaxed);
+                }
+            }
+        }, Flags);
+
+        // 旧顶点索引到新顶点索引（保持原有顺序）
+        TArray<int32> VertexRemap;
+        VertexRemap.Resize(InVertexCount);
+        int32 NewVertexCount = 0;
+        for (uint32 i = 0; i < InVertexCount; ++i)
+        {
+            VertexRemap[i] = Used[i] ? NewVertexCount++ : -1;
+        }
+
+        ParallelForRange(OutIndexCount, 0, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                const int32 VertexIndex = OutIndices[i];
+                if (VertexIndex >= 0 && static_cast<uint32>(VertexIndex) < InVertexCount)
+                {
+                    OutIndices[i] = VertexRemap[VertexIndex];
+                }
+            }
+        }, Flags);
+
+        TArray<FVector> Positions;
+        Positions.Resize(static_cast<uint32>(NewVertexCount));
+        const FVector* InPositions = Input.GetVerticesPositionsPtr();
+        ParallelForRange(InVertexCount, 0, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                if (VertexRemap[i] >= 0)
+                {
+                    Positions[VertexRemap[i]] = InPositions[i];
+                }
+            }
+        }, Flags);
+        Output.AddVerticesPositions(std::move(Positions));
+
+        if (Options.bPassVertexFields)
+        {
+            Input.GetVertexFieldNames(FieldNames);
+            for (const std::string& FieldName : FieldNames)
+            {
+                const FField* InField = Input.GetVertexField(FieldName);
+                if (!InField || InField->GetDataCount() != InVertexCount)
+                {
+                    continue;
+                }
+                TUniquePtr<FField> OutField = MakeUnique<FField>();
+                *OutField = *InField;
+                OutField->CompactData(VertexRemap);
+                Output.AddField(std::move(OutField));
+            }
+        }
+    }
+    else
+    {
+        Output.AddVerticesPositions(Input.GetVerticesPositions());
+
+        if (Options.bPassVertexFields)
+        {
+            Input.GetVertexFieldNames(FieldNames);
+            for (const std::string& FieldName : FieldNames)
+            {
+                if (const FField* InField = Input.GetVertexField(FieldName))
+                {
+                    TUniquePtr<FField> OutField = MakeUnique<FField>();
+                    *OutField = *InField;
+                    Output.AddField(std::move(OutField));
+                }
+            }
+        }
+    }
+
+    // ============================================================================
+    // 单元场（按父单元映射）
+    // ============================================================================
+
+    if (Options.bPassCellFields)
+    {
+        FFilterUtils::CopyCellFields(Input, Output, ParentCells, Flags);
+    }
+
+    Output.GetCells().AppendCells(std::move(OutTypes), std::move(OutOffsets), std::move(OutIndices));
+    Output.GetCells().Compact();
+
+    if (OutParentCells)
+    {
+        *OutParentCells = std::move(ParentCells);
+    }
+}
@@ -0,0 +1,350 @@
+#include "FilterUtils.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+    /** 合并边键时每个扫描块的键数（键数少于该值时不分桶） */
+    constexpr uint32 MergeBlockSize = 65536;
+
+    /** 压缩顶点时每个前缀和块的顶点数 */
+    constexpr uint32 CompactBlockSize = 65536;
+
+    /** 位图转索引时每个前缀和块的字数（每字 64 个元素） */
+    constexpr uint32 MaskBlockWords = 4096;
+
+    /** 合并边键时的分桶位数 */
+    constexpr uint32 MergeBucketBits = 8;
+
+    /** 按键的哈希选择桶（BucketBits 为 0 时只有一个桶） */
+    uint32 GetBucket(uint64 Key, uint32 BucketBits)
+    {
+        return BucketBits == 0 ? 0 : static_cast<uint32>((Key * 0x9E3779B97F4A7C15ull) >> (64 - BucketBits));
+    }
+
+    /** 按索引收集场的元素（IndexType 为 int32 或 uint32） */
+    template<typename IndexType>
+    TUniquePtr<FField> GatherFieldElements(const FField& InField, const TArray<IndexType>& Indices, EParallelForFlags Flags)
+    {
+        TArray<TUniquePtr<FField>> Temporaries;
+        const FField& Source = FFilterUtils::GetDecompressed(InField, Temporaries);
+
+        const uint32 Dimension = Source.GetFieldDimension();
+        const uint32 Count = Indices.Num();
+        TUniquePtr<FField> OutField = MakeUnique<FField>(Source.GetFieldName(), Source.GetFieldType(), Source.GetAttachment(), Dimension);
+        OutField->SetStorage(Source.GetStorage());
+        OutField->Resize(Count);
+
+        const size_t ElementSize = static_cast<size_t>(Dimension) * GetFieldStorageSize(Source.GetStorage());
+        const uint8* InData = static_cast<const uint8*>(Source.GetRawStorage());
+        uint8* OutData = static_cast<uint8*>(OutField->GetRawStorage());
+        ParallelForRange(Count, 0, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                const uint8* Element = InData + static_cast<size_t>(Indices[i]) * ElementSize;
+                std::copy(Element, Element + ElementSize, OutData + static_cast<size_t>(i) * ElementSize);
+            }
+        }, Flags);
+        return OutField;
+    }
+}
+
+void FFilterUtils::MergeEdgeKeys(const TArray<uint64>& CornerKeys, TArray<uint64>& OutUniqueKeys, TArray<int32>& OutCornerVertices, EParallelForFlags Flags)
+{
+    const uint32 Num = CornerKeys.Num();
+    OutUniqueKeys.Reset();
+    OutCornerVertices.Resize(Num);
+    if (Num == 0)
+    {
+        return;
+    }
+
+    const uint32 BucketBits = Num < MergeBlockSize ? 0 : MergeBucketBits;
+    const uint32 NumBuckets = 1u << BucketBits;
+    const uint32 NumBlocks = (Num + MergeBlockSize - 1) / MergeBlockSize;
+
+    // 统计每个块落入每个桶的键数
+    TArray<uint32> Cursors;
+    Cursors.Resize(NumBlocks * NumBuckets);
+    std::fill(Cursors.begin(), Cursors.end(), 0u);
+    ParallelForRange(NumBlocks, 1, [&](uint32 BlockBegin, uint32 BlockEnd)
+    {
+        for (uint32 Block = BlockBegin; Block < BlockEnd; ++Block)
+        {
+            uint32* Counts = Cursors.GetData() + static_cast<size_t>(Block) * NumBuckets;
+            const uint32 End = std::min(Num, (Block + 1) * MergeBlockSize);
+            for (uint32 i = Block * MergeBlockSize; i < End; ++i)
+            {
+                ++Counts[GetBucket(CornerKeys[i], BucketBits)];
+            }
+        }
+    }, Flags);
+
+    // 桶优先的前缀和：计数变为每个块在每个桶中的写入位置
+    TArray<uint32> BucketStarts;
+    BucketStarts.Resize(NumBuckets + 1);
+    uint32 Running = 0;
+    for (uint32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        BucketStarts[Bucket] = Running;
+        for (uint32 Block = 0; Block < NumBlocks; ++Block)
+        {
+            uint32& Cursor = Cursors[Block * NumBuckets + Bucket];
+            const uint32 Count = Cursor;
+            Cursor = Running;
+            Running += Count;
+        }
+    }
+    BucketStarts[NumBuckets] = Running;
+
+    TArray<uint64> Sorted;
+    Sorted.Resize(Num);
+    ParallelForRange(NumBlocks, 1, [&](uint32 BlockBegin, uint32 BlockEnd)
+    {
+        for (uint32 Block = BlockBegin; Block < BlockEnd; ++Block)
+        {
+            uint32* BlockCursors = Cursors.GetData() + static_cast<size_t>(Block) * NumBuckets;
+            const uint32 End = std::min(Num, (Block + 1) * MergeBlockSize);
+            for (uint32 i = Block * MergeBlockSize; i < End; ++i)
+            {
+                Sorted[BlockCursors[GetBucket(CornerKeys[i], BucketBits)]++] = CornerKeys[i];
+            }
+        }
+    }, Flags);
+
+    // 各桶排序去重，去重后的键留在桶的开头
+    TArray<uint32> UniqueCounts;
+    UniqueCounts.Resize(NumBuckets);
+    ParallelForRange(NumBuckets, 1, [&](uint32 BucketBegin, uint32 BucketEnd)
+    {
+        for (uint32 Bucket = BucketBegin; Bucket < BucketEnd; ++Bucket)
+        {
+            uint64* First = Sorted.GetData() + BucketStarts[Bucket];
+            uint64* Last = Sorted.GetData() + BucketStarts[Bucket + 1];
+            std::sort(First, Last);
+            UniqueCounts[Bucket] = static_cast<uint32>(std::unique(First, Last) - First);
+        }
+    }, Flags);
+
+    TArray<uint32> VertexStarts;
+    VertexStarts.Resize(NumBuckets + 1);
+    VertexStarts[0] = 0;
+    for (uint32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        VertexStarts[Bucket + 1] = VertexStarts[Bucket] + UniqueCounts[Bucket];
+    }
+
+    OutUniqueKeys.Resize(VertexStarts[NumBuckets]);
+    ParallelForRange(NumBuckets, 1, [&](uint32 BucketBegin, uint32 BucketEnd)
+    {
+        for (uint32 Bucket = BucketBegin; Bucket < BucketEnd; ++Bucket)
+        {
+            const uint64* First = Sorted.GetData() + BucketStarts[Bucket];
+            std::copy(First, First + UniqueCounts[Bucket], OutUniqueKeys.GetData() + VertexStarts[Bucket]);
+        }
+    }, Flags);
+
+    ParallelForRange(Num, 0, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            const uint64 Key = CornerKeys[i];
+            const uint32 Bucket = GetBucket(Key, BucketBits);
+            const uint64* First = Sorted.GetData() + BucketStarts[Bucket];
+            const uint64* Found = std::lower_bound(First, First + UniqueCounts[Bucket], Key);
+            OutCornerVertices[i] = static_cast<int32>(VertexStarts[Bucket] + (Found - First));
+        }
+    }, Flags);
+}
+
+uint32 FFilterUtils::CompactVertices(TArray<int32>& VertexRemap, TArray<uint32>* OutKeptVertices, EParallelForFlags Flags)
+{
+    const uint32 VertexCount = VertexRemap.Num();
+    const uint32 BlockCount = (VertexCount + CompactBlockSize - 1) / CompactBlockSize;
+    TArray<uint32> BlockStarts;
+    BlockStarts.Resize(BlockCount + 1);
+    BlockStarts[0] = 0;
+    ParallelForRange(BlockCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Block = Begin; Block < End; ++Block)
+        {
+            const uint32 VertexEnd = std::min(VertexCount, (Block + 1) * CompactBlockSize);
+            BlockStarts[Block + 1] = static_cast<uint32>(std::count(VertexRemap.begin() + Block * CompactBlockSize, VertexRemap.begin() + VertexEnd, 1));
+        }
+    }, Flags);
+    for (uint32 Block = 0; Block < BlockCount; ++Block)
+    {
+        BlockStarts[Block + 1] += BlockStarts[Block];
+    }
+
+    uint32* KeptVertices = nullptr;
+    if (OutKeptVertices)
+    {
+        OutKeptVertices->Resize(BlockStarts[BlockCount]);
+        KeptVertices = OutKeptVertices->GetData();
+    }
+    ParallelForRange(BlockCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Block = Begin; Block < End; ++Block)
+        {
+            int32 Next = static_cast<int32>(BlockStarts[Block]);
+            const uint32 VertexEnd = std::min(VertexCount, (Block + 1) * CompactBlockSize);
+            for (uint32 i = Block * CompactBlockSize; i < VertexEnd; ++i)
+            {
+                if (!VertexRemap[i])
+                {
+                    VertexRemap[i] = -1;
+                    continue;
+                }
+                if (KeptVertices)
+                {
+                    KeptVertices[Next] = i;
+                }
+                VertexRemap[i] = Next++;
+            }
+        }
+    }, Flags);
+    return BlockStarts[BlockCount];
+}
+
+void FFilterUtils::MaskToIndices(const TArray<uint64>& Mask, TArray<uint32>& OutIndices, EParallelForFlags Flags)
+{
+    const uint32 WordCount = Mask.Num();
+    const uint32 BlockCount = (WordCount + MaskBlockWords - 1) / MaskBlockWords;
+
+    // 各块按位计数，前缀和得到写入位置
+    TArray<uint32> BlockStarts;
+    BlockStarts.Resize(BlockCount + 1);
+    BlockStarts[0] = 0;
+    ParallelForRange(BlockCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Block = Begin; Block < End; ++Block)
+        {
+            const uint32 WordEnd = std::min(WordCount, (Block + 1) * MaskBlockWords);
+            uint32 Count = 0;
+            for (uint32 Word = Block * MaskBlockWords; Word < WordEnd; ++Word)
+            {
+                Count += static_cast<uint32>(std::popcount(Mask[Word]));
+            }
+            BlockStarts[Block + 1] = Count;
+        }
+    }, Flags);
+    for (uint32 Block = 0; Block < BlockCount; ++Block)
+    {
+        BlockStarts[Block + 1] += BlockStarts[Block];
+    }
+
+    OutIndices.Resize(BlockStarts[BlockCount]);
+    ParallelForRange(BlockCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Block = Begin; Block < End; ++Block)
+        {
+            uint32 Out = BlockStarts[Block];
+            const uint32 WordEnd = std::min(WordCount, (Block + 1) * MaskBlockWords);
+            for (uint32 Word = Block * MaskBlockWords; Word < WordEnd; ++Word)
+            {
+                for (uint64 Bits = Mask[Word]; Bits != 0; Bits &= Bits - 1)
+                {
+                    OutIndices[Out++] = Word * 64 + static_cast<uint32>(std::countr_zero(Bits));
+                }
+            }
+        }
+    }, Flags);
+}
+
+void FFilterUtils::InterpolateVertices(const IMesh& Input, IMesh& Output, const TArray<FEdgePoint>& Points, bool bPassVertexFields, EParallelForFlags Flags)
+{
+    const uint32 NumPoints = Points.Num();
+    const FVector* InPositions = Input.GetVerticesPositionsPtr();
+
+    TArray<FVector> Positions;
+    Positions.Resize(NumPoints);
+    ParallelForRange(NumPoints, 0, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            const FEdgePoint& Point = Points[i];
+            const FVector& A = InPositions[Point.V0];
+            Positions[i] = A + (InPositions[Point.V1] - A) * Point.T;
+        }
+    }, Flags);
+    Output.AddVerticesPositions(std::move(Positions));
+
+    if (!bPassVertexFields)
+    {
+        return;
+    }
+
+    TArray<std::string> FieldNames;
+    Input.GetVertexFieldNames(FieldNames);
+    for (const std::string& FieldName : FieldNames)
+    {
+        const FField* InField = Input.GetVertexField(FieldName);
+        if (!InField || InField->GetDataCount() != Input.GetVertexCount())
+        {
+            continue;
+        }
+
+        TArray<float> ConversionBuffer;
+        const float* InData = InField->GetFloatData(ConversionBuffer);
+        const uint32 Dimension = InField->GetFieldDimension();
+        TUniquePtr<FField> OutField = MakeUnique<FField>(InField->GetFieldName(), InField->GetFieldType(), EFieldAttachment::Vertex, Dimension);
+        OutField->Resize(NumPoints);
+        float* OutData = OutField->GetFieldData().GetData();
+        ParallelForRange(NumPoints, 0, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                const FEdgePoint& Point = Points[i];
+                const float* A = InData + static_cast<size_t>(Point.V0) * Dimension;
+                const float* B = InData + static_cast<size_t>(Point.V1) * Dimension;
+                float* Out = OutData + static_cast<size_t>(i) * Dimension;
+                for (uint32 c = 0; c < Dimension; ++c)
+                {
+                    Out[c] = A[c] + (B[c] - A[c]) * Point.T;
+                }
+            }
+        }, Flags);
+        Output.AddField(std::move(OutField));
+    }
+}
+
+const FField& FFilterUtils::GetDecompressed(const FField& InField, TArray<TUniquePtr<FField>>& OutTemporaries)
+{
+    if (!InField.IsCompressed())
+    {
+        return InField;
+    }
+    OutTemporaries.Add(MakeUnique<FField>(InField));
+    OutTemporaries.Last()->Decompress();
+    return *OutTemporaries.Last();
+}
+
+TUniquePtr<FField> FFilterUtils::GatherField(const FField& InField, const TArray<int32>& Indices, EParallelForFlags Flags)
+{
+    return GatherFieldElements(InField, Indices, Flags);
+}
+
+TUniquePtr<FField> FFilterUtils::GatherField(const FField& InField, const TArray<uint32>& Indices, EParallelForFlags Flags)
+{
+    return GatherFieldElements(InField, Indices, Flags);
+}
+
+void FFilterUtils::CopyCellFields(const IMesh& Input, IMesh& Output, const TArray<int32>& ParentCells, EParallelForFlags Flags)
+{
+    const uint32 InCellCount = Input.GetCellCount();
+
+    TArray<std::string> FieldNames;
+    Input.GetCellFieldNames(FieldNames);
+    for (const std::string& FieldName : FieldNames)
+    {
+        const FField* InField = Input.GetCellField(FieldName);
+        if (InField && InField->GetDataCount() == InCellCount)
+        {
+            Output.AddField(GatherField(*InField, ParentCells, Flags));
+        }
+    }
+}
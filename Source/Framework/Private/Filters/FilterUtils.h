@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "Memory/UniquePtr.h"
+#include "Threading/ParallelFor.h"
+#include "HAL/Platform.h"
+
+class IMesh;
+class FField;
+
+/**
+ * 边上的插值点：位于输入顶点 V0 与 V1 之间，参数 T（0 为 V0，1 为 V1）
+ */
+struct FEdgePoint
+{
+    int32 V0 = 0;
+    int32 V1 = 0;
+    float T = 0.0f;
+};
+
+/**
+ * FFilterUtils - 过滤器共用的输出构建工具（等值面、切片、裁剪等过滤器内部使用）
+ */
+struct FFilterUtils
+{
+    /**
+     * 生成无向边的键（两个顶点索引按从小到大排列，共享边的两个单元得到相同的键）
+     */
+    static uint64 MakeEdgeKey(int32 A, int32 B)
+    {
+        const uint32 Lo = static_cast<uint32>(A < B ? A : B);
+        const uint32 Hi = static_cast<uint32>(A < B ? B : A);
+        return (static_cast<uint64>(Lo) << 32) | Hi;
+    }
+
+    /** 边键中较小的顶点索引 */
+    static int32 GetEdgeKeyLo(uint64 Key) { return static_cast<int32>(Key >> 32); }
+
+    /** 边键中较大的顶点索引 */
+    static int32 GetEdgeKeyHi(uint64 Key) { return static_cast<int32>(Key & 0xFFFFFFFFu); }
+
+    /**
+     * 合并相同的边键（共享边上的点只输出一次）
+     *
+     * 键按哈希分桶后各桶并行排序去重，输出顺序只与键的集合有关，与线程数无关
+     *
+     * @param CornerKeys 每个输出单元角点所在边的键
+     * @param OutUniqueKeys 输出去重后的键（输出顶点 i 位于 OutUniqueKeys[i] 表示的边上）
+     * @param OutCornerVertices 输出每个角点对应的输出顶点索引
+     * @param Flags 并行标志
+     */
+    static void MergeEdgeKeys(const TArray<uint64>& CornerKeys, TArray<uint64>& OutUniqueKeys, TArray<int32>& OutCornerVertices, EParallelForFlags Flags);
+
+    /**
+     * 压缩被使用的顶点：各块计数后前缀和，再并行写入新编号（保持原顺序）
+     * @param VertexRemap 输入为每个顶点的使用标记（0 或 1），输出为新编号（未使用的顶点为 -1）
+     * @param OutKeptVertices 可选，输出每个新顶点对应的原顶点索引
+     * @param Flags 并行标志
+     * @return 被使用的顶点数量
+     */
+    static uint32 CompactVertices(TArray<int32>& VertexRemap, TArray<uint32>* OutKeptVertices, EParallelForFlags Flags);
+
+    /**
+     * 按位图提取置位元素的索引（升序）：各块按位计数后前缀和，再并行写出
+     * @param Mask 位图（元素 i 对应字 i / 64 的第 i % 64 位）
+     * @param OutIndices 输出索引
+     * @param Flags 并行标志
+     */
+    static void MaskToIndices(const TArray<uint64>& Mask, TArray<uint32>& OutIndices, EParallelForFlags Flags);
+
+    /**
+     * 按边上的插值点写入输出网格的顶点坐标，并按需插值顶点场（输出为 Float32 存储）
+     * @param Input 输入网格
+     * @param Output 输出网格（追加顶点和顶点场）
+     * @param Points 插值点
+     * @param bPassVertexFields 是否插值顶点场
+     * @param Flags 并行标志
+     */
+    static void InterpolateVertices(const IMesh& Input, IMesh& Output, const TArray<FEdgePoint>& Points, bool bPassVertexFields, EParallelForFlags Flags);
+
+    /**
+     * 取得未压缩的场：压缩的场解压到临时副本（追加到 OutTemporaries）并返回该副本，否则返回输入场本身
+     * @param InField 输入场
+     * @param OutTemporaries 临时副本（需在使用返回的场期间保持有效）
+     */
+    static const FField& GetDecompressed(const FField& InField, TArray<TUniquePtr<FField>>& OutTemporaries);
+
+    /**
+     * 按索引收集场的元素到新场（保留名称、附着位置和存储类型，按字节拷贝，压缩的输入场先解压）
+     * @param InField 输入场
+     * @param Indices 每个输出元素对应的输入元素索引
+     * @param Flags 并行标志
+     * @return 新场，元素数量为 Indices.Num()
+     */
+    static TUniquePtr<FField> GatherField(const FField& InField, const TArray<int32>& Indices, EParallelForFlags Flags);
+    static TUniquePtr<FField> GatherField(const FField& InField, const TArray<uint32>& Indices, EParallelForFlags Flags);
+
+    /**
+     * 按父单元拷贝单元场（保留输入场的存储类型，压缩的输入场先解压）
+     * @param Input 输入网格
+     * @param Output 输出网格（添加单元场）
+     * @param ParentCells 每个输出单元对应的输入单元索引
+     * @param Flags 并行标志
+     */
+    static void CopyCellFields(const IMesh& Input, IMesh& Output, const TArray<int32>& ParentCells, EParallelForFlags Flags);
+};
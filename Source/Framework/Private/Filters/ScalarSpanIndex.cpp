@@ -0,0 +1,283 @@
+#include "Filters/ScalarSpanIndex.h"
+#include "FilterUtils.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Field/FieldCompression.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    /** 按单元并行时的区间粒度 */
+    constexpr uint32 CellGrainSize = 16384;
+
+    /** 每个直方图格的平均单元数（决定直方图的精度） */
+    constexpr uint32 CellsPerBin = 64;
+
+    /** 直方图的最大格数 */
+    constexpr uint32 MaxBinCount = 65536;
+
+    /**
+     * 按顶点读取压缩标量场的值：保留最近解码的一个块，编号相近的顶点只解码一次
+     * 每个任务使用自己的实例，不分配整个场的解压副本
+     */
+    struct FCompressedScalarReader
+    {
+        explicit FCompressedScalarReader(const FField& InField)
+            : Field(InField)
+            , BlockValueCount(InField.GetCompressedData()->GetBlockValueCount())
+        {
+        }
+
+        float operator()(int32 VertexIndex)
+        {
+            const uint32 Block = static_cast<uint32>(VertexIndex) / BlockValueCount;
+            if (Block != CachedBlock)
+            {
+                Field.DecodeFloatBlock(Block, Values);
+                CachedBlock = Block;
+            }
+            return Values[static_cast<uint32>(VertexIndex) - Block * BlockValueCount];
+        }
+
+        const FField& Field;
+        uint32 BlockValueCount;
+        uint32 CachedBlock = std::numeric_limits<uint32>::max();
+        TArray<float> Values;
+    };
+
+    /**
+     * 计算每个单元的标量区间（含 NaN 的单元区间为空：Min > Max）
+     * @param MakeReader 每个任务调用一次，返回按顶点取值的函数对象
+     */
+    template<typename MakeReaderType>
+    void ComputeCellSpans(const FCellArray& Cells, MakeReaderType&& MakeReader, TArray<float>& CellMin, TArray<float>& CellMax, EParallelForFlags Flags)
+    {
+        ParallelForRange(Cells.GetCellCount(), CellGrainSize, [&](uint32 Begin, uint32 End)
+        {
+            auto Reader = MakeReader();
+            for (uint32 CellIndex = Begin; CellIndex < End; ++CellIndex)
+            {
+                float Min = std::numeric_limits<float>::infinity();
+                float Max = -std::numeric_limits<float>::infinity();
+                bool bNaN = false;
+                for (const int32 VertexIndex : Cells.GetCellViewUnchecked(CellIndex))
+                {
+                    const float Value = Reader(VertexIndex);
+                    bNaN |= std::isnan(Value);
+                    Min = std::min(Min, Value);
+                    Max = std::max(Max, Value);
+                }
+                // 无效单元的区间为空（Min > Max），不进入索引
+                CellMin[CellIndex] = bNaN ? std::numeric_limits<float>::infinity() : Min;
+                CellMax[CellIndex] = bNaN ? -std::numeric_limits<float>::infinity() : Max;
+            }
+        }, Flags);
+    }
+}
+
+void FScalarSpanIndex::Build(const IMesh& Mesh, const FField& Field, bool bParallel)
+{
+    if (Field.GetDataCount() != Mesh.GetVertexCount() || Field.GetFieldDimension() != 1)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Span index requires a vertex scalar field: " + Field.GetFieldName());
+    }
+
+    const EParallelForFlags Flags = bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+    const FCellArray& Cells = Mesh.GetCells();
+    CellCount = Cells.GetCellCount();
+    CellsVersion = Cells.GetVersion();
+    FieldVersion = Field.GetVersion();
+    SourceField = &Field;
+
+    // ============================================================================
+    // 单元区间
+    // ============================================================================
+
+    TArray<float> CellMin;
+    TArray<float> CellMax;
+    CellMin.Resize(CellCount);
+    CellMax.Resize(CellCount);
+    if (Field.IsCompressed())
+    {
+        // 压缩的场按块解码，不分配整个场的解压副本
+        ComputeCellSpans(Cells, [&Field]() { return FCompressedScalarReader(Field); }, CellMin, CellMax, Flags);
+    }
+    else
+    {
+        TArray<float> ConversionBuffer;
+        const float* Scalars = Field.GetFloatData(ConversionBuffer);
+        ComputeCellSpans(Cells, [Scalars]() { return [Scalars](int32 VertexIndex) { return Scalars[VertexIndex]; }; }, CellMin, CellMax, Flags);
+    }
+
+    // ============================================================================
+    // 按 Max 分桶（计数排序）
+    // ============================================================================
+
+    float MaxLo = std::numeric_limits<float>::infinity();
+    float MaxHi = -std::numeric_limits<float>::infinity();
+    uint32 ValidCount = 0;
+    for (uint32 CellIndex = 0; CellIndex < CellCount; ++CellIndex)
+    {
+        if (CellMin[CellIndex] <= CellMax[CellIndex])
+        {
+            MaxLo = std::min(MaxLo, CellMax[CellIndex]);
+            MaxHi = std::max(MaxHi, CellMax[CellIndex]);
+            ++ValidCount;
+        }
+    }
+
+    const uint32 BinCount = std::clamp(ValidCount / CellsPerBin, 1u, MaxBinCount);
+    const double Span = static_cast<double>(MaxHi) - static_cast<double>(MaxLo);
+    const double Scale = (ValidCount > 0 && std::isfinite(Span) && Span > 0.0) ? static_cast<double>(BinCount) / Span : 0.0;
+    auto GetBin = [&](float Value)
+    {
+        const double Offset = (static_cast<double>(Value) - static_cast<double>(MaxLo)) * Scale;
+        return Offset >= 0.0 ? std::min(BinCount - 1, static_cast<uint32>(Offset)) : 0u;
+    };
+
+    TArray<uint32> BinCounts;
+    BinCounts.Resize(BinCount);
+    std::fill(BinCounts.begin(), BinCounts.end(), 0u);
+    for (uint32 CellIndex = 0; CellIndex < CellCount; ++CellIndex)
+    {
+        if (CellMin[CellIndex] <= CellMax[CellIndex])
+        {
+            ++BinCounts[GetBin(CellMax[CellIndex])];
+        }
+    }
+
+    // 相邻的格合并为桶，BinCounts 变为每个格在 Spans 中的写入位置
+    BucketStarts.Reset();
+    BucketStarts.Add(0);
+    uint32 Running = 0;
+    for (uint32 Bin = 0; Bin < BinCount; ++Bin)
+    {
+        const uint32 Count = BinCounts[Bin];
+        BinCounts[Bin] = Running;
+        Running += Count;
+        if (Running - BucketStarts.Last() >= TargetBucketSize && Bin + 1 < BinCount)
+        {
+            BucketStarts.Add(Running);
+        }
+    }
+    if (Running > BucketStarts.Last() || BucketStarts.Num() == 1)
+    {
+        BucketStarts.Add(Running);
+    }
+    const uint32 BucketCount = BucketStarts.Num() - 1;
+
+    Spans.Resize(ValidCount);
+    for (uint32 CellIndex = 0; CellIndex < CellCount; ++CellIndex)
+    {
+        if (CellMin[CellIndex] <= CellMax[CellIndex])
+        {
+            Spans[BinCounts[GetBin(CellMax[CellIndex])]++] = FSpan{ CellMin[CellIndex], CellMax[CellIndex], CellIndex };
+        }
+    }
+
+    // 桶内按 Min 排序（Min 相同时按单元编号，结果与线程数无关）
+    BucketMaxLower.Resize(BucketCount);
+    BucketMaxUpper.Resize(BucketCount);
+    ParallelForRange(BucketCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Bucket = Begin; Bucket < End; ++Bucket)
+        {
+            FSpan* First = Spans.GetData() + BucketStarts[Bucket];
+            FSpan* Last = Spans.GetData() + BucketStarts[Bucket + 1];
+            std::sort(First, Last, [](const FSpan& A, const FSpan& B)
+            {
+                return A.Min != B.Min ? A.Min < B.Min : A.Cell < B.Cell;
+            });
+            float Lower = std::numeric_limits<float>::infinity();
+            float Upper = -std::numeric_limits<float>::infinity();
+            for (const FSpan* It = First; It != Last; ++It)
+            {
+                Lower = std::min(Lower, It->Max);
+                Upper = std::max(Upper, It->Max);
+            }
+            BucketMaxLower[Bucket] = Lower;
+            BucketMaxUpper[Bucket] = Upper;
+        }
+    }, Flags);
+}
+
+bool FScalarSpanIndex::Update(const IMesh& Mesh, const FField& Field, bool bParallel)
+{
+    if (IsBuiltFor(Mesh, Field))
+    {
+        return false;
+    }
+    Build(Mesh, Field, bParallel);
+    return true;
+}
+
+void FScalarSpanIndex::Clear()
+{
+    Spans.Reset();
+    BucketStarts.Reset();
+    BucketMaxLower.Reset();
+    BucketMaxUpper.Reset();
+    CellCount = 0;
+    CellsVersion = 0;
+    FieldVersion = 0;
+    SourceField = nullptr;
+}
+
+bool FScalarSpanIndex::IsBuiltFor(const IMesh& Mesh, const FField& Field) const
+{
+    const FCellArray& Cells = Mesh.GetCells();
+    return SourceField == &Field
+        && FieldVersion == Field.GetVersion()
+        && CellsVersion == Cells.GetVersion()
+        && CellCount == Cells.GetCellCount()
+        && Field.GetDataCount() == Mesh.GetVertexCount();
+}
+
+void FScalarSpanIndex::Query(float IsoValue, TArray<uint32>& OutCells, bool bParallel) const
+{
+    const EParallelForFlags Flags = bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+    const uint32 WordCount = (CellCount + 63) / 64;
+    TArray<uint64> Words;
+    Words.Resize(WordCount);
+    std::fill(Words.begin(), Words.end(), uint64(0));
+    uint64* WordData = Words.GetData();
+
+    // 在位图中标记命中的单元
+    ParallelForRange(GetBucketCount(), 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Bucket = Begin; Bucket < End; ++Bucket)
+        {
+            if (BucketMaxUpper[Bucket] < IsoValue)
+            {
+                continue;
+            }
+            const FSpan* First = Spans.GetData() + BucketStarts[Bucket];
+            const FSpan* Last = Spans.GetData() + BucketStarts[Bucket + 1];
+            const FSpan* PrefixEnd = std::partition_point(First, Last, [IsoValue](const FSpan& Span) { return Span.Min < IsoValue; });
+            const bool bAllAbove = BucketMaxLower[Bucket] >= IsoValue;
+            for (const FSpan* It = First; It != PrefixEnd; ++It)
+            {
+                if (bAllAbove || It->Max >= IsoValue)
+                {
+                    std::atomic_ref<uint64>(WordData[It->Cell / 64]).fetch_or(uint64(1) << (It->Cell % 64), std::memory_order_relaxed);
+                }
+            }
+        }
+    }, Flags);
+
+    // 按单元编号顺序输出
+    FFilterUtils::MaskToIndices(Words, OutCells, Flags);
+}
+
+size_t FScalarSpanIndex::GetMemorySize() const
+{
+    return static_cast<size_t>(Spans.Num()) * sizeof(FSpan)
+        + static_cast<size_t>(BucketStarts.Num()) * sizeof(uint32)
+        + static_cast<size_t>(BucketMaxLower.Num() + BucketMaxUpper.Num()) * sizeof(float);
+}
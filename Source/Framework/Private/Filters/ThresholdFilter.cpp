@@ -0,0 +1,174 @@
+#include "Filters/ThresholdFilter.h"
+#include "FilterUtils.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Field/FieldCompression.h"
+#include "Math/VectorKernels.h"
+#include "Exception/Exception.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace
+{
+    /** 每个任务处理的位图字数（每字 64 个元素） */
+    constexpr uint32 WordGrainSize = 1024;
+
+    /**
+     * 逐块解码压缩的标量场并计算选择位图（不反转，不分配整个场的解压副本）
+     * 块的起点不一定按 64 对齐，块的位图移位后写入，与相邻块共享的字用原子或合并
+     * @return 选中的元素数量
+     */
+    uint32 ComputeCompressedMask(const FField& Field, float Lower, float Upper, TArray<uint64>& OutMask, EParallelForFlags Flags)
+    {
+        const FCompressedFieldData& Compressed = *Field.GetCompressedData();
+        const uint32 BlockValueCount = Compressed.GetBlockValueCount();
+        std::fill(OutMask.begin(), OutMask.end(), uint64(0));
+        uint64* MaskData = OutMask.GetData();
+
+        std::atomic<uint32> Total{0};
+        const uint32 BlockGrainSize = std::max(1u, WordGrainSize * 64 / BlockValueCount);
+        ParallelForRange(Compressed.GetNumBlocks(), BlockGrainSize, [&](uint32 Begin, uint32 End)
+        {
+            TArray<float> Values;
+            TArray<uint64> Bits;
+            uint32 Selected = 0;
+            for (uint32 Block = Begin; Block < End; ++Block)
+            {
+                Field.DecodeFloatBlock(Block, Values);
+                Bits.Resize((Values.Num() + 63) / 64);
+                Selected += FVectorKernels::RangeMask(TArrayView<const float>(Values.GetData(), Values.Num()), Lower, Upper,
+                    TArrayView<uint64>(Bits.GetData(), Bits.Num()));
+
+                const uint32 FirstValue = Block * BlockValueCount;
+                const uint32 FirstWord = FirstValue / 64;
+                const uint32 Shift = FirstValue % 64;
+                for (uint32 k = 0; k < Bits.Num(); ++k)
+                {
+                    const uint64 Low = Bits[k] << Shift;
+                    const uint64 High = Shift != 0 ? Bits[k] >> (64 - Shift) : 0;
+                    if (Low != 0)
+                    {
+                        std::atomic_ref<uint64>(MaskData[FirstWord + k]).fetch_or(Low, std::memory_order_relaxed);
+                    }
+                    if (High != 0)
+                    {
+                        std::atomic_ref<uint64>(MaskData[FirstWord + k + 1]).fetch_or(High, std::memory_order_relaxed);
+                    }
+                }
+            }
+            Total.fetch_add(Selected, std::memory_order_relaxed);
+        }, Flags);
+        return Total.load();
+    }
+}
+
+FSubsetMesh FThresholdFilter::Execute(const IMesh& Input, const std::string& CellFieldName, float Lower, float Upper,
+    const FThresholdOptions& Options)
+{
+    const FField* Field = Input.GetCellField(CellFieldName);
+    if (!Field)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Cell field not found: " + CellFieldName);
+    }
+    if (Field->GetDataCount() != Input.GetCellCount())
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Cell field size does not match cell count: " + CellFieldName);
+    }
+
+    TArray<uint64> Mask;
+    ComputeMask(*Field, Lower, Upper, Mask, Options);
+
+    TArray<uint32> SelectedCells;
+    MaskToIndices(Mask, SelectedCells, Options.bParallel);
+    return FSubsetMesh(Input, std::move(SelectedCells));
+}
+
+uint32 FThresholdFilter::ComputeMask(const FField& Field, float Lower, float Upper, TArray<uint64>& OutMask,
+    const FThresholdOptions& Options)
+{
+    if (Field.GetFieldType() != EFieldType::Scalar || Field.GetFieldDimension() != 1)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Threshold field must be scalar: " + Field.GetFieldName());
+    }
+    if (std::isnan(Lower) || std::isnan(Upper))
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Threshold bounds must not be NaN");
+    }
+
+    const EParallelForFlags Flags = Options.bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+    const uint32 Count = Field.GetDataCount();
+    const uint32 WordCount = (Count + 63) / 64;
+    OutMask.Resize(WordCount);
+
+    // 压缩的场逐块解码，反转在位图完成后进行
+    if (Field.IsCompressed())
+    {
+        const uint32 Selected = ComputeCompressedMask(Field, Lower, Upper, OutMask, Flags);
+        if (!Options.bInvert)
+        {
+            return Selected;
+        }
+        ParallelForRange(WordCount, WordGrainSize, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 Word = Begin; Word < End; ++Word)
+            {
+                OutMask[Word] = ~OutMask[Word];
+            }
+        }, Flags);
+        // 最后一个字的多余位保持为 0
+        if (Count % 64 != 0)
+        {
+            OutMask[WordCount - 1] &= (uint64(1) << (Count % 64)) - 1;
+        }
+        return Count - Selected;
+    }
+
+    TArray<float> ConversionBuffer;
+    const float* Values = Field.GetFloatData(ConversionBuffer);
+
+    // 每块的字数是整数，块之间不共享字
+    const uint32 TaskCount = (WordCount + WordGrainSize - 1) / WordGrainSize;
+    TArray<uint32> TaskCounts;
+    TaskCounts.Resize(TaskCount);
+    ParallelForRange(TaskCount, 1, [&](uint32 Begin, uint32 End)
+    {
+        for (uint32 Task = Begin; Task < End; ++Task)
+        {
+            const uint32 WordBegin = Task * WordGrainSize;
+            const uint32 WordEnd = std::min(WordCount, WordBegin + WordGrainSize);
+            const uint32 ValueBegin = WordBegin * 64;
+            const uint32 ValueEnd = std::min(Count, WordEnd * 64);
+            TArrayView<uint64> Bits(OutMask.GetData() + WordBegin, WordEnd - WordBegin);
+            uint32 Selected = FVectorKernels::RangeMask(TArrayView<const float>(Values + ValueBegin, ValueEnd - ValueBegin), Lower, Upper, Bits);
+
+            if (Options.bInvert)
+            {
+                for (uint64& Word : Bits)
+                {
+                    Word = ~Word;
+                }
+                // 最后一个字的多余位保持为 0
+                if (WordEnd == WordCount && Count % 64 != 0)
+                {
+                    Bits[Bits.Num() - 1] &= (uint64(1) << (Count % 64)) - 1;
+                }
+                Selected = (ValueEnd - ValueBegin) - Selected;
+            }
+            TaskCounts[Task] = Selected;
+        }
+    }, Flags);
+
+    uint32 Total = 0;
+    for (const uint32 TaskSelected : TaskCounts)
+    {
+        Total += TaskSelected;
+    }
+    return Total;
+}
+
+void FThresholdFilter::MaskToIndices(const TArray<uint64>& Mask, TArray<uint32>& OutIndices, bool bParallel)
+{
+    FFilterUtils::MaskToIndices(Mask, OutIndices, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
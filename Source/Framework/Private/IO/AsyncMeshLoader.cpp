@@ -0,0 +1,226 @@
+#include "IO/AsyncMeshLoader.h"
+#include "Mesh/Mesh.h"
+#include "Exception/Exception.h"
+#include "HAL/MappedFile.h"
+#include "Threading/FrameworkTaskQueue.h"
+#include "Threading/TaskGraph.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    /** 文件是否为原生网格格式（按魔数判断） */
+    bool IsNativeMeshFile(const std::string& Path)
+    {
+        std::ifstream Stream(Path, std::ios::binary);
+        char Head[sizeof(FNativeMeshFile::Magic)] = {};
+        Stream.read(Head, sizeof(Head));
+        return Stream && std::memcmp(Head, FNativeMeshFile::Magic, sizeof(Head)) == 0;
+    }
+}
+
+// ============================================================================
+// FAsyncMeshLoad
+// ============================================================================
+
+FAsyncMeshLoad::FAsyncMeshLoad(const std::string& InPath)
+    : Path(InPath)
+    , State(EAsyncMeshLoadState::Pending)
+    , bCancelRequested(false)
+    , TotalBytes(0)
+    , DecodedBytes(0)
+    , PostedPercent(-1)
+    , BroadcastPercent(-1)
+{
+}
+
+bool FAsyncMeshLoad::IsDone() const
+{
+    const EAsyncMeshLoadState CurrentState = State.load();
+    return CurrentState == EAsyncMeshLoadState::Completed || CurrentState == EAsyncMeshLoadState::Failed || CurrentState == EAsyncMeshLoadState::Canceled;
+}
+
+float FAsyncMeshLoad::GetProgress() const
+{
+    if (State.load() == EAsyncMeshLoadState::Completed)
+    {
+        return 1.0f;
+    }
+    const uint64 Total = TotalBytes.load();
+    if (Total == 0)
+    {
+        return 0.0f;
+    }
+    return static_cast<float>(static_cast<double>(std::min(DecodedBytes.load(), Total)) / static_cast<double>(Total));
+}
+
+void FAsyncMeshLoad::Cancel()
+{
+    bCancelRequested.store(true);
+}
+
+bool FAsyncMeshLoad::Wait(uint32 TimeoutMs) const
+{
+    std::unique_lock<std::mutex> Lock(StateMutex);
+    if (TimeoutMs == 0)
+    {
+        StateCondition.wait(Lock, [this]() { return IsDone(); });
+        return true;
+    }
+    return StateCondition.wait_for(Lock, std::chrono::milliseconds(TimeoutMs), [this]() { return IsDone(); });
+}
+
+TSharedPtr<IMesh> FAsyncMeshLoad::GetMesh() const
+{
+    std::lock_guard<std::mutex> Lock(StateMutex);
+    return State.load() == EAsyncMeshLoadState::Completed ? Mesh : TSharedPtr<IMesh>();
+}
+
+std::string FAsyncMeshLoad::GetError() const
+{
+    std::lock_guard<std::mutex> Lock(StateMutex);
+    return Error;
+}
+
+void FAsyncMeshLoad::RunDecode(const FAsyncMeshLoadOptions& Options, const TSharedPtr<FAsyncMeshLoad>& Self)
+{
+    if (bCancelRequested.load())
+    {
+        Finish(EAsyncMeshLoadState::Canceled, TSharedPtr<IMesh>(), "", Self);
+        return;
+    }
+    State.store(EAsyncMeshLoadState::Loading);
+
+    try
+    {
+        const bool bNative = IsNativeMeshFile(Path);
+        const FMeshReadProgress& UserProgress = bNative ? Options.NativeOptions.Progress : Options.VtkOptions.Progress;
+        const FMeshReadProgress Progress = [this, &Self, &UserProgress](uint64 ProcessedBytes, uint64 FileBytes)
+        {
+            TotalBytes.store(FileBytes);
+            DecodedBytes.store(ProcessedBytes);
+            UpdateProgress(Self);
+            if (UserProgress && !UserProgress(ProcessedBytes, FileBytes))
+            {
+                return false;
+            }
+            return !bCancelRequested.load();
+        };
+
+        TSharedPtr<IMesh> Loaded = MakeShared<IMesh>();
+        if (bNative)
+        {
+            FNativeMeshReadOptions ReadOptions = Options.NativeOptions;
+            ReadOptions.Progress = Progress;
+            FNativeMeshFile::Read(Path, *Loaded, ReadOptions);
+        }
+        else
+        {
+            FVtkReadOptions ReadOptions = Options.VtkOptions;
+            ReadOptions.Progress = Progress;
+            FVtkMeshReader::Read(Path, *Loaded, ReadOptions);
+        }
+        DecodedBytes.store(TotalBytes.load());
+        Finish(EAsyncMeshLoadState::Completed, Loaded, "", Self);
+    }
+    catch (const FOperationCanceledException&)
+    {
+        Finish(EAsyncMeshLoadState::Canceled, TSharedPtr<IMesh>(), "", Self);
+    }
+    catch (const FException& Exception)
+    {
+        Finish(EAsyncMeshLoadState::Failed, TSharedPtr<IMesh>(), Exception.GetMessage(), Self);
+    }
+    catch (const std::exception& Exception)
+    {
+        Finish(EAsyncMeshLoadState::Failed, TSharedPtr<IMesh>(), Exception.what(), Self);
+    }
+}
+
+void FAsyncMeshLoad::UpdateProgress(const TSharedPtr<FAsyncMeshLoad>& Self)
+{
+    const int32 Percent = static_cast<int32>(GetProgress() * 100.0f);
+    int32 Posted = PostedPercent.load();
+    while (Percent > Posted)
+    {
+        // 只有推进了 PostedPercent 的线程投递事件，每个百分点最多投递一次
+        if (PostedPercent.compare_exchange_weak(Posted, Percent))
+        {
+            FFrameworkTaskQueue::Get().EnqueueTask([Self, Percent]() { Self->BroadcastProgress(Percent); });
+            return;
+        }
+    }
+}
+
+void FAsyncMeshLoad::BroadcastProgress(int32 Percent)
+{
+    // 投递的顺序可能与进度顺序不同，只广播递增的进度
+    if (Percent > BroadcastPercent)
+    {
+        BroadcastPercent = Percent;
+        OnProgress.Broadcast(static_cast<float>(Percent) / 100.0f);
+    }
+}
+
+void FAsyncMeshLoad::Finish(EAsyncMeshLoadState FinalState, TSharedPtr<IMesh> LoadedMesh, const std::string& ErrorMessage, const TSharedPtr<FAsyncMeshLoad>& Self)
+{
+    // 先投递结束事件再发布状态，Wait 返回时事件一定已经在队列中
+    FFrameworkTaskQueue::Get().EnqueueTask([Self, FinalState, LoadedMesh, ErrorMessage]()
+    {
+        switch (FinalState)
+        {
+            case EAsyncMeshLoadState::Completed:
+                Self->BroadcastProgress(100);
+                Self->OnCompleted.Broadcast(LoadedMesh);
+                break;
+            case EAsyncMeshLoadState::Failed:
+                Self->OnFailed.Broadcast(ErrorMessage);
+                break;
+            case EAsyncMeshLoadState::Canceled:
+                Self->OnCanceled.Broadcast();
+                break;
+            default:
+                break;
+        }
+    });
+
+    {
+        std::lock_guard<std::mutex> Lock(StateMutex);
+        Mesh = std::move(LoadedMesh);
+        Error = ErrorMessage;
+        PrefetchFile.Reset();
+        State.store(FinalState);
+    }
+    StateCondition.notify_all();
+}
+
+// ============================================================================
+// FAsyncMeshLoader
+// ============================================================================
+
+TSharedPtr<FAsyncMeshLoad> FAsyncMeshLoader::Load(const std::string& Path, const FAsyncMeshLoadOptions& Options)
+{
+    TSharedPtr<FAsyncMeshLoad> Load = MakeShared<FAsyncMeshLoad>(Path);
+    std::error_code ErrorCode;
+    const uintmax_t FileSize = std::filesystem::file_size(Path, ErrorCode);
+    Load->TotalBytes.store(ErrorCode ? 0 : static_cast<uint64>(FileSize));
+
+    // 预读由操作系统在后台执行，不占用任务图的线程，解码任务何时运行都能与磁盘读取重叠
+    if (Options.bPrefetch && Load->TotalBytes.load() > 0)
+    {
+        try
+        {
+            Load->PrefetchFile = FMappedFile::Open(Path);
+            Load->PrefetchFile->Prefetch(0, Load->PrefetchFile->GetSize());
+        }
+        catch (const FException&)
+        {
+            // 文件无法打开等错误由解码任务报告
+        }
+    }
+    FTaskGraph::Get().Launch([Load, Options]() { Load->RunDecode(Options, Load); });
+    return Load;
+}
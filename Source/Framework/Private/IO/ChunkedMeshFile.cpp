@@ -0,0 +1,397 @@
+#include "IO/ChunkedMeshFile.h"
+#include "IO/NativeMeshFile.h"
+#include "../Filters/FilterUtils.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include "HAL/MappedFile.h"
+#include "Math/VectorKernels.h"
+#include "Memory/UniquePtr.h"
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    /** 文件头 */
+    struct FFileHeader
+    {
+        char Magic[8];
+        uint32 Version;
+        uint32 ChunkCount;
+        uint64 ChunkTableOffset;
+        uint64 VertexCount;
+        uint64 CellCount;
+        uint32 MeshNameLength;
+        uint32 Reserved[5];
+    };
+
+    /** 块表项 */
+    struct FChunkEntry
+    {
+        uint64 FirstCell;
+        uint64 MeshOffset;
+        uint64 MeshSize;
+        uint64 GlobalVertexIdsOffset;
+        uint32 CellCount;
+        uint32 VertexCount;
+        FVector BoundsMin;
+        FVector BoundsMax;
+    };
+
+    static_assert(sizeof(FFileHeader) == 64, "FFileHeader must be 64 bytes");
+    static_assert(sizeof(FChunkEntry) == 64, "FChunkEntry must be 64 bytes");
+
+    [[noreturn]] void ThrowInvalidFile(const std::string& Path, const std::string& Reason)
+    {
+        THROW_EXCEPTION(FFileIOException, "Invalid chunked mesh file " + Path + ": " + Reason);
+    }
+
+    /** 按源元素编号收集场的值到新场（保留存储类型） */
+    template<typename T, typename IndexFuncType>
+    void GatherTypedValues(const FField& Source, FField& Target, uint32 Count, IndexFuncType&& SourceIndex)
+    {
+        const TArrayView<const T> Values = Source.GetTypedData<T>();
+        const uint32 Dimension = Source.GetFieldDimension();
+        TArray<T> Gathered;
+        Gathered.Resize(Count * Dimension);
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            std::memcpy(&Gathered[i * Dimension], &Values[static_cast<size_t>(SourceIndex(i)) * Dimension], Dimension * sizeof(T));
+        }
+        Target.SetTypedData(Gathered);
+    }
+
+    template<typename IndexFuncType>
+    TUniquePtr<FField> GatherField(const FField& Source, uint32 Count, IndexFuncType&& SourceIndex)
+    {
+        TUniquePtr<FField> Target = MakeUnique<FField>(Source.GetFieldName(), Source.GetFieldType(), Source.GetAttachment(), Source.GetFieldDimension());
+        switch (Source.GetStorage())
+        {
+            case EFieldStorage::Float32: GatherTypedValues<float>(Source, *Target, Count, SourceIndex); break;
+            case EFieldStorage::Float16: GatherTypedValues<FFloat16>(Source, *Target, Count, SourceIndex); break;
+            case EFieldStorage::Float64: GatherTypedValues<double>(Source, *Target, Count, SourceIndex); break;
+            case EFieldStorage::Int32: GatherTypedValues<int32>(Source, *Target, Count, SourceIndex); break;
+            case EFieldStorage::UInt8: GatherTypedValues<uint8>(Source, *Target, Count, SourceIndex); break;
+        }
+        return Target;
+    }
+
+    /** 收集网格的场（压缩的场先解压到 Decompressed 中） */
+    void CollectFields(const IMesh& Mesh, bool bVertexFields, TArray<const FField*>& OutFields, TArray<TUniquePtr<FField>>& Decompressed)
+    {
+        TArray<std::string> Names;
+        if (bVertexFields)
+        {
+            Mesh.GetVertexFieldNames(Names);
+        }
+        else
+        {
+            Mesh.GetCellFieldNames(Names);
+        }
+        for (const std::string& Name : Names)
+        {
+            const FField* Field = bVertexFields ? Mesh.GetVertexField(Name) : Mesh.GetCellField(Name);
+            OutFields.Add(&FFilterUtils::GetDecompressed(*Field, Decompressed));
+        }
+    }
+}
+
+// ============================================================================
+// FChunkedMeshWriter
+// ============================================================================
+
+void FChunkedMeshWriter::Open(const std::string& InPath, const std::string& MeshName)
+{
+    if (IsOpen())
+    {
+        THROW_EXCEPTION(FInvalidOperationException, "Chunked mesh writer is already open: " + Path);
+    }
+
+    Stream.open(InPath, std::ios::binary | std::ios::trunc);
+    if (!Stream)
+    {
+        THROW_EXCEPTION(FFileIOException, "Failed to create file: " + InPath);
+    }
+    Path = InPath;
+    Name = MeshName;
+    Chunks.Clear();
+    VertexCount = 0;
+    CellCount = 0;
+
+    // 文件头占位，Finish 时回填
+    const FFileHeader Header = {};
+    Stream.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+    Stream.write(Name.data(), static_cast<std::streamsize>(Name.size()));
+    Offset = sizeof(Header) + Name.size();
+    PadToAlignment();
+    CheckStream();
+}
+
+void FChunkedMeshWriter::AddChunk(const IMesh& Chunk, TArrayView<const uint64> GlobalVertexIds)
+{
+    if (!IsOpen())
+    {
+        THROW_EXCEPTION(FInvalidOperationException, "Chunked mesh writer is not open");
+    }
+    if (GlobalVertexIds.Num() != Chunk.GetVertexCount())
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "GlobalVertexIds count does not match the chunk vertex count");
+    }
+
+    FMeshChunkInfo Info;
+    Info.FirstCell = CellCount;
+    Info.CellCount = Chunk.GetCellCount();
+    Info.VertexCount = Chunk.GetVertexCount();
+    FVectorKernels::ComputeBounds(TArrayView<const FVector>(Chunk.GetVerticesPositionsPtr(), Chunk.GetVertexCount()), Info.BoundsMin, Info.BoundsMax);
+
+    Info.MeshOffset = Offset;
+    Info.MeshSize = FNativeMeshFile::Write(Chunk, Stream);
+    Offset += Info.MeshSize;
+
+    Info.GlobalVertexIdsOffset = Offset;
+    const uint64 IdsSize = static_cast<uint64>(GlobalVertexIds.Num()) * sizeof(uint64);
+    Stream.write(reinterpret_cast<const char*>(GlobalVertexIds.GetData()), static_cast<std::streamsize>(IdsSize));
+    Offset += IdsSize;
+    PadToAlignment();
+    CheckStream();
+
+    for (uint32 i = 0; i < GlobalVertexIds.Num(); ++i)
+    {
+        VertexCount = std::max(VertexCount, GlobalVertexIds[i] + 1);
+    }
+    CellCount += Info.CellCount;
+    Chunks.Add(Info);
+}
+
+void FChunkedMeshWriter::Finish()
+{
+    if (!IsOpen())
+    {
+        THROW_EXCEPTION(FInvalidOperationException, "Chunked mesh writer is not open");
+    }
+
+    FFileHeader Header = {};
+    std::memcpy(Header.Magic, FChunkedMeshFile::Magic, sizeof(Header.Magic));
+    Header.Version = FChunkedMeshFile::Version;
+    Header.ChunkCount = Chunks.Num();
+    Header.ChunkTableOffset = Offset;
+    Header.VertexCount = VertexCount;
+    Header.CellCount = CellCount;
+    Header.MeshNameLength = static_cast<uint32>(Name.size());
+
+    for (const FMeshChunkInfo& Info : Chunks)
+    {
+        FChunkEntry Entry = {};
+        Entry.FirstCell = Info.FirstCell;
+        Entry.MeshOffset = Info.MeshOffset;
+        Entry.MeshSize = Info.MeshSize;
+        Entry.GlobalVertexIdsOffset = Info.GlobalVertexIdsOffset;
+        Entry.CellCount = Info.CellCount;
+        Entry.VertexCount = Info.VertexCount;
+        Entry.BoundsMin = Info.BoundsMin;
+        Entry.BoundsMax = Info.BoundsMax;
+        Stream.write(reinterpret_cast<const char*>(&Entry), sizeof(Entry));
+    }
+    Stream.seekp(0);
+    Stream.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+    Stream.flush();
+    CheckStream();
+    Stream.close();
+}
+
+void FChunkedMeshWriter::PadToAlignment()
+{
+    const char Padding[FNativeMeshFile::SectionAlignment] = {};
+    const uint64 Aligned = (Offset + FNativeMeshFile::SectionAlignment - 1) / FNativeMeshFile::SectionAlignment * FNativeMeshFile::SectionAlignment;
+    Stream.write(Padding, static_cast<std::streamsize>(Aligned - Offset));
+    Offset = Aligned;
+}
+
+void FChunkedMeshWriter::CheckStream() const
+{
+    if (!Stream)
+    {
+        THROW_EXCEPTION(FFileIOException, "Failed to write file: " + Path);
+    }
+}
+
+// ============================================================================
+// FChunkedMeshFile
+// ============================================================================
+
+void FChunkedMeshFile::Write(const IMesh& Mesh, const std::string& Path, uint32 CellsPerChunk)
+{
+    if (CellsPerChunk == 0)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "CellsPerChunk must be greater than 0");
+    }
+
+    const FCellArray& Cells = Mesh.GetCells();
+    const FVector* Positions = Mesh.GetVerticesPositionsPtr();
+    const uint32 CellCount = Mesh.GetCellCount();
+
+    TArray<const FField*> VertexFields;
+    TArray<const FField*> CellFields;
+    TArray<TUniquePtr<FField>> Decompressed;
+    CollectFields(Mesh, true, VertexFields, Decompressed);
+    CollectFields(Mesh, false, CellFields, Decompressed);
+
+    // 全局顶点编号到块内编号的映射，每块结束后只重置用到的项
+    TArray<int32> GlobalToLocal;
+    GlobalToLocal.Resize(Mesh.GetVertexCount());
+    std::fill(GlobalToLocal.begin(), GlobalToLocal.end(), -1);
+
+    FChunkedMeshWriter Writer;
+    Writer.Open(Path, Mesh.GetMeshName());
+    for (uint32 FirstCell = 0; FirstCell < CellCount; FirstCell += std::min(CellsPerChunk, CellCount - FirstCell))
+    {
+        const uint32 ChunkCellCount = std::min(CellsPerChunk, CellCount - FirstCell);
+        TArray<uint64> GlobalIds;
+        TArray<FCellArray::VertexIndexType> Indices;
+        TArray<ECellType> Types;
+        TArray<uint32> Offsets;
+        if (!Cells.IsUniform())
+        {
+            Types.Reserve(ChunkCellCount);
+            Offsets.Reserve(ChunkCellCount + 1);
+            Offsets.Add(0);
+        }
+
+        for (uint32 CellIndex = FirstCell; CellIndex < FirstCell + ChunkCellCount; ++CellIndex)
+        {
+            const FCellView Cell = Cells.GetCellViewUnchecked(CellIndex);
+            for (const FCellArray::VertexIndexType GlobalIndex : Cell.GetVertexIndices())
+            {
+                int32& LocalIndex = GlobalToLocal[GlobalIndex];
+                if (LocalIndex < 0)
+                {
+                    LocalIndex = static_cast<int32>(GlobalIds.Num());
+                    GlobalIds.Add(static_cast<uint64>(GlobalIndex));
+                }
+                Indices.Add(LocalIndex);
+            }
+            if (!Cells.IsUniform())
+            {
+                Types.Add(Cell.CellType);
+                Offsets.Add(Indices.Num());
+            }
+        }
+
+        IMesh Chunk(Mesh.GetMeshName());
+        const uint32 ChunkVertexCount = GlobalIds.Num();
+        TArray<FVector> ChunkPositions;
+        ChunkPositions.Resize(ChunkVertexCount);
+        for (uint32 i = 0; i < ChunkVertexCount; ++i)
+        {
+            ChunkPositions[i] = Positions[GlobalIds[i]];
+        }
+        Chunk.AddVerticesPositions(std::move(ChunkPositions));
+
+        if (Cells.IsUniform())
+        {
+            Chunk.GetCells().AppendCells(Cells.GetUniformCellType(), Cells.GetUniformStride(), std::move(Indices));
+        }
+        else
+        {
+            Chunk.GetCells().AppendCells(std::move(Types), std::move(Offsets), std::move(Indices));
+        }
+
+        for (const FField* Field : VertexFields)
+        {
+            Chunk.SetField(GatherField(*Field, ChunkVertexCount, [&](uint32 i) { return GlobalIds[i]; }));
+        }
+        for (const FField* Field : CellFields)
+        {
+            Chunk.SetField(GatherField(*Field, ChunkCellCount, [&](uint32 i) { return FirstCell + i; }));
+        }
+
+        Writer.AddChunk(Chunk, TArrayView<const uint64>(GlobalIds.GetData(), GlobalIds.Num()));
+
+        for (const uint64 GlobalIndex : GlobalIds)
+        {
+            GlobalToLocal[static_cast<uint32>(GlobalIndex)] = -1;
+        }
+    }
+    Writer.Finish();
+}
+
+void FChunkedMeshFile::ReadLayout(const FMappedFile& File, FChunkedMeshLayout& OutLayout)
+{
+    const std::string& Path = File.GetPath();
+    const uint8* Bytes = File.GetData();
+    const uint64 FileSize = File.GetSize();
+
+    if (FileSize < sizeof(FFileHeader))
+    {
+        ThrowInvalidFile(Path, "file is too small");
+    }
+    FFileHeader Header;
+    std::memcpy(&Header, Bytes, sizeof(Header));
+    if (std::memcmp(Header.Magic, Magic, sizeof(Magic)) != 0)
+    {
+        ThrowInvalidFile(Path, "bad magic");
+    }
+    if (Header.Version != Version)
+    {
+        ThrowInvalidFile(Path, "unsupported version " + std::to_string(Header.Version));
+    }
+    if (Header.MeshNameLength > FileSize - sizeof(FFileHeader) ||
+        Header.ChunkTableOffset > FileSize ||
+        static_cast<uint64>(Header.ChunkCount) * sizeof(FChunkEntry) > FileSize - Header.ChunkTableOffset)
+    {
+        ThrowInvalidFile(Path, "header is out of range");
+    }
+
+    OutLayout.MeshName.assign(reinterpret_cast<const char*>(Bytes + sizeof(FFileHeader)), Header.MeshNameLength);
+    OutLayout.VertexCount = Header.VertexCount;
+    OutLayout.CellCount = Header.CellCount;
+    OutLayout.Chunks.Clear();
+    OutLayout.Chunks.Reserve(Header.ChunkCount);
+
+    uint64 NextCell = 0;
+    for (uint32 i = 0; i < Header.ChunkCount; ++i)
+    {
+        FChunkEntry Entry;
+        std::memcpy(&Entry, Bytes + Header.ChunkTableOffset + static_cast<uint64>(i) * sizeof(FChunkEntry), sizeof(Entry));
+        const uint64 IdsSize = static_cast<uint64>(Entry.VertexCount) * sizeof(uint64);
+        if (Entry.MeshOffset > FileSize || Entry.MeshSize > FileSize - Entry.MeshOffset ||
+            Entry.GlobalVertexIdsOffset > FileSize || IdsSize > FileSize - Entry.GlobalVertexIdsOffset)
+        {
+            ThrowInvalidFile(Path, "chunk " + std::to_string(i) + " is out of range");
+        }
+        if (Entry.FirstCell != NextCell)
+        {
+            ThrowInvalidFile(Path, "chunk " + std::to_string(i) + " does not continue the cell numbering");
+        }
+        NextCell += Entry.CellCount;
+
+        FMeshChunkInfo Info;
+        Info.FirstCell = Entry.FirstCell;
+        Info.CellCount = Entry.CellCount;
+        Info.VertexCount = Entry.VertexCount;
+        Info.BoundsMin = Entry.BoundsMin;
+        Info.BoundsMax = Entry.BoundsMax;
+        Info.MeshOffset = Entry.MeshOffset;
+        Info.MeshSize = Entry.MeshSize;
+        Info.GlobalVertexIdsOffset = Entry.GlobalVertexIdsOffset;
+        OutLayout.Chunks.Add(Info);
+    }
+    if (NextCell != Header.CellCount)
+    {
+        ThrowInvalidFile(Path, "chunk cell counts do not match the header");
+    }
+}
+
+void FChunkedMeshFile::ReadChunk(const TSharedPtr<FMappedFile>& File, const FMeshChunkInfo& Chunk, IMesh& OutMesh,
+    TArray<uint64>& OutGlobalVertexIds, const FNativeMeshReadOptions& Options)
+{
+    FNativeMeshFile::Read(File, Chunk.MeshOffset, Chunk.MeshSize, OutMesh, Options);
+    if (OutMesh.GetVertexCount() != Chunk.VertexCount || OutMesh.GetCellCount() != Chunk.CellCount)
+    {
+        ThrowInvalidFile(File->GetPath(), "chunk mesh does not match the chunk table");
+    }
+
+    OutGlobalVertexIds.Resize(Chunk.VertexCount);
+    std::memcpy(OutGlobalVertexIds.GetData(), File->GetData() + Chunk.GlobalVertexIdsOffset, static_cast<size_t>(Chunk.VertexCount) * sizeof(uint64));
+}
@@ -0,0 +1,459 @@
+#include "IO/NativeMeshFile.h"
+#include "../Filters/FilterUtils.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Cell/CellType.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include "HAL/MappedFile.h"
+#include "Memory/UniquePtr.h"
+#include "Threading/ParallelFor.h"
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace
+{
+    /** 并行拷贝顶点坐标时的区间粒度 */
+    constexpr uint32 VertexGrainSize = 65536;
+
+    /** 段类型 */
+    enum class ESectionKind : uint8
+    {
+        Positions = 1,      // 顶点坐标（FVector）
+        UniformCells,       // 均质单元的顶点索引（CellType 与 Dimension 记录单元类型与每个单元的顶点数）
+        CellTypes,          // 混合单元的类型（ECellType）
+        CellOffsets,        // 混合单元的偏移（uint32，单元数 + 1 个）
+        CellIndices,        // 混合单元的顶点索引
+        VertexField,        // 顶点场
+        CellField,          // 单元场
+    };
+
+    /** 文件头 */
+    struct FFileHeader
+    {
+        char Magic[8];
+        uint32 Version;
+        uint32 SectionCount;
+        uint64 SectionTableOffset;
+        uint64 StringTableOffset;
+        uint64 StringTableSize;
+        uint32 VertexCount;
+        uint32 CellCount;
+        uint32 MeshNameLength;
+        uint32 Reserved[3];
+    };
+
+    /** 段表项 */
+    struct FSectionEntry
+    {
+        ESectionKind Kind;
+        EFieldStorage Storage;
+        EFieldType FieldType;
+        ECellType CellType;
+        uint32 Dimension;       // 场的分量数，或均质单元的顶点数
+        uint32 NameOffset;      // 场名称在字符串表中的偏移
+        uint32 NameLength;
+        uint64 Offset;          // 段数据在文件中的偏移
+        uint64 Size;            // 段数据的字节数
+        uint64 Count;           // 元素数量（顶点数、单元数或场元素数）
+        uint8 Reserved[24];
+    };
+
+    static_assert(sizeof(FFileHeader) == 64, "FFileHeader must be 64 bytes");
+    static_assert(sizeof(FSectionEntry) == 64, "FSectionEntry must be 64 bytes");
+    static_assert(sizeof(FVector) == 3 * sizeof(float), "FVector must be tightly packed");
+
+    uint64 AlignUp(uint64 Value)
+    {
+        return (Value + FNativeMeshFile::SectionAlignment - 1) / FNativeMeshFile::SectionAlignment * FNativeMeshFile::SectionAlignment;
+    }
+
+    /** 待写入的段 */
+    struct FPendingSection
+    {
+        FSectionEntry Entry;
+        const void* Data;
+    };
+
+    /** 添加一个段（Offset 在布局阶段填写） */
+    FSectionEntry& AddSection(TArray<FPendingSection>& Sections, ESectionKind Kind, const void* Data, uint64 Size, uint64 Count)
+    {
+        FPendingSection Pending;
+        std::memset(&Pending.Entry, 0, sizeof(FSectionEntry));
+        Pending.Entry.Kind = Kind;
+        Pending.Entry.Size = Size;
+        Pending.Entry.Count = Count;
+        Pending.Data = Data;
+        Sections.Add(Pending);
+        return Sections.Last().Entry;
+    }
+
+    /** 添加场段，压缩的场先解压到 Decompressed 中 */
+    void AddFieldSection(TArray<FPendingSection>& Sections, std::string& StringTable, TArray<TUniquePtr<FField>>& Decompressed,
+        const FField& Field, ESectionKind Kind)
+    {
+        const FField* Source = &FFilterUtils::GetDecompressed(Field, Decompressed);
+
+        FSectionEntry& Entry = AddSection(Sections, Kind, Source->GetRawStorage(), Source->GetRawDataSize(), Source->GetDataCount());
+        Entry.Storage = Source->GetStorage();
+        Entry.FieldType = Source->GetFieldType();
+        Entry.Dimension = Source->GetFieldDimension();
+        Entry.NameOffset = static_cast<uint32>(StringTable.size());
+        Entry.NameLength = static_cast<uint32>(Source->GetFieldName().size());
+        StringTable += Source->GetFieldName();
+    }
+
+    [[noreturn]] void ThrowInvalidFile(const std::string& Path, const std::string& Reason)
+    {
+        THROW_EXCEPTION(FFileIOException, "Invalid native mesh file " + Path + ": " + Reason);
+    }
+
+    /** 检查单元类型有效，固定顶点数的类型顶点数必须一致 */
+    bool IsValidCellShape(ECellType CellType, uint64 VertexCount)
+    {
+        if (CellType == ECellType::None || CellType > ECellType::Polyhedron || VertexCount == 0)
+        {
+            return false;
+        }
+        const uint32 StandardCount = GetCellTypeVertexCount(CellType);
+        return StandardCount == 0 || VertexCount == StandardCount;
+    }
+
+    /** 检查顶点索引都在 [0, VertexCount) 内 */
+    bool AreVertexIndicesInRange(const FCellArray::VertexIndexType* Indices, uint32 Num, uint32 VertexCount, bool bParallel)
+    {
+        std::atomic<bool> bInRange = true;
+        ParallelForRange(Num, 0, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                if (Indices[i] < 0 || static_cast<uint32>(Indices[i]) >= VertexCount)
+                {
+                    bInRange.store(false, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+        return bInRange.load();
+    }
+
+    /** 报告读取进度，回调返回 false 时取消读取 */
+    void ReportProgress(const FNativeMeshReadOptions& Options, const std::string& Path, uint64 ProcessedBytes, uint64 TotalBytes)
+    {
+        if (Options.Progress && !Options.Progress(ProcessedBytes, TotalBytes))
+        {
+            THROW_EXCEPTION(FOperationCanceledException, "Reading canceled: " + Path);
+        }
+    }
+}
+
+// ============================================================================
+// 写入
+// ============================================================================
+
+void FNativeMeshFile::Write(const IMesh& Mesh, const std::string& Path)
+{
+    std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+    if (!File)
+    {
+        THROW_EXCEPTION(FFileIOException, "Failed to create file: " + Path);
+    }
+    Write(Mesh, File);
+    File.flush();
+    if (!File)
+    {
+        THROW_EXCEPTION(FFileIOException, "Failed to write file: " + Path);
+    }
+}
+
+uint64 FNativeMeshFile::Write(const IMesh& Mesh, std::ostream& Stream)
+{
+    const FCellArray& Cells = Mesh.GetCells();
+    const uint32 VertexCount = Mesh.GetVertexCount();
+    const uint32 CellCount = Mesh.GetCellCount();
+
+    TArray<FPendingSection> Sections;
+    TArray<TUniquePtr<FField>> Decompressed;
+    std::string StringTable = Mesh.GetMeshName();
+
+    // 几何与拓扑
+    AddSection(Sections, ESectionKind::Positions, Mesh.GetVerticesPositionsPtr(), static_cast<uint64>(VertexCount) * sizeof(FVector), VertexCount);
+
+    const TArrayView<const FCellArray::VertexIndexType> Indices = Cells.GetVertexIndicesView();
+    const uint64 IndicesSize = static_cast<uint64>(Indices.Num()) * sizeof(FCellArray::VertexIndexType);
+    if (Cells.IsUniform())
+    {
+        FSectionEntry& Entry = AddSection(Sections, ESectionKind::UniformCells, Indices.GetData(), IndicesSize, CellCount);
+        Entry.CellType = CellCount > 0 ? Cells.GetUniformCellType() : ECellType::None;
+        Entry.Dimension = Cells.GetUniformStride();
+    }
+    else
+    {
+        const TArrayView<const ECellType> Types = Cells.GetCellTypesView();
+        const TArrayView<const uint32> Offsets = Cells.GetCellOffsetsView();
+        AddSection(Sections, ESectionKind::CellTypes, Types.GetData(), static_cast<uint64>(Types.Num()) * sizeof(ECellType), CellCount);
+        AddSection(Sections, ESectionKind::CellOffsets, Offsets.GetData(), static_cast<uint64>(Offsets.Num()) * sizeof(uint32), CellCount);
+        AddSection(Sections, ESectionKind::CellIndices, Indices.GetData(), IndicesSize, CellCount);
+    }
+
+    // 场数据
+    TArray<std::string> FieldNames;
+    Mesh.GetVertexFieldNames(FieldNames);
+    for (const std::string& Name : FieldNames)
+    {
+        AddFieldSection(Sections, StringTable, Decompressed, *Mesh.GetVertexField(Name), ESectionKind::VertexField);
+    }
+    FieldNames.Clear();
+    Mesh.GetCellFieldNames(FieldNames);
+    for (const std::string& Name : FieldNames)
+    {
+        AddFieldSection(Sections, StringTable, Decompressed, *Mesh.GetCellField(Name), ESectionKind::CellField);
+    }
+
+    // 布局
+    FFileHeader Header;
+    std::memset(&Header, 0, sizeof(Header));
+    std::memcpy(Header.Magic, Magic, sizeof(Magic));
+    Header.Version = Version;
+    Header.SectionCount = Sections.Num();
+    Header.SectionTableOffset = sizeof(FFileHeader);
+    Header.StringTableOffset = Header.SectionTableOffset + static_cast<uint64>(Sections.Num()) * sizeof(FSectionEntry);
+    Header.StringTableSize = StringTable.size();
+    Header.VertexCount = VertexCount;
+    Header.CellCount = CellCount;
+    Header.MeshNameLength = static_cast<uint32>(Mesh.GetMeshName().size());
+
+    uint64 Offset = AlignUp(Header.StringTableOffset + Header.StringTableSize);
+    for (FPendingSection& Section : Sections)
+    {
+        Section.Entry.Offset = Offset;
+        Offset = AlignUp(Offset + Section.Entry.Size);
+    }
+
+    // 顺序写出
+    const char Padding[SectionAlignment] = {};
+    uint64 Written = 0;
+    auto WriteBytes = [&](const void* Bytes, uint64 Size)
+    {
+        Stream.write(static_cast<const char*>(Bytes), static_cast<std::streamsize>(Size));
+        Written += Size;
+    };
+    auto PadTo = [&](uint64 Target)
+    {
+        WriteBytes(Padding, Target - Written);
+    };
+
+    WriteBytes(&Header, sizeof(Header));
+    for (const FPendingSection& Section : Sections)
+    {
+        WriteBytes(&Section.Entry, sizeof(FSectionEntry));
+    }
+    WriteBytes(StringTable.data(), StringTable.size());
+    for (const FPendingSection& Section : Sections)
+    {
+        PadTo(Section.Entry.Offset);
+        WriteBytes(Section.Data, Section.Entry.Size);
+    }
+    PadTo(Offset);
+    if (!Stream)
+    {
+        THROW_EXCEPTION(FFileIOException, "Failed to write native mesh data");
+    }
+    return Written;
+}
+
+// ============================================================================
+// 读取
+// ============================================================================
+
+void FNativeMeshFile::Read(const std::string& Path, IMesh& OutMesh, const FNativeMeshReadOptions& Options)
+{
+    const TSharedPtr<FMappedFile> File = FMappedFile::Open(Path);
+    Read(File, 0, File->GetSize(), OutMesh, Options);
+}
+
+void FNativeMeshFile::Read(const TSharedPtr<FMappedFile>& File, uint64 Offset, uint64 Size, IMesh& OutMesh, const FNativeMeshReadOptions& Options)
+{
+    const std::string& Path = File->GetPath();
+    if (Offset % SectionAlignment != 0 || Offset > File->GetSize() || Size > File->GetSize() - Offset)
+    {
+        ThrowInvalidFile(Path, "mesh data range is out of the file");
+    }
+    const uint8* Bytes = File->GetData() + Offset;
+    const uint64 FileSize = Size;
+
+    // 文件头与段表
+    if (FileSize < sizeof(FFileHeader))
+    {
+        ThrowInvalidFile(Path, "file is too small");
+    }
+    FFileHeader Header;
+    std::memcpy(&Header, Bytes, sizeof(Header));
+    if (std::memcmp(Header.Magic, Magic, sizeof(Magic)) != 0)
+    {
+        ThrowInvalidFile(Path, "bad magic");
+    }
+    if (Header.Version != Version)
+    {
+        ThrowInvalidFile(Path, "unsupported version " + std::to_string(Header.Version));
+    }
+    if (Header.SectionTableOffset > FileSize ||
+        static_cast<uint64>(Header.SectionCount) * sizeof(FSectionEntry) > FileSize - Header.SectionTableOffset ||
+        Header.StringTableOffset > FileSize || Header.StringTableSize > FileSize - Header.StringTableOffset ||
+        Header.MeshNameLength > Header.StringTableSize)
+    {
+        ThrowInvalidFile(Path, "header is out of range");
+    }
+
+    const char* StringTable = reinterpret_cast<const char*>(Bytes + Header.StringTableOffset);
+    TArray<FSectionEntry> Sections;
+    Sections.Resize(Header.SectionCount);
+    std::memcpy(Sections.GetData(), Bytes + Header.SectionTableOffset, static_cast<size_t>(Header.SectionCount) * sizeof(FSectionEntry));
+    for (const FSectionEntry& Section : Sections)
+    {
+        if (Section.Offset % SectionAlignment != 0 || Section.Offset > FileSize || Section.Size > FileSize - Section.Offset)
+        {
+            ThrowInvalidFile(Path, "section is out of range");
+        }
+        if (static_cast<uint64>(Section.NameOffset) + Section.NameLength > Header.StringTableSize)
+        {
+            ThrowInvalidFile(Path, "section name is out of range");
+        }
+    }
+
+    auto FindSection = [&](ESectionKind Kind) -> const FSectionEntry*
+    {
+        for (const FSectionEntry& Section : Sections)
+        {
+            if (Section.Kind == Kind)
+            {
+                return &Section;
+            }
+        }
+        return nullptr;
+    };
+    auto CheckSize = [&](const FSectionEntry& Section, uint64 ExpectedSize)
+    {
+        if (Section.Size != ExpectedSize)
+        {
+            ThrowInvalidFile(Path, "section size does not match its element count");
+        }
+    };
+
+    OutMesh.Clear();
+    OutMesh.SetMeshName(std::string(StringTable, Header.MeshNameLength));
+
+    // 顶点坐标（大块拷贝）
+    const FSectionEntry* PositionsSection = FindSection(ESectionKind::Positions);
+    if (!PositionsSection || PositionsSection->Count != Header.VertexCount)
+    {
+        ThrowInvalidFile(Path, "missing vertex positions");
+    }
+    CheckSize(*PositionsSection, static_cast<uint64>(Header.VertexCount) * sizeof(FVector));
+    ReportProgress(Options, Path, PositionsSection->Offset, FileSize);
+    {
+        TArray<FVector> Positions;
+        Positions.Resize(Header.VertexCount);
+        const uint8* Source = Bytes + PositionsSection->Offset;
+        ParallelForRange(Header.VertexCount, VertexGrainSize, [&](uint32 Begin, uint32 End)
+        {
+            std::memcpy(Positions.GetData() + Begin, Source + static_cast<size_t>(Begin) * sizeof(FVector), static_cast<size_t>(End - Begin) * sizeof(FVector));
+        }, Options.bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+        OutMesh.AddVerticesPositions(std::move(Positions));
+    }
+
+    // 单元拓扑（大块拷贝）
+    FCellArray& Cells = OutMesh.GetCells();
+    ReportProgress(Options, Path, PositionsSection->Offset + PositionsSection->Size, FileSize);
+    if (const FSectionEntry* Uniform = FindSection(ESectionKind::UniformCells))
+    {
+        if (Uniform->Count != Header.CellCount || Uniform->CellType > ECellType::Polyhedron)
+        {
+            ThrowInvalidFile(Path, "invalid uniform cells");
+        }
+        CheckSize(*Uniform, static_cast<uint64>(Header.CellCount) * Uniform->Dimension * sizeof(FCellArray::VertexIndexType));
+        if (Header.CellCount > 0)
+        {
+            if (!IsValidCellShape(Uniform->CellType, Uniform->Dimension))
+            {
+                ThrowInvalidFile(Path, "invalid uniform cell type or vertex count");
+            }
+            const FCellArray::VertexIndexType* Indices = reinterpret_cast<const FCellArray::VertexIndexType*>(Bytes + Uniform->Offset);
+            const uint64 NumIndices = static_cast<uint64>(Header.CellCount) * Uniform->Dimension;
+            if (NumIndices > std::numeric_limits<uint32>::max() ||
+                !AreVertexIndicesInRange(Indices, static_cast<uint32>(NumIndices), Header.VertexCount, Options.bParallel))
+            {
+                ThrowInvalidFile(Path, "cell vertex index is out of range");
+            }
+            Cells.AppendCells(Uniform->CellType, Uniform->Dimension, Indices, Header.CellCount);
+        }
+    }
+    else
+    {
+        const FSectionEntry* TypesSection = FindSection(ESectionKind::CellTypes);
+        const FSectionEntry* OffsetsSection = FindSection(ESectionKind::CellOffsets);
+        const FSectionEntry* IndicesSection = FindSection(ESectionKind::CellIndices);
+        if (!TypesSection || !OffsetsSection || !IndicesSection)
+        {
+            ThrowInvalidFile(Path, "missing cell sections");
+        }
+        CheckSize(*TypesSection, static_cast<uint64>(Header.CellCount) * sizeof(ECellType));
+        CheckSize(*OffsetsSection, (static_cast<uint64>(Header.CellCount) + 1) * sizeof(uint32));
+
+        const ECellType* Types = reinterpret_cast<const ECellType*>(Bytes + TypesSection->Offset);
+        const uint32* Offsets = reinterpret_cast<const uint32*>(Bytes + OffsetsSection->Offset);
+        const uint64 NumIndices = IndicesSection->Size / sizeof(FCellArray::VertexIndexType);
+        CheckSize(*IndicesSection, NumIndices * sizeof(FCellArray::VertexIndexType));
+        for (uint32 i = 0; i < Header.CellCount; ++i)
+        {
+            if (Offsets[i] >= Offsets[i + 1] || !IsValidCellShape(Types[i], Offsets[i + 1] - Offsets[i]))
+            {
+                ThrowInvalidFile(Path, "invalid mixed cells");
+            }
+        }
+        if (Offsets[Header.CellCount] > NumIndices)
+        {
+            ThrowInvalidFile(Path, "cell offsets are out of range");
+        }
+        const FCellArray::VertexIndexType* Indices = reinterpret_cast<const FCellArray::VertexIndexType*>(Bytes + IndicesSection->Offset);
+        if (!AreVertexIndicesInRange(Indices + Offsets[0], Offsets[Header.CellCount] - Offsets[0], Header.VertexCount, Options.bParallel))
+        {
+            ThrowInvalidFile(Path, "cell vertex index is out of range");
+        }
+        Cells.AppendCells(Types, Offsets, Indices, Header.CellCount);
+    }
+
+    // 场数据（引用映射内存或拷贝）
+    for (const FSectionEntry& Section : Sections)
+    {
+        if (Section.Kind != ESectionKind::VertexField && Section.Kind != ESectionKind::CellField)
+        {
+            continue;
+        }
+        if (Section.Storage > EFieldStorage::UInt8 || Section.FieldType > EFieldType::Tensor || Section.Dimension == 0)
+        {
+            ThrowInvalidFile(Path, "invalid field section");
+        }
+
+        const EFieldAttachment Attachment = Section.Kind == ESectionKind::VertexField ? EFieldAttachment::Vertex : EFieldAttachment::Cell;
+        const uint32 ExpectedCount = Attachment == EFieldAttachment::Vertex ? Header.VertexCount : Header.CellCount;
+        TUniquePtr<FField> Field = MakeUnique<FField>(std::string(StringTable + Section.NameOffset, Section.NameLength),
+            Section.FieldType, Attachment, Section.Dimension);
+        if (Field->GetFieldDimension() != Section.Dimension || Section.Count != ExpectedCount)
+        {
+            ThrowInvalidFile(Path, "field does not match the mesh");
+        }
+        const uint64 NumValues = Section.Count * Section.Dimension;
+        CheckSize(Section, NumValues * GetFieldStorageSize(Section.Storage));
+        ReportProgress(Options, Path, Section.Offset, FileSize);
+
+        Field->SetExternalData(Section.Storage, Bytes + Section.Offset, static_cast<uint32>(NumValues), File);
+        if (!Options.bMapFields)
+        {
+            Field->MakeWritable();
+        }
+        OutMesh.SetField(std::move(Field));
+    }
+}
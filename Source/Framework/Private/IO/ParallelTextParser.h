@@ -0,0 +1,226 @@
+#pragma once
+
+#include "TextScanner.h"
+#include "Container/Array.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <cstring>
+
+/**
+ * FParallelTextParser - 大块 ASCII 数值的并行解析（用于网格读取器，不拥有内存）
+ *
+ * 解析流程（按批次进行，每批覆盖 工作线程数 * ChunkBytes 字节）：
+ * 1. 将本批文本按行边界切分为若干块（块内不会截断数值）
+ * 2. 各块并行解析到独立的缓冲区，遇到以字母开头的非数值记号（下一个关键字）时停止
+ * 3. 按块的数值数量做前缀和，得到每块在输出中的偏移，再并行拷贝到输出
+ * 4. 数量足够或遇到关键字后结束，否则继续下一批
+ *
+ * 数值的文本格式与 FTextScanner::ReadNumber 相同；结束位置为第 Count 个数值之后，
+ * 与逐个调用 ReadNumber 的结果一致。已知数量但不知道文本范围时，多解析的部分不超过一批。
+ */
+struct FParallelTextParser
+{
+    /** 每个块的目标字节数 */
+    static constexpr size_t ChunkBytes = size_t(1) << 20;
+
+    /** 剩余文本少于该字节数时直接串行解析 */
+    static constexpr size_t MinParallelBytes = size_t(4) << 20;
+
+    /**
+     * 解析 Count 个数值
+     * @param Begin 文本起始位置
+     * @param End 文本结束位置（可以远大于实际需要的范围）
+     * @param Out 输出（Count 个）
+     * @param Count 数值数量
+     * @param bParallel 是否并行（文本较短时始终串行）
+     * @return 第 Count 个数值之后的位置，格式错误或数量不足时返回 nullptr
+     */
+    template<typename T>
+    static const char* Parse(const char* Begin, const char* End, T* Out, size_t Count, bool bParallel = true)
+    {
+        if (!bParallel || static_cast<size_t>(End - Begin) < MinParallelBytes || FParallelFor::GetNumWorkers() == 1)
+        {
+            return ParseSerial(Begin, End, Out, Count);
+        }
+
+        const uint32 NumChunks = FParallelFor::GetNumWorkers() * 2;
+        TArray<FChunk<T>> Chunks;
+        Chunks.Resize(NumChunks);
+        TArray<size_t> ChunkOffsets;
+        ChunkOffsets.Resize(NumChunks + 1);
+
+        const char* Position = Begin;
+        size_t Collected = 0;
+        while (Collected < Count)
+        {
+            if (Position >= End)
+            {
+                return nullptr;
+            }
+
+            // 按行边界切分本批文本
+            const char* WaveEnd = FindLineEnd(Position + std::min(static_cast<size_t>(End - Position), ChunkBytes * NumChunks), End);
+            const size_t WaveBytes = static_cast<size_t>(WaveEnd - Position);
+            for (uint32 i = 0; i < NumChunks; ++i)
+            {
+                Chunks[i].Begin = i == 0 ? Position : Chunks[i - 1].End;
+                Chunks[i].End = i + 1 == NumChunks ? WaveEnd : FindLineEnd(Position + WaveBytes * (i + 1) / NumChunks, WaveEnd);
+                Chunks[i].End = std::max(Chunks[i].End, Chunks[i].Begin);
+            }
+
+            ParallelForRange(NumChunks, 1, [&](uint32 BeginChunk, uint32 EndChunk)
+            {
+                for (uint32 i = BeginChunk; i < EndChunk; ++i)
+                {
+                    ParseChunk(Chunks[i]);
+                }
+            });
+
+            // 前缀和：每块在输出中的偏移（截断到 Count，遇到停止的块后结束）
+            uint32 NumUsed = 0;
+            bool bStopped = false;
+            ChunkOffsets[0] = Collected;
+            while (NumUsed < NumChunks && !bStopped && ChunkOffsets[NumUsed] < Count)
+            {
+                const FChunk<T>& Chunk = Chunks[NumUsed];
+                ChunkOffsets[NumUsed + 1] = std::min(Count, ChunkOffsets[NumUsed] + Chunk.Values.Num());
+                bStopped = Chunk.bStopped;
+                ++NumUsed;
+            }
+
+            ParallelForRange(NumUsed, 1, [&](uint32 BeginChunk, uint32 EndChunk)
+            {
+                for (uint32 i = BeginChunk; i < EndChunk; ++i)
+                {
+                    std::memcpy(Out + ChunkOffsets[i], Chunks[i].Values.GetData(), (ChunkOffsets[i + 1] - ChunkOffsets[i]) * sizeof(T));
+                }
+            });
+
+            const size_t PreviousCollected = Collected;
+            Collected = ChunkOffsets[NumUsed];
+            if (Collected >= Count)
+            {
+                // 定位第 Count 个数值之后的位置
+                const FChunk<T>& Last = Chunks[NumUsed - 1];
+                const size_t NumInLast = ChunkOffsets[NumUsed] - ChunkOffsets[NumUsed - 1];
+                if (NumInLast == Last.Values.Num())
+                {
+                    return Last.LastValueEnd;
+                }
+                T Scratch;
+                FTextScanner Scanner(Last.Begin, Last.End);
+                for (size_t i = 0; i < NumInLast; ++i)
+                {
+                    Scanner.ReadNumber(Scratch);
+                }
+                return Scanner.GetCursor();
+            }
+            if (bStopped || (Collected == PreviousCollected && WaveEnd >= End))
+            {
+                return nullptr;
+            }
+            Position = WaveEnd;
+        }
+        return Position;
+    }
+
+    /** 串行解析 Count 个数值 */
+    template<typename T>
+    static const char* ParseSerial(const char* Begin, const char* End, T* Out, size_t Count)
+    {
+        FTextScanner Scanner(Begin, End);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            if (!Scanner.ReadNumber(Out[i]))
+            {
+                return nullptr;
+            }
+        }
+        return Scanner.GetCursor();
+    }
+
+private:
+    /** 解析块 */
+    template<typename T>
+    struct FChunk
+    {
+        const char* Begin = nullptr;
+        const char* End = nullptr;
+
+        /** 解析出的数值 */
+        TArray<T> Values;
+
+        /** 最后一个数值之后的位置 */
+        const char* LastValueEnd = nullptr;
+
+        /** 是否遇到非数值记号（关键字或格式错误） */
+        bool bStopped = false;
+    };
+
+    /** 从 Position 开始的下一个行首（不超过 End） */
+    static const char* FindLineEnd(const char* Position, const char* End)
+    {
+        if (Position >= End)
+        {
+            return End;
+        }
+        const void* NewLine = std::memchr(Position, '\n', static_cast<size_t>(End - Position));
+        return NewLine ? static_cast<const char*>(NewLine) + 1 : End;
+    }
+
+    /** 以字母开头的记号是否为 nan / inf（其他视为关键字） */
+    static bool IsSpecialFloatToken(const char* Token, const char* End)
+    {
+        const size_t Length = static_cast<size_t>(End - Token);
+        auto StartsWith = [&](const char* Word, size_t WordLength)
+        {
+            if (Length < WordLength)
+            {
+                return false;
+            }
+            for (size_t i = 0; i < WordLength; ++i)
+            {
+                if ((Token[i] | 0x20) != Word[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+        return StartsWith("nan", 3) || StartsWith("inf", 3);
+    }
+
+    template<typename T>
+    static void ParseChunk(FChunk<T>& Chunk)
+    {
+        Chunk.Values.Reset();
+        Chunk.Values.Reserve(static_cast<uint32>((Chunk.End - Chunk.Begin) / 4));
+        Chunk.LastValueEnd = Chunk.Begin;
+        Chunk.bStopped = false;
+
+        FTextScanner Scanner(Chunk.Begin, Chunk.End);
+        while (true)
+        {
+            Scanner.SkipWhitespace();
+            if (Scanner.IsAtEnd())
+            {
+                return;
+            }
+            const char First = *Scanner.GetCursor();
+            const bool bLetter = (First | 0x20) >= 'a' && (First | 0x20) <= 'z';
+            if (bLetter && !IsSpecialFloatToken(Scanner.GetCursor(), Chunk.End))
+            {
+                Chunk.bStopped = true;
+                return;
+            }
+            T Value;
+            if (!Scanner.ReadNumber(Value))
+            {
+                Chunk.bStopped = true;
+                return;
+            }
+            Chunk.Values.Add(Value);
+            Chunk.LastValueEnd = Scanner.GetCursor();
+        }
+    }
+};
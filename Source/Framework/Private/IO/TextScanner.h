@@ -0,0 +1,159 @@
+#pragma once
+
+#include "HAL/Platform.h"
+#include <charconv>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * FTextScanner - 文本文件的只读扫描器（用于网格读取器，不拥有内存）
+ *
+ * 在内存映射的文件内容上直接按行、按空白分隔的记号读取，不拷贝字符串
+ * 数值使用 std::from_chars 解析（不依赖区域设置，浮点数为正确舍入）
+ */
+class FTextScanner
+{
+public:
+    FTextScanner(const char* InBegin, const char* InEnd)
+        : Begin(InBegin), Cursor(InBegin), End(InEnd)
+    {
+    }
+
+    /** 是否已读取到末尾 */
+    bool IsAtEnd() const { return Cursor >= End; }
+
+    /** 获取当前位置 */
+    const char* GetCursor() const { return Cursor; }
+
+    /** 获取当前位置相对起始位置的偏移 */
+    size_t GetOffset() const { return static_cast<size_t>(Cursor - Begin); }
+
+    /** 获取剩余字节数 */
+    size_t GetRemaining() const { return Cursor < End ? static_cast<size_t>(End - Cursor) : 0; }
+
+    /** 设置当前位置（不能超出末尾） */
+    void SetCursor(const char* InCursor) { Cursor = InCursor < End ? InCursor : End; }
+
+    static bool IsWhitespace(char C)
+    {
+        return C == ' ' || C == '\n' || C == '\r' || C == '\t' || C == '\f' || C == '\v';
+    }
+
+    /** 跳过空白字符 */
+    void SkipWhitespace()
+    {
+        while (Cursor < End && IsWhitespace(*Cursor))
+        {
+            ++Cursor;
+        }
+    }
+
+    /**
+     * 读取一行（不包含行尾的 \n 与 \r），光标移动到下一行开头
+     */
+    std::string_view ReadLine()
+    {
+        const char* LineBegin = Cursor;
+        while (Cursor < End && *Cursor != '\n')
+        {
+            ++Cursor;
+        }
+        const char* LineEnd = Cursor;
+        if (Cursor < End)
+        {
+            ++Cursor;
+        }
+        if (LineEnd > LineBegin && LineEnd[-1] == '\r')
+        {
+            --LineEnd;
+        }
+        return std::string_view(LineBegin, static_cast<size_t>(LineEnd - LineBegin));
+    }
+
+    /** 读取下一个以空白分隔的记号，到达末尾时返回空 */
+    std::string_view ReadToken()
+    {
+        SkipWhitespace();
+        const char* TokenBegin = Cursor;
+        while (Cursor < End && !IsWhitespace(*Cursor))
+        {
+            ++Cursor;
+        }
+        return std::string_view(TokenBegin, static_cast<size_t>(Cursor - TokenBegin));
+    }
+
+    /**
+     * 读取下一个数值（跳过前导空白，允许正号）
+     * @return 格式错误、超出范围或到达末尾时返回 false
+     */
+    template<typename T>
+    bool ReadNumber(T& OutValue)
+    {
+        SkipWhitespace();
+        if (Cursor < End && *Cursor == '+')
+        {
+            ++Cursor;
+        }
+        const std::from_chars_result Result = std::from_chars(Cursor, End, OutValue);
+        if (Result.ec == std::errc::result_out_of_range && std::is_floating_point_v<T>)
+        {
+            // 上溢和下溢的浮点数转换为无穷大和 0（与 strtod 的行为一致）
+            OutValue = SaturateOutOfRange<T>(Cursor, Result.ptr);
+        }
+        else if (Result.ec != std::errc())
+        {
+            return false;
+        }
+        Cursor = Result.ptr;
+        return true;
+    }
+
+    /** 按空白切分字符串（用于解析关键字行） */
+    static std::string_view NextWord(std::string_view& Text)
+    {
+        size_t Start = 0;
+        while (Start < Text.size() && IsWhitespace(Text[Start]))
+        {
+            ++Start;
+        }
+        size_t Stop = Start;
+        while (Stop < Text.size() && !IsWhitespace(Text[Stop]))
+        {
+            ++Stop;
+        }
+        const std::string_view Word = Text.substr(Start, Stop - Start);
+        Text.remove_prefix(Stop);
+        return Word;
+    }
+
+    /** 解析完整的数值字符串 */
+    template<typename T>
+    static bool ParseNumber(std::string_view Text, T& OutValue)
+    {
+        const std::from_chars_result Result = std::from_chars(Text.data(), Text.data() + Text.size(), OutValue);
+        return Result.ec == std::errc() && Result.ptr == Text.data() + Text.size();
+    }
+
+private:
+    /** 根据超出范围的浮点数文本的符号与指数符号得到饱和值 */
+    template<typename T>
+    static T SaturateOutOfRange(const char* First, const char* Last)
+    {
+        const bool bNegative = *First == '-';
+        bool bNegativeExponent = false;
+        for (const char* It = First; It < Last; ++It)
+        {
+            if ((*It == 'e' || *It == 'E') && It + 1 < Last)
+            {
+                bNegativeExponent = It[1] == '-';
+            }
+        }
+        const T Magnitude = bNegativeExponent ? T(0) : std::numeric_limits<T>::infinity();
+        return bNegative ? -Magnitude : Magnitude;
+    }
+
+    const char* Begin;
+    const char* Cursor;
+    const char* End;
+};
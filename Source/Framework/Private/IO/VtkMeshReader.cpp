@@ -0,0 +1,1246 @@
+#include "IO/VtkMeshReader.h"
+#include "ParallelTextParser.h"
+#include "TextScanner.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include "HAL/MappedFile.h"
+#include "Memory/UniquePtr.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+
+namespace
+{
+    /** 并行解码二进制数组时每个任务处理的值数量 */
+    constexpr size_t DecodeGrainSize = 65536;
+
+    /** VTK 数组的数值类型 */
+    enum class EVtkDataType : uint8
+    {
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Int64,
+        UInt64,
+        Float32,
+        Float64,
+    };
+
+    uint32 GetDataTypeSize(EVtkDataType Type)
+    {
+        switch (Type)
+        {
+            case EVtkDataType::Int8:
+            case EVtkDataType::UInt8: return 1;
+            case EVtkDataType::Int16:
+            case EVtkDataType::UInt16: return 2;
+            case EVtkDataType::Int64:
+            case EVtkDataType::UInt64:
+            case EVtkDataType::Float64: return 8;
+            default: return 4;
+        }
+    }
+
+    /** 解析传统格式的类型名（long 按 64 位处理） */
+    bool ParseLegacyDataType(std::string_view Name, EVtkDataType& OutType)
+    {
+        if (Name == "char") { OutType = EVtkDataType::Int8; }
+        else if (Name == "unsigned_char") { OutType = EVtkDataType::UInt8; }
+        else if (Name == "short") { OutType = EVtkDataType::Int16; }
+        else if (Name == "unsigned_short") { OutType = EVtkDataType::UInt16; }
+        else if (Name == "int") { OutType = EVtkDataType::Int32; }
+        else if (Name == "unsigned_int") { OutType = EVtkDataType::UInt32; }
+        else if (Name == "long" || Name == "vtktypeint64") { OutType = EVtkDataType::Int64; }
+        else if (Name == "unsigned_long" || Name == "vtktypeuint64") { OutType = EVtkDataType::UInt64; }
+        else if (Name == "float") { OutType = EVtkDataType::Float32; }
+        else if (Name == "double") { OutType = EVtkDataType::Float64; }
+        else { return false; }
+        return true;
+    }
+
+    /** 解析 XML 格式的类型名 */
+    bool ParseXmlDataType(std::string_view Name, EVtkDataType& OutType)
+    {
+        if (Name == "Int8") { OutType = EVtkDataType::Int8; }
+        else if (Name == "UInt8") { OutType = EVtkDataType::UInt8; }
+        else if (Name == "Int16") { OutType = EVtkDataType::Int16; }
+        else if (Name == "UInt16") { OutType = EVtkDataType::UInt16; }
+        else if (Name == "Int32") { OutType = EVtkDataType::Int32; }
+        else if (Name == "UInt32") { OutType = EVtkDataType::UInt32; }
+        else if (Name == "Int64") { OutType = EVtkDataType::Int64; }
+        else if (Name == "UInt64") { OutType = EVtkDataType::UInt64; }
+        else if (Name == "Float32") { OutType = EVtkDataType::Float32; }
+        else if (Name == "Float64") { OutType = EVtkDataType::Float64; }
+        else { return false; }
+        return true;
+    }
+
+    /** 保留数值类型时场使用的存储类型 */
+    EFieldStorage ChooseFieldStorage(EVtkDataType Type, bool bPreserve)
+    {
+        if (!bPreserve)
+        {
+            return EFieldStorage::Float32;
+        }
+        switch (Type)
+        {
+            case EVtkDataType::UInt8: return EFieldStorage::UInt8;
+            case EVtkDataType::Int8:
+            case EVtkDataType::Int16:
+            case EVtkDataType::UInt16:
+            case EVtkDataType::Int32: return EFieldStorage::Int32;
+            case EVtkDataType::Float32: return EFieldStorage::Float32;
+            default: return EFieldStorage::Float64;
+        }
+    }
+
+    [[noreturn]] void ThrowInvalidFile(const std::string& Path, const std::string& Reason)
+    {
+        THROW_EXCEPTION(FFileIOException, "Invalid VTK file " + Path + ": " + Reason);
+    }
+
+    /** 报告读取进度，回调返回 false 时取消读取 */
+    void ReportProgress(const FVtkReadOptions& Options, const std::string& Path, uint64 ProcessedBytes, uint64 TotalBytes)
+    {
+        if (Options.Progress && !Options.Progress(ProcessedBytes, TotalBytes))
+        {
+            THROW_EXCEPTION(FOperationCanceledException, "Reading canceled: " + Path);
+        }
+    }
+
+    // ============================================================================
+    // 二进制解码
+    // ============================================================================
+
+    template<typename SourceType>
+    SourceType LoadValue(const uint8* Source, bool bSwap)
+    {
+        uint8 Bytes[sizeof(SourceType)];
+        std::memcpy(Bytes, Source, sizeof(SourceType));
+        if (bSwap)
+        {
+            std::reverse(Bytes, Bytes + sizeof(SourceType));
+        }
+        SourceType Value;
+        std::memcpy(&Value, Bytes, sizeof(SourceType));
+        return Value;
+    }
+
+    template<typename T, typename SourceType>
+    void DecodeTyped(const uint8* Source, bool bSwap, T* Out, size_t Count, bool bParallel)
+    {
+        const size_t NumBlocks = (Count + DecodeGrainSize - 1) / DecodeGrainSize;
+        ParallelForRange(static_cast<uint32>(NumBlocks), 1, [&](uint32 BeginBlock, uint32 EndBlock)
+        {
+            const size_t Begin = BeginBlock * DecodeGrainSize;
+            const size_t End = std::min(Count, EndBlock * DecodeGrainSize);
+            if constexpr (std::is_same_v<T, SourceType>)
+            {
+                if (!bSwap)
+                {
+                    std::memcpy(Out + Begin, Source + Begin * sizeof(SourceType), (End - Begin) * sizeof(T));
+                    return;
+                }
+            }
+            for (size_t i = Begin; i < End; ++i)
+            {
+                Out[i] = static_cast<T>(LoadValue<SourceType>(Source + i * sizeof(SourceType), bSwap));
+            }
+        }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+    }
+
+    /** 将 Count 个 Type 类型的二进制值转换为 T */
+    template<typename T>
+    void DecodeBinary(const uint8* Source, EVtkDataType Type, bool bSwap, T* Out, size_t Count, bool bParallel)
+    {
+        switch (Type)
+        {
+            case EVtkDataType::Int8: DecodeTyped<T, int8>(Source, bSwap, Out, Count, bParallel); break;
+            case EVtkDataType::UInt8: DecodeTyped<T, uint8>(Source, bSwap, Out, Count, bParallel); break;
+            case EVtkDataType::Int16: DecodeTyped<T, int16>(Source, bSwap, Out, Count, bParallel); break;
+            case EVtkDataType::UInt16: DecodeTyped<T, uint16>(Source, bSwap, Out, Count, bParallel); break;
+            case EVtkDataType::Int32: DecodeTyped<T, int32>(Source, bSwap, Out, Count, bParallel); break;
+            case EVtkDataType::UInt32: DecodeTyped<T, uint32>(Source, bSwap, Out, Count, bParallel); break;
+            case EVtkDataType::Int64: DecodeTyped<T, int64>(Source, bSwap, Out, Count, bParallel); break;
+            case EVtkDataType::UInt64: DecodeTyped<T, uint64>(Source, bSwap, Out, Count, bParallel); break;
+            case EVtkDataType::Float32: DecodeTyped<T, float>(Source, bSwap, Out, Count, bParallel); break;
+            case EVtkDataType::Float64: DecodeTyped<T, double>(Source, bSwap, Out, Count, bParallel); break;
+        }
+    }
+
+    /**
+     * 从文本中解析 Count 个值（整数目标类型的文本必须是整数）
+     * 大块文本按行切分后并行解析，成功时光标移动到最后一个值之后
+     */
+    template<typename T>
+    bool ParseAscii(FTextScanner& Scanner, T* Out, size_t Count, bool bParallel)
+    {
+        const char* ValuesEnd = FParallelTextParser::Parse(Scanner.GetCursor(), Scanner.GetCursor() + Scanner.GetRemaining(), Out, Count, bParallel);
+        if (!ValuesEnd)
+        {
+            return false;
+        }
+        Scanner.SetCursor(ValuesEnd);
+        return true;
+    }
+
+    // ============================================================================
+    // 网格组装
+    // ============================================================================
+
+    /** 创建场，分量数 1 / 3 / 9 对应标量、向量、张量 */
+    TUniquePtr<FField> MakeField(const std::string& Name, EFieldAttachment Attachment, uint32 NumComponents)
+    {
+        switch (NumComponents)
+        {
+            case 1: return MakeUnique<FField>(Name, EFieldType::Scalar, Attachment);
+            case 3: return MakeUnique<FField>(Name, EFieldType::Vector, Attachment);
+            case 9: return MakeUnique<FField>(Name, EFieldType::Tensor, Attachment);
+            default: return MakeUnique<FField>(Name, EFieldType::Custom, Attachment, NumComponents);
+        }
+    }
+
+    /**
+     * 按选择的存储类型分配缓冲区，由 Decode(T* Out) 填充后交给场
+     */
+    template<typename DecodeFuncType>
+    void FillField(FField& Field, EVtkDataType Type, size_t NumValues, bool bPreserve, DecodeFuncType&& Decode)
+    {
+        auto FillTyped = [&](auto Tag)
+        {
+            using T = decltype(Tag);
+            TArray<T> Values;
+            Values.Resize(NumValues);
+            Decode(Values.GetData());
+            Field.SetTypedData(Values);
+        };
+
+        const EFieldStorage Storage = ChooseFieldStorage(Type, bPreserve);
+        switch (Storage)
+        {
+            case EFieldStorage::UInt8: FillTyped(uint8()); break;
+            case EFieldStorage::Int32: FillTyped(int32()); break;
+            case EFieldStorage::Float64: FillTyped(double()); break;
+            default:
+            {
+                TArray<float> Values;
+                Values.Resize(NumValues);
+                Decode(Values.GetData());
+                Field.SetFieldData(std::move(Values));
+                break;
+            }
+        }
+    }
+
+    /**
+     * 将 VTK 单元转换为 FCellArray（原地压缩不支持的单元，Pixel / Voxel 重排顶点）
+     * @param VtkTypes VTK 单元类型（CellCount 个）
+     * @param Offsets 单元偏移（CellCount + 1 个，首元素为 0）
+     * @param Indices 连接关系
+     * @param OutCellRemap 存在被跳过的单元时输出旧单元索引到新单元索引的映射，否则为空
+     */
+    void BuildCells(const std::string& Path, IMesh& Mesh, const TArray<uint8>& VtkTypes, TArray<uint32>&& Offsets, TArray<int32>&& Indices,
+        const FVtkReadOptions& Options, TArray<int32>& OutCellRemap)
+    {
+        const uint32 CellCount = VtkTypes.Num();
+        const uint32 VertexCount = Mesh.GetVertexCount();
+        if (Offsets.Num() != CellCount + 1 || Offsets[0] != 0 || Offsets[CellCount] != Indices.Num())
+        {
+            ThrowInvalidFile(Path, "cell offsets do not match the connectivity");
+        }
+
+        TArray<ECellType> Types;
+        Types.Resize(CellCount);
+        uint32 NumKept = 0;
+        uint32 WriteOffset = 0;
+        uint32 Start = 0;
+        for (uint32 Cell = 0; Cell < CellCount; ++Cell)
+        {
+            const uint32 End = Offsets[Cell + 1];
+            if (End < Start || End > Indices.Num())
+            {
+                ThrowInvalidFile(Path, "cell offsets are not increasing");
+            }
+            const uint32 Count = End - Start;
+            const ECellType Type = FVtkMeshReader::ConvertCellType(VtkTypes[Cell]);
+            const uint32 StandardCount = ICellType::GetStandardVertexCount(Type);
+
+            if (Type == ECellType::None)
+            {
+                if (!Options.bSkipUnsupportedCells)
+                {
+                    ThrowInvalidFile(Path, "unsupported VTK cell type " + std::to_string(VtkTypes[Cell]));
+                }
+                if (OutCellRemap.IsEmpty())
+                {
+                    OutCellRemap.Resize(CellCount);
+                    for (uint32 i = 0; i < Cell; ++i)
+                    {
+                        OutCellRemap[i] = static_cast<int32>(i);
+                    }
+                }
+                OutCellRemap[Cell] = -1;
+                Start = End;
+                continue;
+            }
+            if ((StandardCount != 0 && Count != StandardCount) || Count == 0)
+            {
+                ThrowInvalidFile(Path, "cell " + std::to_string(Cell) + " has an unexpected vertex count");
+            }
+
+            // 顶点索引检查与原地压缩（写位置不会超过读位置）
+            int32 Local[8];
+            for (uint32 i = 0; i < Count; ++i)
+            {
+                const int32 Index = Indices[Start + i];
+                if (Index < 0 || static_cast<uint32>(Index) >= VertexCount)
+                {
+                    ThrowInvalidFile(Path, "cell " + std::to_string(Cell) + " references an invalid vertex");
+                }
+                if (Count <= 8)
+                {
+                    Local[i] = Index;
+                }
+            }
+            if (VtkTypes[Cell] == 8)
+            {
+                // VTK_PIXEL 的顶点按坐标轴顺序排列
+                const int32 Order[4] = { Local[0], Local[1], Local[3], Local[2] };
+                std::memcpy(Local, Order, sizeof(Order));
+            }
+            else if (VtkTypes[Cell] == 11)
+            {
+                // VTK_VOXEL
+                const int32 Order[8] = { Local[0], Local[1], Local[3], Local[2], Local[4], Local[5], Local[7], Local[6] };
+                std::memcpy(Local, Order, sizeof(Order));
+            }
+            if (Count <= 8)
+            {
+                std::memcpy(Indices.GetData() + WriteOffset, Local, Count * sizeof(int32));
+            }
+            else if (WriteOffset != Start)
+            {
+                std::memmove(Indices.GetData() + WriteOffset, Indices.GetData() + Start, Count * sizeof(int32));
+            }
+
+            if (!OutCellRemap.IsEmpty())
+            {
+                OutCellRemap[Cell] = static_cast<int32>(NumKept);
+            }
+            Types[NumKept] = Type;
+            WriteOffset += Count;
+            Offsets[++NumKept] = WriteOffset;
+            Start = End;
+        }
+
+        Types.Resize(NumKept);
+        Offsets.Resize(NumKept + 1);
+        Indices.Resize(WriteOffset);
+        Mesh.GetCells().AppendCells(std::move(Types), std::move(Offsets), std::move(Indices));
+    }
+
+    /** 将读取的场加入网格，并按单元映射删除被跳过单元的值 */
+    void AddFields(const std::string& Path, IMesh& Mesh, TArray<TUniquePtr<FField>>& Fields, uint32 FileCellCount, const TArray<int32>& CellRemap)
+    {
+        for (TUniquePtr<FField>& Field : Fields)
+        {
+            const bool bVertex = Field->GetAttachment() == EFieldAttachment::Vertex;
+            if (Field->GetDataCount() != (bVertex ? Mesh.GetVertexCount() : FileCellCount))
+            {
+                ThrowInvalidFile(Path, "field " + Field->GetFieldName() + " does not match the mesh");
+            }
+            if (!bVertex && !CellRemap.IsEmpty())
+            {
+                Field->CompactData(CellRemap);
+            }
+            Mesh.SetField(std::move(Field));
+        }
+        Fields.Clear();
+    }
+
+    std::string GetMeshNameFromPath(const std::string& Path)
+    {
+        return std::filesystem::path(Path).stem().string();
+    }
+
+    /** 判断大小写无关的前缀 */
+    bool StartsWithNoCase(std::string_view Text, std::string_view Prefix)
+    {
+        if (Text.size() < Prefix.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < Prefix.size(); ++i)
+        {
+            if (std::toupper(static_cast<unsigned char>(Text[i])) != Prefix[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::string ToUpper(std::string_view Text)
+    {
+        std::string Result(Text);
+        for (char& C : Result)
+        {
+            C = static_cast<char>(std::toupper(static_cast<unsigned char>(C)));
+        }
+        return Result;
+    }
+
+    // ============================================================================
+    // 传统 VTK 格式
+    // ============================================================================
+
+    class FLegacyReader
+    {
+    public:
+        FLegacyReader(const std::string& InPath, const FMappedFile& File, const FVtkReadOptions& InOptions)
+            : Path(InPath)
+            , Scanner(reinterpret_cast<const char*>(File.GetData()), reinterpret_cast<const char*>(File.GetData()) + File.GetSize())
+            , Options(InOptions)
+        {
+        }
+
+        void Read(IMesh& OutMesh)
+        {
+            // 文件头：版本行、标题行、ASCII / BINARY
+            if (!StartsWithNoCase(Scanner.ReadLine(), "# VTK DATAFILE"))
+            {
+                ThrowInvalidFile(Path, "missing '# vtk DataFile' header");
+            }
+            Scanner.ReadLine();
+            const std::string Format = ToUpper(ReadKeywordLine());
+            if (Format.rfind("BINARY", 0) == 0)
+            {
+                bBinary = true;
+            }
+            else if (Format.rfind("ASCII", 0) != 0)
+            {
+                ThrowInvalidFile(Path, "unknown format " + Format);
+            }
+
+            bool bHasPoints = false;
+            const uint64 TotalBytes = Scanner.GetOffset() + Scanner.GetRemaining();
+            while (true)
+            {
+                ReportProgress(Options, Path, Scanner.GetOffset(), TotalBytes);
+                std::string_view Line = ReadKeywordLine();
+                if (Line.empty())
+                {
+                    break;
+                }
+                const std::string Keyword = ToUpper(FTextScanner::NextWord(Line));
+                if (Keyword == "DATASET")
+                {
+                    if (ToUpper(FTextScanner::NextWord(Line)) != "UNSTRUCTURED_GRID")
+                    {
+                        ThrowInvalidFile(Path, "only UNSTRUCTURED_GRID datasets are supported");
+                    }
+                }
+                else if (Keyword == "POINTS")
+                {
+                    ReadPoints(Line);
+                    bHasPoints = true;
+                }
+                else if (Keyword == "CELLS")
+                {
+                    ReadCells(Line);
+                }
+                else if (Keyword == "CELL_TYPES")
+                {
+                    ReadCellTypes(Line);
+                }
+                else if (Keyword == "POINT_DATA" || Keyword == "CELL_DATA")
+                {
+                    Attachment = Keyword == "POINT_DATA" ? EFieldAttachment::Vertex : EFieldAttachment::Cell;
+                    AttributeCount = ParseCount(FTextScanner::NextWord(Line));
+                    bInAttributes = true;
+                }
+                else if (Keyword == "SCALARS")
+                {
+                    const std::string Name(FTextScanner::NextWord(Line));
+                    const EVtkDataType Type = ParseType(FTextScanner::NextWord(Line));
+                    const std::string_view Components = FTextScanner::NextWord(Line);
+                    SkipLookupTableLine();
+                    ReadAttribute(Name, Type, Components.empty() ? 1 : ParseCount(Components));
+                }
+                else if (Keyword == "VECTORS" || Keyword == "NORMALS")
+                {
+                    const std::string Name(FTextScanner::NextWord(Line));
+                    ReadAttribute(Name, ParseType(FTextScanner::NextWord(Line)), 3);
+                }
+                else if (Keyword == "TENSORS" || Keyword == "TENSORS6")
+                {
+                    const std::string Name(FTextScanner::NextWord(Line));
+                    ReadAttribute(Name, ParseType(FTextScanner::NextWord(Line)), Keyword == "TENSORS" ? 9 : 6);
+                }
+                else if (Keyword == "TEXTURE_COORDINATES")
+                {
+                    const std::string Name(FTextScanner::NextWord(Line));
+                    const uint32 Dimension = ParseCount(FTextScanner::NextWord(Line));
+                    ReadAttribute(Name, ParseType(FTextScanner::NextWord(Line)), Dimension);
+                }
+                else if (Keyword == "FIELD")
+                {
+                    FTextScanner::NextWord(Line);
+                    const uint32 NumArrays = ParseCount(FTextScanner::NextWord(Line));
+                    for (uint32 i = 0; i < NumArrays; ++i)
+                    {
+                        ReadFieldArray();
+                    }
+                }
+                else if (Keyword == "COLOR_SCALARS")
+                {
+                    FTextScanner::NextWord(Line);
+                    const uint32 NumValues = ParseCount(FTextScanner::NextWord(Line));
+                    SkipValues(bBinary ? EVtkDataType::UInt8 : EVtkDataType::Float32, static_cast<size_t>(AttributeCount) * NumValues);
+                }
+                else if (Keyword == "LOOKUP_TABLE")
+                {
+                    FTextScanner::NextWord(Line);
+                    const uint32 NumEntries = ParseCount(FTextScanner::NextWord(Line));
+                    SkipValues(bBinary ? EVtkDataType::UInt8 : EVtkDataType::Float32, static_cast<size_t>(NumEntries) * 4);
+                }
+                else if (Keyword == "METADATA")
+                {
+                    // 元数据块以空行结束
+                    while (!Scanner.IsAtEnd() && !Scanner.ReadLine().empty())
+                    {
+                    }
+                }
+                else
+                {
+                    ThrowInvalidFile(Path, "unsupported keyword " + Keyword);
+                }
+            }
+
+            if (!bHasPoints)
+            {
+                ThrowInvalidFile(Path, "missing POINTS");
+            }
+            if (VtkTypes.Num() + 1 != Offsets.Num() && !(VtkTypes.IsEmpty() && Offsets.IsEmpty()))
+            {
+                ThrowInvalidFile(Path, "CELLS and CELL_TYPES do not match");
+            }
+
+            OutMesh.Clear();
+            OutMesh.SetMeshName(GetMeshNameFromPath(Path));
+            OutMesh.AddVerticesPositions(std::move(Positions));
+            TArray<int32> CellRemap;
+            const uint32 FileCellCount = VtkTypes.Num();
+            if (FileCellCount > 0)
+            {
+                BuildCells(Path, OutMesh, VtkTypes, std::move(Offsets), std::move(Indices), Options, CellRemap);
+            }
+            AddFields(Path, OutMesh, Fields, FileCellCount, CellRemap);
+        }
+
+    private:
+        /** 读取下一个非空的关键字行（到达末尾时返回空） */
+        std::string_view ReadKeywordLine()
+        {
+            while (!Scanner.IsAtEnd())
+            {
+                const std::string_view Line = Scanner.ReadLine();
+                for (char C : Line)
+                {
+                    if (!FTextScanner::IsWhitespace(C))
+                    {
+                        return Line;
+                    }
+                }
+            }
+            return {};
+        }
+
+        uint32 ParseCount(std::string_view Text) const
+        {
+            uint64 Value = 0;
+            if (!FTextScanner::ParseNumber(Text, Value) || Value > 0xFFFFFFFFull)
+            {
+                ThrowInvalidFile(Path, "invalid count '" + std::string(Text) + "'");
+            }
+            return static_cast<uint32>(Value);
+        }
+
+        EVtkDataType ParseType(std::string_view Text) const
+        {
+            EVtkDataType Type;
+            if (!ParseLegacyDataType(Text, Type))
+            {
+                ThrowInvalidFile(Path, "unsupported data type '" + std::string(Text) + "'");
+            }
+            return Type;
+        }
+
+        /** 读取 Count 个 Type 类型的值（二进制为大端序） */
+        template<typename T>
+        void ReadValues(EVtkDataType Type, T* Out, size_t Count)
+        {
+            if (!bBinary)
+            {
+                if (!ParseAscii(Scanner, Out, Count, Options.bParallel))
+                {
+                    ThrowInvalidFile(Path, "invalid or missing numbers after offset " + std::to_string(Scanner.GetOffset()));
+                }
+                return;
+            }
+            const size_t NumBytes = Count * GetDataTypeSize(Type);
+            if (NumBytes > Scanner.GetRemaining())
+            {
+                ThrowInvalidFile(Path, "unexpected end of binary data");
+            }
+            DecodeBinary(reinterpret_cast<const uint8*>(Scanner.GetCursor()), Type, std::endian::native != std::endian::big, Out, Count, Options.bParallel);
+            Scanner.SetCursor(Scanner.GetCursor() + NumBytes);
+        }
+
+        void SkipValues(EVtkDataType Type, size_t Count)
+        {
+            if (bBinary)
+            {
+                const size_t NumBytes = Count * GetDataTypeSize(Type);
+                if (NumBytes > Scanner.GetRemaining())
+                {
+                    ThrowInvalidFile(Path, "unexpected end of binary data");
+                }
+                Scanner.SetCursor(Scanner.GetCursor() + NumBytes);
+                return;
+            }
+            for (size_t i = 0; i < Count; ++i)
+            {
+                if (Scanner.ReadToken().empty())
+                {
+                    ThrowInvalidFile(Path, "unexpected end of file");
+                }
+            }
+        }
+
+        void ReadPoints(std::string_view Line)
+        {
+            const uint32 NumPoints = ParseCount(FTextScanner::NextWord(Line));
+            const EVtkDataType Type = ParseType(FTextScanner::NextWord(Line));
+            Positions.Resize(NumPoints);
+            ReadValues(Type, reinterpret_cast<float*>(Positions.GetData()), static_cast<size_t>(NumPoints) * 3);
+        }
+
+        void ReadCells(std::string_view Line)
+        {
+            const uint32 First = ParseCount(FTextScanner::NextWord(Line));
+            const uint32 Second = ParseCount(FTextScanner::NextWord(Line));
+
+            // 5.1 版：CELLS NumOffsets NumConnectivity，随后是 OFFSETS 与 CONNECTIVITY 两个数组
+            const char* Saved = Scanner.GetCursor();
+            std::string_view Next = ReadKeywordLine();
+            if (StartsWithNoCase(Next, "OFFSETS"))
+            {
+                FTextScanner::NextWord(Next);
+                Offsets.Resize(First);
+                ReadValues(ParseType(FTextScanner::NextWord(Next)), Offsets.GetData(), First);
+                Next = ReadKeywordLine();
+                if (!StartsWithNoCase(Next, "CONNECTIVITY"))
+                {
+                    ThrowInvalidFile(Path, "missing CONNECTIVITY");
+                }
+                FTextScanner::NextWord(Next);
+                Indices.Resize(Second);
+                ReadValues(ParseType(FTextScanner::NextWord(Next)), Indices.GetData(), Second);
+                return;
+            }
+            Scanner.SetCursor(Saved);
+
+            // 旧版：CELLS NumCells Size，每个单元为 "n i0 i1 ... i(n-1)"
+            const uint32 NumCells = First;
+            if (Second < NumCells)
+            {
+                ThrowInvalidFile(Path, "invalid CELLS size");
+            }
+            // 整个单元列表先（并行）解析为一个整数数组，再拆分为偏移与连接关系
+            TArray<int32> CellList;
+            CellList.Resize(Second);
+            ReadValues(EVtkDataType::Int32, CellList.GetData(), Second);
+
+            Offsets.Resize(NumCells + 1);
+            Indices.Resize(Second - NumCells);
+            Offsets[0] = 0;
+            size_t Position = 0;
+            for (uint32 Cell = 0; Cell < NumCells; ++Cell)
+            {
+                const int32 Count = CellList[Position++];
+                if (Count < 0 || Offsets[Cell] + static_cast<uint64>(Count) > Indices.Num())
+                {
+                    ThrowInvalidFile(Path, "CELLS size does not match the cell list");
+                }
+                std::memcpy(Indices.GetData() + Offsets[Cell], CellList.GetData() + Position, Count * sizeof(int32));
+                Offsets[Cell + 1] = Offsets[Cell] + static_cast<uint32>(Count);
+                Position += Count;
+            }
+        }
+
+        void ReadCellTypes(std::string_view Line)
+        {
+            const uint32 NumCells = ParseCount(FTextScanner::NextWord(Line));
+            VtkTypes.Resize(NumCells);
+            ReadValues(EVtkDataType::Int32, VtkTypes.GetData(), NumCells);
+        }
+
+        /** SCALARS 之后可选的 LOOKUP_TABLE 行 */
+        void SkipLookupTableLine()
+        {
+            const char* Saved = Scanner.GetCursor();
+            if (!StartsWithNoCase(ReadKeywordLine(), "LOOKUP_TABLE"))
+            {
+                Scanner.SetCursor(Saved);
+            }
+        }
+
+        /** FIELD 中的一个数组："Name NumComponents NumTuples Type" */
+        void ReadFieldArray()
+        {
+            std::string_view Line = ReadKeywordLine();
+            const std::string Name(FTextScanner::NextWord(Line));
+            const uint32 NumComponents = ParseCount(FTextScanner::NextWord(Line));
+            const uint32 NumTuples = ParseCount(FTextScanner::NextWord(Line));
+            const EVtkDataType Type = ParseType(FTextScanner::NextWord(Line));
+            if (!bInAttributes || NumTuples != AttributeCount)
+            {
+                // 数据集级别的 FIELD（如时间步）不对应顶点或单元
+                SkipValues(Type, static_cast<size_t>(NumComponents) * NumTuples);
+                return;
+            }
+            ReadAttribute(Name, Type, NumComponents);
+        }
+
+        void ReadAttribute(const std::string& Name, EVtkDataType Type, uint32 NumComponents)
+        {
+            if (!bInAttributes || NumComponents == 0)
+            {
+                ThrowInvalidFile(Path, "attribute " + Name + " outside POINT_DATA / CELL_DATA");
+            }
+            const size_t NumValues = static_cast<size_t>(AttributeCount) * NumComponents;
+            const bool bWanted = Attachment == EFieldAttachment::Vertex ? Options.bReadVertexFields : Options.bReadCellFields;
+            if (!bWanted)
+            {
+                SkipValues(Type, NumValues);
+                return;
+            }
+
+            TUniquePtr<FField> Field = MakeField(Name, Attachment, NumComponents);
+            FillField(*Field, Type, NumValues, Options.bPreserveFieldStorage, [&](auto* Out)
+            {
+                ReadValues(Type, Out, NumValues);
+            });
+            Fields.Add(std::move(Field));
+        }
+
+        const std::string& Path;
+        FTextScanner Scanner;
+        const FVtkReadOptions& Options;
+        bool bBinary = false;
+
+        TArray<FVector> Positions;
+        TArray<uint32> Offsets;
+        TArray<int32> Indices;
+        TArray<uint8> VtkTypes;
+        TArray<TUniquePtr<FField>> Fields;
+
+        /** 当前属性段（POINT_DATA / CELL_DATA） */
+        bool bInAttributes = false;
+        EFieldAttachment Attachment = EFieldAttachment::Vertex;
+        uint32 AttributeCount = 0;
+    };
+
+    // ============================================================================
+    // VTK XML 格式（.vtu）
+    // ============================================================================
+
+    /** XML 标签（只解析读取 .vtu 需要的部分） */
+    struct FXmlTag
+    {
+        std::string_view Name;
+        std::string_view Attributes;
+        bool bClosing = false;
+        bool bSelfClosing = false;
+        const char* ContentBegin = nullptr;
+    };
+
+    /** 读取下一个标签，跳过声明与注释；没有更多标签时返回 false */
+    bool ReadXmlTag(const char*& Cursor, const char* End, FXmlTag& OutTag)
+    {
+        while (true)
+        {
+            Cursor = std::find(Cursor, End, '<');
+            if (Cursor == End)
+            {
+                return false;
+            }
+            const std::string_view Rest(Cursor, static_cast<size_t>(End - Cursor));
+            if (Rest.rfind("<!--", 0) == 0)
+            {
+                const size_t Close = Rest.find("-->");
+                Cursor = Close == std::string_view::npos ? End : Cursor + Close + 3;
+                continue;
+            }
+            const char* Close = std::find(Cursor, End, '>');
+            if (Close == End)
+            {
+                return false;
+            }
+            if (Rest[1] == '?' || Rest[1] == '!')
+            {
+                Cursor = Close + 1;
+                continue;
+            }
+
+            std::string_view Body(Cursor + 1, static_cast<size_t>(Close - Cursor - 1));
+            OutTag = FXmlTag();
+            if (!Body.empty() && Body.front() == '/')
+            {
+                OutTag.bClosing = true;
+                Body.remove_prefix(1);
+            }
+            if (!Body.empty() && Body.back() == '/')
+            {
+                OutTag.bSelfClosing = true;
+                Body.remove_suffix(1);
+            }
+            OutTag.Name = FTextScanner::NextWord(Body);
+            OutTag.Attributes = Body;
+            OutTag.ContentBegin = Close + 1;
+            Cursor = Close + 1;
+            return true;
+        }
+    }
+
+    /** 获取属性值（不存在时返回空） */
+    std::string_view GetXmlAttribute(std::string_view Attributes, std::string_view Key)
+    {
+        size_t Position = 0;
+        while ((Position = Attributes.find(Key, Position)) != std::string_view::npos)
+        {
+            const size_t After = Position + Key.size();
+            const bool bBoundary = Position == 0 || FTextScanner::IsWhitespace(Attributes[Position - 1]);
+            size_t Equal = After;
+            while (Equal < Attributes.size() && FTextScanner::IsWhitespace(Attributes[Equal]))
+            {
+                ++Equal;
+            }
+            if (bBoundary && Equal < Attributes.size() && Attributes[Equal] == '=')
+            {
+                const size_t Quote = Attributes.find_first_of("\"'", Equal);
+                if (Quote == std::string_view::npos)
+                {
+                    return {};
+                }
+                const size_t CloseQuote = Attributes.find(Attributes[Quote], Quote + 1);
+                if (CloseQuote == std::string_view::npos)
+                {
+                    return {};
+                }
+                return Attributes.substr(Quote + 1, CloseQuote - Quote - 1);
+            }
+            Position = After;
+        }
+        return {};
+    }
+
+    /** .vtu 中的 DataArray */
+    struct FXmlDataArray
+    {
+        std::string Name;
+        EVtkDataType Type = EVtkDataType::Float32;
+        uint32 NumComponents = 1;
+        bool bAppended = false;
+        uint64 AppendedOffset = 0;
+        const char* AsciiBegin = nullptr;
+        const char* AsciiEnd = nullptr;
+    };
+
+    class FVtuReader
+    {
+    public:
+        FVtuReader(const std::string& InPath, const FMappedFile& File, const FVtkReadOptions& InOptions)
+            : Path(InPath)
+            , Begin(reinterpret_cast<const char*>(File.GetData()))
+            , End(reinterpret_cast<const char*>(File.GetData()) + File.GetSize())
+            , Options(InOptions)
+        {
+        }
+
+        void Read(IMesh& OutMesh)
+        {
+            ParseStructure();
+
+            const FXmlDataArray* PointsArray = FindArray(PointArrays, "");
+            const FXmlDataArray* Connectivity = FindArray(CellArrays, "connectivity");
+            const FXmlDataArray* OffsetsArray = FindArray(CellArrays, "offsets");
+            const FXmlDataArray* TypesArray = FindArray(CellArrays, "types");
+            if (!PointsArray || PointsArray->NumComponents != 3)
+            {
+                ThrowInvalidFile(Path, "missing Points");
+            }
+            if (NumCells > 0 && (!Connectivity || !OffsetsArray || !TypesArray))
+            {
+                ThrowInvalidFile(Path, "missing connectivity, offsets or types");
+            }
+
+            TArray<FVector> Positions;
+            Positions.Resize(NumPoints);
+            ReadArray(*PointsArray, reinterpret_cast<float*>(Positions.GetData()), static_cast<size_t>(NumPoints) * 3);
+
+            OutMesh.Clear();
+            OutMesh.SetMeshName(GetMeshNameFromPath(Path));
+            OutMesh.AddVerticesPositions(std::move(Positions));
+
+            TArray<int32> CellRemap;
+            if (NumCells > 0)
+            {
+                // XML 格式的偏移为每个单元的结束位置
+                TArray<uint32> Offsets;
+                Offsets.Resize(NumCells + 1);
+                Offsets[0] = 0;
+                ReadArray(*OffsetsArray, Offsets.GetData() + 1, NumCells);
+
+                // 分配连接关系之前检查偏移，损坏的偏移不能导致超大分配或越界读取
+                for (uint32 Cell = 0; Cell < NumCells; ++Cell)
+                {
+                    if (Offsets[Cell + 1] < Offsets[Cell])
+                    {
+                        ThrowInvalidFile(Path, "cell offsets are not increasing");
+                    }
+                }
+                if (Offsets[NumCells] != GetValueCount(*Connectivity))
+                {
+                    ThrowInvalidFile(Path, "cell offsets do not match the connectivity");
+                }
+                TArray<int32> Indices;
+                Indices.Resize(Offsets[NumCells]);
+                ReadArray(*Connectivity, Indices.GetData(), Indices.Num());
+                TArray<uint8> VtkTypes;
+                VtkTypes.Resize(NumCells);
+                ReadArray(*TypesArray, VtkTypes.GetData(), NumCells);
+                BuildCells(Path, OutMesh, VtkTypes, std::move(Offsets), std::move(Indices), Options, CellRemap);
+            }
+
+            TArray<TUniquePtr<FField>> Fields;
+            if (Options.bReadVertexFields)
+            {
+                ReadFields(PointDataArrays, EFieldAttachment::Vertex, NumPoints, Fields);
+            }
+            if (Options.bReadCellFields)
+            {
+                ReadFields(CellDataArrays, EFieldAttachment::Cell, NumCells, Fields);
+            }
+            AddFields(Path, OutMesh, Fields, NumCells, CellRemap);
+        }
+
+    private:
+        /** 当前所在的 XML 段 */
+        enum class ESection : uint8
+        {
+            None,
+            Points,
+            Cells,
+            PointData,
+            CellData,
+        };
+
+        void ParseStructure()
+        {
+            const char* Cursor = Begin;
+            ESection Section = ESection::None;
+            uint32 NumPieces = 0;
+            FXmlTag Tag;
+            while (ReadXmlTag(Cursor, End, Tag))
+            {
+                if (Tag.Name == "VTKFile" && !Tag.bClosing)
+                {
+                    if (GetXmlAttribute(Tag.Attributes, "type") != "UnstructuredGrid")
+                    {
+                        ThrowInvalidFile(Path, "only UnstructuredGrid files are supported");
+                    }
+                    if (!GetXmlAttribute(Tag.Attributes, "compressor").empty())
+                    {
+                        ThrowInvalidFile(Path, "compressed data is not supported");
+                    }
+                    bBigEndian = GetXmlAttribute(Tag.Attributes, "byte_order") == "BigEndian";
+                    bHeader64 = GetXmlAttribute(Tag.Attributes, "header_type") == "UInt64";
+                }
+                else if (Tag.Name == "Piece" && !Tag.bClosing)
+                {
+                    if (++NumPieces > 1)
+                    {
+                        ThrowInvalidFile(Path, "multiple pieces are not supported");
+                    }
+                    NumPoints = ParseCount(GetXmlAttribute(Tag.Attributes, "NumberOfPoints"));
+                    NumCells = ParseCount(GetXmlAttribute(Tag.Attributes, "NumberOfCells"));
+                }
+                else if (Tag.Name == "Points" || Tag.Name == "Cells" || Tag.Name == "PointData" || Tag.Name == "CellData")
+                {
+                    Section = Tag.bClosing || Tag.bSelfClosing ? ESection::None
+                        : Tag.Name == "Points" ? ESection::Points
+                        : Tag.Name == "Cells" ? ESection::Cells
+                        : Tag.Name == "PointData" ? ESection::PointData : ESection::CellData;
+                }
+                else if (Tag.Name == "DataArray" && !Tag.bClosing)
+                {
+                    FXmlDataArray Array = ParseDataArray(Tag, Cursor);
+                    switch (Section)
+                    {
+                        case ESection::Points: PointArrays.Add(std::move(Array)); break;
+                        case ESection::Cells: CellArrays.Add(std::move(Array)); break;
+                        case ESection::PointData: PointDataArrays.Add(std::move(Array)); break;
+                        case ESection::CellData: CellDataArrays.Add(std::move(Array)); break;
+                        default: break;
+                    }
+                }
+                else if (Tag.Name == "AppendedData" && !Tag.bClosing)
+                {
+                    if (GetXmlAttribute(Tag.Attributes, "encoding") != "raw")
+                    {
+                        ThrowInvalidFile(Path, "only raw appended data is supported");
+                    }
+                    // 追加数据以 '_' 开始，其后为二进制数据，不再按 XML 扫描
+                    const char* Underscore = std::find(Tag.ContentBegin, End, '_');
+                    if (Underscore == End)
+                    {
+                        ThrowInvalidFile(Path, "missing appended data marker");
+                    }
+                    AppendedBase = Underscore + 1;
+                    break;
+                }
+            }
+            if (NumPieces == 0)
+            {
+                ThrowInvalidFile(Path, "missing Piece");
+            }
+        }
+
+        FXmlDataArray ParseDataArray(const FXmlTag& Tag, const char*& Cursor)
+        {
+            FXmlDataArray Array;
+            Array.Name = std::string(GetXmlAttribute(Tag.Attributes, "Name"));
+            if (!ParseXmlDataType(GetXmlAttribute(Tag.Attributes, "type"), Array.Type))
+            {
+                ThrowInvalidFile(Path, "unsupported data type in DataArray " + Array.Name);
+            }
+            const std::string_view Components = GetXmlAttribute(Tag.Attributes, "NumberOfComponents");
+            Array.NumComponents = Components.empty() ? 1 : ParseCount(Components);
+
+            const std::string_view Format = GetXmlAttribute(Tag.Attributes, "format");
+            if (Format == "appended")
+            {
+                Array.bAppended = true;
+                if (!FTextScanner::ParseNumber(GetXmlAttribute(Tag.Attributes, "offset"), Array.AppendedOffset))
+                {
+                    ThrowInvalidFile(Path, "invalid offset in DataArray " + Array.Name);
+                }
+            }
+            else if (Format == "ascii")
+            {
+                const std::string_view Rest(Tag.ContentBegin, static_cast<size_t>(End - Tag.ContentBegin));
+                const size_t Close = Rest.find("</DataArray");
+                if (Tag.bSelfClosing || Close == std::string_view::npos)
+                {
+                    ThrowInvalidFile(Path, "missing data in DataArray " + Array.Name);
+                }
+                Array.AsciiBegin = Tag.ContentBegin;
+                Array.AsciiEnd = Tag.ContentBegin + Close;
+                Cursor = Array.AsciiEnd;
+            }
+            else
+            {
+                ThrowInvalidFile(Path, "unsupported DataArray format '" + std::string(Format) + "'");
+            }
+            return Array;
+        }
+
+        uint32 ParseCount(std::string_view Text) const
+        {
+            uint32 Value = 0;
+            if (!FTextScanner::ParseNumber(Text, Value))
+            {
+                ThrowInvalidFile(Path, "invalid count '" + std::string(Text) + "'");
+            }
+            return Value;
+        }
+
+        static const FXmlDataArray* FindArray(const TArray<FXmlDataArray>& Arrays, std::string_view Name)
+        {
+            for (const FXmlDataArray& Array : Arrays)
+            {
+                if (Name.empty() || Array.Name == Name)
+                {
+                    return &Array;
+                }
+            }
+            return nullptr;
+        }
+
+        template<typename T>
+        void ReadArray(const FXmlDataArray& Array, T* Out, size_t Count)
+        {
+            const uint64 TotalBytes = static_cast<uint64>(End - Begin);
+            const uint64 DataOffset = !Array.bAppended ? static_cast<uint64>(Array.AsciiBegin - Begin)
+                : AppendedBase ? static_cast<uint64>(AppendedBase - Begin) + Array.AppendedOffset : 0;
+            ReportProgress(Options, Path, std::min(DataOffset, TotalBytes), TotalBytes);
+            if (!Array.bAppended)
+            {
+                FTextScanner Scanner(Array.AsciiBegin, Array.AsciiEnd);
+                if (!ParseAscii(Scanner, Out, Count, Options.bParallel))
+                {
+                    ThrowInvalidFile(Path, "invalid or missing values in DataArray " + Array.Name);
+                }
+                return;
+            }
+
+            if (!AppendedBase)
+            {
+                ThrowInvalidFile(Path, "missing AppendedData");
+            }
+            const bool bSwap = bBigEndian != (std::endian::native == std::endian::big);
+            const size_t HeaderSize = bHeader64 ? 8 : 4;
+            const size_t Available = static_cast<size_t>(End - AppendedBase);
+            if (Array.AppendedOffset > Available || HeaderSize > Available - Array.AppendedOffset)
+            {
+                ThrowInvalidFile(Path, "DataArray " + Array.Name + " is out of range");
+            }
+            const uint8* Block = reinterpret_cast<const uint8*>(AppendedBase + Array.AppendedOffset);
+            const uint64 NumBytes = bHeader64 ? LoadValue<uint64>(Block, bSwap) : LoadValue<uint32>(Block, bSwap);
+            if (NumBytes != Count * GetDataTypeSize(Array.Type) || NumBytes > Available - Array.AppendedOffset - HeaderSize)
+            {
+                ThrowInvalidFile(Path, "DataArray " + Array.Name + " has an unexpected size");
+            }
+            DecodeBinary(Block + HeaderSize, Array.Type, bSwap, Out, Count, Options.bParallel);
+        }
+
+        /**
+         * 获取数据数组中的值数量（二进制数组按块头的字节数计算，文本数组按记号计数）
+         */
+        uint64 GetValueCount(const FXmlDataArray& Array) const
+        {
+            if (!Array.bAppended)
+            {
+                uint64 Count = 0;
+                bool bInToken = false;
+                for (const char* Char = Array.AsciiBegin; Char < Array.AsciiEnd; ++Char)
+                {
+                    const bool bWhitespace = FTextScanner::IsWhitespace(*Char);
+                    Count += !bWhitespace && !bInToken ? 1 : 0;
+                    bInToken = !bWhitespace;
+                }
+                return Count;
+            }
+
+            if (!AppendedBase)
+            {
+                ThrowInvalidFile(Path, "missing AppendedData");
+            }
+            const bool bSwap = bBigEndian != (std::endian::native == std::endian::big);
+            const size_t HeaderSize = bHeader64 ? 8 : 4;
+            const size_t Available = static_cast<size_t>(End - AppendedBase);
+            if (Array.AppendedOffset > Available || HeaderSize > Available - Array.AppendedOffset)
+            {
+                ThrowInvalidFile(Path, "DataArray " + Array.Name + " is out of range");
+            }
+            const uint8* Block = reinterpret_cast<const uint8*>(AppendedBase + Array.AppendedOffset);
+            const uint64 NumBytes = bHeader64 ? LoadValue<uint64>(Block, bSwap) : LoadValue<uint32>(Block, bSwap);
+            return NumBytes / GetDataTypeSize(Array.Type);
+        }
+
+        void ReadFields(const TArray<FXmlDataArray>& Arrays, EFieldAttachment Attachment, uint32 Count, TArray<TUniquePtr<FField>>& OutFields)
+        {
+            for (const FXmlDataArray& Array : Arrays)
+            {
+                const size_t NumValues = static_cast<size_t>(Count) * Array.NumComponents;
+                TUniquePtr<FField> Field = MakeField(Array.Name, Attachment, Array.NumComponents);
+                FillField(*Field, Array.Type, NumValues, Options.bPreserveFieldStorage, [&](auto* Out)
+                {
+                    ReadArray(Array, Out, NumValues);
+                });
+                OutFields.Add(std::move(Field));
+            }
+        }
+
+        const std::string& Path;
+        const char* Begin;
+        const char* End;
+        const FVtkReadOptions& Options;
+
+        bool bBigEndian = false;
+        bool bHeader64 = false;
+        uint32 NumPoints = 0;
+        uint32 NumCells = 0;
+        const char* AppendedBase = nullptr;
+
+        TArray<FXmlDataArray> PointArrays;
+        TArray<FXmlDataArray> CellArrays;
+        TArray<FXmlDataArray> PointDataArrays;
+        TArray<FXmlDataArray> CellDataArrays;
+    };
+}
+
+// ============================================================================
+// 读取入口
+// ============================================================================
+
+void FVtkMeshReader::Read(const std::string& Path, IMesh& OutMesh, const FVtkReadOptions& Options)
+{
+    const TSharedPtr<FMappedFile> File = FMappedFile::Open(Path);
+    FTextScanner Scanner(reinterpret_cast<const char*>(File->GetData()), reinterpret_cast<const char*>(File->GetData()) + File->GetSize());
+    Scanner.SkipWhitespace();
+    const std::string_view Head(Scanner.GetCursor(), std::min<size_t>(Scanner.GetRemaining(), 16));
+    if (Head.rfind("# vtk", 0) == 0 || Head.rfind("# VTK", 0) == 0)
+    {
+        FLegacyReader(Path, *File, Options).Read(OutMesh);
+    }
+    else if (Head.rfind("<", 0) == 0)
+    {
+        FVtuReader(Path, *File, Options).Read(OutMesh);
+    }
+    else
+    {
+        ThrowInvalidFile(Path, "unknown file format");
+    }
+}
+
+void FVtkMeshReader::ReadLegacy(const std::string& Path, IMesh& OutMesh, const FVtkReadOptions& Options)
+{
+    const TSharedPtr<FMappedFile> File = FMappedFile::Open(Path);
+    FLegacyReader(Path, *File, Options).Read(OutMesh);
+}
+
+void FVtkMeshReader::ReadVtu(const std::string& Path, IMesh& OutMesh, const FVtkReadOptions& Options)
+{
+    const TSharedPtr<FMappedFile> File = FMappedFile::Open(Path);
+    FVtuReader(Path, *File, Options).Read(OutMesh);
+}
+
+ECellType FVtkMeshReader::ConvertCellType(uint8 VtkCellType)
+{
+    switch (VtkCellType)
+    {
+        case 3: return ECellType::Line;         // VTK_LINE
+        case 4: return ECellType::PolyLine;     // VTK_POLY_LINE
+        case 5: return ECellType::Triangle;     // VTK_TRIANGLE
+        case 7: return ECellType::Polygon;      // VTK_POLYGON
+        case 8: return ECellType::Quad;         // VTK_PIXEL（读取时重排顶点）
+        case 9: return ECellType::Quad;         // VTK_QUAD
+        case 10: return ECellType::Tetra;       // VTK_TETRA
+        case 11: return ECellType::Hex;         // VTK_VOXEL（读取时重排顶点）
+        case 12: return ECellType::Hex;         // VTK_HEXAHEDRON
+        case 13: return ECellType::Prism;       // VTK_WEDGE
+        case 14: return ECellType::Pyramid;     // VTK_PYRAMID
+        default: return ECellType::None;        // 顶点、三角形条带、多面体与高阶单元
+    }
+}
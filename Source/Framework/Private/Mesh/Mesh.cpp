@@ -1,30 +1,43 @@
 #include "Mesh/Mesh.h"
 #include "Container/CellArray.h"
+#include "Container/CellLinks.h"
 #include "Field/Field.h"
+#include "Exception/Exception.h"
+#include "Math/VectorArraySoA.h"
 
 // ============================================================================
 // 构造函数和析构函数
 // ============================================================================
 
 IMesh::IMesh()
-    : MeshName("UnnamedMesh")
+    : VertexLayout(EVertexLayout::AoS)
+    , bPositionsMirrorValid(false)
+    , CellLinksVersion(0)
+    , MeshName("UnnamedMesh")
     , bIsValid(false)
 {
     Cells = MakeUnique<FCellArray>();
 }
 
 IMesh::IMesh(const std::string& InMeshName)
-    : MeshName(InMeshName)
+    : VertexLayout(EVertexLayout::AoS)
+    , bPositionsMirrorValid(false)
+    , CellLinksVersion(0)
+    , MeshName(InMeshName)
     , bIsValid(false)
 {
     Cells = MakeUnique<FCellArray>();
 }
 
 IMesh::IMesh(const IMesh& Other)
-    : VerticesPositions(Other.VerticesPositions)
+    : VertexLayout(EVertexLayout::AoS)
+    , bPositionsMirrorValid(false)
+    , CellLinksVersion(0)
     , MeshName(Other.MeshName)
     , bIsValid(Other.bIsValid)
 {
+    CopyVerticesPositions(Other);
+    
     // 拷贝单元数组
     if (Other.Cells)
     {
@@ -60,20 +73,28 @@ IMesh::IMesh(const IMesh& Other)
 
 IMesh::IMesh(IMesh&& Other) noexcept
     : VerticesPositions(std::move(Other.VerticesPositions))
+    , VerticesPositionsSoA(std::move(Other.VerticesPositionsSoA))
+    , VertexLayout(Other.VertexLayout)
+    , bPositionsMirrorValid(Other.bPositionsMirrorValid)
     , Cells(std::move(Other.Cells))
+    , CellLinksVersion(0)
     , VertexFields(std::move(Other.VertexFields))
     , CellFields(std::move(Other.CellFields))
     , MeshName(std::move(Other.MeshName))
     , bIsValid(Other.bIsValid)
 {
+    Other.VertexLayout = EVertexLayout::AoS;
+    Other.bPositionsMirrorValid = false;
     Other.bIsValid = false;
 }
 
+IMesh::~IMesh() = default;
+
 IMesh& IMesh::operator=(const IMesh& Other)
 {
     if (this != &Other)
     {
-        VerticesPositions = Other.VerticesPositions;
+        CopyVerticesPositions(Other);
         MeshName = Other.MeshName;
         bIsValid = Other.bIsValid;
         
@@ -87,6 +108,8 @@ IMesh& IMesh::operator=(const IMesh& Other)
             Cells = MakeUnique<FCellArray>();
         }
         
+        InvalidateCellLinks();
+        
         // 清空现有场数据
         VertexFields.Clear();
         CellFields.Clear();
@@ -119,12 +142,18 @@ IMesh& IMesh::operator=(IMesh&& Other) noexcept
     if (this != &Other)
     {
         VerticesPositions = std::move(Other.VerticesPositions);
+        VerticesPositionsSoA = std::move(Other.VerticesPositionsSoA);
+        VertexLayout = Other.VertexLayout;
+        bPositionsMirrorValid = Other.bPositionsMirrorValid;
         Cells = std::move(Other.Cells);
+        InvalidateCellLinks();
         VertexFields = std::move(Other.VertexFields);
         CellFields = std::move(Other.CellFields);
         MeshName = std::move(Other.MeshName);
         bIsValid = Other.bIsValid;
         
+        Other.VertexLayout = EVertexLayout::AoS;
+        Other.bPositionsMirrorValid = false;
         Other.bIsValid = false;
     }
     return *this;
@@ -136,26 +165,26 @@ IMesh& IMesh::operator=(IMesh&& Other) noexcept
 
 uint32 IMesh::GetVertexCount() const
 {
-    return VerticesPositions.Num();
+    return VertexLayout == EVertexLayout::AoS ? VerticesPositions.Num() : VerticesPositionsSoA->Num();
 }
 
 FVector IMesh::GetVertexPosition(uint32 Index) const
 {
     if (IsValidVertexIndex(Index))
     {
-        return VerticesPositions[Index];
+        return VertexLayout == EVertexLayout::AoS ? VerticesPositions[Index] : VerticesPositionsSoA->Get(Index);
     }
     return FVector::ZeroVector();
 }
 
 const FVector* IMesh::GetVerticesPositionsPtr() const
 {
-    return VerticesPositions.GetData();
+    return GetVerticesPositions().GetData();
 }
 
 bool IMesh::IsValidVertexIndex(uint32 Index) const
 {
-    return Index < static_cast<uint32>(VerticesPositions.Num());
+    return Index < GetVertexCount();
 }
 
 // ============================================================================
@@ -164,45 +193,207 @@ bool IMesh::IsValidVertexIndex(uint32 Index) const
 
 void IMesh::AddVertexPosition(const FVector& Vertex)
 {
-    VerticesPositions.Add(Vertex);
+    MarkVerticesPositionsModified();
+    if (VertexLayout == EVertexLayout::AoS)
+    {
+        VerticesPositions.Add(Vertex);
+    }
+    else
+    {
+        VerticesPositionsSoA->Add(Vertex);
+    }
 }
 
 void IMesh::AddVertexPosition(float X, float Y, float Z)
 {
-    VerticesPositions.Emplace(X, Y, Z);
+    AddVertexPosition(FVector(X, Y, Z));
 }
 
 void IMesh::AddVerticesPositions(const TArray<FVector>& InVerticesPositions)
 {
-    VerticesPositions.Append(InVerticesPositions);
+    MarkVerticesPositionsModified();
+    if (VertexLayout == EVertexLayout::AoS)
+    {
+        VerticesPositions.Append(InVerticesPositions);
+    }
+    else
+    {
+        VerticesPositionsSoA->Append(InVerticesPositions.GetData(), InVerticesPositions.Num());
+    }
 }
 
 void IMesh::AddVerticesPositions(TArray<FVector>&& InVerticesPositions)
 {
-    VerticesPositions.Append(std::move(InVerticesPositions));
+    if (VertexLayout == EVertexLayout::AoS)
+    {
+        MarkVerticesPositionsModified();
+        VerticesPositions.Append(std::move(InVerticesPositions));
+    }
+    else
+    {
+        AddVerticesPositions(static_cast<const TArray<FVector>&>(InVerticesPositions));
+    }
 }
 
 void IMesh::SetVertexPosition(uint32 Index, const FVector& Vertex)
 {
     if (IsValidVertexIndex(Index))
     {
-        VerticesPositions[Index] = Vertex;
+        MarkVerticesPositionsModified();
+        if (VertexLayout == EVertexLayout::AoS)
+        {
+            VerticesPositions[Index] = Vertex;
+        }
+        else
+        {
+            VerticesPositionsSoA->Set(Index, Vertex);
+        }
     }
 }
 
 void IMesh::SetVertexPosition(uint32 Index, float X, float Y, float Z)
 {
-    if (IsValidVertexIndex(Index))
-    {
-        VerticesPositions[Index] = {X, Y, Z};
-    }
+    SetVertexPosition(Index, FVector(X, Y, Z));
 }
 
 const TArray<FVector>& IMesh::GetVerticesPositions() const
 {
+    if (VertexLayout == EVertexLayout::SoA)
+    {
+        {
+            std::lock_guard<std::mutex> Lock(PositionsMirrorMutex);
+            if (bPositionsMirrorValid)
+            {
+                return VerticesPositions;
+            }
+        }
+
+        // 在锁外转换：并行转换的等待期间本线程可能执行其他任务，其中的查询会再次获取该锁
+        TArray<FVector> Mirror;
+        VerticesPositionsSoA->CopyTo(Mirror);
+
+        std::lock_guard<std::mutex> Lock(PositionsMirrorMutex);
+        if (!bPositionsMirrorValid)
+        {
+            VerticesPositions = std::move(Mirror);
+            bPositionsMirrorValid = true;
+        }
+    }
     return VerticesPositions;
 }
 
+// ============================================================================
+// 顶点坐标存储布局
+// ============================================================================
+
+EVertexLayout IMesh::GetVertexLayout() const
+{
+    return VertexLayout;
+}
+
+void IMesh::SetVertexLayout(EVertexLayout InLayout)
+{
+    if (InLayout == VertexLayout)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> Lock(PositionsMirrorMutex);
+    if (InLayout == EVertexLayout::SoA)
+    {
+        if (!VerticesPositionsSoA)
+        {
+            VerticesPositionsSoA = MakeUnique<FVectorArraySoA>();
+        }
+        if (!bPositionsMirrorValid)
+        {
+            VerticesPositionsSoA->CopyFrom(VerticesPositions.GetData(), VerticesPositions.Num());
+        }
+        VerticesPositions.Empty();
+        VerticesPositions.Shrink();
+    }
+    else
+    {
+        if (!bPositionsMirrorValid)
+        {
+            VerticesPositionsSoA->CopyTo(VerticesPositions);
+        }
+        VerticesPositionsSoA.Reset();
+    }
+    VertexLayout = InLayout;
+    bPositionsMirrorValid = false;
+}
+
+const FVectorArraySoA& IMesh::GetVerticesPositionsSoA() const
+{
+    if (VertexLayout == EVertexLayout::AoS)
+    {
+        {
+            std::lock_guard<std::mutex> Lock(PositionsMirrorMutex);
+            if (VerticesPositionsSoA && bPositionsMirrorValid)
+            {
+                return *VerticesPositionsSoA;
+            }
+        }
+
+        // 在锁外转换（原因同 GetVerticesPositions），发布时其他线程已生成镜像则保留已有的
+        TUniquePtr<FVectorArraySoA> Mirror = MakeUnique<FVectorArraySoA>();
+        Mirror->CopyFrom(VerticesPositions.GetData(), VerticesPositions.Num());
+
+        std::lock_guard<std::mutex> Lock(PositionsMirrorMutex);
+        if (!VerticesPositionsSoA || !bPositionsMirrorValid)
+        {
+            VerticesPositionsSoA = std::move(Mirror);
+            bPositionsMirrorValid = true;
+        }
+    }
+    return *VerticesPositionsSoA;
+}
+
+FVectorArraySoA& IMesh::EditVerticesPositionsSoA()
+{
+    SetVertexLayout(EVertexLayout::SoA);
+    MarkVerticesPositionsModified();
+    return *VerticesPositionsSoA;
+}
+
+void IMesh::ReleaseVerticesPositionsMirror()
+{
+    std::lock_guard<std::mutex> Lock(PositionsMirrorMutex);
+    if (VertexLayout == EVertexLayout::AoS)
+    {
+        VerticesPositionsSoA.Reset();
+    }
+    else
+    {
+        VerticesPositions.Empty();
+        VerticesPositions.Shrink();
+    }
+    bPositionsMirrorValid = false;
+}
+
+void IMesh::MarkVerticesPositionsModified()
+{
+    bPositionsMirrorValid = false;
+}
+
+void IMesh::CopyVerticesPositions(const IMesh& Other)
+{
+    // 只拷贝主存储，镜像按需重新生成
+    VertexLayout = Other.VertexLayout;
+    bPositionsMirrorValid = false;
+    if (Other.VertexLayout == EVertexLayout::AoS)
+    {
+        VerticesPositions = Other.VerticesPositions;
+        VerticesPositionsSoA.Reset();
+    }
+    else
+    {
+        VerticesPositions.Empty();
+        VerticesPositionsSoA = MakeUnique<FVectorArraySoA>(*Other.VerticesPositionsSoA);
+    }
+}
+
 // ============================================================================
 // 拓扑数据操作（实现IMeshBase接口）
 // ============================================================================
@@ -246,6 +437,64 @@ bool IMesh::IsValidCellIndex(uint32 Index) const
     return false;
 }
 
+// ============================================================================
+// 拓扑邻接查询
+// ============================================================================
+
+const FCellLinks& IMesh::GetCellLinks() const
+{
+    const uint64 CellsVersion = Cells ? Cells->GetVersion() : 0;
+    const uint32 VertexCount = GetVertexCount();
+    {
+        std::lock_guard<std::mutex> Lock(CellLinksMutex);
+        if (CellLinks && CellLinksVersion == CellsVersion && CellLinks->GetVertexCount() == VertexCount)
+        {
+            return *CellLinks;
+        }
+    }
+
+    // 在锁外构建：并行构建的等待期间本线程可能执行其他任务，其中的查询会再次获取该锁
+    TUniquePtr<FCellLinks> NewLinks = MakeUnique<FCellLinks>();
+    if (Cells)
+    {
+        NewLinks->Build(*Cells, VertexCount);
+    }
+
+    // 其他线程已发布同一版本的邻接表时使用已发布的，避免替换其他线程正在读取的邻接表
+    std::lock_guard<std::mutex> Lock(CellLinksMutex);
+    if (!CellLinks || CellLinksVersion != CellsVersion || CellLinks->GetVertexCount() != VertexCount)
+    {
+        CellLinks = std::move(NewLinks);
+        CellLinksVersion = CellsVersion;
+    }
+    return *CellLinks;
+}
+
+TArrayView<const int32> IMesh::GetCellsUsingVertex(uint32 VertexIndex) const
+{
+    return GetCellLinks().GetCells(VertexIndex);
+}
+
+void IMesh::BuildCellLinks(bool bParallel) const
+{
+    TUniquePtr<FCellLinks> NewLinks = MakeUnique<FCellLinks>();
+    if (Cells)
+    {
+        NewLinks->Build(*Cells, GetVertexCount(), bParallel);
+    }
+
+    std::lock_guard<std::mutex> Lock(CellLinksMutex);
+    CellLinks = std::move(NewLinks);
+    CellLinksVersion = Cells ? Cells->GetVersion() : 0;
+}
+
+void IMesh::InvalidateCellLinks()
+{
+    std::lock_guard<std::mutex> Lock(CellLinksMutex);
+    CellLinks.Reset();
+    CellLinksVersion = 0;
+}
+
 // ============================================================================
 // 场数据操作（实现IMeshBase接口）
 // ============================================================================
@@ -445,6 +694,25 @@ bool IMesh::RemoveCellField(const std::string& FieldName)
     return false;
 }
 
+void IMesh::RemapCellFields(const TArray<int32>& CellRemap)
+{
+    // 先检查所有场，数量不一致时不修改任何场
+    for (const auto& Pair : CellFields)
+    {
+        if (Pair.second && Pair.second->GetDataCount() != CellRemap.Num())
+        {
+            THROW_EXCEPTION(FInvalidArgumentException, "Cell field size does not match remap count: " + Pair.first);
+        }
+    }
+    for (auto& Pair : CellFields)
+    {
+        if (Pair.second)
+        {
+            Pair.second->CompactData(CellRemap);
+        }
+    }
+}
+
 void IMesh::GetVertexFieldNames(TArray<std::string>& OutFieldNames) const
 {
     OutFieldNames.Empty();
@@ -515,25 +783,15 @@ bool IMesh::Validate() const
         return false;
     }
     
-    // 检查单元索引是否有效
+    // 检查单元中的顶点索引是否有效（通过单元视图遍历，不分配内存）
     uint32 CellCount = Cells->GetCellCount();
-    for (uint32 i = 0; i < CellCount; ++i)
+    for (const FCellView Cell : *Cells)
     {
-        if (!Cells->IsValidCellIndex(static_cast<FCellArray::CellIndexType>(i)))
+        for (int32 VertexIndex : Cell)
         {
-            return false;
-        }
-        
-        // 检查单元中的顶点索引是否有效
-        FCellInfo CellInfo;
-        if (Cells->GetCell(static_cast<FCellArray::CellIndexType>(i), CellInfo))
-        {
-            for (int32 VertexIndex : CellInfo.VertexIndices)
+            if (VertexIndex < 0 || !IsValidVertexIndex(static_cast<uint32>(VertexIndex)))
             {
-                if (VertexIndex < 0 || !IsValidVertexIndex(static_cast<uint32>(VertexIndex)))
-                {
-                    return false;
-                }
+                return false;
             }
         }
     }
@@ -573,10 +831,16 @@ bool IMesh::Validate() const
 void IMesh::Clear()
 {
     VerticesPositions.Empty();
+    if (VerticesPositionsSoA)
+    {
+        VerticesPositionsSoA->Reset();
+    }
+    MarkVerticesPositionsModified();
     if (Cells)
     {
         Cells->Clear();
     }
+    InvalidateCellLinks();
     VertexFields.Empty();
     CellFields.Empty();
     bIsValid = false;
@@ -598,7 +862,14 @@ void IMesh::Reset()
 
 void IMesh::ReserveVerticesPositions(uint32 Capacity)
 {
-    VerticesPositions.Reserve(Capacity);
+    if (VertexLayout == EVertexLayout::AoS)
+    {
+        VerticesPositions.Reserve(Capacity);
+    }
+    else
+    {
+        VerticesPositionsSoA->Reserve(Capacity);
+    }
 }
 
 void IMesh::ReserveCells(uint32 Capacity)
@@ -613,6 +884,10 @@ void IMesh::ReserveCells(uint32 Capacity)
 void IMesh::Shrink()
 {
     VerticesPositions.Shrink();
+    if (VerticesPositionsSoA)
+    {
+        VerticesPositionsSoA->Shrink();
+    }
     if (Cells)
     {
         Cells->Shrink();
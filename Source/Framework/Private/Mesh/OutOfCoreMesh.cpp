@@ -0,0 +1,264 @@
+#include "Mesh/OutOfCoreMesh.h"
+#include "IO/NativeMeshFile.h"
+#include "Container/CellArray.h"
+#include "Field/Field.h"
+#include "Exception/Exception.h"
+#include "HAL/MappedFile.h"
+#include <algorithm>
+
+FOutOfCoreMesh::FOutOfCoreMesh()
+    : UseClock(0)
+{
+}
+
+FOutOfCoreMesh::~FOutOfCoreMesh() = default;
+
+// ============================================================================
+// 打开和关闭
+// ============================================================================
+
+void FOutOfCoreMesh::Open(const std::string& Path, const FOutOfCoreMeshOptions& InOptions)
+{
+    const TSharedPtr<FMappedFile> NewFile = FMappedFile::Open(Path);
+    FChunkedMeshLayout NewLayout;
+    FChunkedMeshFile::ReadLayout(*NewFile, NewLayout);
+
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    File = NewFile;
+    Layout = std::move(NewLayout);
+    Options = InOptions;
+    Slots.Clear();
+    Slots.Resize(Layout.Chunks.Num());
+    UseClock = 0;
+    Stats = FOutOfCoreCacheStats();
+}
+
+void FOutOfCoreMesh::Close()
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    Slots.Clear();
+    Layout = FChunkedMeshLayout();
+    File.Reset();
+    Stats = FOutOfCoreCacheStats();
+}
+
+bool FOutOfCoreMesh::IsOpen() const
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    return File.Get() != nullptr;
+}
+
+// ============================================================================
+// 网格信息
+// ============================================================================
+
+std::string FOutOfCoreMesh::GetMeshName() const
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    return Layout.MeshName;
+}
+
+uint64 FOutOfCoreMesh::GetVertexCount() const
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    return Layout.VertexCount;
+}
+
+uint64 FOutOfCoreMesh::GetCellCount() const
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    return Layout.CellCount;
+}
+
+uint32 FOutOfCoreMesh::GetChunkCount() const
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    return Layout.Chunks.Num();
+}
+
+FMeshChunkInfo FOutOfCoreMesh::GetChunkInfo(uint32 ChunkIndex) const
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    if (ChunkIndex >= Layout.Chunks.Num())
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Chunk index out of range: " + std::to_string(ChunkIndex));
+    }
+    return Layout.Chunks[ChunkIndex];
+}
+
+bool FOutOfCoreMesh::GetBounds(FVector& OutMin, FVector& OutMax) const
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    bool bHasBounds = false;
+    for (const FMeshChunkInfo& Info : Layout.Chunks)
+    {
+        if (Info.VertexCount == 0)
+        {
+            continue;
+        }
+        if (!bHasBounds)
+        {
+            OutMin = Info.BoundsMin;
+            OutMax = Info.BoundsMax;
+            bHasBounds = true;
+            continue;
+        }
+        OutMin = FVector(std::min(OutMin.X, Info.BoundsMin.X), std::min(OutMin.Y, Info.BoundsMin.Y), std::min(OutMin.Z, Info.BoundsMin.Z));
+        OutMax = FVector(std::max(OutMax.X, Info.BoundsMax.X), std::max(OutMax.Y, Info.BoundsMax.Y), std::max(OutMax.Z, Info.BoundsMax.Z));
+    }
+    return bHasBounds;
+}
+
+uint32 FOutOfCoreMesh::FindChunkByCell(uint64 CellIndex) const
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    if (CellIndex >= Layout.CellCount)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Cell index out of range: " + std::to_string(CellIndex));
+    }
+    // 块按 FirstCell 升序排列，第一个结束位置大于 CellIndex 的块即为所求（跳过空块）
+    const auto It = std::upper_bound(Layout.Chunks.begin(), Layout.Chunks.end(), CellIndex,
+        [](uint64 Value, const FMeshChunkInfo& Info) { return Value < Info.FirstCell + Info.CellCount; });
+    return static_cast<uint32>(It - Layout.Chunks.begin());
+}
+
+// ============================================================================
+// 块访问
+// ============================================================================
+
+TSharedPtr<const FMeshChunk> FOutOfCoreMesh::LoadChunk(uint32 ChunkIndex)
+{
+    TSharedPtr<FMappedFile> ChunkFile;
+    FMeshChunkInfo Info;
+    FNativeMeshReadOptions ReadOptions;
+    {
+        std::lock_guard<std::mutex> Lock(CacheMutex);
+        if (ChunkIndex >= Slots.Num())
+        {
+            THROW_EXCEPTION(FInvalidArgumentException, "Chunk index out of range: " + std::to_string(ChunkIndex));
+        }
+        FCacheSlot& Slot = Slots[ChunkIndex];
+        if (Slot.Chunk.Get())
+        {
+            Slot.LastUse = ++UseClock;
+            ++Stats.Hits;
+            return Slot.Chunk;
+        }
+        ChunkFile = File;
+        Info = Layout.Chunks[ChunkIndex];
+        ReadOptions.bMapFields = Options.bMapFields;
+    }
+
+    // 加载过程不持有锁，其他线程可以同时访问已常驻的块或加载其他块
+    TSharedPtr<FMeshChunk> Chunk = MakeShared<FMeshChunk>();
+    Chunk->ChunkIndex = ChunkIndex;
+    Chunk->FirstCell = Info.FirstCell;
+    FChunkedMeshFile::ReadChunk(ChunkFile, Info, Chunk->Mesh, Chunk->GlobalVertexIds, ReadOptions);
+    Chunk->MemorySize = ComputeChunkMemorySize(*Chunk);
+
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    if (ChunkIndex >= Slots.Num() || File.Get() != ChunkFile.Get())
+    {
+        // 加载期间文件被关闭或重新打开，块不进入缓存
+        return Chunk;
+    }
+    FCacheSlot& Slot = Slots[ChunkIndex];
+    Slot.LastUse = ++UseClock;
+    if (Slot.Chunk.Get())
+    {
+        // 其他线程已经加载了同一个块
+        ++Stats.Hits;
+        return Slot.Chunk;
+    }
+    ++Stats.Misses;
+    ++Stats.ResidentChunks;
+    Stats.ResidentBytes += Chunk->MemorySize;
+    Slot.Chunk = Chunk;
+    EvictToBudget(Options.MemoryBudget);
+    return Chunk;
+}
+
+bool FOutOfCoreMesh::IsChunkResident(uint32 ChunkIndex) const
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    return ChunkIndex < Slots.Num() && Slots[ChunkIndex].Chunk.Get() != nullptr;
+}
+
+// ============================================================================
+// 缓存管理
+// ============================================================================
+
+void FOutOfCoreMesh::SetMemoryBudget(uint64 InMemoryBudget)
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    Options.MemoryBudget = InMemoryBudget;
+    EvictToBudget(Options.MemoryBudget);
+}
+
+uint64 FOutOfCoreMesh::GetMemoryBudget() const
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    return Options.MemoryBudget;
+}
+
+void FOutOfCoreMesh::Trim()
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    EvictToBudget(0);
+}
+
+FOutOfCoreCacheStats FOutOfCoreMesh::GetCacheStats() const
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    return Stats;
+}
+
+void FOutOfCoreMesh::EvictToBudget(uint64 Budget)
+{
+    while (Stats.ResidentBytes > Budget)
+    {
+        // 缓存槽只持有一份引用的块没有被外部钉住，选择其中最久未使用的淘汰
+        FCacheSlot* Oldest = nullptr;
+        for (FCacheSlot& Slot : Slots)
+        {
+            if (Slot.Chunk.Get() && Slot.Chunk.IsUnique() && (!Oldest || Slot.LastUse < Oldest->LastUse))
+            {
+                Oldest = &Slot;
+            }
+        }
+        if (!Oldest)
+        {
+            return;
+        }
+        Stats.ResidentBytes -= Oldest->Chunk->MemorySize;
+        --Stats.ResidentChunks;
+        ++Stats.Evictions;
+        Oldest->Chunk.Reset();
+    }
+}
+
+size_t FOutOfCoreMesh::ComputeChunkMemorySize(const FMeshChunk& Chunk)
+{
+    const IMesh& Mesh = Chunk.Mesh;
+    const FCellArray& Cells = Mesh.GetCells();
+    size_t Size = sizeof(FMeshChunk);
+    Size += static_cast<size_t>(Mesh.GetVertexCount()) * sizeof(FVector);
+    Size += static_cast<size_t>(Chunk.GlobalVertexIds.Num()) * sizeof(uint64);
+    Size += static_cast<size_t>(Cells.GetVertexIndicesView().Num()) * sizeof(FCellArray::VertexIndexType);
+    Size += static_cast<size_t>(Cells.GetCellOffsetsView().Num()) * sizeof(uint32);
+    Size += static_cast<size_t>(Cells.GetCellTypesView().Num()) * sizeof(ECellType);
+
+    TArray<std::string> FieldNames;
+    Mesh.GetVertexFieldNames(FieldNames);
+    for (const std::string& Name : FieldNames)
+    {
+        Size += Mesh.GetVertexField(Name)->GetMemorySize();
+    }
+    FieldNames.Clear();
+    Mesh.GetCellFieldNames(FieldNames);
+    for (const std::string& Name : FieldNames)
+    {
+        Size += Mesh.GetCellField(Name)->GetMemorySize();
+    }
+    return Size;
+}
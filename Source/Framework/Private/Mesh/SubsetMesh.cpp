@@ -0,0 +1,500 @@
+#include "Mesh/SubsetMesh.h"
+#include "../Filters/FilterUtils.h"
+#include "Mesh/Mesh.h"
+#include "Container/CellArray.h"
+#include "Field/Field.h"
+#include "Exception/Exception.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+    /** 收集后的单元数据（按父网格的布局：均匀或混合） */
+    struct FGatheredCells
+    {
+        bool bUniform = false;
+        ECellType UniformType = ECellType::None;
+        uint32 UniformStride = 0;
+        TArray<ECellType> Types;
+        TArray<uint32> Offsets;
+        TArray<int32> Indices;
+
+        /** 追加到单元数组（移动数据） */
+        void AppendTo(FCellArray& OutCells)
+        {
+            if (Indices.IsEmpty() && Types.IsEmpty())
+            {
+                return;
+            }
+            if (bUniform)
+            {
+                OutCells.AppendCells(UniformType, UniformStride, std::move(Indices));
+            }
+            else
+            {
+                OutCells.AppendCells(std::move(Types), std::move(Offsets), std::move(Indices));
+            }
+        }
+    };
+
+    /**
+     * 收集选中单元的类型和顶点索引（顶点索引仍指向父网格顶点）
+     */
+    void GatherCells(const FCellArray& InCells, const TArray<uint32>& Selected, EParallelForFlags Flags, FGatheredCells& Out)
+    {
+        const uint32 CellCount = Selected.Num();
+        if (CellCount == 0)
+        {
+            return;
+        }
+
+        if (InCells.IsUniform())
+        {
+            // 均匀单元：定长拷贝
+            const uint32 Stride = InCells.GetUniformStride();
+            const int32* InIndices = InCells.GetVertexIndicesView().GetData();
+            Out.bUniform = true;
+            Out.UniformType = InCells.GetUniformCellType();
+            Out.UniformStride = Stride;
+            Out.Indices.Resize(CellCount * Stride);
+            ParallelForRange(CellCount, 0, [&](uint32 Begin, uint32 End)
+            {
+                for (uint32 i = Begin; i < End; ++i)
+                {
+                    const int32* Source = InIndices + static_cast<size_t>(Selected[i]) * Stride;
+                    std::copy(Source, Source + Stride, Out.Indices.GetData() + static_cast<size_t>(i) * Stride);
+                }
+            }, Flags);
+            return;
+        }
+
+        // 混合单元：先求偏移，再并行拷贝
+        Out.Types.Resize(CellCount);
+        Out.Offsets.Resize(CellCount + 1);
+        Out.Offsets[0] = 0;
+        for (uint32 i = 0; i < CellCount; ++i)
+        {
+            const FCellView Cell = InCells.GetCellViewUnchecked(Selected[i]);
+            Out.Types[i] = Cell.CellType;
+            Out.Offsets[i + 1] = Out.Offsets[i] + Cell.Num();
+        }
+        Out.Indices.Resize(Out.Offsets[CellCount]);
+        ParallelForRange(CellCount, 0, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                const FCellView Cell = InCells.GetCellViewUnchecked(Selected[i]);
+                std::copy(Cell.begin(), Cell.end(), Out.Indices.GetData() + Out.Offsets[i]);
+            }
+        }, Flags);
+    }
+}
+
+// ============================================================================
+// 构造函数和析构函数
+// ============================================================================
+
+FSubsetMesh::FSubsetMesh()
+    : Parent(nullptr)
+    , MeshName("UnnamedMesh")
+{
+}
+
+FSubsetMesh::FSubsetMesh(const IMesh& InParent, TArray<uint32>&& InSelectedCells, const std::string& InMeshName)
+    : Parent(&InParent)
+    , SelectedCells(std::move(InSelectedCells))
+    , MeshName(InMeshName.empty() ? InParent.GetMeshName() : InMeshName)
+{
+    const uint32 ParentCellCount = InParent.GetCellCount();
+    for (const uint32 CellIndex : SelectedCells)
+    {
+        if (CellIndex >= ParentCellCount)
+        {
+            THROW_EXCEPTION(FInvalidArgumentException, "Selected cell index out of range: " + std::to_string(CellIndex));
+        }
+    }
+}
+
+FSubsetMesh::FSubsetMesh(FSubsetMesh&& Other) noexcept
+    : Parent(Other.Parent)
+    , SelectedCells(std::move(Other.SelectedCells))
+    , MeshName(std::move(Other.MeshName))
+    , CellsCache(std::move(Other.CellsCache))
+    , CellFieldsCache(std::move(Other.CellFieldsCache))
+    , VertexFieldCopies(std::move(Other.VertexFieldCopies))
+{
+    Other.Parent = nullptr;
+}
+
+FSubsetMesh& FSubsetMesh::operator=(FSubsetMesh&& Other) noexcept
+{
+    if (this != &Other)
+    {
+        std::scoped_lock Lock(CacheMutex, Other.CacheMutex);
+        Parent = Other.Parent;
+        SelectedCells = std::move(Other.SelectedCells);
+        MeshName = std::move(Other.MeshName);
+        CellsCache = std::move(Other.CellsCache);
+        CellFieldsCache = std::move(Other.CellFieldsCache);
+        VertexFieldCopies = std::move(Other.VertexFieldCopies);
+        Other.Parent = nullptr;
+    }
+    return *this;
+}
+
+FSubsetMesh::~FSubsetMesh() = default;
+
+// ============================================================================
+// 子集信息
+// ============================================================================
+
+FCellView FSubsetMesh::GetCellView(uint32 Index) const
+{
+    return Parent->GetCells().GetCellViewUnchecked(SelectedCells[Index]);
+}
+
+bool FSubsetMesh::IsCellsMaterialized() const
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    return CellsCache.IsValid();
+}
+
+void FSubsetMesh::ReleaseMaterialized()
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    CellsCache.Reset();
+    CellFieldsCache.Clear();
+    VertexFieldCopies.Clear();
+}
+
+void FSubsetMesh::Materialize(IMesh& OutMesh, bool bCompactVertices, bool bParallel) const
+{
+    if (Parent == &OutMesh)
+    {
+        THROW_EXCEPTION(FInvalidArgumentException, "Output mesh must differ from parent mesh");
+    }
+
+    OutMesh.Clear();
+    OutMesh.SetMeshName(MeshName);
+    if (!Parent)
+    {
+        return;
+    }
+
+    const EParallelForFlags Flags = bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+    const uint32 VertexCount = Parent->GetVertexCount();
+
+    FGatheredCells Gathered;
+    GatherCells(Parent->GetCells(), SelectedCells, Flags, Gathered);
+
+    // ============================================================================
+    // 顶点：压缩时只保留被选中单元使用的顶点（保持原顺序）
+    // ============================================================================
+
+    TArray<std::string> FieldNames;
+    Parent->GetVertexFieldNames(FieldNames);
+    if (bCompactVertices)
+    {
+        // 标记被使用的顶点，压缩得到新编号
+        TArray<int32> VertexRemap;
+        VertexRemap.Resize(VertexCount);
+        std::fill(VertexRemap.begin(), VertexRemap.end(), 0);
+        int32* RemapData = VertexRemap.GetData();
+        ParallelForRange(Gathered.Indices.Num(), 0, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                std::atomic_ref<int32>(RemapData[Gathered.Indices[i]]).store(1, std::memory_order_relaxed);
+            }
+        }, Flags);
+
+        TArray<uint32> KeptVertices;
+        FFilterUtils::CompactVertices(VertexRemap, &KeptVertices, Flags);
+
+        ParallelForRange(Gathered.Indices.Num(), 0, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                Gathered.Indices[i] = VertexRemap[Gathered.Indices[i]];
+            }
+        }, Flags);
+
+        const FVector* InPositions = Parent->GetVerticesPositionsPtr();
+        TArray<FVector> Positions;
+        Positions.Resize(KeptVertices.Num());
+        ParallelForRange(KeptVertices.Num(), 0, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 i = Begin; i < End; ++i)
+            {
+                Positions[i] = InPositions[KeptVertices[i]];
+            }
+        }, Flags);
+        OutMesh.AddVerticesPositions(std::move(Positions));
+
+        for (const std::string& FieldName : FieldNames)
+        {
+            const FField* Field = GetVertexField(FieldName);
+            if (Field && Field->GetDataCount() == VertexCount)
+            {
+                OutMesh.AddField(FFilterUtils::GatherField(*Field, KeptVertices, Flags));
+            }
+        }
+    }
+    else
+    {
+        OutMesh.AddVerticesPositions(Parent->GetVerticesPositions());
+        for (const std::string& FieldName : FieldNames)
+        {
+            const FField* Field = GetVertexField(FieldName);
+            if (Field && Field->GetDataCount() == VertexCount)
+            {
+                OutMesh.AddField(MakeUnique<FField>(*Field));
+            }
+        }
+    }
+
+    Gathered.AppendTo(OutMesh.GetCells());
+
+    // ============================================================================
+    // 单元场：已物化的直接拷贝，否则按选中单元收集
+    // ============================================================================
+
+    Parent->GetCellFieldNames(FieldNames);
+    const uint32 ParentCellCount = Parent->GetCellCount();
+    for (const std::string& FieldName : FieldNames)
+    {
+        TUniquePtr<FField> CachedCopy;
+        {
+            std::lock_guard<std::mutex> Lock(CacheMutex);
+            const TUniquePtr<FField>* Cached = CellFieldsCache.Find(FieldName);
+            if (Cached && Cached->IsValid())
+            {
+                CachedCopy = MakeUnique<FField>(**Cached);
+            }
+        }
+        if (CachedCopy)
+        {
+            OutMesh.AddField(std::move(CachedCopy));
+            continue;
+        }
+
+        // 在锁外收集（原因同 MaterializeCells）
+        const FField* Field = Parent->GetCellField(FieldName);
+        if (Field && Field->GetDataCount() == ParentCellCount)
+        {
+            OutMesh.AddField(FFilterUtils::GatherField(*Field, SelectedCells, Flags));
+        }
+    }
+}
+
+// ============================================================================
+// 几何数据访问
+// ============================================================================
+
+uint32 FSubsetMesh::GetVertexCount() const
+{
+    return Parent ? Parent->GetVertexCount() : 0;
+}
+
+FVector FSubsetMesh::GetVertexPosition(uint32 Index) const
+{
+    return Parent ? Parent->GetVertexPosition(Index) : FVector::ZeroVector();
+}
+
+const FVector* FSubsetMesh::GetVerticesPositionsPtr() const
+{
+    return Parent ? Parent->GetVerticesPositionsPtr() : nullptr;
+}
+
+bool FSubsetMesh::IsValidVertexIndex(uint32 Index) const
+{
+    return Index < GetVertexCount();
+}
+
+// ============================================================================
+// 拓扑数据访问
+// ============================================================================
+
+uint32 FSubsetMesh::GetCellCount() const
+{
+    return SelectedCells.Num();
+}
+
+FCellArray& FSubsetMesh::GetCells()
+{
+    return MaterializeCells();
+}
+
+const FCellArray& FSubsetMesh::GetCells() const
+{
+    return MaterializeCells();
+}
+
+bool FSubsetMesh::IsValidCellIndex(uint32 Index) const
+{
+    return Index < SelectedCells.Num();
+}
+
+FCellArray& FSubsetMesh::MaterializeCells() const
+{
+    {
+        std::lock_guard<std::mutex> Lock(CacheMutex);
+        if (CellsCache)
+        {
+            return *CellsCache;
+        }
+    }
+
+    // 在锁外收集：并行收集的等待期间本线程可能执行其他任务，其中的访问会再次获取该锁
+    TUniquePtr<FCellArray> NewCells = MakeUnique<FCellArray>();
+    if (Parent)
+    {
+        FGatheredCells Gathered;
+        GatherCells(Parent->GetCells(), SelectedCells, EParallelForFlags::None, Gathered);
+        Gathered.AppendTo(*NewCells);
+    }
+
+    // 其他线程已物化时使用已有的单元数组
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    if (!CellsCache)
+    {
+        CellsCache = std::move(NewCells);
+    }
+    return *CellsCache;
+}
+
+// ============================================================================
+// 场数据访问
+// ============================================================================
+
+FField* FSubsetMesh::GetField(const std::string& FieldName)
+{
+    FField* Field = GetVertexField(FieldName);
+    return Field ? Field : GetCellField(FieldName);
+}
+
+const FField* FSubsetMesh::GetField(const std::string& FieldName) const
+{
+    const FField* Field = GetVertexField(FieldName);
+    return Field ? Field : GetCellField(FieldName);
+}
+
+bool FSubsetMesh::HasField(const std::string& FieldName) const
+{
+    return HasVertexField(FieldName) || HasCellField(FieldName);
+}
+
+FField* FSubsetMesh::GetVertexField(const std::string& FieldName)
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    TUniquePtr<FField>* Copy = VertexFieldCopies.Find(FieldName);
+    if (Copy && Copy->IsValid())
+    {
+        return Copy->Get();
+    }
+
+    // 首次非常量访问时拷贝父网格的顶点场，修改不影响父网格
+    const FField* ParentField = Parent ? Parent->GetVertexField(FieldName) : nullptr;
+    if (!ParentField)
+    {
+        return nullptr;
+    }
+    TUniquePtr<FField> NewCopy = MakeUnique<FField>(*ParentField);
+    FField* Result = NewCopy.Get();
+    VertexFieldCopies.Add(FieldName, std::move(NewCopy));
+    return Result;
+}
+
+const FField* FSubsetMesh::GetVertexField(const std::string& FieldName) const
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    const TUniquePtr<FField>* Copy = VertexFieldCopies.Find(FieldName);
+    if (Copy && Copy->IsValid())
+    {
+        return Copy->Get();
+    }
+    return Parent ? Parent->GetVertexField(FieldName) : nullptr;
+}
+
+FField* FSubsetMesh::GetCellField(const std::string& FieldName)
+{
+    return MaterializeCellField(FieldName);
+}
+
+const FField* FSubsetMesh::GetCellField(const std::string& FieldName) const
+{
+    return MaterializeCellField(FieldName);
+}
+
+bool FSubsetMesh::HasVertexField(const std::string& FieldName) const
+{
+    return Parent && Parent->HasVertexField(FieldName);
+}
+
+bool FSubsetMesh::HasCellField(const std::string& FieldName) const
+{
+    const FField* Field = Parent ? Parent->GetCellField(FieldName) : nullptr;
+    return Field && Field->GetDataCount() == Parent->GetCellCount();
+}
+
+FField* FSubsetMesh::MaterializeCellField(const std::string& FieldName) const
+{
+    {
+        std::lock_guard<std::mutex> Lock(CacheMutex);
+        TUniquePtr<FField>* Cached = CellFieldsCache.Find(FieldName);
+        if (Cached && Cached->IsValid())
+        {
+            return Cached->Get();
+        }
+    }
+
+    // 数量与父网格单元数不一致的场无法按单元收集
+    const FField* ParentField = Parent ? Parent->GetCellField(FieldName) : nullptr;
+    if (!ParentField || ParentField->GetDataCount() != Parent->GetCellCount())
+    {
+        return nullptr;
+    }
+
+    // 在锁外收集（原因同 MaterializeCells），其他线程已物化时使用已有的场
+    TUniquePtr<FField> NewField = FFilterUtils::GatherField(*ParentField, SelectedCells, EParallelForFlags::None);
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    TUniquePtr<FField>* Cached = CellFieldsCache.Find(FieldName);
+    if (Cached && Cached->IsValid())
+    {
+        return Cached->Get();
+    }
+    FField* Result = NewField.Get();
+    CellFieldsCache.Add(FieldName, std::move(NewField));
+    return Result;
+}
+
+// ============================================================================
+// 元数据、验证、清空
+// ============================================================================
+
+bool FSubsetMesh::Validate() const
+{
+    if (!Parent || !Parent->Validate())
+    {
+        return false;
+    }
+    const uint32 ParentCellCount = Parent->GetCellCount();
+    return std::all_of(SelectedCells.begin(), SelectedCells.end(), [ParentCellCount](uint32 CellIndex) { return CellIndex < ParentCellCount; });
+}
+
+void FSubsetMesh::Clear()
+{
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+    SelectedCells.Reset();
+    CellsCache.Reset();
+    CellFieldsCache.Clear();
+    VertexFieldCopies.Clear();
+}
+
+void FSubsetMesh::Reset()
+{
+    Clear();
+    Parent = nullptr;
+    MeshName = "UnnamedMesh";
+}
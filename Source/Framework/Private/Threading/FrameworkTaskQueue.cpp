@@ -0,0 +1,64 @@
+#include "Threading/FrameworkTaskQueue.h"
+#include <chrono>
+
+FFrameworkTaskQueue& FFrameworkTaskQueue::Get()
+{
+    static FFrameworkTaskQueue Instance;
+    return Instance;
+}
+
+void FFrameworkTaskQueue::EnqueueTask(std::function<void()> Task)
+{
+    std::lock_guard<std::mutex> Lock(QueueMutex);
+    TaskQueue.push_back(std::move(Task));
+}
+
+uint32 FFrameworkTaskQueue::ProcessTasks(double TimeBudgetSeconds)
+{
+    std::deque<std::function<void()>> TasksToProcess;
+
+    // 快速交换，减少锁持有时间（任务执行期间投递的新任务留到下一次处理）
+    {
+        std::lock_guard<std::mutex> Lock(QueueMutex);
+        TasksToProcess.swap(TaskQueue);
+    }
+
+    const auto StartTime = std::chrono::steady_clock::now();
+    uint32 NumProcessed = 0;
+    while (!TasksToProcess.empty())
+    {
+        std::function<void()> Task = std::move(TasksToProcess.front());
+        TasksToProcess.pop_front();
+        if (Task)
+        {
+            Task();
+        }
+        ++NumProcessed;
+
+        const std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - StartTime;
+        if (TimeBudgetSeconds > 0.0 && Elapsed.count() >= TimeBudgetSeconds)
+        {
+            break;
+        }
+    }
+
+    // 超出预算未执行的任务放回队列头部，保持提交顺序
+    if (!TasksToProcess.empty())
+    {
+        std::lock_guard<std::mutex> Lock(QueueMutex);
+        TaskQueue.insert(TaskQueue.begin(), std::make_move_iterator(TasksToProcess.begin()), std::make_move_iterator(TasksToProcess.end()));
+    }
+    return NumProcessed;
+}
+
+uint32 FFrameworkTaskQueue::GetPendingTaskCount() const
+{
+    std::lock_guard<std::mutex> Lock(QueueMutex);
+    return static_cast<uint32>(TaskQueue.size());
+}
+
+void FFrameworkTaskQueue::Flush()
+{
+    std::lock_guard<std::mutex> Lock(QueueMutex);
+    TaskQueue.clear();
+}
@@ -1,8 +1,15 @@
 #include "../../Public/Threading/FrameworkThread.h"
+#include "Threading/FrameworkTaskQueue.h"
 #include <iostream>
 #include <thread>
 #include <chrono>
 
+namespace
+{
+    /** 每帧处理 Framework 任务队列的时间预算（秒），约为 60 FPS 帧时间的一半 */
+    constexpr double TaskQueueTimeBudget = 0.008;
+}
+
 IFrameworkThread::IFrameworkThread()
     : IThread("FrameworkThread")
     , FrameCount(0)
@@ -56,6 +63,9 @@ void IFrameworkThread::Run()
 
 void IFrameworkThread::Tick(float DeltaTime)
 {
+    // 执行其他线程投递的任务（异步加载完成通知等）
+    FFrameworkTaskQueue::Get().ProcessTasks(TaskQueueTimeBudget);
+
     // TODO: 在这里实现Framework的具体逻辑
     // 例如：游戏逻辑更新、物理模拟、AI计算等
     
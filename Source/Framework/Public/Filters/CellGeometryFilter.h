@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include "Cell/CellGeometry.h"
+#include "HAL/Platform.h"
+
+class IMesh;
+class FField;
+
+/**
+ * FCellGeometryFilter - 网格单元几何量计算过滤器
+ * 
+ * 使用 FCellGeometry 计算网格所有单元的面积 / 体积 / 中心 / 法线，
+ * 结果作为单元场添加到网格中（同名场会被替换）
+ * 
+ * 使用示例：
+ *   FField* Volumes = FCellGeometryFilter::Execute(Mesh, ECellGeometryQuantity::Volume);
+ */
+struct FCellGeometryFilter
+{
+    /**
+     * 计算单元几何量并写入网格单元场
+     * @param Mesh 网格
+     * @param Quantity 几何量类型
+     * @param FieldName 场名称（为空时使用 EnumToString(Quantity)）
+     * @param bParallel 是否并行计算
+     * @return 网格中的结果场
+     */
+    static FField* Execute(IMesh& Mesh, ECellGeometryQuantity Quantity, const std::string& FieldName = "", bool bParallel = true);
+
+    /**
+     * 计算单元几何量到外部场（不修改网格）
+     * @param Mesh 网格
+     * @param Quantity 几何量类型
+     * @param OutField 输出单元场
+     * @param bParallel 是否并行计算
+     */
+    static void Execute(const IMesh& Mesh, ECellGeometryQuantity Quantity, FField& OutField, bool bParallel = true);
+};
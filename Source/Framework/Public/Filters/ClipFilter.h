@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "Math/Math.h"
+#include "HAL/Platform.h"
+#include <string>
+
+class IMesh;
+
+/**
+ * 裁剪函数类型
+ */
+enum class EClipFunction : uint8
+{
+    /** 平面：保留法线指向的一侧 */
+    Plane,
+
+    /** 轴对齐包围盒：保留盒内 */
+    Box,
+
+    /** 顶点标量场：保留标量 >= 阈值的部分 */
+    Scalar,
+};
+
+/**
+ * FClipFunction - 裁剪函数
+ *
+ * 每个顶点得到一个裁剪值，裁剪值 >= 0 的一侧被保留，边上的裁剪点按裁剪值线性插值：
+ * - Plane：Normal · (P - Origin)（Normal 归一化后计算，值为到平面的有符号距离）
+ * - Box：P 到盒子六个面的有向距离的最小值（盒内为正）；单元跨越盒子的棱或角时，裁剪面在该单元内是近似的
+ * - Scalar：标量 - Threshold
+ *
+ * 使用示例：
+ *   FClipFunction Function = FClipFunction::MakePlane(FVector(0, 0, 0), FVector(1, 0, 0));
+ *   FClipFunction Function = FClipFunction::MakeBox(FVector(0, 0, 0), FVector(1, 1, 1));
+ *   FClipFunction Function = FClipFunction::MakeScalar("Temperature", 350.0f);
+ */
+struct FClipFunction
+{
+    /** 裁剪函数类型 */
+    EClipFunction Type = EClipFunction::Plane;
+
+    /** 平面上的一点（Plane） */
+    FVector Origin;
+
+    /** 平面法线（Plane，不需要单位长度） */
+    FVector Normal = FVector(0.0f, 0.0f, 1.0f);
+
+    /** 盒子的最小角点（Box） */
+    FVector BoxMin;
+
+    /** 盒子的最大角点（Box） */
+    FVector BoxMax;
+
+    /** 顶点标量场名称（Scalar） */
+    std::string FieldName;
+
+    /** 阈值（Scalar） */
+    float Threshold = 0.0f;
+
+    /** 创建平面裁剪函数 */
+    static FClipFunction MakePlane(const FVector& InOrigin, const FVector& InNormal);
+
+    /** 创建包围盒裁剪函数 */
+    static FClipFunction MakeBox(const FVector& InMin, const FVector& InMax);
+
+    /** 创建标量阈值裁剪函数 */
+    static FClipFunction MakeScalar(const std::string& InFieldName, float InThreshold);
+};
+
+/**
+ * 裁剪选项
+ */
+struct FClipOptions
+{
+    /** 是否反转保留的一侧（保留裁剪值 <= 0 的部分） */
+    bool bInvert = false;
+
+    /**
+     * 是否只输出被使用的输入顶点
+     * 为 false 时输出网格包含全部输入顶点（顺序不变，裁剪点追加在后面），
+     * 完整保留的单元直接拷贝输入单元数组中的顶点索引，不做重映射
+     */
+    bool bCompactVertices = true;
+
+    /** 是否传递顶点场（输出为 Float32 存储，裁剪点上线性插值） */
+    bool bPassVertexFields = true;
+
+    /** 是否拷贝单元场（每个输出单元取其父单元的值） */
+    bool bPassCellFields = true;
+
+    /** 是否并行执行 */
+    bool bParallel = true;
+};
+
+/**
+ * FClipFilter - 裁剪过滤器
+ *
+ * 按裁剪函数切掉网格的一部分，保留的部分与输入单元的维度相同：
+ * 1. 所有顶点都在保留侧的单元整体保留（单元类型和顶点顺序不变）；所有顶点都在另一侧的单元被丢弃
+ * 2. 跨越裁剪面的 Tetra / Pyramid / Prism / Hex 单元按等值面过滤器相同的方式分解为四面体，
+ *    每个四面体保留侧的部分输出为一个 Tetra、Pyramid 或 Prism（楔形）单元，输出单元的顶点顺序符合单元定义
+ * 3. 跨越裁剪面的 Triangle / Quad / Polygon 单元裁剪为一个多边形（按角点数输出为 Triangle、Quad 或 Polygon，顶点顺序不变），
+ *    Line / PolyLine 单元保留侧的每一段输出为一个 Line 或 PolyLine
+ * 4. 跨越裁剪面的多面体单元（没有面信息，无法分解）整体保留；裁剪值为 NaN 的单元被丢弃
+ * 5. 输出单元的顺序：先是完整保留的单元（按输入顺序），再是分解产生的单元（按父单元顺序）
+ * 6. 裁剪点按边去重，相邻单元共享；裁剪面上的顶点与其边上的裁剪点合并，体积（面积、长度）为 0 的部分不输出；
+ *    顶点场插值，单元场取父单元的值
+ *
+ * 注意：完整保留的 Hex 与相邻被分解的单元在共享面上不共形（四边形对三角形），与常见的裁剪实现一致
+ *
+ * 使用示例：
+ *   IMesh Cutaway;
+ *   FClipFilter::Execute(Mesh, FClipFunction::MakePlane(Center, FVector(1, 0, 0)), Cutaway);
+ */
+struct FClipFilter
+{
+    /**
+     * 裁剪网格
+     * @param Input 输入网格
+     * @param Function 裁剪函数（参数无效、场不存在或不是顶点标量场时抛出 FInvalidArgumentException）
+     * @param Output 输出网格（原有数据会被清空，不能与输入网格相同）
+     * @param Options 裁剪选项
+     * @param OutParentCells 可选，输出每个输出单元对应的输入单元索引
+     */
+    static void Execute(const IMesh& Input, const FClipFunction& Function, IMesh& Output,
+        const FClipOptions& Options = FClipOptions(), TArray<int32>* OutParentCells = nullptr);
+};
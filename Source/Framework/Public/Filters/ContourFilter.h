@@ -0,0 +1,148 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "HAL/Platform.h"
+#include <string>
+
+class IMesh;
+class FField;
+class FScalarSpanIndex;
+
+/**
+ * FScalarChunkRanges - 按单元分块的标量范围
+ *
+ * 将单元按编号顺序每 CellsPerChunk 个分为一块，记录块内单元所有顶点的标量最小值和最大值。
+ * 等值面过滤器据此整块跳过不与等值面相交的单元；拖动等值时复用同一份范围，每次只需处理相交的块。
+ *
+ * 范围与构建时的单元数组版本和场版本绑定，网格拓扑或场数据修改后 IsBuiltFor 返回 false
+ */
+class FScalarChunkRanges
+{
+public:
+    /** 默认每块的单元数 */
+    static constexpr uint32 DefaultCellsPerChunk = 16384;
+
+    /**
+     * 计算每块的标量范围
+     * @param Mesh 网格
+     * @param Field 顶点标量场（数据数量必须等于网格顶点数，否则抛出 FInvalidArgumentException）
+     * @param InCellsPerChunk 每块的单元数（大于 0）
+     * @param bParallel 是否并行计算
+     */
+    void Build(const IMesh& Mesh, const FField& Field, uint32 InCellsPerChunk = DefaultCellsPerChunk, bool bParallel = true);
+
+    /** 清空 */
+    void Clear();
+
+    /** 是否为指定网格和场的当前内容构建 */
+    [[nodiscard]] bool IsBuiltFor(const IMesh& Mesh, const FField& Field) const;
+
+    /** 获取每块的单元数 */
+    [[nodiscard]] uint32 GetCellsPerChunk() const { return CellsPerChunk; }
+
+    /** 获取块数 */
+    [[nodiscard]] uint32 GetChunkCount() const { return Ranges.Num() / 2; }
+
+    /** 获取块的标量最小值 */
+    [[nodiscard]] float GetChunkMin(uint32 ChunkIndex) const { return Ranges[ChunkIndex * 2]; }
+
+    /** 获取块的标量最大值 */
+    [[nodiscard]] float GetChunkMax(uint32 ChunkIndex) const { return Ranges[ChunkIndex * 2 + 1]; }
+
+    /**
+     * 块内是否可能有单元与等值面相交（Min < IsoValue <= Max，与等值面过滤器的顶点分类一致）
+     */
+    [[nodiscard]] bool MayIntersect(uint32 ChunkIndex, float IsoValue) const
+    {
+        return GetChunkMin(ChunkIndex) < IsoValue && IsoValue <= GetChunkMax(ChunkIndex);
+    }
+
+private:
+    /** [Min0, Max0, Min1, Max1, ...] */
+    TArray<float> Ranges;
+
+    /** 每块的单元数 */
+    uint32 CellsPerChunk = DefaultCellsPerChunk;
+
+    /** 构建时的单元数组版本 */
+    uint64 CellsVersion = 0;
+
+    /** 构建时的单元数 */
+    uint32 CellCount = 0;
+
+    /** 构建时的场版本 */
+    uint64 FieldVersion = 0;
+
+    /** 构建时使用的场 */
+    const FField* SourceField = nullptr;
+};
+
+/**
+ * 等值面提取选项
+ */
+struct FContourOptions
+{
+    /** 是否插值顶点场（输出为 Float32 存储，标量场本身也会输出，值等于等值） */
+    bool bPassVertexFields = true;
+
+    /** 是否拷贝单元场（每个三角形取其父单元的值） */
+    bool bPassCellFields = true;
+
+    /** 是否并行执行 */
+    bool bParallel = true;
+
+    /**
+     * 可选，预先计算的分块标量范围
+     * 为空或与输入不匹配（IsBuiltFor 返回 false）时，过滤器在本次执行中临时计算
+     */
+    const FScalarChunkRanges* ChunkRanges = nullptr;
+
+    /**
+     * 可选，单元标量区间索引（优先于 ChunkRanges）
+     * 过滤器先调用 Update（首次使用或网格、场修改后重建），再只处理索引返回的候选单元；
+     * 适合反复以不同等值提取同一个场的等值面
+     */
+    FScalarSpanIndex* SpanIndex = nullptr;
+};
+
+/**
+ * FContourFilter - 等值面提取过滤器（Marching Tetrahedra）
+ *
+ * 从三维单元网格中提取顶点标量场的等值面，输出三角形网格：
+ * 1. 顶点按 标量 >= 等值 分为上、下两类，所有顶点同类的单元没有等值面
+ * 2. Tetra 直接使用四面体的 16 种情况；Hex / Prism / Pyramid 按固定方式分解为四面体
+ *    （6 / 3 / 2 个），分解后的三角形按单元的顶点情况（2^顶点数 种）预先组合为查找表
+ * 3. 等值点位于单元的边（或分解产生的面对角线、体对角线）上，按边的两个顶点去重，
+ *    相邻单元共享的等值点只输出一次，输出网格是连通的
+ * 4. 三角形法线指向标量增大的一侧（对于顶点顺序符合单元定义的单元）
+ * 5. 按 FScalarChunkRanges 的块并行处理，标量范围不包含等值的块整块跳过；
+ *    提供 FScalarSpanIndex 时只处理索引查询到的候选单元（按候选单元分块并行）
+ *
+ * 注意：分解方式固定，两个六面体共享的面上对角线方向由各自的顶点编号决定，
+ * 非结构网格中方向不一致时等值面在该面上可能出现细小裂缝；多面体单元和二维、一维单元被忽略
+ *
+ * 使用示例：
+ *   FScalarChunkRanges Ranges;
+ *   Ranges.Build(Mesh, *Mesh.GetVertexField("Temperature"));
+ *   FContourOptions Options;
+ *   Options.ChunkRanges = &Ranges;                      // 拖动等值时复用
+ *   IMesh Surface;
+ *   FContourFilter::Execute(Mesh, "Temperature", 350.0f, Surface, Options);
+ *
+ *   FScalarSpanIndex Index;                             // 或使用区间索引，只访问候选单元
+ *   Options.SpanIndex = &Index;
+ */
+struct FContourFilter
+{
+    /**
+     * 提取等值面
+     * @param Input 输入网格
+     * @param FieldName 顶点标量场名称（不存在、不是标量场或数据数量与顶点数不一致时抛出 FInvalidArgumentException）
+     * @param IsoValue 等值
+     * @param Output 输出三角形网格（原有数据会被清空，不能与输入网格相同）
+     * @param Options 提取选项
+     * @param OutParentCells 可选，输出每个三角形对应的输入单元索引
+     */
+    static void Execute(const IMesh& Input, const std::string& FieldName, float IsoValue, IMesh& Output,
+        const FContourOptions& Options = FContourOptions(), TArray<int32>* OutParentCells = nullptr);
+};
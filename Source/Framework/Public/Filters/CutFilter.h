@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "Math/Math.h"
+#include "HAL/Platform.h"
+
+class IMesh;
+
+/**
+ * 切片选项
+ */
+struct FCutOptions
+{
+    /** 是否插值顶点场（输出为 Float32 存储） */
+    bool bPassVertexFields = true;
+
+    /** 是否拷贝单元场（每个三角形取其父单元的值） */
+    bool bPassCellFields = true;
+
+    /** 是否并行执行 */
+    bool bParallel = true;
+};
+
+/**
+ * FCutFilter - 平面切片过滤器
+ *
+ * 用平面（或一组平行平面）切割三维单元网格，输出截面三角形网格：
+ * 1. 先并行计算每个顶点到基准平面的有符号距离 d = Normal · (P - Origin)，
+ *    平面 k 为 d = Offsets[k]，顶点按 d >= Offsets[k] 分为两侧
+ * 2. 单元的距离范围 (Min, Max] 不包含任何平面时直接跳过；
+ *    多个平面只遍历一次单元，每个单元只处理与之相交的平面（偏移排序后二分查找）
+ * 3. 截面按等值面过滤器的情况表（Marching Tetrahedra）三角化，截面点按边去重，每个平面的截面是连通的
+ * 4. 三角形法线与 Normal 同向；输出三角形按平面顺序排列，同一平面内按单元顺序排列
+ * 5. 顶点场在边上线性插值，单元场取父单元的值
+ *
+ * 注意：多面体单元和二维、一维单元被忽略；Hex 共享面上的分解方向与等值面过滤器相同
+ *
+ * 使用示例：
+ *   IMesh Section;
+ *   FCutFilter::Execute(Mesh, FVector(0, 0, 0), FVector(0, 0, 1), Section);
+ *
+ *   // 切片堆叠：沿 Z 轴每隔 0.5 一个截面，一次遍历
+ *   TArray<float> Offsets = { 0.0f, 0.5f, 1.0f, 1.5f };
+ *   TArray<uint32> PlaneStarts;
+ *   FCutFilter::Execute(Mesh, FVector(0, 0, 0), FVector(0, 0, 1), Offsets, Section, FCutOptions(), nullptr, &PlaneStarts);
+ */
+struct FCutFilter
+{
+    /**
+     * 用单个平面切片
+     * @param Input 输入网格
+     * @param Origin 平面上的一点
+     * @param Normal 平面法线（不需要单位长度，长度为 0 时抛出 FInvalidArgumentException）
+     * @param Output 输出三角形网格（原有数据会被清空，不能与输入网格相同）
+     * @param Options 切片选项
+     * @param OutParentCells 可选，输出每个三角形对应的输入单元索引
+     */
+    static void Execute(const IMesh& Input, const FVector& Origin, const FVector& Normal, IMesh& Output,
+        const FCutOptions& Options = FCutOptions(), TArray<int32>* OutParentCells = nullptr);
+
+    /**
+     * 用一组平行平面切片（一次遍历）
+     * @param Input 输入网格
+     * @param Origin 基准平面上的一点
+     * @param Normal 平面法线（不需要单位长度，长度为 0 时抛出 FInvalidArgumentException）
+     * @param Offsets 每个平面沿单位法线相对基准平面的偏移（必须是有限值，否则抛出 FInvalidArgumentException）
+     * @param Output 输出三角形网格（原有数据会被清空，不能与输入网格相同）
+     * @param Options 切片选项
+     * @param OutParentCells 可选，输出每个三角形对应的输入单元索引
+     * @param OutPlaneStarts 可选，输出每个平面的第一个三角形（长度为平面数 + 1）
+     */
+    static void Execute(const IMesh& Input, const FVector& Origin, const FVector& Normal, const TArray<float>& Offsets, IMesh& Output,
+        const FCutOptions& Options = FCutOptions(), TArray<int32>* OutParentCells = nullptr, TArray<uint32>* OutPlaneStarts = nullptr);
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "HAL/Platform.h"
+
+class IMesh;
+
+/**
+ * 表面提取选项
+ */
+struct FExtractSurfaceOptions
+{
+    /**
+     * 是否压缩顶点
+     * true：只保留表面使用的顶点，并同步压缩顶点场
+     * false：完整拷贝顶点坐标和顶点场，表面单元直接使用原顶点索引（适合频繁切换显示模式的场景）
+     */
+    bool bCompactVertices = true;
+
+    /** 是否输出输入网格中的二维、一维单元（原样输出） */
+    bool bPassLowerDimensionCells = true;
+
+    /** 是否拷贝顶点场 */
+    bool bPassVertexFields = true;
+
+    /** 是否拷贝单元场（每个表面单元取其父单元的值） */
+    bool bPassCellFields = true;
+
+    /** 是否并行执行 */
+    bool bParallel = true;
+};
+
+/**
+ * FExtractSurfaceFilter - 外表面提取过滤器
+ * 
+ * 从包含 Tetra/Hex/Prism/Pyramid 等三维单元的网格中提取外表面，输出由三角形和四边形组成的新网格：
+ * 1. 使用 FCellNeighborTable（面顶点哈希）找出只属于一个单元的面，两个单元共享的内部面互相抵消
+ * 2. 表面单元的顶点顺序与单元面定义一致，法线朝向单元外部
+ * 3. 单元场按父单元映射到表面单元，顶点场按顶点压缩或完整拷贝
+ * 
+ * 注意：多面体单元（Polyhedron）没有标准面定义，会被忽略
+ * 
+ * 使用示例：
+ *   IMesh Surface;
+ *   TArray<int32> ParentCells;
+ *   FExtractSurfaceFilter::Execute(VolumeMesh, Surface, FExtractSurfaceOptions(), &ParentCells);
+ */
+struct FExtractSurfaceFilter
+{
+    /**
+     * 提取外表面
+     * @param Input 输入网格
+     * @param Output 输出网格（原有数据会被清空，不能与输入网格相同）
+     * @param Options 提取选项
+     * @param OutParentCells 可选，输出每个表面单元对应的输入单元索引
+     */
+    static void Execute(const IMesh& Input, IMesh& Output, const FExtractSurfaceOptions& Options = FExtractSurfaceOptions(), TArray<int32>* OutParentCells = nullptr);
+};
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "HAL/Platform.h"
+
+class IMesh;
+class FField;
+
+/**
+ * FScalarSpanIndex - 单元标量区间索引（Span Space 分桶），用于反复查询与等值面相交的单元
+ *
+ * 每个单元的区间为其顶点标量的 [Min, Max]，单元与等值面 IsoValue 相交当且仅当 Min < IsoValue <= Max
+ * （与等值面过滤器的顶点分类 标量 >= 等值 一致）。
+ *
+ * 构建：
+ * 1. 并行计算每个单元的区间（没有顶点或包含 NaN 的单元不进入索引）
+ * 2. 按 Max 做直方图（计数排序），相邻的直方图格合并为约 TargetBucketSize 个单元的桶，
+ *    桶按 Max 递增排列，桶内按 Min 排序
+ *
+ * 查询（桶之间并行）：
+ * - 桶内最大的 Max 小于等值：整桶跳过
+ * - 桶内最小的 Max 不小于等值：二分查找 Min < IsoValue 的前缀，前缀全部命中
+ * - 其余（最多一两个跨越等值的桶）：在前缀中逐个检查 Max
+ * 命中的单元写入位图，再按单元编号顺序输出，结果与暴力扫描完全一致
+ *
+ * 索引与构建时的单元数组版本和场版本绑定（FCellArray::GetVersion / FField::GetVersion），
+ * Update 在网格拓扑或场数据修改后自动重建。索引不拥有网格和场，Query 可以在多个线程上同时调用，
+ * Build / Update 不能与其他调用同时进行
+ *
+ * 使用示例（拖动等值时每帧调用）：
+ *   FScalarSpanIndex Index;                                // 与 (网格, 场) 一起保存
+ *   FContourOptions Options;
+ *   Options.SpanIndex = &Index;                             // 首次执行时构建，之后复用
+ *   FContourFilter::Execute(Mesh, "Temperature", IsoValue, Surface, Options);
+ */
+class FScalarSpanIndex
+{
+public:
+    /** 每个桶的目标单元数 */
+    static constexpr uint32 TargetBucketSize = 4096;
+
+    /**
+     * 构建索引
+     * @param Mesh 网格
+     * @param Field 顶点标量场（数据数量必须等于网格顶点数，否则抛出 FInvalidArgumentException）
+     * @param bParallel 是否并行构建
+     */
+    void Build(const IMesh& Mesh, const FField& Field, bool bParallel = true);
+
+    /**
+     * 索引与网格或场不匹配时重建
+     * @return 是否重建了索引
+     */
+    bool Update(const IMesh& Mesh, const FField& Field, bool bParallel = true);
+
+    /** 清空 */
+    void Clear();
+
+    /** 是否为指定网格和场的当前内容构建 */
+    [[nodiscard]] bool IsBuiltFor(const IMesh& Mesh, const FField& Field) const;
+
+    /**
+     * 查询与等值面相交的单元（Min < IsoValue <= Max）
+     * @param IsoValue 等值
+     * @param OutCells 输出单元索引（按编号递增）
+     * @param bParallel 是否并行查询
+     */
+    void Query(float IsoValue, TArray<uint32>& OutCells, bool bParallel = true) const;
+
+    /** 获取索引中的单元数 */
+    [[nodiscard]] uint32 GetIndexedCellCount() const { return Spans.Num(); }
+
+    /** 获取桶数 */
+    [[nodiscard]] uint32 GetBucketCount() const { return BucketMaxLower.Num(); }
+
+    /** 获取索引占用的内存（字节） */
+    [[nodiscard]] size_t GetMemorySize() const;
+
+private:
+    /** 单元区间 */
+    struct FSpan
+    {
+        float Min;
+        float Max;
+        uint32 Cell;
+    };
+
+    /** 所有单元区间（按桶排列，桶内按 Min 递增） */
+    TArray<FSpan> Spans;
+
+    /** 每个桶在 Spans 中的起始位置（长度为桶数 + 1） */
+    TArray<uint32> BucketStarts;
+
+    /** 每个桶内 Max 的最小值与最大值 */
+    TArray<float> BucketMaxLower;
+    TArray<float> BucketMaxUpper;
+
+    /** 构建时的网格单元数 */
+    uint32 CellCount = 0;
+
+    /** 构建时的单元数组版本 */
+    uint64 CellsVersion = 0;
+
+    /** 构建时的场版本 */
+    uint64 FieldVersion = 0;
+
+    /** 构建时使用的场 */
+    const FField* SourceField = nullptr;
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "Mesh/SubsetMesh.h"
+#include "HAL/Platform.h"
+#include <string>
+
+class IMesh;
+class FField;
+
+/**
+ * 阈值选项
+ */
+struct FThresholdOptions
+{
+    /** 是否反转选择（选中范围外的单元，包括值为 NaN 的单元） */
+    bool bInvert = false;
+
+    /** 是否并行执行 */
+    bool bParallel = true;
+};
+
+/**
+ * FThresholdFilter - 阈值过滤器
+ *
+ * 选出单元标量场的值在 [Lower, Upper] 内的单元，返回引用输入网格的子集网格：
+ * 1. 选择位图由 FVectorKernels::RangeMask 按块并行生成（SIMD 比较，每 64 个单元一个字）
+ * 2. 由位图按单元顺序提取选中的单元索引（各块按位计数后前缀和，再并行写入）
+ * 3. 结果 FSubsetMesh 只保存选中的单元索引，坐标、单元数组和场都引用输入网格，需要时再物化
+ *
+ * 注意：输入网格必须比返回的子集网格存活更久；值为 NaN 的单元不被选中（反转时被选中）
+ *
+ * 使用示例：
+ *   FSubsetMesh Hot = FThresholdFilter::Execute(Mesh, "Temperature", 350.0f, 500.0f);
+ *   IMesh HotCopy;
+ *   Hot.Materialize(HotCopy);
+ *
+ *   // 只需要位图时
+ *   TArray<uint64> Mask;
+ *   const uint32 Count = FThresholdFilter::ComputeMask(*Mesh.GetCellField("Temperature"), 350.0f, 500.0f, Mask);
+ */
+struct FThresholdFilter
+{
+    /**
+     * 按单元标量场选择单元
+     * @param Input 输入网格
+     * @param CellFieldName 单元标量场名称（场不存在、不是标量或数量与单元数不一致时抛出 FInvalidArgumentException）
+     * @param Lower 下界（包含）
+     * @param Upper 上界（包含，下界或上界为 NaN 时抛出 FInvalidArgumentException）
+     * @param Options 阈值选项
+     * @return 引用输入网格的子集网格
+     */
+    static FSubsetMesh Execute(const IMesh& Input, const std::string& CellFieldName, float Lower, float Upper,
+        const FThresholdOptions& Options = FThresholdOptions());
+
+    /**
+     * 计算标量场的范围选择位图
+     * @param Field 标量场（不是标量时抛出 FInvalidArgumentException）
+     * @param Lower 下界（包含）
+     * @param Upper 上界（包含）
+     * @param OutMask 输出位图（元素 i 对应字 i / 64 的第 i % 64 位，最后一个字的多余位为 0）
+     * @param Options 阈值选项
+     * @return 选中的元素数量
+     */
+    static uint32 ComputeMask(const FField& Field, float Lower, float Upper, TArray<uint64>& OutMask,
+        const FThresholdOptions& Options = FThresholdOptions());
+
+    /**
+     * 按位图提取选中元素的索引（升序）
+     * @param Mask 位图
+     * @param OutIndices 输出索引
+     * @param bParallel 是否并行执行
+     */
+    static void MaskToIndices(const TArray<uint64>& Mask, TArray<uint32>& OutIndices, bool bParallel = true);
+};
@@ -0,0 +1,204 @@
+#pragma once
+
+#include "IO/NativeMeshFile.h"
+#include "IO/VtkMeshReader.h"
+#include "Delegates/DelegateMacros.h"
+#include "Memory/SharedPtr.h"
+#include "HAL/Platform.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+
+class IMesh;
+class FMappedFile;
+
+/**
+ * 异步加载状态
+ */
+enum class EAsyncMeshLoadState : uint8
+{
+    Pending,    // 已提交，等待工作线程执行
+    Loading,    // 正在读取和解码
+    Completed,  // 加载成功
+    Failed,     // 加载失败（文件无法打开或格式无效）
+    Canceled,   // 已取消
+};
+
+inline std::string EnumToString(EAsyncMeshLoadState State)
+{
+    switch (State)
+    {
+        case EAsyncMeshLoadState::Pending: return "Pending";
+        case EAsyncMeshLoadState::Loading: return "Loading";
+        case EAsyncMeshLoadState::Completed: return "Completed";
+        case EAsyncMeshLoadState::Failed: return "Failed";
+        case EAsyncMeshLoadState::Canceled: return "Canceled";
+        default: return "Unknown";
+    }
+}
+
+/**
+ * 异步加载选项
+ */
+struct FAsyncMeshLoadOptions
+{
+    /**
+     * 是否在解码的同时预读文件
+     * true：开始加载时提示操作系统在后台预读整个文件（见 FMappedFile::Prefetch），磁盘读取与解码重叠进行
+     * false：只由解码按需读取
+     */
+    bool bPrefetch = true;
+
+    /** 原生格式（.ivm）的读取选项（Progress 回调仍会被调用，返回 false 同样会取消加载） */
+    FNativeMeshReadOptions NativeOptions;
+
+    /** VTK 格式（.vtk / .vtu）的读取选项（Progress 回调仍会被调用，返回 false 同样会取消加载） */
+    FVtkReadOptions VtkOptions;
+};
+
+/**
+ * FAsyncMeshLoad - 异步加载句柄
+ *
+ * 由 FAsyncMeshLoader::Load 创建，加载任务持有句柄直到加载结束，调用者释放句柄不会中断加载
+ *
+ * 事件（OnProgress / OnCompleted / OnFailed / OnCanceled）通过 FFrameworkTaskQueue 在 Framework 线程上广播，
+ * 在 Framework 线程上订阅不会错过事件（广播最早发生在下一次处理任务队列时）；
+ * 状态查询、Cancel 和 Wait 可以在任意线程调用
+ */
+class FAsyncMeshLoad
+{
+public:
+    DECLARE_EVENT_OneParam(FAsyncMeshLoad, FOnProgress, float)
+    DECLARE_EVENT_OneParam(FAsyncMeshLoad, FOnCompleted, const TSharedPtr<IMesh>&)
+    DECLARE_EVENT_OneParam(FAsyncMeshLoad, FOnFailed, const std::string&)
+    DECLARE_EVENT(FAsyncMeshLoad, FOnCanceled)
+
+    /** 加载进度更新（0 到 1，单调递增；相邻两次至少相差 1%，完成时广播 1） */
+    FOnProgress OnProgress;
+
+    /** 加载成功 */
+    FOnCompleted OnCompleted;
+
+    /** 加载失败（参数为错误信息） */
+    FOnFailed OnFailed;
+
+    /** 加载已取消 */
+    FOnCanceled OnCanceled;
+
+    explicit FAsyncMeshLoad(const std::string& InPath);
+
+    FAsyncMeshLoad(const FAsyncMeshLoad&) = delete;
+    FAsyncMeshLoad& operator=(const FAsyncMeshLoad&) = delete;
+
+    /** 获取文件路径 */
+    [[nodiscard]] const std::string& GetPath() const { return Path; }
+
+    /** 获取当前状态 */
+    [[nodiscard]] EAsyncMeshLoadState GetState() const { return State.load(); }
+
+    /** 加载是否已结束（成功、失败或取消，事件可能尚未在 Framework 线程上广播） */
+    [[nodiscard]] bool IsDone() const;
+
+    /** 获取加载进度（0 到 1） */
+    [[nodiscard]] float GetProgress() const;
+
+    /**
+     * 请求取消加载（异步）
+     * 解码在处理下一个数据块之前响应取消；已经结束的加载不受影响
+     */
+    void Cancel();
+
+    /** 是否已请求取消 */
+    [[nodiscard]] bool IsCancelRequested() const { return bCancelRequested.load(); }
+
+    /**
+     * 等待加载结束
+     * @param TimeoutMs 超时时间（毫秒），0 表示无限等待
+     * @return 是否在超时前结束
+     */
+    bool Wait(uint32 TimeoutMs = 0) const;
+
+    /** 获取加载的网格（仅在 Completed 状态下有效，否则为空） */
+    [[nodiscard]] TSharedPtr<IMesh> GetMesh() const;
+
+    /** 获取错误信息（仅在 Failed 状态下有效） */
+    [[nodiscard]] std::string GetError() const;
+
+private:
+    friend struct FAsyncMeshLoader;
+
+    /** 解码任务：判断格式并调用对应的读取器 */
+    void RunDecode(const FAsyncMeshLoadOptions& Options, const TSharedPtr<FAsyncMeshLoad>& Self);
+
+    /** 更新进度，进度变化足够大时投递一次进度事件 */
+    void UpdateProgress(const TSharedPtr<FAsyncMeshLoad>& Self);
+
+    /** 在 Framework 线程上广播进度事件（只广播递增的进度） */
+    void BroadcastProgress(int32 Percent);
+
+    /** 设置结束状态，唤醒等待的线程，并投递结束事件 */
+    void Finish(EAsyncMeshLoadState FinalState, TSharedPtr<IMesh> LoadedMesh, const std::string& ErrorMessage, const TSharedPtr<FAsyncMeshLoad>& Self);
+
+    /** 文件路径 */
+    std::string Path;
+
+    /** 当前状态 */
+    std::atomic<EAsyncMeshLoadState> State;
+
+    /** 是否已请求取消 */
+    std::atomic<bool> bCancelRequested;
+
+    /** 文件总字节数（打开文件前为 0） */
+    std::atomic<uint64> TotalBytes;
+
+    /** 解码完成的字节数 */
+    std::atomic<uint64> DecodedBytes;
+
+    /** 最近一次投递的进度（百分比，-1 表示尚未投递） */
+    std::atomic<int32> PostedPercent;
+
+    /** 最近一次广播的进度（百分比，只在 Framework 线程上访问） */
+    int32 BroadcastPercent;
+
+    /** 预读的映射文件（加载结束时释放） */
+    TSharedPtr<FMappedFile> PrefetchFile;
+
+    /** 加载结果（由 StateMutex 保护） */
+    TSharedPtr<IMesh> Mesh;
+    std::string Error;
+
+    /** 保护加载结果，配合条件变量实现 Wait */
+    mutable std::mutex StateMutex;
+    mutable std::condition_variable StateCondition;
+};
+
+/**
+ * FAsyncMeshLoader - 异步网格加载
+ *
+ * 加载流程（在任务图上执行，调用线程和 Framework 线程不会阻塞）：
+ * 1. 解码任务根据文件头判断格式（原生 .ivm 或 VTK），调用 FNativeMeshFile / FVtkMeshReader 读取，
+ *    读取器内部的并行解码同样在任务图上执行
+ * 2. 启用预读时，Load 映射文件并提示操作系统在后台预读整个文件（madvise / PrefetchVirtualMemory），
+ *    预读不占用任务图的线程，磁盘读取领先于解码，解码访问的页大多已在页缓存中
+ * 3. 进度 = 解码字节数 / 文件字节数
+ * 4. 取消通过读取器的 Progress 回调响应，读取器抛出 FOperationCanceledException 后加载进入 Canceled 状态
+ * 5. 结束后在 Framework 线程上广播 OnProgress(1)（仅成功时）以及 OnCompleted / OnFailed / OnCanceled
+ *
+ * 使用示例（在 Framework 线程上）：
+ *   TSharedPtr<FAsyncMeshLoad> Load = FAsyncMeshLoader::Load("Result.vtu");
+ *   Load->OnProgress.AddLambda([](float Progress) { UpdateProgressBar(Progress); });
+ *   Load->OnCompleted.AddLambda([](const TSharedPtr<IMesh>& Mesh) { ShowMesh(Mesh); });
+ *   ...
+ *   Load->Cancel();  // 用户取消
+ */
+struct FAsyncMeshLoader
+{
+    /**
+     * 开始异步加载
+     * @param Path 文件路径（错误在加载过程中报告，不会在此抛出）
+     * @param Options 加载选项
+     * @return 加载句柄
+     */
+    static TSharedPtr<FAsyncMeshLoad> Load(const std::string& Path, const FAsyncMeshLoadOptions& Options = FAsyncMeshLoadOptions());
+};
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "HAL/Platform.h"
+#include "Math/Math.h"
+#include "Container/Array.h"
+#include "Container/ArrayView.h"
+#include "Memory/SharedPtr.h"
+#include <fstream>
+#include <string>
+
+class IMesh;
+class FMappedFile;
+struct FNativeMeshReadOptions;
+
+/**
+ * 分块网格文件中单个块的信息（块表项）
+ */
+struct FMeshChunkInfo
+{
+    /** 块内第一个单元的全局编号（块按单元顺序排列，单元编号连续） */
+    uint64 FirstCell = 0;
+
+    /** 块内单元数 */
+    uint32 CellCount = 0;
+
+    /** 块内顶点数（块之间共享的顶点在每个块中各存一份） */
+    uint32 VertexCount = 0;
+
+    /** 块内顶点的包围盒（用于不加载块的空间裁剪） */
+    FVector BoundsMin;
+    FVector BoundsMax;
+
+    /** 块网格数据（.ivm 格式）在文件中的偏移和字节数 */
+    uint64 MeshOffset = 0;
+    uint64 MeshSize = 0;
+
+    /** 块内顶点的全局编号（uint64 * VertexCount）在文件中的偏移 */
+    uint64 GlobalVertexIdsOffset = 0;
+};
+
+/**
+ * 分块网格文件的整体布局（读取块表的结果）
+ */
+struct FChunkedMeshLayout
+{
+    /** 网格名称 */
+    std::string MeshName;
+
+    /** 全局顶点数（最大全局顶点编号 + 1） */
+    uint64 VertexCount = 0;
+
+    /** 全局单元数 */
+    uint64 CellCount = 0;
+
+    /** 块表 */
+    TArray<FMeshChunkInfo> Chunks;
+};
+
+/**
+ * FChunkedMeshFile - 分块网格文件（.ivc），用于超出内存容量的网格
+ *
+ * 文件布局（小端序，所有数据按 64 字节对齐）：
+ *   [文件头 64 字节][网格名称][块 0 的网格数据][块 0 的全局顶点编号][块 1 ...]...[块表 ChunkCount * 64 字节]
+ *
+ * - 文件头：魔数 "IVISCHNK"、版本号、块数、块表位置、全局顶点数与单元数、网格名称长度
+ * - 每个块是一个完整的原生网格（FNativeMeshFile 格式，包含几何、拓扑和场），单元编号为块内局部编号，
+ *   另存一份块内顶点到全局顶点编号的映射
+ * - 块表位于文件末尾，写入过程中逐块追加数据，结束时再写块表并回填文件头，
+ *   因此生成器无需一次性持有整个网格
+ *
+ * 读取由 FOutOfCoreMesh 完成：映射整个文件后只读取块表，按需加载单个块
+ *
+ * 使用示例：
+ *   FChunkedMeshFile::Write(Mesh, "Model.ivc", 1 << 20);  // 从常驻网格按每块 1M 单元划分
+ *
+ *   FChunkedMeshWriter Writer;                              // 或由生成器逐块写出
+ *   Writer.Open("Model.ivc", "Model");
+ *   Writer.AddChunk(ChunkMesh, ChunkGlobalVertexIds);
+ *   Writer.Finish();
+ */
+struct FChunkedMeshFile
+{
+    /** 文件魔数 */
+    static constexpr char Magic[8] = { 'I', 'V', 'I', 'S', 'C', 'H', 'N', 'K' };
+
+    /** 当前文件版本 */
+    static constexpr uint32 Version = 1;
+
+    /**
+     * 将常驻网格按单元顺序划分为块并写入文件
+     * 每块包含 CellsPerChunk 个连续单元（最后一块可能更少）、这些单元引用的顶点以及对应的顶点场和单元场
+     * @param Mesh 输入网格（压缩的场以解压后的形式写入）
+     * @param Path 文件路径，无法写入时抛出 FFileIOException
+     * @param CellsPerChunk 每块的单元数（大于 0）
+     */
+    static void Write(const IMesh& Mesh, const std::string& Path, uint32 CellsPerChunk);
+
+    /**
+     * 读取文件头和块表
+     * @param File 映射的文件，格式无效时抛出 FFileIOException
+     * @param OutLayout 输出布局
+     */
+    static void ReadLayout(const FMappedFile& File, FChunkedMeshLayout& OutLayout);
+
+    /**
+     * 读取单个块
+     * @param File 映射的文件
+     * @param Chunk 块表项（来自 ReadLayout）
+     * @param OutMesh 输出的块网格（原有数据会被清空）
+     * @param OutGlobalVertexIds 输出块内顶点的全局编号
+     * @param Options 读取选项
+     */
+    static void ReadChunk(const TSharedPtr<FMappedFile>& File, const FMeshChunkInfo& Chunk, IMesh& OutMesh,
+        TArray<uint64>& OutGlobalVertexIds, const FNativeMeshReadOptions& Options);
+};
+
+/**
+ * FChunkedMeshWriter - 逐块写出分块网格文件
+ *
+ * 每次 AddChunk 立即把块数据追加到文件，只在内存中保留块表；
+ * Finish 写出块表并回填文件头，未调用 Finish 的文件是无效的
+ */
+class FChunkedMeshWriter
+{
+public:
+    FChunkedMeshWriter() = default;
+    FChunkedMeshWriter(const FChunkedMeshWriter&) = delete;
+    FChunkedMeshWriter& operator=(const FChunkedMeshWriter&) = delete;
+
+    /**
+     * 创建文件并写入文件头占位
+     * @param InPath 文件路径，无法创建时抛出 FFileIOException
+     * @param MeshName 网格名称
+     */
+    void Open(const std::string& InPath, const std::string& MeshName);
+
+    /**
+     * 追加一个块
+     * @param Chunk 块网格（单元编号为块内局部编号）
+     * @param GlobalVertexIds 块内每个顶点的全局编号，数量必须等于块的顶点数
+     */
+    void AddChunk(const IMesh& Chunk, TArrayView<const uint64> GlobalVertexIds);
+
+    /** 写出块表并回填文件头，写入失败时抛出 FFileIOException */
+    void Finish();
+
+    /** 文件是否已打开且尚未 Finish */
+    [[nodiscard]] bool IsOpen() const { return Stream.is_open(); }
+
+    /** 已写入的块数 */
+    [[nodiscard]] uint32 GetChunkCount() const { return Chunks.Num(); }
+
+private:
+    /** 补齐到 64 字节对齐 */
+    void PadToAlignment();
+
+    /** 写入失败时抛出异常 */
+    void CheckStream() const;
+
+    std::ofstream Stream;
+    std::string Path;
+    std::string Name;
+    TArray<FMeshChunkInfo> Chunks;
+    uint64 Offset = 0;
+    uint64 VertexCount = 0;
+    uint64 CellCount = 0;
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "HAL/Platform.h"
+#include <functional>
+
+/**
+ * 网格读取进度回调（在执行读取的线程上调用，读取器在处理每个数据块之前调用一次）
+ * @param ProcessedBytes 已处理的文件字节数
+ * @param TotalBytes 文件总字节数
+ * @return 返回 false 时取消读取，读取函数抛出 FOperationCanceledException
+ */
+using FMeshReadProgress = std::function<bool(uint64 ProcessedBytes, uint64 TotalBytes)>;
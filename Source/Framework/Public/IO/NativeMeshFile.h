@@ -0,0 +1,95 @@
+#pragma once
+
+#include "HAL/Platform.h"
+#include "IO/MeshReadProgress.h"
+#include "Memory/SharedPtr.h"
+#include <iosfwd>
+#include <string>
+
+class IMesh;
+class FMappedFile;
+
+/**
+ * 原生网格文件读取选项
+ */
+struct FNativeMeshReadOptions
+{
+    /**
+     * 是否让场数据直接引用映射的文件页（零拷贝）
+     * true：场以外部存储（FField::IsExternal）的形式引用映射内存，首次修改时才复制
+     * false：场数据拷贝到自有存储，读取完成后不再持有文件映射
+     */
+    bool bMapFields = true;
+
+    /** 是否并行拷贝顶点坐标 */
+    bool bParallel = true;
+
+    /** 读取进度回调（可为空，在读取每个段之前调用，字节数相对于网格数据的起始位置） */
+    FMeshReadProgress Progress;
+};
+
+/**
+ * FNativeMeshFile - IVisEngine 原生二进制网格文件（.ivm）
+ *
+ * 文件布局（小端序，所有段按 64 字节对齐）：
+ *   [文件头 64 字节][段表 SectionCount * 64 字节][字符串表][段 0][段 1]...
+ *
+ * - 文件头：魔数 "IVISMESH"、版本号、段表与字符串表位置、顶点数、单元数、网格名称
+ * - 段：顶点坐标、单元拓扑（均质存储为一个顶点索引段，混合存储为类型、偏移、顶点索引三个段）、
+ *   每个顶点场和单元场各一个段（保留场的存储类型）
+ * - 字符串表：网格名称和场名称（段表中记录偏移和长度）
+ *
+ * 写入时先计算布局，再顺序一次写出；读取时映射整个文件，校验文件头和每个段的范围后：
+ * - 场数据直接引用映射内存（零拷贝，按页由操作系统加载）
+ * - 顶点坐标和单元拓扑以大块内存拷贝导入（IMesh 与 FCellArray 的存储不支持引用外部内存）
+ *
+ * 使用示例：
+ *   FNativeMeshFile::Write(Mesh, "Model.ivm");
+ *   IMesh Loaded;
+ *   FNativeMeshFile::Read("Model.ivm", Loaded);
+ */
+struct FNativeMeshFile
+{
+    /** 文件魔数 */
+    static constexpr char Magic[8] = { 'I', 'V', 'I', 'S', 'M', 'E', 'S', 'H' };
+
+    /** 当前文件版本 */
+    static constexpr uint32 Version = 1;
+
+    /** 段的对齐字节数 */
+    static constexpr uint32 SectionAlignment = 64;
+
+    /**
+     * 写入网格
+     * @param Mesh 输入网格（压缩的场以解压后的形式写入）
+     * @param Path 文件路径，无法写入时抛出 FFileIOException
+     */
+    static void Write(const IMesh& Mesh, const std::string& Path);
+
+    /**
+     * 将网格写入输出流（用于把网格数据嵌入其他文件，段偏移相对于网格数据的起始位置）
+     * @param Mesh 输入网格
+     * @param Stream 输出流（从当前位置开始写入，调用者负责保证起始位置按 SectionAlignment 对齐）
+     * @return 写入的字节数（SectionAlignment 的倍数），写入失败时抛出 FFileIOException
+     */
+    static uint64 Write(const IMesh& Mesh, std::ostream& Stream);
+
+    /**
+     * 读取网格
+     * @param Path 文件路径，无法打开或格式无效时抛出 FFileIOException
+     * @param OutMesh 输出网格（原有数据会被清空）
+     * @param Options 读取选项
+     */
+    static void Read(const std::string& Path, IMesh& OutMesh, const FNativeMeshReadOptions& Options = FNativeMeshReadOptions());
+
+    /**
+     * 从已映射文件的指定范围读取网格（嵌入在其他文件中的网格数据）
+     * @param File 映射文件（映射引用场数据时由场持有）
+     * @param Offset 网格数据在文件中的偏移（必须按 SectionAlignment 对齐）
+     * @param Size 网格数据的字节数
+     * @param OutMesh 输出网格（原有数据会被清空）
+     * @param Options 读取选项
+     */
+    static void Read(const TSharedPtr<FMappedFile>& File, uint64 Offset, uint64 Size, IMesh& OutMesh,
+        const FNativeMeshReadOptions& Options = FNativeMeshReadOptions());
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Cell/CellType.h"
+#include "HAL/Platform.h"
+#include "IO/MeshReadProgress.h"
+#include <string>
+
+class IMesh;
+
+/**
+ * VTK 文件读取选项
+ */
+struct FVtkReadOptions
+{
+    /** 是否读取顶点场（POINT_DATA / PointData） */
+    bool bReadVertexFields = true;
+
+    /** 是否读取单元场（CELL_DATA / CellData） */
+    bool bReadCellFields = true;
+
+    /**
+     * 是否保留场的数值类型
+     * true：整数数组使用 Int32 / UInt8 存储，双精度数组（以及无法用 Int32 表示的整数数组）使用 Float64 存储
+     * false：全部转换为 Float32
+     */
+    bool bPreserveFieldStorage = false;
+
+    /**
+     * 是否跳过没有对应 ECellType 的单元（顶点、三角形条带、高阶单元等）
+     * true：跳过这些单元并同步删除单元场中对应的值
+     * false：遇到时抛出 FFileIOException
+     */
+    bool bSkipUnsupportedCells = true;
+
+    /** 是否并行解析（大块 ASCII 数值与二进制数组） */
+    bool bParallel = true;
+
+    /** 读取进度回调（可为空，传统格式在每个关键字、XML 格式在每个 DataArray 之前调用） */
+    FMeshReadProgress Progress;
+};
+
+/**
+ * FVtkMeshReader - VTK 非结构网格读取器
+ *
+ * 支持的格式：
+ * 1. 传统 VTK 格式（.vtk）：DATASET UNSTRUCTURED_GRID，ASCII 或 BINARY（大端序），
+ *    同时支持旧版 CELLS 布局与 5.1 版的 OFFSETS / CONNECTIVITY 布局
+ * 2. VTK XML 非结构网格（.vtu）：单个 Piece，DataArray 为 ascii 或 appended（encoding="raw"，未压缩）
+ *
+ * 实现特点：
+ * - 文件通过内存映射读取，文本直接在映射内存上扫描，数值使用 std::from_chars 解析
+ * - 大块 ASCII 数值按行边界切分后并行解析到各块的缓冲区，再按前缀和偏移拼接到输出
+ * - 顶点坐标、连接关系、偏移和场数据直接解码到预先分配好大小的缓冲区，再以移动语义交给 IMesh / FCellArray / FField
+ * - VTK 单元类型映射到 ECellType：Pixel / Voxel 重排顶点后转换为 Quad / Hex
+ * - 场按分量数映射为 Scalar（1）、Vector（3）、Tensor（9），其他分量数为 Custom
+ *
+ * 使用示例：
+ *   IMesh Mesh;
+ *   FVtkMeshReader::Read("Result.vtu", Mesh);
+ */
+struct FVtkMeshReader
+{
+    /**
+     * 读取 VTK 文件（根据文件内容判断是传统格式还是 XML 格式）
+     * @param Path 文件路径，无法打开、格式无效或包含不支持的内容时抛出 FFileIOException
+     * @param OutMesh 输出网格（原有数据会被清空，网格名称为文件名）
+     * @param Options 读取选项
+     */
+    static void Read(const std::string& Path, IMesh& OutMesh, const FVtkReadOptions& Options = FVtkReadOptions());
+
+    /** 读取传统 VTK 格式文件 */
+    static void ReadLegacy(const std::string& Path, IMesh& OutMesh, const FVtkReadOptions& Options = FVtkReadOptions());
+
+    /** 读取 VTK XML 非结构网格文件 */
+    static void ReadVtu(const std::string& Path, IMesh& OutMesh, const FVtkReadOptions& Options = FVtkReadOptions());
+
+    /**
+     * 将 VTK 单元类型编号转换为 ECellType
+     * @param VtkCellType VTK 单元类型编号（VTK_TRIANGLE = 5 等）
+     * @return 对应的单元类型，没有对应类型时返回 ECellType::None
+     */
+    static ECellType ConvertCellType(uint8 VtkCellType);
+};
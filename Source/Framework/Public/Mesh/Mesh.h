@@ -2,13 +2,26 @@
 
 #include "Mesh/MeshBase.h"
 #include "Container/Array.h"
+#include "Container/ArrayView.h"
 #include "Container/Map.h"
 #include "Memory/UniquePtr.h"
+#include <mutex>
 #include <string>
 
 // 前向声明
 class FCellArray;
+class FCellLinks;
 class FField;
+class FVectorArraySoA;
+
+/**
+ * 顶点坐标的主存储布局
+ */
+enum class EVertexLayout : uint8
+{
+    AoS,    // TArray<FVector>（默认，适合逐顶点访问和 GPU 上传）
+    SoA,    // FVectorArraySoA（X/Y/Z 分量分别对齐存储，适合 SIMD 批量计算）
+};
 
 /**
  * IMesh - 基础网格类
@@ -31,8 +44,20 @@ private:
     // 几何数据（值类型，直接使用）
     // ============================================================================
     
-    /** 顶点坐标数组 */
-    TArray<FVector> VerticesPositions;
+    /** 顶点坐标数组（AoS 布局时为主存储，SoA 布局时为按需生成的镜像） */
+    mutable TArray<FVector> VerticesPositions;
+    
+    /** 顶点坐标的 SoA 存储（SoA 布局时为主存储，AoS 布局时为按需生成的镜像） */
+    mutable TUniquePtr<FVectorArraySoA> VerticesPositionsSoA;
+    
+    /** 顶点坐标的主存储布局 */
+    EVertexLayout VertexLayout;
+    
+    /** 非主存储布局的镜像是否与主存储一致 */
+    mutable bool bPositionsMirrorValid;
+    
+    /** 保护顶点坐标镜像的互斥锁 */
+    mutable std::mutex PositionsMirrorMutex;
 
     // ============================================================================
     // 拓扑数据（使用UniquePtr）
@@ -41,6 +66,19 @@ private:
     /** 单元数组（存储拓扑信息） */
     TUniquePtr<FCellArray> Cells;
     
+    // ============================================================================
+    // 拓扑缓存（按需构建）
+    // ============================================================================
+    
+    /** 顶点到单元的邻接表缓存 */
+    mutable TUniquePtr<FCellLinks> CellLinks;
+    
+    /** 构建邻接表时单元数组的版本号 */
+    mutable uint64 CellLinksVersion;
+    
+    /** 保护邻接表缓存的互斥锁（允许多个线程同时在常量网格上查询） */
+    mutable std::mutex CellLinksMutex;
+    
     // ============================================================================
     // 场数据
     // ============================================================================
@@ -82,7 +120,7 @@ public:
     IMesh(IMesh&& Other) noexcept;
     
     /** 析构函数 */
-    ~IMesh() override = default;
+    ~IMesh() override;
     
     /** 拷贝赋值 */
     IMesh& operator=(const IMesh& Other);
@@ -100,7 +138,7 @@ public:
     /** 获取指定索引的顶点坐标 */
     [[nodiscard]] FVector GetVertexPosition(uint32 Index) const override;
     
-    /** 获取顶点坐标数组的原始指针 */
+    /** 获取顶点坐标数组的原始指针（SoA 布局时按需生成 AoS 镜像） */
     [[nodiscard]] const FVector* GetVerticesPositionsPtr() const override;
     
     /** 检查顶点索引是否有效 */
@@ -139,10 +177,43 @@ public:
 
     /**
      * 获取所有顶点（常量引用）
+     * SoA 布局时按需生成 AoS 镜像
      * @return 顶点数组常量引用
      */
     [[nodiscard]] const TArray<FVector>& GetVerticesPositions() const;
     
+    // ============================================================================
+    // 顶点坐标存储布局
+    // ============================================================================
+    
+    /** 获取顶点坐标的主存储布局 */
+    [[nodiscard]] EVertexLayout GetVertexLayout() const;
+    
+    /**
+     * 设置顶点坐标的主存储布局（并行转换现有数据，并释放原布局的存储）
+     * @param InLayout 新的存储布局
+     */
+    void SetVertexLayout(EVertexLayout InLayout);
+    
+    /**
+     * 获取 SoA 布局的顶点坐标
+     * AoS 布局时按需生成 SoA 镜像，镜像在顶点修改后自动失效
+     * @return SoA 顶点坐标常量引用（在下一次修改顶点前有效）
+     */
+    [[nodiscard]] const FVectorArraySoA& GetVerticesPositionsSoA() const;
+    
+    /**
+     * 获取可修改的 SoA 顶点坐标（用于批量变换、变形等）
+     * 如果当前为 AoS 布局，会先切换为 SoA 布局；AoS 镜像随之失效
+     * @return SoA 顶点坐标引用（在下一次调用其它顶点修改接口前有效）
+     */
+    [[nodiscard]] FVectorArraySoA& EditVerticesPositionsSoA();
+    
+    /**
+     * 释放非主存储布局的镜像（下次访问时重新生成）
+     */
+    void ReleaseVerticesPositionsMirror();
+    
     // ============================================================================
     // 拓扑数据操作（实现IMeshBase接口）
     // ============================================================================
@@ -159,6 +230,37 @@ public:
     /** 检查单元索引是否有效 */
     [[nodiscard]] bool IsValidCellIndex(uint32 Index) const override;
     
+    // ============================================================================
+    // 拓扑邻接查询
+    // ============================================================================
+    
+    /**
+     * 获取顶点到单元的邻接表
+     * 首次调用或单元数组、顶点数量变化后自动重建，否则直接返回缓存
+     * @return 邻接表常量引用（在下一次修改网格前有效）
+     */
+    [[nodiscard]] const FCellLinks& GetCellLinks() const;
+    
+    /**
+     * 获取使用指定顶点的所有单元（按单元索引升序）
+     * 替代 FCellArray::FindCellsContainingVertex 的逐单元扫描
+     * @param VertexIndex 顶点索引
+     * @return 单元索引视图（在下一次修改网格前有效），顶点索引无效时返回空视图
+     */
+    [[nodiscard]] TArrayView<const int32> GetCellsUsingVertex(uint32 VertexIndex) const;
+    
+    /**
+     * 立即（重新）构建顶点到单元的邻接表
+     * 之前通过 GetCellLinks 得到的引用失效，因此不能与其他线程的邻接查询同时调用
+     * @param bParallel 是否并行构建
+     */
+    void BuildCellLinks(bool bParallel = true) const;
+    
+    /**
+     * 释放邻接表缓存，下次查询时重新构建
+     */
+    void InvalidateCellLinks();
+    
     // ============================================================================
     // 场数据操作（实现IMeshBase接口）
     // ============================================================================
@@ -228,6 +330,14 @@ public:
      */
     bool RemoveCellField(const std::string& FieldName);
     
+    /**
+     * 使用单元索引映射表压缩所有单元场
+     * 与 FCellArray::RemoveCellsIf / KeepCellsIf / CompactCells 输出的映射表配合使用
+     * @param CellRemap 旧单元索引到新单元索引的映射，负值表示单元已删除
+     *                  （任一单元场的数量与映射表长度不一致时抛出 FInvalidArgumentException，且不修改任何场）
+     */
+    void RemapCellFields(const TArray<int32>& CellRemap);
+    
     /**
      * 获取所有顶点场名称
      * @param OutFieldNames 输出的场名称数组
@@ -310,5 +420,12 @@ public:
      * 收缩内存以匹配实际大小
      */
     void Shrink();
+
+private:
+    /** 顶点坐标被修改后使镜像失效 */
+    void MarkVerticesPositionsModified();
+    
+    /** 拷贝其他网格的顶点坐标主存储 */
+    void CopyVerticesPositions(const IMesh& Other);
 };
 
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "Math/MathType.h"
+#include "Math/Math.h"
 #include "HAL/Platform.h"
 #include <string>
 
@@ -0,0 +1,241 @@
+#pragma once
+
+#include "Mesh/Mesh.h"
+#include "IO/ChunkedMeshFile.h"
+#include "Container/Array.h"
+#include "Memory/SharedPtr.h"
+#include "Threading/ParallelFor.h"
+#include <mutex>
+#include <string>
+
+class FMappedFile;
+
+/**
+ * 外存网格的打开选项
+ */
+struct FOutOfCoreMeshOptions
+{
+    /** 常驻块的内存预算（字节），超出后淘汰最久未使用的块 */
+    uint64 MemoryBudget = uint64(1) << 30;
+
+    /**
+     * 块的场数据是否直接引用映射的文件页（见 FNativeMeshReadOptions::bMapFields）
+     * 引用时场数据由操作系统按页换入换出，不计入内存预算
+     */
+    bool bMapFields = false;
+};
+
+/**
+ * FMeshChunk - 外存网格中已加载到内存的一个块
+ * 块内的单元和顶点使用局部编号，通过 FirstCell 和 GlobalVertexIds 换算为全局编号
+ */
+struct FMeshChunk
+{
+    /** 块编号 */
+    uint32 ChunkIndex = 0;
+
+    /** 块内第一个单元的全局编号（块内第 i 个单元的全局编号为 FirstCell + i） */
+    uint64 FirstCell = 0;
+
+    /** 块网格（几何、拓扑和场） */
+    IMesh Mesh;
+
+    /** 块内每个顶点的全局编号 */
+    TArray<uint64> GlobalVertexIds;
+
+    /** 块占用的内存字节数（计入缓存预算） */
+    size_t MemorySize = 0;
+};
+
+/**
+ * 外存网格缓存统计
+ */
+struct FOutOfCoreCacheStats
+{
+    /** 命中次数 */
+    uint64 Hits = 0;
+
+    /** 未命中（从文件加载）次数 */
+    uint64 Misses = 0;
+
+    /** 淘汰次数 */
+    uint64 Evictions = 0;
+
+    /** 当前常驻块数 */
+    uint32 ResidentChunks = 0;
+
+    /** 当前常驻块占用的内存字节数 */
+    uint64 ResidentBytes = 0;
+};
+
+/**
+ * FOutOfCoreMesh - 外存网格（数据量超出内存容量时使用）
+ *
+ * 设计特点：
+ * 1. 网格按单元顺序划分为块存储在分块网格文件（FChunkedMeshFile）中，打开时只读取块表
+ * 2. 块按需加载：LoadChunk 返回块的共享指针，持有期间块不会被淘汰（钉住）
+ * 3. 常驻块由 LRU 缓存管理：加载新块后如果常驻内存超出预算，
+ *    按最近使用时间从旧到新淘汰没有被外部持有的块；所有块都被钉住时允许暂时超出预算
+ * 4. 过滤器通过 ForEachChunk 逐块处理，每个块都是完整的 IMesh，现有过滤器可以直接作用于块
+ * 5. 线程安全：多个线程可以同时加载块和查询网格信息，缓存和块表由互斥锁保护，加载过程不持有锁；
+ *    网格信息按值返回，与 Close / Open 并发时得到关闭前或关闭后的结果
+ *
+ * 块之间共享的顶点在每个块中各有一份，按顶点聚合的结果需要使用 GlobalVertexIds 合并
+ *
+ * 使用示例：
+ *   FOutOfCoreMesh Mesh;
+ *   Mesh.Open("Model.ivc", { 512ull << 20 });
+ *   Mesh.ForEachChunk([&](const FMeshChunk& Chunk)
+ *   {
+ *       FField Volumes;
+ *       FCellGeometryFilter::Execute(Chunk.Mesh, ECellGeometryQuantity::Volume, Volumes, false);
+ *       ...
+ *   });
+ */
+class FOutOfCoreMesh
+{
+public:
+    FOutOfCoreMesh();
+    ~FOutOfCoreMesh();
+
+    FOutOfCoreMesh(const FOutOfCoreMesh&) = delete;
+    FOutOfCoreMesh& operator=(const FOutOfCoreMesh&) = delete;
+
+    // ============================================================================
+    // 打开和关闭
+    // ============================================================================
+
+    /**
+     * 打开分块网格文件（只读取块表，不加载任何块）
+     * @param Path 文件路径，无法打开或格式无效时抛出 FFileIOException
+     * @param InOptions 打开选项
+     */
+    void Open(const std::string& Path, const FOutOfCoreMeshOptions& InOptions = FOutOfCoreMeshOptions());
+
+    /** 关闭文件并释放所有常驻块（外部持有的块在释放前仍然有效） */
+    void Close();
+
+    /** 是否已打开 */
+    [[nodiscard]] bool IsOpen() const;
+
+    // ============================================================================
+    // 网格信息（不需要加载块）
+    // ============================================================================
+
+    /** 获取网格名称 */
+    [[nodiscard]] std::string GetMeshName() const;
+
+    /** 获取全局顶点数 */
+    [[nodiscard]] uint64 GetVertexCount() const;
+
+    /** 获取全局单元数 */
+    [[nodiscard]] uint64 GetCellCount() const;
+
+    /** 获取块数 */
+    [[nodiscard]] uint32 GetChunkCount() const;
+
+    /**
+     * 获取块信息（按值返回，Close 后仍然有效）
+     * @param ChunkIndex 块编号，越界时抛出 FInvalidArgumentException
+     */
+    [[nodiscard]] FMeshChunkInfo GetChunkInfo(uint32 ChunkIndex) const;
+
+    /**
+     * 获取整个网格的包围盒（由块表中的包围盒合并）
+     * @return 网格为空时返回 false，且不修改输出
+     */
+    bool GetBounds(FVector& OutMin, FVector& OutMax) const;
+
+    /**
+     * 查找包含指定全局单元的块
+     * @return 块编号，单元编号越界时抛出 FInvalidArgumentException
+     */
+    [[nodiscard]] uint32 FindChunkByCell(uint64 CellIndex) const;
+
+    // ============================================================================
+    // 块访问
+    // ============================================================================
+
+    /**
+     * 加载块（已常驻时直接返回）
+     * @param ChunkIndex 块编号，越界时抛出 FInvalidArgumentException
+     * @return 块的共享指针，持有期间块不会被淘汰
+     */
+    TSharedPtr<const FMeshChunk> LoadChunk(uint32 ChunkIndex);
+
+    /** 块是否常驻内存 */
+    [[nodiscard]] bool IsChunkResident(uint32 ChunkIndex) const;
+
+    /**
+     * 逐块处理整个网格
+     * 并行时多个块同时加载和处理，常驻内存最多为 预算 + 工作线程数 个块
+     * @param Func 处理函数，签名：void(const FMeshChunk& Chunk)
+     * @param bParallel 是否并行处理多个块（处理函数需要线程安全）
+     */
+    template<typename FuncType>
+    void ForEachChunk(FuncType&& Func, bool bParallel = true)
+    {
+        ParallelForRange(GetChunkCount(), 1, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 ChunkIndex = Begin; ChunkIndex < End; ++ChunkIndex)
+            {
+                const TSharedPtr<const FMeshChunk> Chunk = LoadChunk(ChunkIndex);
+                Func(*Chunk);
+            }
+        }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+    }
+
+    // ============================================================================
+    // 缓存管理
+    // ============================================================================
+
+    /** 设置内存预算（立即按新预算淘汰） */
+    void SetMemoryBudget(uint64 InMemoryBudget);
+
+    /** 获取内存预算 */
+    [[nodiscard]] uint64 GetMemoryBudget() const;
+
+    /** 淘汰所有没有被外部持有的块 */
+    void Trim();
+
+    /** 获取缓存统计 */
+    [[nodiscard]] FOutOfCoreCacheStats GetCacheStats() const;
+
+private:
+    /** 缓存槽（每个块一个） */
+    struct FCacheSlot
+    {
+        /** 常驻的块，未加载时为空 */
+        TSharedPtr<FMeshChunk> Chunk;
+
+        /** 最近一次使用的时间戳 */
+        uint64 LastUse = 0;
+    };
+
+    /** 按 LRU 淘汰块直到常驻内存不超过 Budget（调用者持有锁） */
+    void EvictToBudget(uint64 Budget);
+
+    /** 计算块占用的内存 */
+    static size_t ComputeChunkMemorySize(const FMeshChunk& Chunk);
+
+    /** 映射的文件 */
+    TSharedPtr<FMappedFile> File;
+
+    /** 文件布局（块表） */
+    FChunkedMeshLayout Layout;
+
+    /** 打开选项 */
+    FOutOfCoreMeshOptions Options;
+
+    /** 缓存槽 */
+    TArray<FCacheSlot> Slots;
+
+    /** 使用时间戳计数器 */
+    uint64 UseClock;
+
+    /** 缓存统计 */
+    FOutOfCoreCacheStats Stats;
+
+    /** 保护文件、块表、缓存槽、时间戳和统计的互斥锁 */
+    mutable std::mutex CacheMutex;
+};
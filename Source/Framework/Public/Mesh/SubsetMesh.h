@@ -0,0 +1,194 @@
+#pragma once
+
+#include "Mesh/MeshBase.h"
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Memory/UniquePtr.h"
+#include <mutex>
+#include <string>
+
+// 前向声明
+class IMesh;
+class FCellArray;
+struct FCellView;
+class FField;
+
+/**
+ * FSubsetMesh - 子集网格（引用父网格的轻量视图）
+ *
+ * 设计特点：
+ * 1. 只保存父网格指针和选中的单元索引（按父网格单元编号），不拷贝几何数据
+ * 2. 顶点坐标、顶点场直接使用父网格的数据（顶点编号与父网格相同，包括未被选中单元使用的顶点）
+ * 3. 单元 i 对应父网格单元 GetParentCellIndex(i)，GetCellView 直接返回父网格单元数组中的视图
+ * 4. 需要子集自身布局的数据在首次访问时物化并缓存：
+ *    - GetCells() 返回只含选中单元的单元数组
+ *    - GetCellField() 返回按选中单元收集的单元场（保留存储类型）
+ * 5. 非常量的场访问返回子集自己的副本（顶点场在首次非常量访问时拷贝），修改不会影响父网格
+ * 6. Materialize 生成独立的 IMesh（可选只保留被使用的顶点）
+ *
+ * 注意：
+ * - 父网格必须比子集网格存活更久，且在使用子集期间不能修改（修改后需要重新执行过滤器）
+ * - 缓存由互斥锁保护，多个线程可以同时在常量子集网格上访问
+ * - 修改 GetCells() 返回的单元数组只影响缓存，不改变选择
+ *
+ * 使用示例：
+ *   FSubsetMesh Hot = FThresholdFilter::Execute(Mesh, "Temperature", 350.0f, 500.0f);
+ *   for (uint32 i = 0; i < Hot.GetCellCount(); ++i)
+ *   {
+ *       const FCellView Cell = Hot.GetCellView(i);     // 零拷贝
+ *   }
+ *   IMesh Copy;
+ *   Hot.Materialize(Copy);                             // 需要独立网格时再拷贝
+ */
+class FSubsetMesh : public IMeshBase
+{
+public:
+    // ============================================================================
+    // 构造函数和析构函数
+    // ============================================================================
+
+    /** 默认构造函数（没有父网格的空子集） */
+    FSubsetMesh();
+
+    /**
+     * 构造子集网格
+     * @param InParent 父网格
+     * @param InSelectedCells 选中的父网格单元索引（超出范围时抛出 FInvalidArgumentException）
+     * @param InMeshName 网格名称（为空时使用父网格名称）
+     */
+    FSubsetMesh(const IMesh& InParent, TArray<uint32>&& InSelectedCells, const std::string& InMeshName = "");
+
+    FSubsetMesh(const FSubsetMesh&) = delete;
+    FSubsetMesh& operator=(const FSubsetMesh&) = delete;
+
+    /** 移动构造函数 */
+    FSubsetMesh(FSubsetMesh&& Other) noexcept;
+
+    /** 移动赋值 */
+    FSubsetMesh& operator=(FSubsetMesh&& Other) noexcept;
+
+    ~FSubsetMesh() override;
+
+    // ============================================================================
+    // 子集信息
+    // ============================================================================
+
+    /** 获取父网格（空子集时为 nullptr） */
+    [[nodiscard]] const IMesh* GetParent() const { return Parent; }
+
+    /** 获取选中的父网格单元索引 */
+    [[nodiscard]] const TArray<uint32>& GetSelectedCells() const { return SelectedCells; }
+
+    /** 获取子集单元对应的父网格单元索引 */
+    [[nodiscard]] uint32 GetParentCellIndex(uint32 Index) const { return SelectedCells[Index]; }
+
+    /** 获取子集单元的视图（直接指向父网格单元数组，不物化） */
+    [[nodiscard]] FCellView GetCellView(uint32 Index) const;
+
+    /** 单元数组是否已物化 */
+    [[nodiscard]] bool IsCellsMaterialized() const;
+
+    /**
+     * 释放物化的单元数组、单元场和顶点场副本（之后的访问重新物化）
+     * 注意：之前返回的单元数组和场指针失效
+     */
+    void ReleaseMaterialized();
+
+    /**
+     * 生成独立的网格
+     * @param OutMesh 输出网格（原有数据会被清空）
+     * @param bCompactVertices 是否只保留选中单元使用的顶点（为 false 时保留父网格的全部顶点）
+     * @param bParallel 是否并行执行
+     */
+    void Materialize(IMesh& OutMesh, bool bCompactVertices = true, bool bParallel = true) const;
+
+    // ============================================================================
+    // 几何数据访问（实现IMeshBase接口，直接使用父网格）
+    // ============================================================================
+
+    [[nodiscard]] uint32 GetVertexCount() const override;
+    [[nodiscard]] FVector GetVertexPosition(uint32 Index) const override;
+    [[nodiscard]] const FVector* GetVerticesPositionsPtr() const override;
+    [[nodiscard]] bool IsValidVertexIndex(uint32 Index) const override;
+
+    // ============================================================================
+    // 拓扑数据访问（实现IMeshBase接口）
+    // ============================================================================
+
+    [[nodiscard]] uint32 GetCellCount() const override;
+
+    /** 获取物化的单元数组（首次访问时构建） */
+    [[nodiscard]] FCellArray& GetCells() override;
+    [[nodiscard]] const FCellArray& GetCells() const override;
+
+    [[nodiscard]] bool IsValidCellIndex(uint32 Index) const override;
+
+    // ============================================================================
+    // 场数据访问（实现IMeshBase接口）
+    // ============================================================================
+
+    [[nodiscard]] FField* GetField(const std::string& FieldName) override;
+    [[nodiscard]] const FField* GetField(const std::string& FieldName) const override;
+    [[nodiscard]] bool HasField(const std::string& FieldName) const override;
+
+    /** 非常量访问返回子集自己的副本（首次访问时拷贝父网格的顶点场） */
+    [[nodiscard]] FField* GetVertexField(const std::string& FieldName) override;
+
+    /** 常量访问直接返回父网格的顶点场（已有副本时返回副本） */
+    [[nodiscard]] const FField* GetVertexField(const std::string& FieldName) const override;
+
+    /** 按选中单元收集的单元场（首次访问时物化） */
+    [[nodiscard]] FField* GetCellField(const std::string& FieldName) override;
+    [[nodiscard]] const FField* GetCellField(const std::string& FieldName) const override;
+
+    [[nodiscard]] bool HasVertexField(const std::string& FieldName) const override;
+
+    /** 父网格有该单元场且数量与父网格单元数一致时为 true（与 GetCellField 能否返回场一致） */
+    [[nodiscard]] bool HasCellField(const std::string& FieldName) const override;
+
+    // ============================================================================
+    // 元数据、验证、清空（实现IMeshBase接口）
+    // ============================================================================
+
+    [[nodiscard]] const std::string& GetMeshName() const override { return MeshName; }
+
+    /** 有父网格时有效 */
+    [[nodiscard]] bool IsValid() const override { return Parent != nullptr; }
+
+    /** 检查父网格有效且选中的单元索引都在父网格范围内 */
+    [[nodiscard]] bool Validate() const override;
+
+    /** 清空选择和缓存（保留父网格） */
+    void Clear() override;
+
+    /** 清空选择、缓存和父网格 */
+    void Reset() override;
+
+private:
+    /** 物化单元数组（只在检查和发布缓存时持有 CacheMutex，收集期间不持锁） */
+    FCellArray& MaterializeCells() const;
+
+    /** 物化单元场（加锁方式同 MaterializeCells，父网格没有该场时返回 nullptr） */
+    FField* MaterializeCellField(const std::string& FieldName) const;
+
+    /** 父网格 */
+    const IMesh* Parent;
+
+    /** 选中的父网格单元索引 */
+    TArray<uint32> SelectedCells;
+
+    /** 网格名称 */
+    std::string MeshName;
+
+    /** 物化的单元数组 */
+    mutable TUniquePtr<FCellArray> CellsCache;
+
+    /** 物化的单元场 */
+    mutable TMap<std::string, TUniquePtr<FField>> CellFieldsCache;
+
+    /** 顶点场副本（非常量访问时创建） */
+    TMap<std::string, TUniquePtr<FField>> VertexFieldCopies;
+
+    /** 保护缓存的互斥锁 */
+    mutable std::mutex CacheMutex;
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include "HAL/Platform.h"
+
+/**
+ * FFrameworkTaskQueue - Framework 线程任务队列
+ * 线程安全的任务队列，用于后台线程（任务图工作线程、加载线程等）把回调投递到 Framework 线程执行，
+ * 例如异步加载完成后在 Framework 线程上广播委托
+ *
+ * Framework 线程在每帧 Tick 开始时处理队列，单帧处理时间有预算，超出预算的任务留到下一帧，
+ * 大量投递不会拖慢帧率
+ */
+class FFrameworkTaskQueue
+{
+public:
+
+    FFrameworkTaskQueue(const FFrameworkTaskQueue&) = delete;
+    FFrameworkTaskQueue& operator=(const FFrameworkTaskQueue&) = delete;
+
+    /**
+     * 获取全局 Framework 任务队列单例
+     * @return 任务队列引用
+     */
+    static FFrameworkTaskQueue& Get();
+
+    /**
+     * 将任务添加到队列（可从任意线程调用）
+     * @param Task 要在 Framework 线程执行的任务
+     */
+    void EnqueueTask(std::function<void()> Task);
+
+    /**
+     * 按提交顺序执行队列中的任务（在 Framework 线程中调用）
+     * @param TimeBudgetSeconds 时间预算（秒），执行完一个任务后超出预算即停止，0 表示执行全部任务
+     * @return 执行的任务数量
+     */
+    uint32 ProcessTasks(double TimeBudgetSeconds = 0.0);
+
+    /**
+     * 获取队列中待处理的任务数量
+     * @return 任务数量
+     */
+    uint32 GetPendingTaskCount() const;
+
+    /**
+     * 清空所有待处理的任务
+     */
+    void Flush();
+
+private:
+    FFrameworkTaskQueue() = default;
+    ~FFrameworkTaskQueue() = default;
+
+
+    mutable std::mutex QueueMutex;
+    std::deque<std::function<void()>> TaskQueue;
+};
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "HAL/Platform.h"
+#include <filesystem>
+#include <string>
+
+// ============================================================================
+// 临时文件
+// ============================================================================
+
+/** 返回系统临时目录下名为 Name 的文件路径 */
+inline std::string GetTempFilePath(const std::string& Name)
+{
+    return (std::filesystem::temp_directory_path() / Name).string();
+}
+
+// ============================================================================
+// 规则六面体网格
+// ============================================================================
+
+/**
+ * 向 Cells 追加 N x N x N 的规则六面体单元
+ *
+ * 顶点 (x, y, z) 的编号为 (z * (N + 1) + y) * (N + 1) + x，单元按 z、y、x 的顺序排列
+ */
+inline void AppendHexGridCells(FCellArray& Cells, int32 N)
+{
+    auto Index = [N](int32 x, int32 y, int32 z) { return (z * (N + 1) + y) * (N + 1) + x; };
+    TArray<int32> Indices;
+    Indices.Reserve(N * N * N * 8);
+    for (int32 z = 0; z < N; ++z)
+    {
+        for (int32 y = 0; y < N; ++y)
+        {
+            for (int32 x = 0; x < N; ++x)
+            {
+                const int32 Hex[8] = {
+                    Index(x, y, z), Index(x + 1, y, z), Index(x + 1, y + 1, z), Index(x, y + 1, z),
+                    Index(x, y, z + 1), Index(x + 1, y, z + 1), Index(x + 1, y + 1, z + 1), Index(x, y + 1, z + 1) };
+                Indices.Append(Hex, 8);
+            }
+        }
+    }
+    Cells.AppendCells(ECellType::Hex, 8, std::move(Indices));
+}
+
+/**
+ * 生成 N x N x N 的规则六面体网格（顶点坐标为整数格点）
+ *
+ * 附带顶点场 "Index"（顶点编号）、"X"、"Y"（坐标分量）和单元场 "CellId"（单元编号）
+ */
+inline void BuildHexGridMesh(IMesh& Mesh, int32 N)
+{
+    TUniquePtr<FField> IndexField = MakeUnique<FField>("Index", EFieldType::Scalar, EFieldAttachment::Vertex);
+    TUniquePtr<FField> XField = MakeUnique<FField>("X", EFieldType::Scalar, EFieldAttachment::Vertex);
+    TUniquePtr<FField> YField = MakeUnique<FField>("Y", EFieldType::Scalar, EFieldAttachment::Vertex);
+    for (int32 z = 0; z <= N; ++z)
+    {
+        for (int32 y = 0; y <= N; ++y)
+        {
+            for (int32 x = 0; x <= N; ++x)
+            {
+                Mesh.AddVertexPosition(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+                IndexField->AddScalar(static_cast<float>(IndexField->GetDataCount()));
+                XField->AddScalar(static_cast<float>(x));
+                YField->AddScalar(static_cast<float>(y));
+            }
+        }
+    }
+
+    FCellArray& Cells = Mesh.GetCells();
+    AppendHexGridCells(Cells, N);
+    TUniquePtr<FField> CellIdField = MakeUnique<FField>("CellId", EFieldType::Scalar, EFieldAttachment::Cell);
+    for (uint32 i = 0; i < Cells.GetCellCount(); ++i)
+    {
+        CellIdField->AddScalar(static_cast<float>(i));
+    }
+
+    Mesh.AddField(std::move(IndexField));
+    Mesh.AddField(std::move(XField));
+    Mesh.AddField(std::move(YField));
+    Mesh.AddField(std::move(CellIdField));
+}
+
+// ============================================================================
+// 规则四边形网格
+// ============================================================================
+
+/**
+ * 构造 N x N 的四边形网格，带一个向量顶点场 "Velocity"
+ *
+ * @param bAddCellIds 是否附带 Int32 单元场 "CellId"（值为单元编号的 3 倍）；
+ *                    之后还要追加单元的网格不应附带，否则单元场大小与单元数不符
+ */
+inline void MakeQuadGrid(IMesh& Mesh, uint32 N, bool bAddCellIds = false)
+{
+    for (uint32 y = 0; y <= N; ++y)
+    {
+        for (uint32 x = 0; x <= N; ++x)
+        {
+            Mesh.AddVertexPosition(static_cast<float>(x), static_cast<float>(y), 0.0f);
+        }
+    }
+    TArray<int32> Indices;
+    for (uint32 y = 0; y < N; ++y)
+    {
+        for (uint32 x = 0; x < N; ++x)
+        {
+            const int32 V0 = static_cast<int32>(y * (N + 1) + x);
+            Indices.Append(TArray<int32>{ V0, V0 + 1, V0 + static_cast<int32>(N) + 2, V0 + static_cast<int32>(N) + 1 });
+        }
+    }
+    Mesh.GetCells().AppendCells(ECellType::Quad, 4, std::move(Indices));
+
+    TUniquePtr<FField> Velocity = MakeUnique<FField>("Velocity", EFieldType::Vector, EFieldAttachment::Vertex);
+    for (uint32 i = 0; i < Mesh.GetVertexCount(); ++i)
+    {
+        Velocity->AddVector(FVector(static_cast<float>(i), 1.0f, -static_cast<float>(i)));
+    }
+    Mesh.AddField(std::move(Velocity));
+
+    if (bAddCellIds)
+    {
+        TArray<int32> Ids;
+        for (uint32 i = 0; i < Mesh.GetCellCount(); ++i)
+        {
+            Ids.Add(static_cast<int32>(i * 3));
+        }
+        TUniquePtr<FField> CellId = MakeUnique<FField>("CellId", EFieldType::Scalar, EFieldAttachment::Cell);
+        CellId->SetTypedData(Ids);
+        Mesh.AddField(std::move(CellId));
+    }
+}
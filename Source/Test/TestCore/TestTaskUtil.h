@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include "Container/Array.h"
+#include "Container/ArrayView.h"
+#include "Threading/TaskGraph.h"
+#include "HAL/Platform.h"
+
+/**
+ * 在调用线程与任务中同时执行查询，用于检查按需构建的缓存不会在持锁时调用 ParallelFor
+ *
+ * 先用休眠任务占满所有工作线程，再提交 QueryCount 个查询任务（留在注入队列中），
+ * 最后在调用线程上执行一次查询：查询内部的并行等待会帮助执行队列中的查询任务，
+ * 若构建缓存时持有锁，同一线程再次加锁会死锁
+ *
+ * @param QueryCount 查询任务数量
+ * @param Query 查询函数，参数为查询序号（调用线程的查询序号为 QueryCount）
+ *
+ * 使用示例：
+ *   RunQueriesWithBusyWorkers(64, [&](uint32 i) { (void)Mesh.GetCellsUsingVertex(i); });
+ */
+inline void RunQueriesWithBusyWorkers(uint32 QueryCount, const std::function<void(uint32)>& Query)
+{
+    FTaskGraph& Graph = FTaskGraph::Get();
+    const uint32 NumWorkers = Graph.GetNumWorkerThreads();
+
+    std::atomic<uint32> StartedWorkers{0};
+    TArray<FTaskHandle> Tasks;
+    for (uint32 i = 0; i < NumWorkers; ++i)
+    {
+        Tasks.Add(Graph.Launch([&StartedWorkers]()
+        {
+            ++StartedWorkers;
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }));
+    }
+    while (StartedWorkers.load() < NumWorkers)
+    {
+        std::this_thread::yield();
+    }
+
+    for (uint32 i = 0; i < QueryCount; ++i)
+    {
+        Tasks.Add(Graph.Launch([&Query, i]() { Query(i); }));
+    }
+    Query(QueryCount);
+    Graph.WaitAll(TArrayView<const FTaskHandle>(Tasks.GetData(), Tasks.Num()));
+}
@@ -32,3 +32,20 @@ TEST(FindAndRemove)
     ASSERT(Array[1] == 3);
 }
 
+
+// 对齐数组测试
+TEST(AlignedArray)
+{
+    TAlignedArray<float, 64> Array;
+    for (int i = 0; i < 100; ++i)
+    {
+        Array.Add(static_cast<float>(i));
+        ASSERT(reinterpret_cast<uintptr_t>(Array.GetData()) % 64 == 0);
+    }
+    ASSERT(Array.Num() == 100);
+    ASSERT(Array[99] == 99.0f);
+
+    TAlignedArray<float, 64> Copy(Array);
+    ASSERT(reinterpret_cast<uintptr_t>(Copy.GetData()) % 64 == 0);
+    ASSERT(Copy[50] == 50.0f);
+}
@@ -644,4 +644,435 @@ TEST(CellArray_IsEmpty)
 
     ASSERT(!Array.IsEmpty());
     ASSERT(Array.GetCellCount() == 1);
-}
\ No newline at end of file
+}
+// ============================================================================
+// 均质存储测试
+// ============================================================================
+
+TEST(CellArray_Uniform_Storage)
+{
+    FCellArray Array;
+    ASSERT(Array.IsUniform());
+    ASSERT(Array.GetUniformCellType() == ECellType::None);
+
+    // 纯四面体网格保持均质存储
+    for (int i = 0; i < 10; ++i)
+    {
+        int32 TetraIndices[4] = {i * 4 + 0, i * 4 + 1, i * 4 + 2, i * 4 + 3};
+        Array.AddCell(ECellType::Tetra, TetraIndices, 4);
+    }
+
+    ASSERT(Array.IsUniform());
+    ASSERT(Array.GetUniformCellType() == ECellType::Tetra);
+    ASSERT(Array.GetUniformStride() == 4);
+    ASSERT(Array.GetCellCount() == 10);
+    ASSERT(Array.GetCellType(7) == ECellType::Tetra);
+    ASSERT(Array.GetCellVertexCount(7) == 4);
+    ASSERT(Array.GetCellCountByType(ECellType::Tetra) == 10);
+
+    uint32 VertexCount = 0;
+    const int32* Ptr = Array.GetCellVertexIndicesPtr(7, VertexCount);
+    ASSERT(Ptr != nullptr);
+    ASSERT(VertexCount == 4);
+    ASSERT(Ptr[0] == 28);
+    ASSERT(Ptr[3] == 31);
+
+    // 删除单元后仍保持均质存储
+    ASSERT(Array.RemoveCells(2, 3) == 3);
+    ASSERT(Array.IsUniform());
+    ASSERT(Array.GetCellCount() == 7);
+    Ptr = Array.GetCellVertexIndicesPtr(2, VertexCount);
+    ASSERT(Ptr[0] == 20);
+}
+
+TEST(CellArray_Uniform_FallbackToMixed)
+{
+    FCellArray Array;
+    Array.AddCell(ECellType::Tetra, TArray<int32>{0, 1, 2, 3});
+    Array.AddCell(ECellType::Tetra, TArray<int32>{4, 5, 6, 7});
+    ASSERT(Array.IsUniform());
+
+    // 添加不同类型的单元，自动转换为混合存储
+    Array.AddCell(ECellType::Triangle, TArray<int32>{8, 9, 10});
+    ASSERT(!Array.IsUniform());
+    ASSERT(Array.GetUniformCellType() == ECellType::None);
+    ASSERT(Array.GetCellCount() == 3);
+    ASSERT(Array.GetCellType(0) == ECellType::Tetra);
+    ASSERT(Array.GetCellType(1) == ECellType::Tetra);
+    ASSERT(Array.GetCellType(2) == ECellType::Triangle);
+    ASSERT(Array.GetCellVertexCount(1) == 4);
+    ASSERT(Array.GetCellVertexCount(2) == 3);
+
+    TArray<int32> OutIndices;
+    ASSERT(Array.GetCellVertexIndices(1, OutIndices));
+    ASSERT(OutIndices[0] == 4);
+    ASSERT(Array.GetCellVertexIndices(2, OutIndices));
+    ASSERT(OutIndices[2] == 10);
+
+    // 删除唯一的三角形后，Compact 恢复均质存储
+    ASSERT(Array.RemoveCell(2));
+    ASSERT(!Array.IsUniform());
+    Array.Compact();
+    ASSERT(Array.IsUniform());
+    ASSERT(Array.GetUniformCellType() == ECellType::Tetra);
+    ASSERT(Array.GetCellCount() == 2);
+    ASSERT(Array.GetCellVertexIndices(1, OutIndices));
+    ASSERT(OutIndices[3] == 7);
+
+    // 清空后重新回到均质存储
+    Array.AddCell(ECellType::Hex, TArray<int32>{0, 1, 2, 3, 4, 5, 6, 7});
+    ASSERT(!Array.IsUniform());
+    Array.Clear();
+    ASSERT(Array.IsUniform());
+    Array.AddCell(ECellType::Hex, TArray<int32>{0, 1, 2, 3, 4, 5, 6, 7});
+    ASSERT(Array.IsUniform());
+    ASSERT(Array.GetUniformStride() == 8);
+}
+
+// ============================================================================
+// 批量导入测试
+// ============================================================================
+
+TEST(CellArray_AppendCells_Uniform)
+{
+    FCellArray Array;
+
+    // 同一类型批量导入
+    int32 TetraIndices[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    Array.AppendCells(ECellType::Tetra, 4, TetraIndices, 3);
+    ASSERT(Array.GetCellCount() == 3);
+    ASSERT(Array.IsUniform());
+    ASSERT(Array.GetVertexIndexCount() == 12);
+
+    Array.AppendCells(ECellType::Tetra, 4, TetraIndices, 2);
+    ASSERT(Array.GetCellCount() == 5);
+    ASSERT(Array.IsUniform());
+
+    uint32 VertexCount = 0;
+    const int32* Ptr = Array.GetCellVertexIndicesPtr(4, VertexCount);
+    ASSERT(VertexCount == 4);
+    ASSERT(Ptr[0] == 4);
+
+    // 不同类型批量导入转为混合存储
+    int32 TriangleIndices[6] = {20, 21, 22, 23, 24, 25};
+    Array.AppendCells(ECellType::Triangle, 3, TriangleIndices, 2);
+    ASSERT(!Array.IsUniform());
+    ASSERT(Array.GetCellCount() == 7);
+    ASSERT(Array.GetCellType(4) == ECellType::Tetra);
+    ASSERT(Array.GetCellType(6) == ECellType::Triangle);
+    Ptr = Array.GetCellVertexIndicesPtr(6, VertexCount);
+    ASSERT(VertexCount == 3);
+    ASSERT(Ptr[0] == 23);
+}
+
+TEST(CellArray_AppendCells_Mixed)
+{
+    FCellArray Array;
+    Array.AddCell(ECellType::Line, TArray<int32>{100, 101});
+
+    // 偏移数组不必从 0 开始
+    ECellType Types[3] = {ECellType::Triangle, ECellType::Quad, ECellType::Triangle};
+    uint32 Offsets[4] = {2, 5, 9, 12};
+    int32 Indices[12] = {-1, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    Array.AppendCells(Types, Offsets, Indices, 3);
+
+    ASSERT(Array.GetCellCount() == 4);
+    ASSERT(Array.GetVertexIndexCount() == 12);
+    ASSERT(Array.GetCellType(0) == ECellType::Line);
+    ASSERT(Array.GetCellType(2) == ECellType::Quad);
+
+    TArray<int32> OutIndices;
+    ASSERT(Array.GetCellVertexIndices(1, OutIndices));
+    ASSERT(OutIndices.Num() == 3);
+    ASSERT(OutIndices[0] == 0);
+    ASSERT(Array.GetCellVertexIndices(2, OutIndices));
+    ASSERT(OutIndices.Num() == 4);
+    ASSERT(OutIndices[3] == 6);
+    ASSERT(Array.GetCellVertexIndices(3, OutIndices));
+    ASSERT(OutIndices[2] == 9);
+
+    // 空数组导入同一类型的单元时保持均质存储
+    FCellArray UniformArray;
+    ECellType QuadTypes[2] = {ECellType::Quad, ECellType::Quad};
+    uint32 QuadOffsets[3] = {0, 4, 8};
+    UniformArray.AppendCells(QuadTypes, QuadOffsets, Indices + 2, 2);
+    ASSERT(UniformArray.IsUniform());
+    ASSERT(UniformArray.GetUniformCellType() == ECellType::Quad);
+    ASSERT(UniformArray.GetCellCount() == 2);
+}
+
+TEST(CellArray_AppendCells_Move)
+{
+    // 空数组接管缓冲区
+    TArray<int32> Buffer{0, 1, 2, 3, 4, 5, 6, 7};
+    const int32* BufferData = Buffer.GetData();
+
+    FCellArray Array;
+    Array.AppendCells(ECellType::Tetra, 4, std::move(Buffer));
+    ASSERT(Array.GetCellCount() == 2);
+    ASSERT(Array.IsUniform());
+
+    uint32 VertexCount = 0;
+    ASSERT(Array.GetCellVertexIndicesPtr(0, VertexCount) == BufferData);
+
+    // 非空数组追加拷贝
+    Array.AppendCells(ECellType::Tetra, 4, TArray<int32>{8, 9, 10, 11});
+    ASSERT(Array.GetCellCount() == 3);
+
+    // 长度不是步长的倍数时抛出异常
+    bool bThrown = false;
+    try
+    {
+        Array.AppendCells(ECellType::Tetra, 4, TArray<int32>{0, 1, 2});
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+
+    // 混合类型接管缓冲区
+    FCellArray MixedArray;
+    MixedArray.AppendCells(TArray<ECellType>{ECellType::Triangle, ECellType::Quad},
+                           TArray<uint32>{0, 3, 7},
+                           TArray<int32>{0, 1, 2, 3, 4, 5, 6});
+    ASSERT(!MixedArray.IsUniform());
+    ASSERT(MixedArray.GetCellCount() == 2);
+    ASSERT(MixedArray.GetCellVertexCount(1) == 4);
+
+    // 实际为单一类型时转换为均质存储
+    FCellArray SingleTypeArray;
+    SingleTypeArray.AppendCells(TArray<ECellType>{ECellType::Triangle, ECellType::Triangle},
+                                TArray<uint32>{0, 3, 6},
+                                TArray<int32>{0, 1, 2, 3, 4, 5});
+    ASSERT(SingleTypeArray.IsUniform());
+    ASSERT(SingleTypeArray.GetUniformStride() == 3);
+}
+
+TEST(CellArray_AppendCells_InvalidArguments)
+{
+    FCellArray Array;
+    Array.AddCell(ECellType::Line, TArray<int32>{0, 1});
+    const int32 Indices[6] = {0, 1, 2, 3, 4, 5};
+
+    auto ExpectThrow = [](auto&& Function)
+    {
+        bool bThrown = false;
+        try
+        {
+            Function();
+        }
+        catch (const FInvalidArgumentException&)
+        {
+            bThrown = true;
+        }
+        return bThrown;
+    };
+
+    // 步长为 0：指针和移动两种重载都抛出异常
+    ASSERT(ExpectThrow([&] { Array.AppendCells(ECellType::Triangle, 0, Indices, 2); }));
+    ASSERT(ExpectThrow([&] { Array.AppendCells(ECellType::Triangle, 0, TArray<int32>{0, 1, 2}); }));
+
+    // 偏移不递增或单元没有顶点
+    const ECellType Types[2] = {ECellType::Triangle, ECellType::Triangle};
+    const uint32 DecreasingOffsets[3] = {0, 4, 3};
+    const uint32 EmptyCellOffsets[3] = {0, 3, 3};
+    ASSERT(ExpectThrow([&] { Array.AppendCells(Types, DecreasingOffsets, Indices, 2); }));
+    ASSERT(ExpectThrow([&] { Array.AppendCells(Types, EmptyCellOffsets, Indices, 2); }));
+    ASSERT(ExpectThrow([&]
+    {
+        FCellArray Empty;
+        Empty.AppendCells(TArray<ECellType>{ECellType::Triangle, ECellType::Triangle},
+                          TArray<uint32>{0, 3, 3},
+                          TArray<int32>{0, 1, 2});
+    }));
+
+    // 失败的导入不修改数组
+    ASSERT(Array.GetCellCount() == 1);
+    ASSERT(Array.GetVertexIndexCount() == 2);
+}
+
+// ============================================================================
+// 单元视图和遍历测试
+// ============================================================================
+
+TEST(CellArray_CellView)
+{
+    FCellArray Array;
+    Array.AddCell(ECellType::Triangle, TArray<int32>{0, 1, 2});
+    Array.AddCell(ECellType::Quad, TArray<int32>{3, 4, 5, 6});
+
+    FCellView View = Array.GetCellView(1);
+    ASSERT(View.IsValid());
+    ASSERT(View.CellType == ECellType::Quad);
+    ASSERT(View.Num() == 4);
+    ASSERT(View[0] == 3);
+    ASSERT(View[3] == 6);
+    ASSERT(View.Contains(5));
+    ASSERT(!View.Contains(0));
+    ASSERT(View.GetVertexIndices().Num() == 4);
+
+    // 视图直接指向内部存储
+    uint32 VertexCount = 0;
+    ASSERT(View.VertexIndices == Array.GetCellVertexIndicesPtr(1, VertexCount));
+
+    // 无效索引返回无效视图
+    FCellView InvalidView = Array.GetCellView(100);
+    ASSERT(!InvalidView.IsValid());
+    ASSERT(InvalidView.Num() == 0);
+}
+
+TEST(CellArray_RangeIteration)
+{
+    // 混合存储遍历
+    FCellArray MixedArray;
+    MixedArray.AddCell(ECellType::Line, TArray<int32>{0, 1});
+    MixedArray.AddCell(ECellType::Triangle, TArray<int32>{2, 3, 4});
+    MixedArray.AddCell(ECellType::Hex, TArray<int32>{5, 6, 7, 8, 9, 10, 11, 12});
+
+    uint32 CellCount = 0;
+    int32 IndexSum = 0;
+    uint32 VertexTotal = 0;
+    for (const FCellView Cell : MixedArray)
+    {
+        ASSERT(Cell.CellType == MixedArray.GetCellType(static_cast<int32>(CellCount)));
+        for (int32 VertexIndex : Cell)
+        {
+            IndexSum += VertexIndex;
+        }
+        VertexTotal += Cell.Num();
+        ++CellCount;
+    }
+    ASSERT(CellCount == 3);
+    ASSERT(VertexTotal == 13);
+    ASSERT(IndexSum == 78);
+
+    // 均质存储遍历
+    FCellArray UniformArray;
+    for (int32 i = 0; i < 5; ++i)
+    {
+        int32 TetraIndices[4] = {i, i + 1, i + 2, i + 3};
+        UniformArray.AddCell(ECellType::Tetra, TetraIndices, 4);
+    }
+
+    for (auto It = UniformArray.begin(); It != UniformArray.end(); ++It)
+    {
+        const FCellView Cell = *It;
+        ASSERT(Cell.CellType == ECellType::Tetra);
+        ASSERT(Cell.Num() == 4);
+        ASSERT(Cell[0] == It.GetIndex());
+    }
+
+    // 空数组不进入循环
+    FCellArray EmptyArray;
+    ASSERT(EmptyArray.begin() == EmptyArray.end());
+    uint32 EmptyVisited = 0;
+    for (const FCellView Cell : EmptyArray)
+    {
+        EmptyVisited += Cell.Num() + 1;
+    }
+    ASSERT(EmptyVisited == 0);
+}
+
+// ============================================================================
+// 批量删除和压缩测试
+// ============================================================================
+
+TEST(CellArray_RemoveCellsIf_Mixed)
+{
+    FCellArray Array;
+    Array.AddCell(ECellType::Line, TArray<int32>{0, 1});
+    Array.AddCell(ECellType::Triangle, TArray<int32>{2, 3, 4});
+    Array.AddCell(ECellType::Line, TArray<int32>{5, 6});
+    Array.AddCell(ECellType::Quad, TArray<int32>{7, 8, 9, 10});
+    Array.AddCell(ECellType::Line, TArray<int32>{11, 12});
+
+    TArray<int32> Remap;
+    uint32 RemovedCount = Array.RemoveCellsIf([](int32, const FCellView& Cell)
+    {
+        return Cell.CellType == ECellType::Line;
+    }, &Remap);
+
+    ASSERT(RemovedCount == 3);
+    ASSERT(Array.GetCellCount() == 2);
+    ASSERT(Array.GetVertexIndexCount() == 7);
+    ASSERT(!Array.IsUniform());
+
+    ASSERT(Remap.Num() == 5);
+    ASSERT(Remap[0] == FCellArray::InvalidCellIndex);
+    ASSERT(Remap[1] == 0);
+    ASSERT(Remap[2] == FCellArray::InvalidCellIndex);
+    ASSERT(Remap[3] == 1);
+    ASSERT(Remap[4] == FCellArray::InvalidCellIndex);
+
+    FCellView Cell = Array.GetCellView(1);
+    ASSERT(Cell.CellType == ECellType::Quad);
+    ASSERT(Cell.Num() == 4);
+    ASSERT(Cell[0] == 7);
+    ASSERT(Cell[3] == 10);
+
+    // 剩余单元为单一类型时恢复均质存储
+    Array.KeepCellsIf([](int32 CellIndex, const FCellView&)
+    {
+        return CellIndex == 1;
+    });
+    ASSERT(Array.IsUniform());
+    ASSERT(Array.GetUniformCellType() == ECellType::Quad);
+    ASSERT(Array.GetCellView(0)[0] == 7);
+}
+
+TEST(CellArray_KeepCellsIf_Uniform)
+{
+    FCellArray Array;
+    for (int32 i = 0; i < 10; ++i)
+    {
+        int32 TetraIndices[4] = {i * 4, i * 4 + 1, i * 4 + 2, i * 4 + 3};
+        Array.AddCell(ECellType::Tetra, TetraIndices, 4);
+    }
+
+    // 只保留偶数单元
+    TArray<int32> Remap;
+    uint32 RemovedCount = Array.KeepCellsIf([](int32 CellIndex, const FCellView&)
+    {
+        return CellIndex % 2 == 0;
+    }, &Remap);
+
+    ASSERT(RemovedCount == 5);
+    ASSERT(Array.GetCellCount() == 5);
+    ASSERT(Array.IsUniform());
+    ASSERT(Array.GetVertexIndexCount() == 20);
+    ASSERT(Remap[4] == 2);
+    ASSERT(Remap[5] == FCellArray::InvalidCellIndex);
+    ASSERT(Array.GetCellView(2)[0] == 16);
+
+    // 全部删除
+    Array.RemoveCellsIf([](int32, const FCellView&) { return true; });
+    ASSERT(Array.IsEmpty());
+    ASSERT(Array.GetVertexIndexCount() == 0);
+}
+
+TEST(CellArray_RemoveCellsByType_Large)
+{
+    // 大量混合单元按类型删除应为线性复杂度
+    FCellArray Array;
+    const int32 CellCount = 200000;
+    for (int32 i = 0; i < CellCount; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            int32 LineIndices[2] = {i, i + 1};
+            Array.AddCell(ECellType::Line, LineIndices, 2);
+        }
+        else
+        {
+            int32 TriangleIndices[3] = {i, i + 1, i + 2};
+            Array.AddCell(ECellType::Triangle, TriangleIndices, 3);
+        }
+    }
+
+    uint32 RemovedCount = Array.RemoveCellsByType(ECellType::Line);
+    ASSERT(RemovedCount == CellCount / 2);
+    ASSERT(Array.GetCellCount() == CellCount / 2);
+    ASSERT(Array.IsUniform());
+    ASSERT(Array.GetCellView(0)[0] == 1);
+}
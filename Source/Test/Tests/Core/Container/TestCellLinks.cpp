@@ -0,0 +1,128 @@
+#include "TestFramework.h"
+#include "Container/CellArray.h"
+#include "Container/CellLinks.h"
+
+TEST_GROUP(TestCellLinks)
+
+// ============================================================================
+// 基本构建和查询
+// ============================================================================
+
+TEST(CellLinks_Build)
+{
+    FCellArray Cells;
+    Cells.AddCell(ECellType::Triangle, TArray<int32>{0, 1, 2});
+    Cells.AddCell(ECellType::Triangle, TArray<int32>{1, 3, 2});
+    Cells.AddCell(ECellType::Quad, TArray<int32>{2, 3, 4, 5});
+
+    FCellLinks Links;
+    Links.Build(Cells, 7, false);
+
+    ASSERT(Links.GetVertexCount() == 7);
+    ASSERT(Links.GetLinkCount() == 10);
+
+    ASSERT(Links.GetCellCount(0) == 1);
+    ASSERT(Links.GetCells(0)[0] == 0);
+
+    TArrayView<const int32> Vertex2 = Links.GetCells(2);
+    ASSERT(Vertex2.Num() == 3);
+    ASSERT(Vertex2[0] == 0);
+    ASSERT(Vertex2[1] == 1);
+    ASSERT(Vertex2[2] == 2);
+
+    // 未被使用的顶点和越界顶点
+    ASSERT(Links.GetCells(6).IsEmpty());
+    ASSERT(Links.GetCells(100).IsEmpty());
+}
+
+TEST(CellLinks_DuplicateAndInvalidVertices)
+{
+    FCellArray Cells;
+    Cells.AddCell(ECellType::Polygon, TArray<int32>{0, 1, 1, 2, 0});
+    Cells.AddCell(ECellType::Triangle, TArray<int32>{2, 3, 9});
+    Cells.AddCell(ECellType::Line, TArray<int32>{-1, 3});
+
+    FCellLinks Links;
+    Links.Build(Cells, 4);
+
+    ASSERT(Links.GetCellCount(0) == 1);
+    ASSERT(Links.GetCellCount(1) == 1);
+    ASSERT(Links.GetCellCount(2) == 2);
+    ASSERT(Links.GetCellCount(3) == 2);
+    ASSERT(Links.GetLinkCount() == 6);
+}
+
+// ============================================================================
+// 并行构建与串行构建结果一致
+// ============================================================================
+
+TEST(CellLinks_ParallelMatchesSerial)
+{
+    // 规则三角形网格：(N + 1) x (N + 1) 个顶点，2 x N x N 个三角形
+    constexpr int32 N = 200;
+    FCellArray Cells;
+    Cells.Reserve(2 * N * N, 6 * N * N);
+    for (int32 y = 0; y < N; ++y)
+    {
+        for (int32 x = 0; x < N; ++x)
+        {
+            const int32 V0 = y * (N + 1) + x;
+            const int32 V1 = V0 + 1;
+            const int32 V2 = V0 + N + 1;
+            const int32 V3 = V2 + 1;
+            Cells.AddCell(ECellType::Triangle, TArray<int32>{V0, V1, V3});
+            Cells.AddCell(ECellType::Triangle, TArray<int32>{V0, V3, V2});
+        }
+    }
+
+    const uint32 VertexCount = (N + 1) * (N + 1);
+    FCellLinks Serial;
+    FCellLinks Parallel;
+    Serial.Build(Cells, VertexCount, false);
+    Parallel.Build(Cells, VertexCount, true);
+
+    ASSERT(Serial.GetLinkCount() == 6 * N * N);
+    ASSERT(Serial.GetOffsets() == Parallel.GetOffsets());
+    ASSERT(Serial.GetLinks() == Parallel.GetLinks());
+
+    // 内部顶点被 6 个三角形共享
+    ASSERT(Serial.GetCellCount((N + 1) + 1) == 6);
+
+    // 与逐单元扫描的结果一致
+    TArray<int32> Expected;
+    Cells.FindCellsContainingVertex(N + 2, Expected);
+    TArrayView<const int32> Actual = Parallel.GetCells(N + 2);
+    ASSERT(Actual.Num() == Expected.Num());
+    for (uint32 i = 0; i < Actual.Num(); ++i)
+    {
+        ASSERT(Actual[i] == Expected[i]);
+    }
+}
+
+// ============================================================================
+// 单元数组版本号
+// ============================================================================
+
+TEST(CellLinks_CellArrayVersion)
+{
+    FCellArray Cells;
+    const uint64 InitialVersion = Cells.GetVersion();
+
+    Cells.AddCell(ECellType::Line, TArray<int32>{0, 1});
+    const uint64 AfterAdd = Cells.GetVersion();
+    ASSERT(AfterAdd != InitialVersion);
+
+    // 只读操作不改变版本号
+    FCellInfo Info;
+    Cells.GetCell(0, Info);
+    ASSERT(Cells.GetVersion() == AfterAdd);
+
+    Cells.RemoveCell(0);
+    ASSERT(Cells.GetVersion() != AfterAdd);
+
+    // 不同实例的版本号互不相同
+    FCellArray Other;
+    ASSERT(Other.GetVersion() != Cells.GetVersion());
+    Other = Cells;
+    ASSERT(Other.GetVersion() != Cells.GetVersion());
+}
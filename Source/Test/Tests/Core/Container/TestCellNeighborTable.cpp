@@ -0,0 +1,106 @@
+#include "TestFramework.h"
+#include "TestMeshUtil.h"
+#include "Container/CellArray.h"
+#include "Container/CellNeighborTable.h"
+
+TEST_GROUP(TestCellNeighborTable)
+
+// ============================================================================
+// 基本邻接关系
+// ============================================================================
+
+TEST(CellNeighborTable_TwoTetras)
+{
+    FCellArray Cells;
+    Cells.AddCell(ECellType::Tetra, TArray<int32>{0, 1, 2, 3});
+    Cells.AddCell(ECellType::Tetra, TArray<int32>{2, 1, 0, 4});
+
+    FCellNeighborTable Table;
+    Table.Build(Cells, false);
+
+    ASSERT(Table.GetCellCount() == 2);
+    ASSERT(Table.GetTotalFaceCount() == 8);
+    ASSERT(Table.GetBoundaryFaceCount() == 6);
+
+    // 第一个四面体的面 3 (0,2,1) 与第二个四面体的面 3 (2,0,1) 共享
+    ASSERT(Table.GetNeighbor(0, 3) == 1);
+    ASSERT(Table.GetNeighbor(1, 3) == 0);
+    ASSERT(Table.IsBoundaryFace(0, 0));
+    ASSERT(Table.GetNeighbor(5, 0) == FCellNeighborTable::NoNeighbor);
+}
+
+TEST(CellNeighborTable_Mixed)
+{
+    FCellArray Cells;
+    // 六面体与金字塔共享四边形面 (4,5,6,7)
+    Cells.AddCell(ECellType::Hex, TArray<int32>{0, 1, 2, 3, 4, 5, 6, 7});
+    Cells.AddCell(ECellType::Pyramid, TArray<int32>{4, 5, 6, 7, 8});
+    // 金字塔与四面体共享三角形面 (4,5,8)
+    Cells.AddCell(ECellType::Tetra, TArray<int32>{4, 5, 8, 9});
+    // 三角形边 (4,5) 不与任何三维单元的面配对
+    Cells.AddCell(ECellType::Triangle, TArray<int32>{4, 5, 10});
+
+    FCellNeighborTable Table;
+    Table.Build(Cells);
+
+    ASSERT(Table.GetFaceCount(0) == 6);
+    ASSERT(Table.GetFaceCount(1) == 5);
+    ASSERT(Table.GetFaceCount(3) == 3);
+    ASSERT(Table.GetNeighbor(0, 5) == 1);
+    ASSERT(Table.GetNeighbor(1, 0) == 0);
+    ASSERT(Table.GetNeighbor(1, 1) == 2);
+
+    TArrayView<const int32> TriangleNeighbors = Table.GetNeighbors(3);
+    ASSERT(TriangleNeighbors.Num() == 3);
+    ASSERT(!TriangleNeighbors.Contains(0) && !TriangleNeighbors.Contains(1) && !TriangleNeighbors.Contains(2));
+}
+
+TEST(CellNeighborTable_SurfaceEdges)
+{
+    // 两个三角形和一个四边形组成的平面网格
+    FCellArray Cells;
+    Cells.AddCell(ECellType::Triangle, TArray<int32>{0, 1, 2});
+    Cells.AddCell(ECellType::Triangle, TArray<int32>{2, 1, 3});
+    Cells.AddCell(ECellType::Quad, TArray<int32>{1, 4, 5, 3});
+
+    FCellNeighborTable Table;
+    Table.Build(Cells);
+
+    ASSERT(Table.GetNeighbor(0, 1) == 1);
+    ASSERT(Table.GetNeighbor(1, 0) == 0);
+    ASSERT(Table.GetNeighbor(1, 1) == 2);
+    ASSERT(Table.GetNeighbor(2, 3) == 1);
+    ASSERT(Table.GetBoundaryFaceCount() == 6);
+}
+
+// ============================================================================
+// 规则网格与并行构建
+// ============================================================================
+
+TEST(CellNeighborTable_HexGrid)
+{
+    constexpr int32 N = 24;
+    FCellArray Cells;
+    AppendHexGridCells(Cells, N);
+    ASSERT(Cells.IsUniform());
+
+    FCellNeighborTable Serial;
+    FCellNeighborTable Parallel;
+    Serial.Build(Cells, false);
+    Parallel.Build(Cells, true);
+
+    ASSERT(Serial.GetTotalFaceCount() == 6 * N * N * N);
+    ASSERT(Serial.GetBoundaryFaceCount() == 6 * N * N);
+    ASSERT(Serial.GetNeighborArray() == Parallel.GetNeighborArray());
+
+    // 内部单元的六个面都有相邻单元
+    const uint32 Center = (N / 2 * N + N / 2) * N + N / 2;
+    TArrayView<const int32> Neighbors = Parallel.GetNeighbors(Center);
+    ASSERT(Neighbors.Num() == 6);
+    ASSERT(Neighbors[0] == static_cast<int32>(Center - 1));
+    ASSERT(Neighbors[1] == static_cast<int32>(Center + 1));
+    ASSERT(Neighbors[2] == static_cast<int32>(Center - N));
+    ASSERT(Neighbors[3] == static_cast<int32>(Center + N));
+    ASSERT(Neighbors[4] == static_cast<int32>(Center - N * N));
+    ASSERT(Neighbors[5] == static_cast<int32>(Center + N * N));
+}
@@ -1,6 +1,10 @@
 #include "TestFramework.h"
 #include "Field/Field.h"
 #include "Math/Math.h"
+#include "Exception/Exception.h"
+#include "TestTaskUtil.h"
+#include <atomic>
+#include <cmath>
 
 TEST_GROUP(TestField)
 
@@ -343,6 +347,34 @@ TEST(Field_Resize)
     ASSERT(VectorField.GetRawDataSize() == 3 * 3 * sizeof(float));
 }
 
+TEST(Field_CompactData)
+{
+    FField VectorField("Vel", EFieldType::Vector, EFieldAttachment::Cell);
+    for (int i = 0; i < 5; ++i)
+    {
+        VectorField.AddVector(FVector(static_cast<float>(i), static_cast<float>(i * 10), 0.0f));
+    }
+
+    // 删除索引 0 和 3
+    VectorField.CompactData(TArray<int32>{-1, 0, 1, -1, 2});
+    ASSERT(VectorField.GetDataCount() == 3);
+    ASSERT(VectorField.GetVector(0).X == 1.0f);
+    ASSERT(VectorField.GetVector(1).Y == 20.0f);
+    ASSERT(VectorField.GetVector(2).X == 4.0f);
+
+    // 映射表长度不匹配或打乱顺序时抛出异常
+    bool bThrown = false;
+    try
+    {
+        VectorField.CompactData(TArray<int32>{1, 0, 2});
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+}
+
 // ============================================================================
 // 底层数据访问测试
 // ============================================================================
@@ -450,3 +482,287 @@ TEST(Field_Performance_GetVector)
     //Timer.Print();
 }
 
+
+// ============================================================================
+// 数据范围测试
+// ============================================================================
+
+TEST(Field_DataRange_Compute)
+{
+    // 空场没有范围
+    FField Empty("Empty", EFieldType::Scalar, EFieldAttachment::Vertex);
+    float Min = 0.0f, Max = 0.0f;
+    ASSERT(!Empty.GetDataRange(0, Min, Max));
+    ASSERT(!Empty.IsDataRangeValid());
+
+    FField ScalarField("Temp", EFieldType::Scalar, EFieldAttachment::Vertex);
+    ScalarField.SetScalarData(TArray<float>{3.0f, -5.0f, 2.0f, 4.0f});
+    ASSERT(!ScalarField.IsDataRangeValid());
+    ASSERT(ScalarField.GetDataRange(0, Min, Max));
+    ASSERT(ScalarField.IsDataRangeValid());
+    ASSERT_EQ(Min, -5.0f);
+    ASSERT_EQ(Max, 4.0f);
+    ASSERT(ScalarField.GetDataRange(FField::MagnitudeComponent, Min, Max));
+    ASSERT_EQ(Min, 2.0f);
+    ASSERT_EQ(Max, 5.0f);
+    ASSERT(!ScalarField.GetDataRange(1, Min, Max));
+
+    FField VectorField("Vel", EFieldType::Vector, EFieldAttachment::Vertex);
+    VectorField.SetVectorData(TArray<float>{3.0f, 4.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f, -6.0f, 8.0f});
+    ASSERT(VectorField.GetDataRange(1, Min, Max));
+    ASSERT_EQ(Min, -6.0f);
+    ASSERT_EQ(Max, 4.0f);
+    ASSERT(VectorField.GetDataRange(FField::MagnitudeComponent, Min, Max));
+    ASSERT(FMath::IsNearlyEqual(Min, 1.0f));
+    ASSERT(FMath::IsNearlyEqual(Max, 10.0f));
+
+    // 多个归约区间（张量场，超过一个区间的元素数量）
+    const uint32 Count = 20000;
+    TArray<float> TensorData;
+    TensorData.Resize(Count * 9);
+    for (uint32 i = 0; i < Count * 9; ++i)
+    {
+        TensorData[i] = static_cast<float>(i % 1000) - 500.0f;
+    }
+    TensorData[12345 * 9 + 4] = 1.0e4f;
+    FField TensorField("Stress", EFieldType::Tensor, EFieldAttachment::Cell);
+    TensorField.SetTensorData(std::move(TensorData));
+    ASSERT(TensorField.GetDataRange(4, Min, Max));
+    ASSERT_EQ(Min, -500.0f);
+    ASSERT_EQ(Max, 1.0e4f);
+    ASSERT(TensorField.GetDataRange(FField::MagnitudeComponent, Min, Max));
+    ASSERT(Max > 1.0e4f);
+}
+
+TEST(Field_DataRange_Update)
+{
+    FField ScalarField("Temp", EFieldType::Scalar, EFieldAttachment::Vertex);
+    ScalarField.SetScalarData(TArray<float>{1.0f, 2.0f, 3.0f});
+    float Min = 0.0f, Max = 0.0f;
+    ASSERT(ScalarField.GetDataRange(0, Min, Max));
+
+    // 添加和向外扩展的修改增量更新，缓存保持有效
+    ScalarField.AddScalar(10.0f);
+    ScalarField.SetScalar(1, -4.0f);
+    ASSERT(ScalarField.IsDataRangeValid());
+    ASSERT(ScalarField.GetDataRange(0, Min, Max));
+    ASSERT_EQ(Min, -4.0f);
+    ASSERT_EQ(Max, 10.0f);
+
+    // 边界值向内移动时缓存失效，重新计算得到正确结果
+    ScalarField.SetScalar(3, 0.0f);
+    ASSERT(!ScalarField.IsDataRangeValid());
+    ASSERT(ScalarField.GetDataRange(0, Min, Max));
+    ASSERT_EQ(Max, 3.0f);
+    ASSERT(ScalarField.GetDataRange(FField::MagnitudeComponent, Min, Max));
+    ASSERT_EQ(Min, 0.0f);
+    ASSERT_EQ(Max, 4.0f);
+
+    // 整体修改数据使缓存失效
+    ScalarField.Resize(2);
+    ASSERT(!ScalarField.IsDataRangeValid());
+    ASSERT(ScalarField.GetDataRange(0, Min, Max));
+    ScalarField.GetFieldData()[0] = 100.0f;
+    ASSERT(!ScalarField.IsDataRangeValid());
+    ASSERT(ScalarField.GetDataRange(0, Min, Max));
+    ASSERT_EQ(Max, 100.0f);
+
+    // 向量场的增量更新
+    FField VectorField("Vel", EFieldType::Vector, EFieldAttachment::Vertex);
+    VectorField.AddVector(FVector(1.0f, 0.0f, 0.0f));
+    ASSERT(VectorField.GetDataRange(FField::MagnitudeComponent, Min, Max));
+    VectorField.AddVector(FVector(0.0f, 3.0f, 4.0f));
+    ASSERT(VectorField.IsDataRangeValid());
+    ASSERT(VectorField.GetDataRange(FField::MagnitudeComponent, Min, Max));
+    ASSERT_EQ(Min, 1.0f);
+    ASSERT_EQ(Max, 5.0f);
+
+    // 拷贝保留缓存，修改副本不影响原场
+    FField Copy = VectorField;
+    ASSERT(Copy.IsDataRangeValid());
+    Copy.Clear();
+    ASSERT(!Copy.IsDataRangeValid());
+    ASSERT(VectorField.IsDataRangeValid());
+    FField Moved = std::move(VectorField);
+    ASSERT(Moved.IsDataRangeValid());
+    ASSERT(Moved.GetDataRange(2, Min, Max));
+    ASSERT_EQ(Max, 4.0f);
+}
+
+TEST(Field_DataRange_FromTasks)
+{
+    // 多个任务同时触发数据范围的并行计算：计算期间等待的线程可能执行其他查询任务，不能持锁计算
+    TArray<float> Values;
+    Values.Resize(1 << 20);
+    for (uint32 i = 0; i < Values.Num(); ++i)
+    {
+        Values[i] = static_cast<float>(i % 1000);
+    }
+    FField ScalarField("Temp", EFieldType::Scalar, EFieldAttachment::Vertex);
+    ScalarField.SetScalarData(std::move(Values));
+
+    std::atomic<uint32> ValidCount{0};
+    RunQueriesWithBusyWorkers(64, [&](uint32)
+    {
+        float Min = 0.0f, Max = 0.0f;
+        if (ScalarField.GetDataRange(0, Min, Max) && Min == 0.0f && Max == 999.0f)
+        {
+            ++ValidCount;
+        }
+    });
+    ASSERT_EQ(ValidCount.load(), 65u);
+    ASSERT(ScalarField.IsDataRangeValid());
+}
+
+// ============================================================================
+// 存储类型测试
+// ============================================================================
+
+TEST(Field_Storage_Float16)
+{
+    // 可精确表示的值往返不变
+    for (float Value : { 0.0f, 1.0f, -2.5f, 65504.0f, 0.000061035156f, 0.000000059604645f })
+    {
+        ASSERT_EQ(static_cast<float>(FFloat16(Value)), Value);
+    }
+
+    // 就近舍入（偶数优先）、溢出与下溢
+    ASSERT_EQ(static_cast<float>(FFloat16(1.0f + 1.0f / 2048.0f)), 1.0f);
+    ASSERT_EQ(static_cast<float>(FFloat16(1.0f + 3.0f / 2048.0f)), 1.0f + 1.0f / 512.0f);
+    ASSERT_EQ(static_cast<float>(FFloat16(1.0f + 3.0f / 4096.0f)), 1.0f + 1.0f / 1024.0f);
+    ASSERT(std::isinf(static_cast<float>(FFloat16(70000.0f))));
+    ASSERT_EQ(static_cast<float>(FFloat16(1.0e-9f)), 0.0f);
+    ASSERT(std::isnan(static_cast<float>(FFloat16(std::nanf("")))));
+}
+
+TEST(Field_Storage_Typed)
+{
+    // 双精度存储保留 float 无法表示的精度
+    FField DoubleField("Pressure", EFieldType::Scalar, EFieldAttachment::Vertex);
+    DoubleField.SetTypedData(TArray<double>{1.0 + 1.0e-12, 2.0, 3.0});
+    ASSERT(DoubleField.GetStorage() == EFieldStorage::Float64);
+    ASSERT(DoubleField.GetDataCount() == 3);
+    ASSERT(DoubleField.GetRawDataSize() == 3 * sizeof(double));
+    ASSERT_EQ(DoubleField.GetTypedData<double>()[0], 1.0 + 1.0e-12);
+    ASSERT_EQ(DoubleField.GetScalar(1), 2.0f);
+
+    // float 接口按存储类型转换
+    DoubleField.SetScalar(2, 5.0f);
+    DoubleField.AddScalar(-1.0f);
+    ASSERT(DoubleField.GetDataCount() == 4);
+    ASSERT_EQ(DoubleField.GetTypedData<double>()[3], -1.0);
+    float Min = 0.0f, Max = 0.0f;
+    ASSERT(DoubleField.GetDataRange(0, Min, Max));
+    ASSERT_EQ(Min, -1.0f);
+    ASSERT_EQ(Max, 5.0f);
+
+    // 类型不匹配时抛出异常
+    bool bThrown = false;
+    try
+    {
+        DoubleField.GetTypedData<float>();
+    }
+    catch (const FInvalidOperationException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+    bThrown = false;
+    try
+    {
+        DoubleField.GetFieldData();
+    }
+    catch (const FInvalidOperationException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+
+    // 整数存储的向量场
+    FField IdField("PartId", EFieldType::Vector, EFieldAttachment::Cell);
+    IdField.SetStorage(EFieldStorage::Int32);
+    IdField.AddVector(FVector(1.0f, 2.0f, 3.0f));
+    IdField.AddVector(FVector(4.4f, -5.6f, 6.0f));
+    IdField.AddVector(FVector(7.0f, 8.0f, 9.0f));
+    ASSERT(IdField.GetRawDataSize() == 9 * sizeof(int32));
+    ASSERT(IdField.GetTypedData<int32>()[3] == 4);
+    ASSERT(IdField.GetTypedData<int32>()[4] == -6);
+    IdField.CompactData(TArray<int32>{0, -1, 1});
+    ASSERT(IdField.GetDataCount() == 2);
+    ASSERT(IdField.GetVector(1) == FVector(7.0f, 8.0f, 9.0f));
+
+    // 拷贝保留存储类型
+    FField Copy = IdField;
+    ASSERT(Copy.GetStorage() == EFieldStorage::Int32);
+    ASSERT(Copy.GetVector(0) == FVector(1.0f, 2.0f, 3.0f));
+}
+
+TEST(Field_Storage_Convert)
+{
+    FField ScalarField("Temp", EFieldType::Scalar, EFieldAttachment::Vertex);
+    ScalarField.SetScalarData(TArray<float>{-10.4f, 0.5f, 1.5f, 300.0f, 1.0f / 3.0f});
+    ASSERT(ScalarField.GetRawDataSize() == 5 * sizeof(float));
+
+    // 半精度存储减少一半内存，精度约为 3 位有效数字
+    ScalarField.SetStorage(EFieldStorage::Float16);
+    ASSERT(ScalarField.GetRawDataSize() == 5 * sizeof(FFloat16));
+    ASSERT(std::fabs(ScalarField.GetScalar(4) - 1.0f / 3.0f) < 1.0e-3f);
+    ASSERT_EQ(ScalarField.GetScalar(3), 300.0f);
+
+    // 整数存储四舍五入并截断到类型范围
+    ScalarField.SetStorage(EFieldStorage::UInt8);
+    const TArrayView<const uint8> Bytes = static_cast<const FField&>(ScalarField).GetTypedData<uint8>();
+    ASSERT(Bytes[0] == 0);
+    ASSERT(Bytes[3] == 255);
+
+    // 转回 float 并整体替换数据
+    ScalarField.SetStorage(EFieldStorage::Float32);
+    ASSERT(ScalarField.GetRawDataSize() == 5 * sizeof(float));
+    ASSERT_EQ(ScalarField.GetRawDataPtr()[3], 255.0f);
+
+    ScalarField.SetStorage(EFieldStorage::Float16);
+    ScalarField.SetScalarData(TArray<float>{1.0f, 2.0f});
+    ASSERT(ScalarField.GetStorage() == EFieldStorage::Float16);
+    ASSERT(ScalarField.GetDataCount() == 2);
+    TArray<float> Converted;
+    ScalarField.CopyToFloat(Converted);
+    ASSERT(Converted.Num() == 2);
+    ASSERT_EQ(Converted[1], 2.0f);
+
+    ScalarField.Reset();
+    ASSERT(ScalarField.GetStorage() == EFieldStorage::Float32);
+}
+
+// ============================================================================
+// 版本号
+// ============================================================================
+
+TEST(Field_Version)
+{
+    FField ScalarField("Pressure", EFieldType::Scalar, EFieldAttachment::Vertex);
+    uint64 Version = ScalarField.GetVersion();
+
+    // 每次修改数据都得到新的版本号
+    ScalarField.AddScalar(1.0f);
+    ASSERT(ScalarField.GetVersion() != Version);
+    Version = ScalarField.GetVersion();
+
+    ScalarField.SetScalar(0, 2.0f);
+    ASSERT(ScalarField.GetVersion() != Version);
+    Version = ScalarField.GetVersion();
+
+    ScalarField.SetStorage(EFieldStorage::Float16);
+    ASSERT(ScalarField.GetVersion() != Version);
+    Version = ScalarField.GetVersion();
+
+    // 只读访问不改变版本号
+    float Min = 0.0f;
+    float Max = 0.0f;
+    ASSERT(ScalarField.GetDataRange(0, Min, Max));
+    ASSERT_EQ(ScalarField.GetScalar(0), 2.0f);
+    ASSERT(ScalarField.GetVersion() == Version);
+
+    // 拷贝得到不同的版本号
+    const FField Copy = ScalarField;
+    ASSERT(Copy.GetVersion() != ScalarField.GetVersion());
+}
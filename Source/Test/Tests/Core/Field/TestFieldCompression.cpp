@@ -0,0 +1,198 @@
+#include "TestFramework.h"
+#include "Field/Field.h"
+#include "Field/FieldCompression.h"
+#include "Field/FieldOperations.h"
+#include "Exception/Exception.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+TEST_GROUP(TestFieldCompression)
+
+namespace
+{
+    /** 平滑的向量数据（模拟速度场） */
+    TArray<float> MakeSmoothData(uint32 Count, uint32 Dimension)
+    {
+        TArray<float> Data;
+        Data.Resize(Count * Dimension);
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            for (uint32 c = 0; c < Dimension; ++c)
+            {
+                Data[i * Dimension + c] = 10.0f * std::sin(0.001f * static_cast<float>(i) + static_cast<float>(c)) + static_cast<float>(c);
+            }
+        }
+        return Data;
+    }
+
+    FFieldCompressionOptions MakeOptions(EFieldCompression Method, double ErrorBound, uint32 BlockElementCount)
+    {
+        FFieldCompressionOptions Options;
+        Options.Method = Method;
+        Options.ErrorBound = ErrorBound;
+        Options.BlockElementCount = BlockElementCount;
+        return Options;
+    }
+}
+
+// 无损压缩逐位还原（包括非有限值与尾部不足一个块的情况）
+TEST(FieldCompression_Lossless)
+{
+    for (uint32 Dimension : { 1u, 3u, 9u })
+    {
+        TArray<float> Data = MakeSmoothData(5003, Dimension);
+        Data[7] = std::numeric_limits<float>::infinity();
+        Data[11] = std::nanf("");
+        Data[13] = -0.0f;
+
+        const TSharedPtr<FCompressedFieldData> Compressed = FCompressedFieldData::Compress(
+            Data.GetData(), EFieldStorage::Float32, Data.Num(), Dimension, MakeOptions(EFieldCompression::Lossless, 0.0, 256));
+        ASSERT(Compressed->GetNumBlocks() == (5003 + 255) / 256);
+        ASSERT(Compressed->GetCompressedSize() < Compressed->GetUncompressedSize());
+
+        TArray<float> Decoded;
+        Decoded.Resize(Data.Num());
+        Compressed->Decode(Decoded.GetData());
+        ASSERT(std::memcmp(Decoded.GetData(), Data.GetData(), Data.Num() * sizeof(float)) == 0);
+
+        // 随机访问
+        for (uint32 Index : { 0u, 255u * Dimension, 5002u * Dimension })
+        {
+            ASSERT(std::memcmp(Compressed->GetValuePtr(Index), &Data[Index], sizeof(float)) == 0);
+        }
+    }
+
+    // 其他存储类型
+    TArray<int32> Ids;
+    for (int32 i = 0; i < 1000; ++i)
+    {
+        Ids.Add(i / 100 - 3);
+    }
+    const TSharedPtr<FCompressedFieldData> Compressed = FCompressedFieldData::Compress(
+        Ids.GetData(), EFieldStorage::Int32, Ids.Num(), 1, MakeOptions(EFieldCompression::Lossy, 0.5, 128));
+    TArray<int32> Decoded;
+    Decoded.Resize(Ids.Num());
+    Compressed->Decode(Decoded.GetData(), false);
+    ASSERT(Decoded == Ids);
+    ASSERT(Compressed->GetCompressedSize() * 4 < Compressed->GetUncompressedSize());
+}
+
+// 有损压缩满足误差界，无法量化的块回退为无损
+TEST(FieldCompression_Lossy)
+{
+    const double ErrorBound = 1.0e-3;
+    TArray<float> Data = MakeSmoothData(20000, 3);
+    Data[30001] = std::numeric_limits<float>::infinity();
+
+    const TSharedPtr<FCompressedFieldData> Compressed = FCompressedFieldData::Compress(
+        Data.GetData(), EFieldStorage::Float32, Data.Num(), 3, MakeOptions(EFieldCompression::Lossy, ErrorBound, 1024));
+    ASSERT(Compressed->GetMethod() == EFieldCompression::Lossy);
+    ASSERT(Compressed->GetCompressedSize() * 2 < Compressed->GetUncompressedSize());
+
+    // 流式解码
+    uint32 NumDecoded = 0;
+    double MaxError = 0.0;
+    Compressed->ForEachBlock([&](uint32 FirstValue, const void* Values, uint32 NumValues)
+    {
+        const float* Decoded = static_cast<const float*>(Values);
+        for (uint32 i = 0; i < NumValues; ++i)
+        {
+            const float Expected = Data[FirstValue + i];
+            if (std::isinf(Expected))
+            {
+                MaxError = Decoded[i] == Expected ? MaxError : 1.0e30;
+                continue;
+            }
+            MaxError = std::max(MaxError, std::fabs(static_cast<double>(Decoded[i]) - Expected));
+        }
+        NumDecoded += NumValues;
+    });
+    ASSERT(NumDecoded == Data.Num());
+    ASSERT(MaxError <= ErrorBound);
+
+    // 参数检查
+    bool bThrown = false;
+    try
+    {
+        FCompressedFieldData::Compress(Data.GetData(), EFieldStorage::Float32, Data.Num(), 3, MakeOptions(EFieldCompression::Lossy, 0.0, 1024));
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+}
+
+// FField 透明访问压缩数据
+TEST(FieldCompression_Field)
+{
+    const TArray<float> Data = MakeSmoothData(10000, 3);
+    FField Velocity("Velocity", EFieldType::Vector, EFieldAttachment::Vertex);
+    Velocity.SetVectorData(Data);
+    float Min = 0.0f, Max = 0.0f;
+    ASSERT(Velocity.GetDataRange(0, Min, Max));
+
+    Velocity.Compress(MakeOptions(EFieldCompression::Lossless, 0.0, 512));
+    ASSERT(Velocity.IsCompressed());
+    ASSERT(Velocity.IsDataRangeValid());
+    ASSERT(Velocity.GetMemorySize() < Velocity.GetRawDataSize());
+    ASSERT(Velocity.GetRawDataSize() == Data.Num() * sizeof(float));
+
+    // 读取接口不解压
+    ASSERT(Velocity.GetVector(4321) == FVector(Data[4321 * 3], Data[4321 * 3 + 1], Data[4321 * 3 + 2]));
+    TArray<float> Element;
+    Velocity.GetData(9999, Element);
+    ASSERT_EQ(Element[2], Data[9999 * 3 + 2]);
+    ASSERT(Velocity.IsCompressed());
+
+    // 整体运算通过解码缓冲区
+    FField Magnitude;
+    FFieldOperations::ComputeMagnitude(Velocity, Magnitude);
+    ASSERT(Magnitude.GetDataCount() == 10000);
+    ASSERT(FMath::IsNearlyEqual(Magnitude.GetScalar(0), FVector(Data[0], Data[1], Data[2]).Size(), 1.0e-4));
+
+    // const 的底层指针访问要求先解压
+    bool bThrown = false;
+    try
+    {
+        static_cast<const FField&>(Velocity).GetRawDataPtr();
+    }
+    catch (const FInvalidOperationException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+
+    // 拷贝共享压缩数据，修改时自动解压
+    FField Copy = Velocity;
+    ASSERT(Copy.GetCompressedData() == Velocity.GetCompressedData());
+    Copy.SetVector(0, FVector(100.0f, 0.0f, 0.0f));
+    ASSERT(!Copy.IsCompressed());
+    ASSERT(Copy.GetVector(0) == FVector(100.0f, 0.0f, 0.0f));
+    ASSERT(Copy.GetVector(1) == Velocity.GetVector(1));
+    ASSERT(Velocity.IsCompressed());
+
+    // 有损压缩使数据范围缓存失效，解压后的数据满足误差界
+    Velocity.Compress(MakeOptions(EFieldCompression::Lossy, 1.0e-2, 512));
+    ASSERT(!Velocity.IsDataRangeValid());
+    ASSERT(Velocity.GetDataRange(0, Min, Max));
+    Velocity.Decompress();
+    ASSERT(!Velocity.IsCompressed());
+    const float* Decoded = Velocity.GetRawDataPtr();
+    for (uint32 i = 0; i < Data.Num(); i += 97)
+    {
+        ASSERT(std::fabs(Decoded[i] - Data[i]) <= 1.0e-2f);
+    }
+
+    // 半精度存储同样可以压缩
+    FField Half("Pressure", EFieldType::Scalar, EFieldAttachment::Cell);
+    Half.SetStorage(EFieldStorage::Float16);
+    Half.SetScalarData(MakeSmoothData(3000, 1));
+    const float Expected = Half.GetScalar(1234);
+    Half.Compress(MakeOptions(EFieldCompression::Lossless, 0.0, 1000));
+    ASSERT_EQ(Half.GetScalar(1234), Expected);
+    Half.Resize(3001);
+    ASSERT(!Half.IsCompressed());
+    ASSERT_EQ(Half.GetScalar(1234), Expected);
+}
@@ -0,0 +1,149 @@
+#include "TestFramework.h"
+#include "Field/Field.h"
+#include "Field/FieldOperations.h"
+#include "Exception/Exception.h"
+#include <cmath>
+
+TEST_GROUP(TestFieldOperations)
+
+namespace
+{
+    bool NearlyEqual(double A, double B, double Tolerance = 1e-4)
+    {
+        return std::fabs(A - B) <= Tolerance * (1.0 + std::fabs(A) + std::fabs(B));
+    }
+
+    /** 生成 Count 个张量，第 i 个为 对角(i, -i, 2) + 对称剪切 */
+    FField MakeTensorField(uint32 Count)
+    {
+        FField Field("Stress", EFieldType::Tensor, EFieldAttachment::Cell);
+        TArray<float> Data;
+        Data.Resize(Count * 9);
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            const float V = static_cast<float>(i % 97) * 0.5f;
+            const float Shear = static_cast<float>(i % 13) * 0.25f;
+            float* T = Data.GetData() + i * 9;
+            T[0] = V;     T[1] = Shear; T[2] = 0.0f;
+            T[3] = Shear; T[4] = -V;    T[5] = 1.0f;
+            T[6] = 0.0f;  T[7] = 1.0f;  T[8] = 2.0f;
+        }
+        Field.SetTensorData(std::move(Data));
+        return Field;
+    }
+}
+
+// ============================================================================
+// 统计
+// ============================================================================
+
+TEST(FieldOperations_Statistics)
+{
+    FField Field("Velocity", EFieldType::Vector, EFieldAttachment::Vertex);
+    constexpr uint32 Count = 200000;
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        Field.AddVector(FVector(static_cast<float>(i), -static_cast<float>(i) * 0.1f, 1.0f / static_cast<float>(i + 1)));
+    }
+
+    const FFieldStatistics Stats = FFieldOperations::ComputeStatistics(Field);
+    ASSERT(Stats.Count == Count);
+    ASSERT(Stats.Min.Num() == 3);
+    ASSERT_EQ(Stats.Min[0], 0.0f);
+    ASSERT_EQ(Stats.Max[0], static_cast<float>(Count - 1));
+    ASSERT_EQ(Stats.Max[1], 0.0f);
+    ASSERT_EQ(Stats.Max[2], 1.0f);
+    ASSERT(NearlyEqual(Stats.Mean[0], (Count - 1) / 2.0));
+
+    // 结果与串行逐位一致
+    const FFieldStatistics Serial = FFieldOperations::ComputeStatistics(Field, false);
+    ASSERT(Serial.Mean[2] == Stats.Mean[2]);
+    ASSERT(Serial.Min[1] == Stats.Min[1]);
+
+    FField Empty("Empty", EFieldType::Scalar, EFieldAttachment::Vertex);
+    ASSERT(FFieldOperations::ComputeStatistics(Empty).Count == 0);
+    ASSERT(FFieldOperations::ComputeStatistics(Empty).Min.IsEmpty());
+}
+
+// ============================================================================
+// 逐元素运算
+// ============================================================================
+
+TEST(FieldOperations_Magnitude)
+{
+    FField Field("Velocity", EFieldType::Vector, EFieldAttachment::Cell);
+    Field.AddVector(FVector(3.0f, 4.0f, 0.0f));
+    Field.AddVector(FVector(0.0f, 0.0f, -2.0f));
+
+    FField Magnitude;
+    FFieldOperations::ComputeMagnitude(Field, Magnitude);
+    ASSERT(Magnitude.GetFieldName() == "Velocity_Magnitude");
+    ASSERT(Magnitude.GetFieldType() == EFieldType::Scalar);
+    ASSERT(Magnitude.GetAttachment() == EFieldAttachment::Cell);
+    ASSERT_EQ(Magnitude.GetScalar(0), 5.0f);
+    ASSERT_EQ(Magnitude.GetScalar(1), 2.0f);
+
+    bool bThrown = false;
+    try
+    {
+        FFieldOperations::ComputeMagnitude(Field, Field);
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+}
+
+TEST(FieldOperations_TensorInvariants)
+{
+    // 单轴拉伸：von Mises 等于拉伸应力，主值为 (S, 0, 0)
+    FField Uniaxial("Stress", EFieldType::Tensor, EFieldAttachment::Cell);
+    Uniaxial.AddTensor(TArray<float>{ 100.0f, 0, 0, 0, 0, 0, 0, 0, 0 });
+    // 纯剪切：von Mises = sqrt(3) * Tau，主值为 (Tau, 0, -Tau)
+    Uniaxial.AddTensor(TArray<float>{ 0, 10.0f, 0, 10.0f, 0, 0, 0, 0, 0 });
+
+    FField VonMises, Principal("Principal", EFieldType::Vector, EFieldAttachment::Cell);
+    FFieldOperations::ComputeVonMises(Uniaxial, VonMises);
+    FFieldOperations::ComputePrincipalValues(Uniaxial, Principal);
+    ASSERT(VonMises.GetFieldName() == "Stress_VonMises");
+    ASSERT(Principal.GetFieldName() == "Principal");
+    ASSERT(NearlyEqual(VonMises.GetScalar(0), 100.0));
+    ASSERT(NearlyEqual(VonMises.GetScalar(1), std::sqrt(3.0) * 10.0));
+    ASSERT(NearlyEqual(Principal.GetVector(0).X, 100.0) && NearlyEqual(Principal.GetVector(0).Y, 0.0) && NearlyEqual(Principal.GetVector(0).Z, 0.0));
+    ASSERT(NearlyEqual(Principal.GetVector(1).X, 10.0) && NearlyEqual(Principal.GetVector(1).Y, 0.0) && NearlyEqual(Principal.GetVector(1).Z, -10.0));
+
+    // 大场：主值满足 迹 = S1 + S2 + S3，且 von Mises 与主值公式一致；并行与串行结果一致
+    const FField Stress = MakeTensorField(50000);
+    FField ParallelPrincipal, SerialPrincipal, ParallelVonMises;
+    FFieldOperations::ComputePrincipalValues(Stress, ParallelPrincipal);
+    FFieldOperations::ComputePrincipalValues(Stress, SerialPrincipal, false);
+    FFieldOperations::ComputeVonMises(Stress, ParallelVonMises);
+
+    bool bConsistent = true;
+    for (uint32 i = 0; i < Stress.GetDataCount(); ++i)
+    {
+        const FVector S = ParallelPrincipal.GetVector(i);
+        const float* T = Stress.GetRawDataPtr() + i * 9;
+        const double FromPrincipal = std::sqrt(0.5 * ((S.X - S.Y) * (S.X - S.Y) + (S.Y - S.Z) * (S.Y - S.Z) + (S.Z - S.X) * (S.Z - S.X)));
+        bConsistent = bConsistent &&
+            S == SerialPrincipal.GetVector(i) &&
+            S.X >= S.Y && S.Y >= S.Z &&
+            NearlyEqual(S.X + S.Y + S.Z, T[0] + T[4] + T[8], 1e-3) &&
+            NearlyEqual(FromPrincipal, ParallelVonMises.GetScalar(i), 1e-3);
+    }
+    ASSERT(bConsistent);
+
+    FField Scalar("Temperature", EFieldType::Scalar, EFieldAttachment::Vertex);
+    FField Out;
+    bool bThrown = false;
+    try
+    {
+        FFieldOperations::ComputeVonMises(Scalar, Out);
+    }
+    catch (const FInvalidOperationException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+}
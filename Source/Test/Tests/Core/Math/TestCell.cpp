@@ -1,6 +1,8 @@
 #include "TestFramework.h"
 #include "TestTimeUtil.h"
 #include "Cell/CellTriangle.h"
+#include "Cell/CellType.h"
+#include "Container/Array.h"
 
 TEST_GROUP(TestCell)
 
@@ -16,3 +18,83 @@ TEST(CellTriangle)
     ASSERT(arr > 0);
 }
 
+
+// ============================================================================
+// 边界面定义测试
+// ============================================================================
+
+namespace
+{
+    /** 检查单元所有面的法线（按面顶点顺序计算）都指向单元外部 */
+    bool AreFacesOutward(ECellType CellType, const TArray<FVector>& Vertices)
+    {
+        FVector CellCenter(0.0f, 0.0f, 0.0f);
+        for (const FVector& Vertex : Vertices)
+        {
+            CellCenter += Vertex;
+        }
+        CellCenter /= static_cast<float>(Vertices.Num());
+
+        const uint32 FaceCount = ICellType::GetFaceCount(CellType, Vertices.Num());
+        for (uint32 FaceIndex = 0; FaceIndex < FaceCount; ++FaceIndex)
+        {
+            int32 Local[ICellType::MaxFaceVertexCount];
+            const uint32 Count = ICellType::GetFaceLocalIndices(CellType, Vertices.Num(), FaceIndex, Local);
+            FVector FaceCenter(0.0f, 0.0f, 0.0f);
+            for (uint32 i = 0; i < Count; ++i)
+            {
+                FaceCenter += Vertices[Local[i]];
+            }
+            FaceCenter /= static_cast<float>(Count);
+
+            const FVector Normal = (Vertices[Local[1]] - Vertices[Local[0]]).Cross(Vertices[Local[2]] - Vertices[Local[0]]);
+            if (Normal.Dot(FaceCenter - CellCenter) <= 0.0f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST(CellFaces_Outward)
+{
+    const FVector P000(0, 0, 0), P100(1, 0, 0), P110(1, 1, 0), P010(0, 1, 0);
+    const FVector P001(0, 0, 1), P101(1, 0, 1), P111(1, 1, 1), P011(0, 1, 1);
+
+    ASSERT(ICellType::GetFaceCount(ECellType::Tetra, 4) == 4);
+    ASSERT(AreFacesOutward(ECellType::Tetra, TArray<FVector>{P000, P100, P010, P001}));
+
+    ASSERT(ICellType::GetFaceCount(ECellType::Hex, 8) == 6);
+    ASSERT(AreFacesOutward(ECellType::Hex, TArray<FVector>{P000, P100, P110, P010, P001, P101, P111, P011}));
+
+    ASSERT(ICellType::GetFaceCount(ECellType::Prism, 6) == 5);
+    ASSERT(AreFacesOutward(ECellType::Prism, TArray<FVector>{P000, P100, P010, P001, P101, P011}));
+
+    ASSERT(ICellType::GetFaceCount(ECellType::Pyramid, 5) == 5);
+    ASSERT(AreFacesOutward(ECellType::Pyramid, TArray<FVector>{P000, P100, P110, P010, FVector(0.5f, 0.5f, 1.0f)}));
+}
+
+TEST(CellFaces_LowerDimension)
+{
+    int32 Local[ICellType::MaxFaceVertexCount];
+
+    // 二维单元的边界面为边
+    ASSERT(ICellType::GetFaceCount(ECellType::Triangle, 3) == 3);
+    ASSERT(ICellType::GetFaceLocalIndices(ECellType::Triangle, 3, 2, Local) == 2);
+    ASSERT(Local[0] == 2 && Local[1] == 0);
+
+    ASSERT(ICellType::GetFaceCount(ECellType::Polygon, 5) == 5);
+    ASSERT(ICellType::GetFaceLocalIndices(ECellType::Polygon, 5, 4, Local) == 2);
+    ASSERT(Local[0] == 4 && Local[1] == 0);
+
+    // 一维单元的边界面为端点
+    ASSERT(ICellType::GetFaceCount(ECellType::PolyLine, 4) == 2);
+    ASSERT(ICellType::GetFaceLocalIndices(ECellType::PolyLine, 4, 1, Local) == 1);
+    ASSERT(Local[0] == 3);
+
+    // 顶点数不足的单元、多面体以及越界的面索引
+    ASSERT(ICellType::GetFaceCount(ECellType::Hex, 4) == 0);
+    ASSERT(ICellType::GetFaceCount(ECellType::Polyhedron, 12) == 0);
+    ASSERT(ICellType::GetFaceLocalIndices(ECellType::Tetra, 4, 4, Local) == 0);
+}
@@ -0,0 +1,168 @@
+#include "TestFramework.h"
+#include "Cell/CellGeometry.h"
+#include "Cell/CellTriangle.h"
+#include "Cell/CellQuad.h"
+#include "Cell/CellPolygon.h"
+#include "Cell/CellTetra.h"
+#include "Cell/CellPyramid.h"
+#include "Cell/CellPrism.h"
+#include "Cell/CellLine.h"
+#include "Cell/CellPolyLine.h"
+#include "Container/CellArray.h"
+#include "Field/Field.h"
+#include <cmath>
+
+TEST_GROUP(TestCellGeometry)
+
+namespace
+{
+    bool NearlyEqual(float A, float B)
+    {
+        return std::fabs(A - B) <= 1e-5f * (1.0f + std::fabs(A) + std::fabs(B));
+    }
+
+    bool NearlyEqual(const FVector& A, const FVector& B)
+    {
+        return NearlyEqual(A.X, B.X) && NearlyEqual(A.Y, B.Y) && NearlyEqual(A.Z, B.Z);
+    }
+
+    TArray<FVector> GatherVertices(const TArray<FVector>& Positions, const FCellArray& Cells, int32 CellIndex)
+    {
+        TArray<FVector> Result;
+        for (int32 VertexIndex : Cells.GetCellView(CellIndex))
+        {
+            Result.Add(Positions[VertexIndex]);
+        }
+        return Result;
+    }
+
+    /**
+     * 混合单元测试数据：
+     * 0 Line, 1 PolyLine, 2 Triangle, 3 Quad(翘曲), 4 Polygon(五边形), 5 Tetra, 6 Hex(单位立方体拉伸), 7 Pyramid, 8 Prism, 9 Polyhedron
+     */
+    void BuildMixedCells(TArray<FVector>& Positions, FCellArray& Cells)
+    {
+        // 0-7：长方体 [0,2]x[0,1]x[0,3]
+        Positions = {
+            FVector(0, 0, 0), FVector(2, 0, 0), FVector(2, 1, 0), FVector(0, 1, 0),
+            FVector(0, 0, 3), FVector(2, 0, 3), FVector(2, 1, 3), FVector(0, 1, 3),
+            FVector(1, 0.5f, 5), FVector(0.3f, 0.7f, 0.4f), FVector(1.5f, -1, 0.2f)
+        };
+
+        Cells.AddCell(ECellType::Line, TArray<int32>{ 0, 6 });
+        Cells.AddCell(ECellType::PolyLine, TArray<int32>{ 0, 1, 2, 6 });
+        Cells.AddCell(ECellType::Triangle, TArray<int32>{ 0, 1, 9 });
+        Cells.AddCell(ECellType::Quad, TArray<int32>{ 0, 1, 2, 9 });
+        Cells.AddCell(ECellType::Polygon, TArray<int32>{ 0, 10, 1, 2, 3 });
+        Cells.AddCell(ECellType::Tetra, TArray<int32>{ 0, 1, 3, 4 });
+        Cells.AddCell(ECellType::Hex, TArray<int32>{ 0, 1, 2, 3, 4, 5, 6, 7 });
+        Cells.AddCell(ECellType::Pyramid, TArray<int32>{ 4, 5, 6, 7, 8 });
+        Cells.AddCell(ECellType::Prism, TArray<int32>{ 0, 1, 3, 4, 5, 7 });
+        Cells.AddCell(ECellType::Polyhedron, TArray<int32>{ 0, 1, 2, 3, 8 });
+    }
+}
+
+// 混合单元：结果与各单元类型的静态函数一致
+TEST(CellGeometry_MixedMatchesPerCell)
+{
+    TArray<FVector> Positions;
+    FCellArray Cells;
+    BuildMixedCells(Positions, Cells);
+    const TArrayView<const FVector> View(Positions.GetData(), Positions.Num());
+
+    FField Size, Area, Volume, Centroid, Normal;
+    FCellGeometry::Compute(View, Cells, ECellGeometryQuantity::Size, Size);
+    FCellGeometry::Compute(View, Cells, ECellGeometryQuantity::Area, Area);
+    FCellGeometry::Compute(View, Cells, ECellGeometryQuantity::Volume, Volume);
+    FCellGeometry::Compute(View, Cells, ECellGeometryQuantity::Centroid, Centroid);
+    FCellGeometry::Compute(View, Cells, ECellGeometryQuantity::Normal, Normal);
+
+    ASSERT(Volume.GetFieldName() == "Volume");
+    ASSERT(Volume.GetAttachment() == EFieldAttachment::Cell);
+    ASSERT(Volume.GetDataCount() == Cells.GetCellCount());
+    ASSERT(Centroid.GetFieldType() == EFieldType::Vector);
+    ASSERT(Centroid.GetDataCount() == Cells.GetCellCount());
+
+    const TArray<FVector> Line = GatherVertices(Positions, Cells, 0);
+    ASSERT(NearlyEqual(Size.GetScalar(0), ICellLine::ComputeLength(Line[0], Line[1])));
+    ASSERT(NearlyEqual(Size.GetScalar(1), ICellPolyLine::ComputeLength(GatherVertices(Positions, Cells, 1))));
+    ASSERT_EQ(Area.GetScalar(0), 0.0f);
+
+    const TArray<FVector> Tri = GatherVertices(Positions, Cells, 2);
+    ASSERT(NearlyEqual(Area.GetScalar(2), ICellTriangle::ComputeArea(Tri[0], Tri[1], Tri[2])));
+    ASSERT(NearlyEqual(Normal.GetVector(2), ICellTriangle::ComputeNormal(Tri[0], Tri[1], Tri[2])));
+
+    const TArray<FVector> Quad = GatherVertices(Positions, Cells, 3);
+    ASSERT(NearlyEqual(Area.GetScalar(3), ICellQuad::ComputeArea(Quad[0], Quad[1], Quad[2], Quad[3])));
+    ASSERT(NearlyEqual(Normal.GetVector(3), ICellQuad::ComputeNormal(Quad[0], Quad[1], Quad[2], Quad[3])));
+
+    const TArray<FVector> Polygon = GatherVertices(Positions, Cells, 4);
+    ASSERT(NearlyEqual(Area.GetScalar(4), ICellPolygon::ComputeArea(Polygon)));
+    ASSERT(NearlyEqual(Normal.GetVector(4), ICellPolygon::ComputeNormal(Polygon)));
+    ASSERT(NearlyEqual(Centroid.GetVector(4), ICellPolygon::ComputeCenter(Polygon)));
+    ASSERT_EQ(Volume.GetScalar(4), 0.0f);
+
+    const TArray<FVector> Tetra = GatherVertices(Positions, Cells, 5);
+    ASSERT(NearlyEqual(Volume.GetScalar(5), ICellTetra::ComputeVolume(Tetra[0], Tetra[1], Tetra[2], Tetra[3])));
+    ASSERT(NearlyEqual(Volume.GetScalar(5), 1.0f));
+
+    // 长方体 2 x 1 x 3
+    ASSERT(NearlyEqual(Volume.GetScalar(6), 6.0f));
+    ASSERT(NearlyEqual(Size.GetScalar(6), 6.0f));
+    ASSERT(NearlyEqual(Centroid.GetVector(6), FVector(1.0f, 0.5f, 1.5f)));
+    ASSERT(Normal.GetVector(6) == FVector::ZeroVector());
+
+    ASSERT(NearlyEqual(Volume.GetScalar(7), ICellPyramid::ComputeVolume(GatherVertices(Positions, Cells, 7))));
+    ASSERT(NearlyEqual(Volume.GetScalar(7), 2.0f * 1.0f * 2.0f / 3.0f));
+    ASSERT(NearlyEqual(Volume.GetScalar(8), ICellPrism::ComputeVolume(GatherVertices(Positions, Cells, 8))));
+    ASSERT(NearlyEqual(Volume.GetScalar(8), 3.0f));
+
+    // 多面体没有面信息：体积为 0，中心为顶点平均值
+    ASSERT_EQ(Volume.GetScalar(9), 0.0f);
+    ASSERT(NearlyEqual(Centroid.GetVector(9), FVector(1.0f, 0.5f, 1.0f)));
+}
+
+// 均匀单元数组（并行路径）与逐单元计算一致
+TEST(CellGeometry_UniformParallel)
+{
+    constexpr int32 N = 120;
+    TArray<FVector> Positions;
+    for (int32 y = 0; y <= N; ++y)
+    {
+        for (int32 x = 0; x <= N; ++x)
+        {
+            Positions.Add(FVector(static_cast<float>(x), static_cast<float>(y), 0.01f * static_cast<float>(x * y % 7)));
+        }
+    }
+
+    TArray<int32> Indices;
+    for (int32 y = 0; y < N; ++y)
+    {
+        for (int32 x = 0; x < N; ++x)
+        {
+            const int32 V0 = y * (N + 1) + x;
+            Indices.Append(TArray<int32>{ V0, V0 + 1, V0 + N + 2, V0, V0 + N + 2, V0 + N + 1 });
+        }
+    }
+    FCellArray Cells;
+    Cells.AppendCells(ECellType::Triangle, 3, std::move(Indices));
+    ASSERT(Cells.IsUniform());
+
+    FField Area("TriangleArea", EFieldType::Scalar, EFieldAttachment::Cell);
+    FField Normal;
+    const TArrayView<const FVector> View(Positions.GetData(), Positions.Num());
+    FCellGeometry::Compute(View, Cells, ECellGeometryQuantity::Area, Area);
+    FCellGeometry::Compute(View, Cells, ECellGeometryQuantity::Normal, Normal, false);
+    ASSERT(Area.GetFieldName() == "TriangleArea");
+    ASSERT(Area.GetDataCount() == Cells.GetCellCount());
+
+    bool bMatched = true;
+    for (uint32 CellIndex = 0; CellIndex < Cells.GetCellCount(); ++CellIndex)
+    {
+        const TArray<FVector> Tri = GatherVertices(Positions, Cells, static_cast<int32>(CellIndex));
+        bMatched = bMatched &&
+            NearlyEqual(Area.GetScalar(CellIndex), ICellTriangle::ComputeArea(Tri[0], Tri[1], Tri[2])) &&
+            NearlyEqual(Normal.GetVector(CellIndex), ICellTriangle::ComputeNormal(Tri[0], Tri[1], Tri[2]));
+    }
+    ASSERT(bMatched);
+}
@@ -1,5 +1,6 @@
 #include "TestFramework.h"
 #include "Math/Math.h"
+#include "Math/VectorArraySoA.h"
 
 TEST_GROUP(TestVector)
 
@@ -131,4 +132,32 @@ TEST(TVector4_Conversion)
     ASSERT_EQ(FloatVec.Y, 2.0f);
     ASSERT_EQ(FloatVec.Z, 3.0f);
     ASSERT_EQ(FloatVec.W, 4.0f);
-}
\ No newline at end of file
+}
+
+// SoA 向量数组测试
+TEST(VectorArraySoA_Conversion)
+{
+    TArray<FVector> Source;
+    for (int i = 0; i < 1000; ++i)
+    {
+        Source.Add(FVector(static_cast<float>(i), static_cast<float>(i * 2), static_cast<float>(-i)));
+    }
+
+    FVectorArraySoA SoA;
+    SoA.CopyFrom(Source.GetData(), Source.Num());
+    ASSERT(SoA.Num() == 1000);
+    ASSERT(reinterpret_cast<uintptr_t>(SoA.GetX()) % FVectorArraySoA::Alignment == 0);
+    ASSERT(reinterpret_cast<uintptr_t>(SoA.GetZ()) % FVectorArraySoA::Alignment == 0);
+    ASSERT_EQ(SoA.GetY()[10], 20.0f);
+    ASSERT(SoA.Get(999) == Source[999]);
+
+    SoA.Add(FVector(1.0f, 2.0f, 3.0f));
+    SoA.Set(0, FVector(7.0f, 8.0f, 9.0f));
+
+    TArray<FVector> Back;
+    SoA.CopyTo(Back);
+    ASSERT(Back.Num() == 1001);
+    ASSERT(Back[0] == FVector(7.0f, 8.0f, 9.0f));
+    ASSERT(Back[500] == Source[500]);
+    ASSERT(Back[1000] == FVector(1.0f, 2.0f, 3.0f));
+}
@@ -0,0 +1,395 @@
+#include "TestFramework.h"
+#include "Math/Math.h"
+#include "Math/VectorKernels.h"
+#include "Math/VectorArraySoA.h"
+#include "Exception/Exception.h"
+#include <cmath>
+
+TEST_GROUP(TestVectorKernels)
+
+namespace
+{
+    /** 覆盖整块与各种尾部长度 */
+    const uint32 TestSizes[] = { 0, 1, 3, 4, 7, 8, 13, 16, 1003 };
+
+    bool NearlyEqual(float A, float B)
+    {
+        return std::fabs(A - B) <= 1e-5f * (1.0f + std::fabs(A) + std::fabs(B));
+    }
+
+    bool NearlyEqual(const FVector& A, const FVector& B)
+    {
+        return NearlyEqual(A.X, B.X) && NearlyEqual(A.Y, B.Y) && NearlyEqual(A.Z, B.Z);
+    }
+
+    TArray<FVector> MakeVectors(uint32 Count, uint32 Seed)
+    {
+        TArray<FVector> Result;
+        Result.Reserve(Count);
+        uint32 State = Seed * 2654435761u + 1;
+        auto NextFloat = [&State]()
+        {
+            State = State * 1664525u + 1013904223u;
+            return static_cast<float>(State >> 8) / 16777216.0f * 200.0f - 100.0f;
+        };
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            const float X = NextFloat();
+            const float Y = NextFloat();
+            const float Z = NextFloat();
+            Result.Add(FVector(X, Y, Z));
+        }
+        // 插入零向量以覆盖归一化的容差分支
+        if (Count > 2)
+        {
+            Result[Count / 2] = FVector(0.0f, 0.0f, 0.0f);
+        }
+        return Result;
+    }
+
+    TArrayView<FVector> MakeView(TArray<FVector>& Array) { return TArrayView<FVector>(Array.GetData(), Array.Num()); }
+    TArrayView<const FVector> MakeConstView(const TArray<FVector>& Array) { return TArrayView<const FVector>(Array.GetData(), Array.Num()); }
+    TArrayView<float> MakeView(TArray<float>& Array) { return TArrayView<float>(Array.GetData(), Array.Num()); }
+
+    /** 依次在所有支持的指令集级别上执行测试 */
+    template<typename FuncType>
+    bool ForEachLevel(FuncType&& Func)
+    {
+        const ESimdLevel Previous = FVectorKernels::GetActiveLevel();
+        bool bPassed = true;
+        for (ESimdLevel Level : { ESimdLevel::Scalar, ESimdLevel::SSE42, ESimdLevel::AVX2 })
+        {
+            if (static_cast<uint8>(Level) > static_cast<uint8>(FVectorKernels::GetSupportedLevel()))
+            {
+                continue;
+            }
+            FVectorKernels::SetActiveLevel(Level);
+            bPassed = Func() && bPassed;
+        }
+        FVectorKernels::SetActiveLevel(Previous);
+        return bPassed;
+    }
+}
+
+// 指令集选择测试
+TEST(VectorKernels_Level)
+{
+    const ESimdLevel Supported = FVectorKernels::GetSupportedLevel();
+    ASSERT(FVectorKernels::GetActiveLevel() == Supported);
+    ASSERT(FVectorKernels::SetActiveLevel(ESimdLevel::Scalar) == ESimdLevel::Scalar);
+    ASSERT(FVectorKernels::GetActiveLevel() == ESimdLevel::Scalar);
+    ASSERT(FVectorKernels::SetActiveLevel(ESimdLevel::AVX2) == Supported);
+    ASSERT(EnumToString(ESimdLevel::SSE42) == "SSE42");
+}
+
+// AoS 平移、缩放、归一化与 TVector 逐元素结果一致
+TEST(VectorKernels_AoSInPlace)
+{
+    const bool bPassed = ForEachLevel([]()
+    {
+        for (uint32 Size : TestSizes)
+        {
+            const TArray<FVector> Source = MakeVectors(Size, Size);
+            const FVector Offset(1.5f, -2.0f, 3.25f);
+            const FVector ScaleVector(2.0f, 0.5f, -1.0f);
+
+            TArray<FVector> Translated = Source;
+            FVectorKernels::Translate(MakeView(Translated), Offset);
+            TArray<FVector> Scaled = Source;
+            FVectorKernels::Scale(MakeView(Scaled), 3.0f);
+            TArray<FVector> ScaledPerAxis = Source;
+            FVectorKernels::Scale(MakeView(ScaledPerAxis), ScaleVector);
+            TArray<FVector> Normalized = Source;
+            FVectorKernels::Normalize(MakeView(Normalized));
+
+            for (uint32 i = 0; i < Size; ++i)
+            {
+                FVector Expected = Source[i];
+                Expected.Normalize();
+                if (!(Translated[i] == Source[i] + Offset) ||
+                    !(Scaled[i] == Source[i] * 3.0f) ||
+                    !(ScaledPerAxis[i] == FVector(Source[i].X * 2.0f, Source[i].Y * 0.5f, -Source[i].Z)) ||
+                    !NearlyEqual(Normalized[i], Expected))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    });
+    ASSERT(bPassed);
+}
+
+// AoS 点积、叉积、长度、包围盒与 TVector 逐元素结果一致
+TEST(VectorKernels_AoSBinary)
+{
+    const bool bPassed = ForEachLevel([]()
+    {
+        for (uint32 Size : TestSizes)
+        {
+            const TArray<FVector> A = MakeVectors(Size, Size + 1);
+            const TArray<FVector> B = MakeVectors(Size, Size + 2);
+
+            TArray<float> Dots;
+            Dots.Resize(Size);
+            FVectorKernels::Dot(MakeConstView(A), MakeConstView(B), MakeView(Dots));
+            TArray<float> Lengths;
+            Lengths.Resize(Size);
+            FVectorKernels::Length(MakeConstView(A), MakeView(Lengths));
+            TArray<FVector> Crosses;
+            Crosses.Resize(Size);
+            FVectorKernels::Cross(MakeConstView(A), MakeConstView(B), MakeView(Crosses));
+
+            // 输出与输入为同一数组
+            TArray<FVector> InPlace = A;
+            FVectorKernels::Cross(MakeConstView(InPlace), MakeConstView(B), MakeView(InPlace));
+
+            FVector ExpectedMin(0.0f), ExpectedMax(0.0f);
+            for (uint32 i = 0; i < Size; ++i)
+            {
+                if (!NearlyEqual(Dots[i], A[i].Dot(B[i])) ||
+                    !NearlyEqual(Lengths[i], A[i].Size()) ||
+                    !(Crosses[i] == A[i].Cross(B[i])) ||
+                    !(InPlace[i] == Crosses[i]))
+                {
+                    return false;
+                }
+                for (int32 Axis = 0; Axis < 3; ++Axis)
+                {
+                    ExpectedMin.XYZ[Axis] = i == 0 ? A[i].XYZ[Axis] : std::fmin(ExpectedMin.XYZ[Axis], A[i].XYZ[Axis]);
+                    ExpectedMax.XYZ[Axis] = i == 0 ? A[i].XYZ[Axis] : std::fmax(ExpectedMax.XYZ[Axis], A[i].XYZ[Axis]);
+                }
+            }
+
+            FVector Min, Max;
+            if (FVectorKernels::ComputeBounds(MakeConstView(A), Min, Max) != (Size > 0))
+            {
+                return false;
+            }
+            if (Size > 0 && (!(Min == ExpectedMin) || !(Max == ExpectedMax)))
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+    ASSERT(bPassed);
+}
+
+// SoA 内核与 AoS 结果一致
+TEST(VectorKernels_SoA)
+{
+    const bool bPassed = ForEachLevel([]()
+    {
+        for (uint32 Size : TestSizes)
+        {
+            const TArray<FVector> A = MakeVectors(Size, Size + 3);
+            const TArray<FVector> B = MakeVectors(Size, Size + 4);
+            FVectorArraySoA SoAA, SoAB;
+            SoAA.CopyFrom(A.GetData(), A.Num());
+            SoAB.CopyFrom(B.GetData(), B.Num());
+
+            TArray<float> Dots;
+            Dots.Resize(Size);
+            FVectorKernels::Dot(SoAA, SoAB, MakeView(Dots));
+            TArray<float> Lengths;
+            Lengths.Resize(Size);
+            FVectorKernels::Length(SoAA, MakeView(Lengths));
+
+            FVectorArraySoA Transformed = SoAA;
+            FVectorKernels::Scale(Transformed, FVector(2.0f, 0.5f, -1.0f));
+            FVectorKernels::Translate(Transformed, FVector(1.0f, 2.0f, 3.0f));
+            FVectorArraySoA Normalized = SoAA;
+            FVectorKernels::Normalize(Normalized);
+
+            for (uint32 i = 0; i < Size; ++i)
+            {
+                FVector Expected = A[i];
+                Expected.Normalize();
+                const FVector ExpectedTransformed(A[i].X * 2.0f + 1.0f, A[i].Y * 0.5f + 2.0f, -A[i].Z + 3.0f);
+                if (!NearlyEqual(Dots[i], A[i].Dot(B[i])) ||
+                    !NearlyEqual(Lengths[i], A[i].Size()) ||
+                    !(Transformed.Get(i) == ExpectedTransformed) ||
+                    !NearlyEqual(Normalized.Get(i), Expected))
+                {
+                    return false;
+                }
+            }
+
+            FVector MinAoS, MaxAoS, MinSoA, MaxSoA;
+            const bool bAoS = FVectorKernels::ComputeBounds(MakeConstView(A), MinAoS, MaxAoS);
+            const bool bSoA = FVectorKernels::ComputeBounds(SoAA, MinSoA, MaxSoA);
+            if (bAoS != bSoA || (bAoS && (!(MinAoS == MinSoA) || !(MaxAoS == MaxSoA))))
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+    ASSERT(bPassed);
+}
+
+// 交错存储数据的分量范围（覆盖 SIMD 块内多寄存器与超出寄存器数量回退标量的维度）
+TEST(VectorKernels_ComponentBounds)
+{
+    const bool bPassed = ForEachLevel([]()
+    {
+        for (uint32 Dimension : { 1u, 2u, 3u, 7u, 9u, 13u, 17u })
+        {
+            for (uint32 Count : TestSizes)
+            {
+                TArray<float> Data;
+                Data.Reserve(Count * Dimension);
+                for (const FVector& V : MakeVectors((Count * Dimension + 2) / 3, Count + Dimension))
+                {
+                    Data.Add(V.X);
+                    Data.Add(V.Y);
+                    Data.Add(V.Z);
+                }
+                Data.Resize(Count * Dimension);
+
+                TArray<float> Min, Max;
+                Min.Resize(Dimension);
+                Max.Resize(Dimension);
+                const bool bResult = FVectorKernels::ComputeComponentBounds(
+                    TArrayView<const float>(Data.GetData(), Data.Num()), Dimension, Min.GetData(), Max.GetData());
+                if (bResult != (Count > 0))
+                {
+                    return false;
+                }
+                for (uint32 c = 0; c < Dimension && Count > 0; ++c)
+                {
+                    float ExpectedMin = Data[c];
+                    float ExpectedMax = Data[c];
+                    for (uint32 i = 1; i < Count; ++i)
+                    {
+                        ExpectedMin = std::fmin(ExpectedMin, Data[i * Dimension + c]);
+                        ExpectedMax = std::fmax(ExpectedMax, Data[i * Dimension + c]);
+                    }
+                    if (Min[c] != ExpectedMin || Max[c] != ExpectedMax)
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    });
+    ASSERT(bPassed);
+
+    // 数据长度不是维度的倍数
+    TArray<float> Data;
+    Data.Resize(5, 1.0f);
+    float Min[2], Max[2];
+    bool bThrown = false;
+    try
+    {
+        FVectorKernels::ComputeComponentBounds(TArrayView<const float>(Data.GetData(), Data.Num()), 2, Min, Max);
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+}
+
+// 范围选择位图（包括 64 的整倍数、尾部、边界值和 NaN）
+TEST(VectorKernels_RangeMask)
+{
+    const bool bPassed = ForEachLevel([]()
+    {
+        for (uint32 Count : { 0u, 1u, 63u, 64u, 65u, 128u, 1003u })
+        {
+            TArray<float> Data;
+            for (const FVector& V : MakeVectors((Count + 2) / 3, Count))
+            {
+                Data.Add(V.X);
+                Data.Add(V.Y);
+                Data.Add(V.Z);
+            }
+            Data.Resize(Count);
+            for (uint32 i = 0; i < Count; i += 17)
+            {
+                Data[i] = (i / 17) % 3 == 0 ? -25.0f : ((i / 17) % 3 == 1 ? 50.0f : std::nanf(""));
+            }
+
+            TArray<uint64> Bits;
+            Bits.Resize((Count + 63) / 64, ~uint64(0));
+            const uint32 Selected = FVectorKernels::RangeMask(TArrayView<const float>(Data.GetData(), Data.Num()), -25.0f, 50.0f,
+                TArrayView<uint64>(Bits.GetData(), Bits.Num()));
+
+            uint32 Expected = 0;
+            for (uint32 i = 0; i < Bits.Num() * 64; ++i)
+            {
+                const bool bExpected = i < Count && Data[i] >= -25.0f && Data[i] <= 50.0f;
+                const bool bActual = ((Bits[i / 64] >> (i % 64)) & 1u) != 0;
+                if (bExpected != bActual)
+                {
+                    return false;
+                }
+                Expected += bExpected ? 1u : 0u;
+            }
+            if (Selected != Expected)
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+    ASSERT(bPassed);
+
+    // 位图字数不匹配
+    TArray<float> Data;
+    Data.Resize(65, 1.0f);
+    TArray<uint64> Bits;
+    Bits.Resize(1);
+    bool bThrown = false;
+    try
+    {
+        FVectorKernels::RangeMask(TArrayView<const float>(Data.GetData(), Data.Num()), 0.0f, 2.0f, TArrayView<uint64>(Bits.GetData(), Bits.Num()));
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+}
+
+// FVector3d 标量路径与参数检查
+TEST(VectorKernels_DoubleAndValidation)
+{
+    TArray<FVector3d> Data;
+    Data.Add(FVector3d(1.0, 2.0, 2.0));
+    Data.Add(FVector3d(-3.0, 0.0, 4.0));
+    TArrayView<FVector3d> View(Data.GetData(), Data.Num());
+
+    TArray<double> Lengths;
+    Lengths.Resize(2);
+    FVectorKernels::Length(TArrayView<const FVector3d>(Data.GetData(), Data.Num()), TArrayView<double>(Lengths.GetData(), Lengths.Num()));
+    ASSERT_EQ(Lengths[0], 3.0);
+    ASSERT_EQ(Lengths[1], 5.0);
+
+    FVectorKernels::Translate(View, FVector3d(1.0, 1.0, 1.0));
+    FVectorKernels::Scale(View, FVector3d(2.0, 1.0, 0.5));
+    ASSERT(Data[0] == FVector3d(4.0, 3.0, 1.5));
+
+    FVector3d Min, Max;
+    ASSERT(FVectorKernels::ComputeBounds(TArrayView<const FVector3d>(Data.GetData(), Data.Num()), Min, Max));
+    ASSERT(Min == FVector3d(-4.0, 1.0, 1.5));
+    ASSERT(Max == FVector3d(4.0, 3.0, 2.5));
+
+    // 输出大小不匹配
+    TArray<FVector> A = MakeVectors(4, 1);
+    TArray<float> Out;
+    Out.Resize(3);
+    bool bThrown = false;
+    try
+    {
+        FVectorKernels::Dot(MakeConstView(A), MakeConstView(A), MakeView(Out));
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+}
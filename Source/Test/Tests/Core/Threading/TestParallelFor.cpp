@@ -0,0 +1,93 @@
+#include "TestFramework.h"
+#include "Threading/ParallelFor.h"
+#include "Container/Array.h"
+#include <atomic>
+
+TEST_GROUP(TestParallelFor)
+
+// ============================================================================
+// 并行循环测试
+// ============================================================================
+
+TEST(ParallelFor_VisitsEveryIndexOnce)
+{
+    constexpr uint32 Num = 100000;
+    TArray<int32> Visits;
+    Visits.Resize(Num);
+
+    ParallelFor(Num, [&Visits](uint32 Index)
+    {
+        Visits[Index] += 1;
+    });
+
+    bool bAllOnce = true;
+    for (uint32 i = 0; i < Num; ++i)
+    {
+        bAllOnce = bAllOnce && Visits[i] == 1;
+    }
+    ASSERT(bAllOnce);
+}
+
+TEST(ParallelFor_Range)
+{
+    std::atomic<uint64> Sum{0};
+    std::atomic<uint32> ChunkCount{0};
+    ParallelForRange(1000, 100, [&](uint32 Begin, uint32 End)
+    {
+        uint64 LocalSum = 0;
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            LocalSum += i;
+        }
+        Sum += LocalSum;
+        ++ChunkCount;
+    });
+
+    ASSERT(Sum == 999 * 1000 / 2);
+    ASSERT(ChunkCount >= 1 && ChunkCount <= 10);
+
+    // 空区间不调用函数体
+    bool bCalled = false;
+    ParallelForRange(0, 0, [&](uint32, uint32) { bCalled = true; });
+    ASSERT(!bCalled);
+
+    // 强制单线程时整个区间只调用一次
+    uint32 SingleThreadCalls = 0;
+    ParallelForRange(1000, 10, [&](uint32 Begin, uint32 End)
+    {
+        ASSERT(Begin == 0 && End == 1000);
+        ++SingleThreadCalls;
+    }, EParallelForFlags::ForceSingleThread);
+    ASSERT(SingleThreadCalls == 1);
+}
+
+TEST(ParallelReduce_Deterministic)
+{
+    constexpr uint32 Num = 300000;
+    TArray<float> Values;
+    Values.Resize(Num);
+    for (uint32 i = 0; i < Num; ++i)
+    {
+        Values[i] = 1.0f / static_cast<float>(i + 1);
+    }
+
+    auto Map = [&Values](uint32 Begin, uint32 End)
+    {
+        float Sum = 0.0f;
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            Sum += Values[i];
+        }
+        return Sum;
+    };
+    auto Combine = [](float A, float B) { return A + B; };
+
+    // 并行与串行按相同区间合并，结果逐位一致
+    const float Parallel = ParallelReduce<float>(Num, 1000, 0.0f, Map, Combine);
+    const float Serial = ParallelReduce<float>(Num, 1000, 0.0f, Map, Combine, EParallelForFlags::ForceSingleThread);
+    ASSERT(Parallel == Serial);
+    ASSERT(Parallel > 12.0f && Parallel < 14.0f);
+
+    // 空区间返回初始值
+    ASSERT_EQ(ParallelReduce<float>(0, 0, 5.0f, Map, Combine), 5.0f);
+}
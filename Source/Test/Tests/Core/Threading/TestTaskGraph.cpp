@@ -0,0 +1,138 @@
+#include "TestFramework.h"
+#include "Threading/TaskGraph.h"
+#include "Threading/ParallelFor.h"
+#include "Exception/Exception.h"
+#include "Container/Array.h"
+#include <atomic>
+
+TEST_GROUP(TestTaskGraph)
+
+// ============================================================================
+// 任务调度测试
+// ============================================================================
+
+TEST(TaskGraph_LaunchAndWait)
+{
+    FTaskGraph Graph(2);
+    ASSERT(Graph.GetNumWorkerThreads() == 2);
+    ASSERT(!Graph.IsWorkerThread());
+
+    std::atomic<uint32> Counter{0};
+    TArray<FTaskHandle> Tasks;
+    for (int32 i = 0; i < 1000; ++i)
+    {
+        Tasks.Add(Graph.Launch([&Counter]() { ++Counter; }));
+    }
+    Graph.WaitAll(TArrayView<const FTaskHandle>(Tasks.GetData(), Tasks.Num()));
+    ASSERT(Counter == 1000);
+    ASSERT(Tasks[999].IsCompleted());
+
+    // 无效句柄视为已完成
+    FTaskHandle Empty;
+    ASSERT(Empty.IsCompleted());
+    Graph.Wait(Empty);
+}
+
+TEST(TaskGraph_Dependencies)
+{
+    FTaskGraph Graph(3);
+
+    // 菱形依赖：A -> (B, C) -> D
+    std::atomic<int32> Step{0};
+    int32 OrderA = -1, OrderB = -1, OrderC = -1, OrderD = -1;
+    FTaskHandle A = Graph.Launch([&]() { OrderA = Step++; });
+    FTaskHandle B = Graph.Launch([&]() { OrderB = Step++; }, { A });
+    FTaskHandle C = Graph.Launch([&]() { OrderC = Step++; }, { A });
+    FTaskHandle D = Graph.Launch([&]() { OrderD = Step++; }, { B, C });
+    Graph.Wait(D);
+
+    ASSERT(B.IsCompleted() && C.IsCompleted());
+    ASSERT(OrderA == 0);
+    ASSERT(OrderB > OrderA && OrderC > OrderA);
+    ASSERT(OrderD == 3);
+
+    // 前置任务已完成时直接执行
+    bool bRan = false;
+    Graph.Wait(Graph.Launch([&]() { bRan = true; }, { D }));
+    ASSERT(bRan);
+}
+
+TEST(TaskGraph_NestedWaitHelps)
+{
+    // 只有一个工作线程：任务内部等待子任务时必须帮助执行，否则会死锁
+    FTaskGraph Graph(1);
+    std::atomic<uint32> Leaves{0};
+    FTaskHandle Root = Graph.Launch([&]()
+    {
+        TArray<FTaskHandle> Children;
+        for (int32 i = 0; i < 8; ++i)
+        {
+            Children.Add(Graph.Launch([&]()
+            {
+                FTaskHandle Leaf = Graph.Launch([&]() { ++Leaves; });
+                Graph.Wait(Leaf);
+            }));
+        }
+        Graph.WaitAll(TArrayView<const FTaskHandle>(Children.GetData(), Children.Num()));
+    });
+    Graph.Wait(Root);
+    ASSERT(Leaves == 8);
+
+    // 外部线程主动参与执行
+    std::atomic<uint32> Executed{0};
+    for (int32 i = 0; i < 16; ++i)
+    {
+        Graph.Launch([&]() { ++Executed; });
+    }
+    while (Graph.TryExecuteTask()) {}
+    Graph.Wait(Graph.Launch([]() {}));
+    ASSERT(Executed == 16);
+}
+
+TEST(TaskGraph_Exception)
+{
+    FTaskGraph Graph(2);
+    FTaskHandle Failed = Graph.Launch([]() { THROW_EXCEPTION(FInvalidOperationException, "Task failed"); });
+
+    // 前置任务失败不阻止后续任务
+    bool bDependentRan = false;
+    FTaskHandle Dependent = Graph.Launch([&]() { bDependentRan = true; }, { Failed });
+
+    bool bThrown = false;
+    try
+    {
+        Graph.Wait(Failed);
+    }
+    catch (const FInvalidOperationException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+    Graph.Wait(Dependent);
+    ASSERT(bDependentRan);
+}
+
+TEST(TaskGraph_NestedParallelFor)
+{
+    // ParallelFor 运行在全局调度器上，任务内部嵌套调用
+    constexpr uint32 Outer = 16;
+    constexpr uint32 Inner = 4096;
+    std::atomic<uint64> Sum{0};
+    FTaskGraph& Graph = FTaskGraph::Get();
+    FTaskHandle Task = Graph.Launch([&]()
+    {
+        ParallelForRange(Outer, 1, [&](uint32 Begin, uint32 End)
+        {
+            for (uint32 o = Begin; o < End; ++o)
+            {
+                ParallelForRange(Inner, 256, [&](uint32 InnerBegin, uint32 InnerEnd)
+                {
+                    Sum += InnerEnd - InnerBegin;
+                });
+            }
+        });
+    });
+    Graph.Wait(Task);
+    ASSERT(Sum == Outer * Inner);
+    ASSERT(FParallelFor::GetNumWorkers() == Graph.GetNumWorkerThreads() + 1);
+}
@@ -0,0 +1,60 @@
+#include "TestFramework.h"
+#include "Filters/CellGeometryFilter.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+
+TEST_GROUP(TestCellGeometryFilter)
+
+// 规则六面体网格：体积与中心写入网格单元场
+TEST(CellGeometryFilter_HexGrid)
+{
+    constexpr int32 N = 4;
+    IMesh Mesh("Grid");
+    auto Index = [](int32 x, int32 y, int32 z) { return (z * (N + 1) + y) * (N + 1) + x; };
+    for (int32 z = 0; z <= N; ++z)
+    {
+        for (int32 y = 0; y <= N; ++y)
+        {
+            for (int32 x = 0; x <= N; ++x)
+            {
+                Mesh.AddVertexPosition(static_cast<float>(x) * 0.5f, static_cast<float>(y), static_cast<float>(z) * 2.0f);
+            }
+        }
+    }
+    FCellArray& Cells = Mesh.GetCells();
+    for (int32 z = 0; z < N; ++z)
+    {
+        for (int32 y = 0; y < N; ++y)
+        {
+            for (int32 x = 0; x < N; ++x)
+            {
+                Cells.AddCell(ECellType::Hex, TArray<int32>{
+                    Index(x, y, z), Index(x + 1, y, z), Index(x + 1, y + 1, z), Index(x, y + 1, z),
+                    Index(x, y, z + 1), Index(x + 1, y, z + 1), Index(x + 1, y + 1, z + 1), Index(x, y + 1, z + 1) });
+            }
+        }
+    }
+
+    FField* Volume = FCellGeometryFilter::Execute(Mesh, ECellGeometryQuantity::Volume);
+    ASSERT(Volume != nullptr);
+    ASSERT(Mesh.GetCellField("Volume") == Volume);
+    ASSERT(Volume->GetDataCount() == Cells.GetCellCount());
+
+    bool bAllUnit = true;
+    for (uint32 CellIndex = 0; CellIndex < Volume->GetDataCount(); ++CellIndex)
+    {
+        bAllUnit = bAllUnit && FMath::Abs(Volume->GetScalar(CellIndex) - 1.0f) < 1e-5f;
+    }
+    ASSERT(bAllUnit);
+
+    FField* Centroid = FCellGeometryFilter::Execute(Mesh, ECellGeometryQuantity::Centroid, "Center");
+    ASSERT(Mesh.HasCellField("Center"));
+    ASSERT(Centroid->GetVector(0) == FVector(0.25f, 0.5f, 1.0f));
+
+    // 外部场版本不修改网格
+    FField Normals;
+    FCellGeometryFilter::Execute(static_cast<const IMesh&>(Mesh), ECellGeometryQuantity::Normal, Normals);
+    ASSERT(!Mesh.HasCellField("Normal"));
+    ASSERT(Normals.GetVector(3) == FVector::ZeroVector());
+}
@@ -0,0 +1,430 @@
+#include "TestFramework.h"
+#include "TestMeshUtil.h"
+#include "Filters/ClipFilter.h"
+#include "Filters/CellGeometryFilter.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include "Math/Math.h"
+#include <algorithm>
+#include <cmath>
+
+TEST_GROUP(TestClipFilter)
+
+namespace
+{
+    /** 所有单元的几何量之和 */
+    float SumQuantity(const IMesh& Mesh, ECellGeometryQuantity Quantity)
+    {
+        FField Values;
+        FCellGeometryFilter::Execute(Mesh, Quantity, Values);
+        float Sum = 0.0f;
+        for (uint32 i = 0; i < Values.GetDataCount(); ++i)
+        {
+            Sum += Values.GetScalar(i);
+        }
+        return Sum;
+    }
+
+    /** 所有单元的体积之和 */
+    float SumVolume(const IMesh& Mesh)
+    {
+        return SumQuantity(Mesh, ECellGeometryQuantity::Volume);
+    }
+
+    /** 带符号的四面体体积 */
+    float SignedVolume(const FVector& P0, const FVector& P1, const FVector& P2, const FVector& P3)
+    {
+        return (P1 - P0).Cross(P2 - P0).Dot(P3 - P0) / 6.0f;
+    }
+
+    /** 分解产生的 Tetra / Pyramid / Prism 单元的顶点顺序是否符合单元定义（带符号的体积为正） */
+    bool IsPieceOriented(const IMesh& Mesh)
+    {
+        for (const FCellView Cell : Mesh.GetCells())
+        {
+            if (Cell.CellType != ECellType::Tetra && Cell.CellType != ECellType::Pyramid && Cell.CellType != ECellType::Prism)
+            {
+                continue;
+            }
+            FVector P[6];
+            for (uint32 k = 0; k < Cell.Num(); ++k)
+            {
+                P[k] = Mesh.GetVertexPosition(Cell[k]);
+            }
+            float Volume = SignedVolume(P[0], P[1], P[2], P[3]);
+            if (Cell.CellType == ECellType::Pyramid)
+            {
+                Volume = SignedVolume(P[0], P[1], P[2], P[4]) + SignedVolume(P[0], P[2], P[3], P[4]);
+            }
+            else if (Cell.CellType == ECellType::Prism)
+            {
+                Volume += SignedVolume(P[1], P[2], P[3], P[4]) + SignedVolume(P[2], P[3], P[4], P[5]);
+            }
+            if (Volume <= 0.0f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** 是否没有坐标相同的输出顶点 */
+    bool AreVerticesDistinct(const IMesh& Mesh)
+    {
+        TArray<FVector> Positions = Mesh.GetVerticesPositions();
+        auto Less = [](const FVector& A, const FVector& B)
+        {
+            return A.X != B.X ? A.X < B.X : A.Y != B.Y ? A.Y < B.Y : A.Z < B.Z;
+        };
+        std::sort(Positions.begin(), Positions.end(), Less);
+        return std::adjacent_find(Positions.begin(), Positions.end()) == Positions.end();
+    }
+
+    /** 是否每个输出顶点都被单元使用 */
+    bool AreAllVerticesUsed(const IMesh& Mesh)
+    {
+        TArray<uint8> Used;
+        Used.Resize(Mesh.GetVertexCount());
+        std::fill(Used.begin(), Used.end(), uint8(0));
+        for (const FCellView Cell : Mesh.GetCells())
+        {
+            for (const int32 VertexIndex : Cell)
+            {
+                Used[VertexIndex] = 1;
+            }
+        }
+        return std::all_of(Used.begin(), Used.end(), [](uint8 Flag) { return Flag != 0; });
+    }
+}
+
+// ============================================================================
+// 平面裁剪
+// ============================================================================
+
+TEST(Clip_PlaneHexGrid)
+{
+    constexpr int32 N = 4;
+    IMesh Volume("Volume");
+    BuildHexGridMesh(Volume, N);
+
+    // 保留 x >= 1.5：x 方向第 2、3 层完整保留，第 1 层被分解
+    IMesh Clipped;
+    TArray<int32> ParentCells;
+    FClipFilter::Execute(Volume, FClipFunction::MakePlane(FVector(1.5f, 0.0f, 0.0f), FVector(2.0f, 0.0f, 0.0f)), Clipped, FClipOptions(), &ParentCells);
+
+    ASSERT(Clipped.Validate());
+    ASSERT_EQ(ParentCells.Num(), Clipped.GetCellCount());
+    ASSERT_EQ(Clipped.GetMeshName(), std::string("Volume"));
+    ASSERT_EQ(Clipped.GetCells().GetCellCountByType(ECellType::Hex), static_cast<uint32>(2 * N * N));
+    ASSERT(Clipped.GetCellCount() > static_cast<uint32>(2 * N * N));
+    ASSERT(std::fabs(SumVolume(Clipped) - 2.5f * N * N) < 1e-3f);
+    ASSERT(IsPieceOriented(Clipped));
+    ASSERT(AreAllVerticesUsed(Clipped));
+
+    // 完整保留的单元在前，按输入顺序；分解产生的单元的父单元位于第 1 层
+    for (uint32 i = 0; i < Clipped.GetCellCount(); ++i)
+    {
+        const bool bKept = i < static_cast<uint32>(2 * N * N);
+        ASSERT(bKept == (Clipped.GetCells().GetCellType(i) == ECellType::Hex));
+        ASSERT_EQ(ParentCells[i] % N >= 2, bKept);
+        if (i > 0 && bKept)
+        {
+            ASSERT(ParentCells[i] > ParentCells[i - 1]);
+        }
+    }
+
+    // 顶点场插值、单元场取父单元的值
+    const FField* XField = Clipped.GetVertexField("X");
+    const FField* CellId = Clipped.GetCellField("CellId");
+    ASSERT(XField && CellId);
+    for (uint32 i = 0; i < Clipped.GetVertexCount(); ++i)
+    {
+        const FVector Position = Clipped.GetVertexPosition(i);
+        ASSERT(Position.X >= 1.5f - 1e-5f);
+        ASSERT(std::fabs(XField->GetScalar(i) - Position.X) < 1e-5f);
+    }
+    for (uint32 i = 0; i < Clipped.GetCellCount(); ++i)
+    {
+        ASSERT_EQ(CellId->GetScalar(i), static_cast<float>(ParentCells[i]));
+    }
+
+    // 反转：保留 x <= 1.5
+    FClipOptions Inverted;
+    Inverted.bInvert = true;
+    FClipFilter::Execute(Volume, FClipFunction::MakePlane(FVector(1.5f, 0.0f, 0.0f), FVector(1.0f, 0.0f, 0.0f)), Clipped, Inverted);
+    ASSERT(std::fabs(SumVolume(Clipped) - 1.5f * N * N) < 1e-3f);
+    ASSERT(IsPieceOriented(Clipped));
+
+    // 并行与串行结果一致
+    IMesh Parallel;
+    IMesh Serial;
+    TArray<int32> SerialParents;
+    FClipOptions SerialOptions;
+    SerialOptions.bParallel = false;
+    const FClipFunction Oblique = FClipFunction::MakePlane(FVector(2.0f, 2.0f, 2.0f), FVector(1.0f, 2.0f, 3.0f));
+    FClipFilter::Execute(Volume, Oblique, Parallel, FClipOptions(), &ParentCells);
+    FClipFilter::Execute(Volume, Oblique, Serial, SerialOptions, &SerialParents);
+    ASSERT(ParentCells == SerialParents);
+    ASSERT(Parallel.GetVerticesPositions() == Serial.GetVerticesPositions());
+    ASSERT(std::equal(Parallel.GetCells().GetVertexIndicesView().begin(), Parallel.GetCells().GetVertexIndicesView().end(),
+        Serial.GetCells().GetVertexIndicesView().begin(), Serial.GetCells().GetVertexIndicesView().end()));
+    ASSERT(std::fabs(SumVolume(Parallel) - 32.0f) < 1e-2f);
+    ASSERT(IsPieceOriented(Parallel));
+
+    // 平面在网格外：全部丢弃
+    FClipFilter::Execute(Volume, FClipFunction::MakePlane(FVector(10.0f, 0.0f, 0.0f), FVector(1.0f, 0.0f, 0.0f)), Clipped);
+    ASSERT_EQ(Clipped.GetCellCount(), 0u);
+    ASSERT_EQ(Clipped.GetVertexCount(), 0u);
+}
+
+// ============================================================================
+// 包围盒与标量阈值
+// ============================================================================
+
+TEST(Clip_BoxAndScalar)
+{
+    constexpr int32 N = 4;
+    IMesh Volume("Volume");
+    BuildHexGridMesh(Volume, N);
+
+    // x 方向的盒面切过单元，其余盒面在网格外：保留 3 x 4 x 4
+    IMesh Clipped;
+    FClipFilter::Execute(Volume, FClipFunction::MakeBox(FVector(0.5f, -1.0f, -1.0f), FVector(3.5f, 5.0f, 5.0f)), Clipped);
+    ASSERT(Clipped.Validate());
+    ASSERT(std::fabs(SumVolume(Clipped) - 48.0f) < 1e-3f);
+    ASSERT(IsPieceOriented(Clipped));
+    ASSERT(AreAllVerticesUsed(Clipped));
+    for (uint32 i = 0; i < Clipped.GetVertexCount(); ++i)
+    {
+        const FVector Position = Clipped.GetVertexPosition(i);
+        ASSERT(Position.X >= 0.5f - 1e-5f && Position.X <= 3.5f + 1e-5f);
+    }
+
+    // 盒面与网格面重合：只保留盒内的完整单元，盒面上的顶点不产生零体积的单元
+    TArray<int32> ParentCells;
+    FClipFilter::Execute(Volume, FClipFunction::MakeBox(FVector(1.0f, 1.0f, 1.0f), FVector(3.0f, 3.0f, 3.0f)), Clipped, FClipOptions(), &ParentCells);
+    ASSERT_EQ(Clipped.GetCellCount(), 8u);
+    ASSERT(Clipped.GetCells().IsUniform());
+    ASSERT_EQ(Clipped.GetVertexCount(), 27u);
+    ASSERT(std::fabs(SumVolume(Clipped) - 8.0f) < 1e-5f);
+
+    // 斜平面 x + y = 2 恰好穿过一排节点：节点处的裁剪点与节点合并，不产生重复顶点。
+    // 保留 x + y >= 2 的 6 x 3 个节点，另有 2 个被分解的单元列中各 5 个裁剪点（3 个面对角线中点、2 个体对角线中点）
+    IMesh Small("Small");
+    BuildHexGridMesh(Small, 2);
+    FClipFilter::Execute(Small, FClipFunction::MakePlane(FVector(2.0f, 0.0f, 0.0f), FVector(1.0f, 1.0f, 0.0f)), Clipped);
+    ASSERT(Clipped.Validate());
+    ASSERT_EQ(Clipped.GetVertexCount(), 28u);
+    ASSERT(AreVerticesDistinct(Clipped));
+    ASSERT(AreAllVerticesUsed(Clipped));
+    ASSERT(Clipped.GetCells().GetCellCountByType(ECellType::Pyramid) > 0);
+    ASSERT(IsPieceOriented(Clipped));
+    ASSERT(std::fabs(SumVolume(Clipped) - 4.0f) < 1e-5f);
+
+    // 标量阈值：保留 X <= 2.25
+    FClipOptions Options;
+    Options.bInvert = true;
+    FClipFilter::Execute(Volume, FClipFunction::MakeScalar("X", 2.25f), Clipped, Options);
+    ASSERT(std::fabs(SumVolume(Clipped) - 2.25f * N * N) < 1e-3f);
+    ASSERT(IsPieceOriented(Clipped));
+    const FField* XField = Clipped.GetVertexField("X");
+    ASSERT(XField != nullptr);
+    ASSERT(std::all_of(XField->GetFieldData().begin(), XField->GetFieldData().end(), [](float Value) { return Value <= 2.25f + 1e-5f; }));
+}
+
+// ============================================================================
+// 各单元类型的分解
+// ============================================================================
+
+TEST(Clip_CellTypes)
+{
+    // 参考单元保留 z <= 0.5 的体积；跨越裁剪面的 Quad 单元裁剪为五边形
+    struct FCase
+    {
+        ECellType CellType;
+        TArray<FVector> Vertices;
+        float ExpectedVolume;
+    };
+    const TArray<FCase> Cases = {
+        { ECellType::Tetra, { FVector(0, 0, 0), FVector(1, 0, 0), FVector(0, 1, 0), FVector(0, 0, 1) }, 7.0f / 48.0f },
+        { ECellType::Pyramid, { FVector(0, 0, 0), FVector(1, 0, 0), FVector(1, 1, 0), FVector(0, 1, 0), FVector(0.5f, 0.5f, 1) }, 7.0f / 24.0f },
+        { ECellType::Prism, { FVector(0, 0, 0), FVector(1, 0, 0), FVector(0, 1, 0), FVector(0, 0, 1), FVector(1, 0, 1), FVector(0, 1, 1) }, 0.25f },
+        { ECellType::Hex, { FVector(0, 0, 0), FVector(1, 0, 0), FVector(1, 1, 0), FVector(0, 1, 0),
+                            FVector(0, 0, 1), FVector(1, 0, 1), FVector(1, 1, 1), FVector(0, 1, 1) }, 0.5f },
+    };
+
+    FClipOptions Options;
+    Options.bInvert = true;
+    const FClipFunction Plane = FClipFunction::MakePlane(FVector(0.0f, 0.0f, 0.5f), FVector(0.0f, 0.0f, 1.0f));
+    for (const FCase& Case : Cases)
+    {
+        IMesh Volume;
+        TArray<int32> Indices;
+        for (const FVector& Vertex : Case.Vertices)
+        {
+            Indices.Add(static_cast<int32>(Volume.GetVertexCount()));
+            Volume.AddVertexPosition(Vertex);
+        }
+        Volume.GetCells().AddCell(Case.CellType, Indices);
+        Volume.GetCells().AddCell(ECellType::Quad, TArray<int32>{ Indices[0], Indices[1], Indices.Last(), Indices[2] });
+
+        IMesh Clipped;
+        FClipFilter::Execute(Volume, Plane, Clipped, Options);
+        ASSERT(Clipped.Validate());
+        ASSERT_EQ(Clipped.GetCells().GetCellCountByType(ECellType::Quad), 0u);
+        ASSERT_EQ(Clipped.GetCells().GetCellCountByType(ECellType::Polygon), 1u);
+        ASSERT(std::fabs(SumVolume(Clipped) - Case.ExpectedVolume) < 1e-5f);
+        ASSERT(IsPieceOriented(Clipped));
+        for (uint32 i = 0; i < Clipped.GetVertexCount(); ++i)
+        {
+            ASSERT(Clipped.GetVertexPosition(i).Z <= 0.5f + 1e-6f);
+        }
+    }
+}
+
+TEST(Clip_SurfaceAndLineCells)
+{
+    // 边长为 2 的正方形平面上的各类单元，保留 x <= 1
+    IMesh Surface("Surface");
+    Surface.AddVertexPosition(0.0f, 0.0f, 0.0f);
+    Surface.AddVertexPosition(2.0f, 0.0f, 0.0f);
+    Surface.AddVertexPosition(2.0f, 2.0f, 0.0f);
+    Surface.AddVertexPosition(0.0f, 2.0f, 0.0f);
+    Surface.AddVertexPosition(1.0f, 1.0f, 1.0f);
+    FCellArray& Cells = Surface.GetCells();
+    Cells.AddCell(ECellType::Quad, TArray<int32>{ 0, 1, 2, 3 });
+    Cells.AddCell(ECellType::Triangle, TArray<int32>{ 0, 1, 3 });
+    Cells.AddCell(ECellType::Line, TArray<int32>{ 0, 1 });
+    Cells.AddCell(ECellType::PolyLine, TArray<int32>{ 3, 0, 1, 2 });
+    Cells.AddCell(ECellType::PolyLine, TArray<int32>{ 0, 1, 2, 3 });
+    Cells.AddCell(ECellType::Polyhedron, TArray<int32>{ 0, 1, 2, 3, 4 });
+
+    FClipOptions Options;
+    Options.bInvert = true;
+    IMesh Clipped;
+    TArray<int32> ParentCells;
+    FClipFilter::Execute(Surface, FClipFunction::MakePlane(FVector(1.0f, 0.0f, 0.0f), FVector(1.0f, 0.0f, 0.0f)), Clipped, Options, &ParentCells);
+    ASSERT(Clipped.Validate());
+
+    // 多面体整体保留在前；四边形和三角形裁剪为四边形，线裁剪为线，第一条折线保留一段，第二条折线保留两段
+    const ECellType ExpectedTypes[] = { ECellType::Polyhedron, ECellType::Quad, ECellType::Quad, ECellType::Line,
+                                        ECellType::PolyLine, ECellType::Line, ECellType::Line };
+    const int32 ExpectedParents[] = { 5, 0, 1, 2, 3, 4, 4 };
+    ASSERT_EQ(Clipped.GetCellCount(), 7u);
+    for (uint32 i = 0; i < Clipped.GetCellCount(); ++i)
+    {
+        ASSERT(Clipped.GetCells().GetCellType(i) == ExpectedTypes[i]);
+        ASSERT_EQ(ParentCells[i], ExpectedParents[i]);
+    }
+    ASSERT_EQ(Clipped.GetCells().GetCellView(4).Num(), 3u);
+
+    // 面积与长度；裁剪后的多边形法线方向不变
+    FField Areas;
+    FCellGeometryFilter::Execute(Clipped, ECellGeometryQuantity::Area, Areas);
+    ASSERT(std::fabs(Areas.GetScalar(1) - 2.0f) < 1e-5f);
+    ASSERT(std::fabs(Areas.GetScalar(2) - 1.5f) < 1e-5f);
+    FField Normals;
+    FCellGeometryFilter::Execute(Clipped, ECellGeometryQuantity::Normal, Normals);
+    ASSERT(Normals.GetVector(1).Z > 0.0f && Normals.GetVector(2).Z > 0.0f);
+    FField Sizes;
+    FCellGeometryFilter::Execute(Clipped, ECellGeometryQuantity::Size, Sizes);
+    ASSERT(std::fabs(Sizes.GetScalar(3) - 1.0f) < 1e-5f);
+    ASSERT(std::fabs(Sizes.GetScalar(4) - 3.0f) < 1e-5f);
+
+    // 保留 x >= 2：只在裁剪面上接触的多边形和线不输出，位于裁剪面上的折线段保留
+    FClipFilter::Execute(Surface, FClipFunction::MakePlane(FVector(2.0f, 0.0f, 0.0f), FVector(1.0f, 0.0f, 0.0f)), Clipped, FClipOptions(), &ParentCells);
+    ASSERT(Clipped.Validate());
+    ASSERT_EQ(Clipped.GetCellCount(), 3u);
+    ASSERT(Clipped.GetCells().GetCellType(0) == ECellType::Polyhedron);
+    ASSERT(Clipped.GetCells().GetCellType(1) == ECellType::Line && Clipped.GetCells().GetCellType(2) == ECellType::Line);
+    ASSERT_EQ(ParentCells[1], 3);
+    ASSERT_EQ(ParentCells[2], 4);
+    ASSERT_EQ(Clipped.GetVertexCount(), 5u);
+}
+
+// ============================================================================
+// 不压缩顶点时直接拷贝完整保留的单元
+// ============================================================================
+
+TEST(Clip_KeepInputVertices)
+{
+    constexpr int32 N = 4;
+    IMesh Volume("Volume");
+    BuildHexGridMesh(Volume, N);
+
+    FClipOptions Options;
+    Options.bCompactVertices = false;
+
+    // 全部保留：单元数组与输入相同
+    IMesh Clipped;
+    TArray<int32> ParentCells;
+    FClipFilter::Execute(Volume, FClipFunction::MakePlane(FVector(-1.0f, 0.0f, 0.0f), FVector(1.0f, 0.0f, 0.0f)), Clipped, Options, &ParentCells);
+    ASSERT_EQ(Clipped.GetVertexCount(), Volume.GetVertexCount());
+    ASSERT_EQ(Clipped.GetCellCount(), Volume.GetCellCount());
+    ASSERT(Clipped.GetCells().IsUniform());
+    ASSERT(std::equal(Clipped.GetCells().GetVertexIndicesView().begin(), Clipped.GetCells().GetVertexIndicesView().end(),
+        Volume.GetCells().GetVertexIndicesView().begin(), Volume.GetCells().GetVertexIndicesView().end()));
+    for (uint32 i = 0; i < ParentCells.Num(); ++i)
+    {
+        ASSERT_EQ(ParentCells[i], static_cast<int32>(i));
+    }
+
+    // 部分保留：输入顶点编号不变，完整保留的单元的顶点索引与输入相同，裁剪点追加在后面
+    FClipFilter::Execute(Volume, FClipFunction::MakePlane(FVector(1.5f, 0.0f, 0.0f), FVector(1.0f, 0.0f, 0.0f)), Clipped, Options, &ParentCells);
+    ASSERT(Clipped.Validate());
+    ASSERT(Clipped.GetVertexCount() > Volume.GetVertexCount());
+    for (uint32 i = 0; i < Volume.GetVertexCount(); ++i)
+    {
+        ASSERT(Clipped.GetVertexPosition(i) == Volume.GetVertexPosition(i));
+    }
+    for (uint32 i = 0; i < Clipped.GetCellCount(); ++i)
+    {
+        if (Clipped.GetCells().GetCellType(i) == ECellType::Hex)
+        {
+            const FCellView OutCell = Clipped.GetCells().GetCellView(i);
+            const FCellView InCell = Volume.GetCells().GetCellView(ParentCells[i]);
+            ASSERT(std::equal(OutCell.begin(), OutCell.end(), InCell.begin(), InCell.end()));
+        }
+    }
+    ASSERT(std::fabs(SumVolume(Clipped) - 2.5f * N * N) < 1e-3f);
+}
+
+TEST(Clip_InvalidArguments)
+{
+    IMesh Volume("Volume");
+    BuildHexGridMesh(Volume, 2);
+    IMesh Clipped;
+
+    const TArray<FClipFunction> Functions = {
+        FClipFunction::MakePlane(FVector(1.0f, 1.0f, 1.0f), FVector(0.0f, 0.0f, 0.0f)),
+        FClipFunction::MakeBox(FVector(1.0f, 0.0f, 0.0f), FVector(0.0f, 1.0f, 1.0f)),
+        FClipFunction::MakeScalar("Missing", 0.0f),
+        FClipFunction::MakeScalar("CellId", 0.0f),
+    };
+    for (const FClipFunction& Function : Functions)
+    {
+        bool bThrown = false;
+        try
+        {
+            FClipFilter::Execute(Volume, Function, Clipped);
+        }
+        catch (const FInvalidArgumentException&)
+        {
+            bThrown = true;
+        }
+        ASSERT(bThrown);
+    }
+
+    bool bThrown = false;
+    try
+    {
+        FClipFilter::Execute(Volume, FClipFunction::MakePlane(FVector(1.0f, 1.0f, 1.0f), FVector(1.0f, 0.0f, 0.0f)), Volume);
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+}
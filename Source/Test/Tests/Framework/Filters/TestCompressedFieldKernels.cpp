@@ -0,0 +1,177 @@
+#include "TestFramework.h"
+#include "Filters/ScalarSpanIndex.h"
+#include "Filters/ThresholdFilter.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Field/FieldCompression.h"
+#include "Container/CellArray.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+
+TEST_GROUP(TestCompressedFieldKernels)
+
+namespace
+{
+    /** 是否记录分配（只在被测调用期间开启） */
+    std::atomic<bool> bTrackAllocations{false};
+
+    /** 记录期间最大的单次分配字节数 */
+    std::atomic<size_t> LargestAllocation{0};
+
+    void RecordAllocation(size_t Size)
+    {
+        if (bTrackAllocations.load(std::memory_order_relaxed))
+        {
+            size_t Largest = LargestAllocation.load(std::memory_order_relaxed);
+            while (Size > Largest && !LargestAllocation.compare_exchange_weak(Largest, Size, std::memory_order_relaxed))
+            {
+            }
+        }
+    }
+
+    /** 执行函数，返回期间（包括工作线程上）最大的单次分配字节数 */
+    template<typename FuncType>
+    size_t MeasureLargestAllocation(FuncType&& Func)
+    {
+        LargestAllocation.store(0);
+        bTrackAllocations.store(true);
+        Func();
+        bTrackAllocations.store(false);
+        return LargestAllocation.load();
+    }
+
+    /**
+     * 构造 VertexCount 个顶点的网格：顶点场 "Value" 为平滑数据，
+     * 每 8 个顶点一条线单元（单元数只有顶点数的 1/8，索引本身的分配小于整个场）
+     */
+    void BuildLineMesh(IMesh& Mesh, uint32 VertexCount)
+    {
+        TUniquePtr<FField> Value = MakeUnique<FField>("Value", EFieldType::Scalar, EFieldAttachment::Vertex);
+        TArray<float> Values;
+        Values.Resize(VertexCount);
+        for (uint32 i = 0; i < VertexCount; ++i)
+        {
+            Mesh.AddVertexPosition(static_cast<float>(i), 0.0f, 0.0f);
+            Values[i] = 100.0f * std::sin(0.0001f * static_cast<float>(i));
+        }
+        Value->SetScalarData(Values);
+
+        FCellArray& Cells = Mesh.GetCells();
+        for (uint32 i = 0; i + 7 < VertexCount; i += 8)
+        {
+            Cells.AddCell(ECellType::Line, TArray<int32>{ static_cast<int32>(i), static_cast<int32>(i + 7) });
+        }
+        Mesh.AddField(std::move(Value));
+    }
+}
+
+// 以下替换全局分配函数，记录被测调用期间的单次分配大小（未记录时行为与默认实现相同）
+
+void* operator new(std::size_t Size)
+{
+    RecordAllocation(Size);
+    if (void* Pointer = std::malloc(Size != 0 ? Size : 1))
+    {
+        return Pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t Size, std::align_val_t Alignment)
+{
+    RecordAllocation(Size);
+    const size_t AlignValue = static_cast<size_t>(Alignment);
+#if PLATFORM_WINDOWS
+    void* Pointer = _aligned_malloc(Size != 0 ? Size : 1, AlignValue);
+#else
+    void* Pointer = std::aligned_alloc(AlignValue, (std::max<size_t>(Size, 1) + AlignValue - 1) / AlignValue * AlignValue);
+#endif
+    if (Pointer)
+    {
+        return Pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* Pointer) noexcept
+{
+    std::free(Pointer);
+}
+
+void operator delete(void* Pointer, std::size_t) noexcept
+{
+    std::free(Pointer);
+}
+
+void operator delete(void* Pointer, std::align_val_t) noexcept
+{
+#if PLATFORM_WINDOWS
+    _aligned_free(Pointer);
+#else
+    std::free(Pointer);
+#endif
+}
+
+void operator delete(void* Pointer, std::size_t, std::align_val_t) noexcept
+{
+    operator delete(Pointer, std::align_val_t(0));
+}
+
+// 压缩场的数据范围、阈值位图和区间索引逐块解码：结果与未压缩时相同，且从不分配整个场大小的解压副本
+TEST(CompressedKernels_NoFullDecode)
+{
+    constexpr uint32 VertexCount = 1u << 20;
+    IMesh Mesh("Compressed");
+    BuildLineMesh(Mesh, VertexCount);
+    const FField Plain = *Mesh.GetVertexField("Value");
+
+    FFieldCompressionOptions Options;
+    Options.BlockElementCount = 1000;  // 块的起点不按 64 对齐
+    Mesh.GetVertexField("Value")->Compress(Options);
+    const FField& Compressed = *Mesh.GetVertexField("Value");
+    ASSERT(Compressed.IsCompressed());
+    ASSERT(!Compressed.IsDataRangeValid());
+    const size_t DecodedSize = Compressed.GetCompressedData()->GetUncompressedSize();
+
+    // 数据范围
+    float PlainMin = 0.0f;
+    float PlainMax = 0.0f;
+    ASSERT(Plain.GetDataRange(0, PlainMin, PlainMax));
+    float Min = 0.0f;
+    float Max = 0.0f;
+    ASSERT(MeasureLargestAllocation([&]() { (void)Compressed.GetDataRange(0, Min, Max); }) < DecodedSize);
+    ASSERT_EQ(Min, PlainMin);
+    ASSERT_EQ(Max, PlainMax);
+
+    // 阈值位图（包括反转）
+    for (const bool bInvert : { false, true })
+    {
+        FThresholdOptions ThresholdOptions;
+        ThresholdOptions.bInvert = bInvert;
+        TArray<uint64> PlainMask;
+        const uint32 PlainCount = FThresholdFilter::ComputeMask(Plain, -20.0f, 35.0f, PlainMask, ThresholdOptions);
+        TArray<uint64> Mask;
+        uint32 Count = 0;
+        ASSERT(MeasureLargestAllocation([&]() { Count = FThresholdFilter::ComputeMask(Compressed, -20.0f, 35.0f, Mask, ThresholdOptions); }) < DecodedSize);
+        ASSERT_EQ(Count, PlainCount);
+        ASSERT(Mask == PlainMask);
+    }
+
+    // 区间索引
+    FScalarSpanIndex PlainIndex;
+    PlainIndex.Build(Mesh, Plain);
+    FScalarSpanIndex Index;
+    ASSERT(MeasureLargestAllocation([&]() { Index.Build(Mesh, Compressed); }) < DecodedSize);
+    for (const float IsoValue : { -50.0f, 0.0f, 99.5f })
+    {
+        TArray<uint32> Expected;
+        TArray<uint32> Cells;
+        PlainIndex.Query(IsoValue, Expected);
+        Index.Query(IsoValue, Cells);
+        ASSERT(!Cells.IsEmpty());
+        ASSERT(Cells == Expected);
+    }
+}
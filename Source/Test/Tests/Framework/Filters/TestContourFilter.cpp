@@ -0,0 +1,267 @@
+#include "TestFramework.h"
+#include "TestMeshUtil.h"
+#include "Filters/ContourFilter.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include "Math/Math.h"
+#include <algorithm>
+#include <cmath>
+
+TEST_GROUP(TestContourFilter)
+
+namespace
+{
+    /** 三角形面积之和，同时检查法线与 Direction 同向 */
+    float SumArea(const IMesh& Surface, const FVector& Direction, bool& bOriented)
+    {
+        float Area = 0.0f;
+        bOriented = true;
+        for (const FCellView Cell : Surface.GetCells())
+        {
+            const FVector V0 = Surface.GetVertexPosition(Cell[0]);
+            const FVector Normal = (Surface.GetVertexPosition(Cell[1]) - V0).Cross(Surface.GetVertexPosition(Cell[2]) - V0);
+            Area += 0.5f * Normal.Size();
+            if (Normal.Dot(Direction) <= 0.0f)
+            {
+                bOriented = false;
+            }
+        }
+        return Area;
+    }
+}
+
+// ============================================================================
+// 六面体网格的平面等值面
+// ============================================================================
+
+TEST(Contour_HexGridPlane)
+{
+    constexpr int32 N = 4;
+    IMesh Volume("Volume");
+    BuildHexGridMesh(Volume, N);
+
+    IMesh Surface;
+    TArray<int32> ParentCells;
+    FContourFilter::Execute(Volume, "X", 1.25f, Surface, FContourOptions(), &ParentCells);
+
+    ASSERT(Surface.GetCellCount() > 0);
+    ASSERT(Surface.GetCells().IsUniform());
+    ASSERT(Surface.GetCells().GetUniformCellType() == ECellType::Triangle);
+    ASSERT(Surface.Validate());
+    ASSERT_EQ(ParentCells.Num(), Surface.GetCellCount());
+
+    // 等值面为 x = 1.25 的平面，面积 N * N，法线指向 x 增大的方向
+    bool bOriented = false;
+    const float Area = SumArea(Surface, FVector(1.0f, 0.0f, 0.0f), bOriented);
+    ASSERT(std::fabs(Area - static_cast<float>(N * N)) < 1e-3f);
+    ASSERT(bOriented);
+
+    // 顶点场插值、单元场取父单元的值
+    const FField* XField = Surface.GetVertexField("X");
+    const FField* YField = Surface.GetVertexField("Y");
+    const FField* CellId = Surface.GetCellField("CellId");
+    ASSERT(XField && YField && CellId);
+    for (uint32 i = 0; i < Surface.GetVertexCount(); ++i)
+    {
+        const FVector Position = Surface.GetVertexPosition(i);
+        ASSERT(std::fabs(Position.X - 1.25f) < 1e-5f);
+        ASSERT(std::fabs(XField->GetScalar(i) - 1.25f) < 1e-5f);
+        ASSERT(std::fabs(YField->GetScalar(i) - Position.Y) < 1e-5f);
+    }
+    for (uint32 i = 0; i < Surface.GetCellCount(); ++i)
+    {
+        ASSERT_EQ(CellId->GetScalar(i), static_cast<float>(ParentCells[i]));
+        ASSERT_EQ(ParentCells[i] % N, 1);
+    }
+
+    // 共享边上的点只输出一次
+    TArray<FVector> Positions = Surface.GetVerticesPositions();
+    std::sort(Positions.begin(), Positions.end(), [](const FVector& A, const FVector& B)
+    {
+        return A.X != B.X ? A.X < B.X : (A.Y != B.Y ? A.Y < B.Y : A.Z < B.Z);
+    });
+    ASSERT(std::adjacent_find(Positions.begin(), Positions.end()) == Positions.end());
+
+    // 等值在范围外时输出为空
+    FContourFilter::Execute(Volume, "X", 10.0f, Surface);
+    ASSERT_EQ(Surface.GetCellCount(), 0u);
+    ASSERT_EQ(Surface.GetVertexCount(), 0u);
+}
+
+// ============================================================================
+// 各单元类型的情况表
+// ============================================================================
+
+TEST(Contour_CellTypes)
+{
+    // 参考单元在 z = 0.5 处的截面面积
+    struct FCase
+    {
+        ECellType CellType;
+        TArray<FVector> Vertices;
+        float ExpectedArea;
+    };
+    const TArray<FCase> Cases = {
+        { ECellType::Tetra, { FVector(0, 0, 0), FVector(1, 0, 0), FVector(0, 1, 0), FVector(0, 0, 1) }, 0.125f },
+        { ECellType::Pyramid, { FVector(0, 0, 0), FVector(1, 0, 0), FVector(1, 1, 0), FVector(0, 1, 0), FVector(0.5f, 0.5f, 1) }, 0.25f },
+        { ECellType::Prism, { FVector(0, 0, 0), FVector(1, 0, 0), FVector(0, 1, 0), FVector(0, 0, 1), FVector(1, 0, 1), FVector(0, 1, 1) }, 0.5f },
+        { ECellType::Hex, { FVector(0, 0, 0), FVector(1, 0, 0), FVector(1, 1, 0), FVector(0, 1, 0),
+                            FVector(0, 0, 1), FVector(1, 0, 1), FVector(1, 1, 1), FVector(0, 1, 1) }, 1.0f },
+    };
+
+    for (const FCase& Case : Cases)
+    {
+        IMesh Volume;
+        TUniquePtr<FField> Height = MakeUnique<FField>("Height", EFieldType::Scalar, EFieldAttachment::Vertex);
+        TArray<int32> Indices;
+        for (const FVector& Vertex : Case.Vertices)
+        {
+            Indices.Add(static_cast<int32>(Volume.GetVertexCount()));
+            Volume.AddVertexPosition(Vertex);
+            Height->AddScalar(Vertex.Z);
+        }
+        Volume.GetCells().AddCell(Case.CellType, Indices);
+        Volume.AddField(std::move(Height));
+
+        IMesh Surface;
+        FContourFilter::Execute(Volume, "Height", 0.5f, Surface);
+        bool bOriented = false;
+        ASSERT(std::fabs(SumArea(Surface, FVector(0.0f, 0.0f, 1.0f), bOriented) - Case.ExpectedArea) < 1e-5f);
+        ASSERT(bOriented);
+
+        // 反向的标量场：法线随之反向
+        for (uint32 i = 0; i < Case.Vertices.Num(); ++i)
+        {
+            Volume.GetVertexField("Height")->SetScalar(i, -Case.Vertices[i].Z);
+        }
+        FContourFilter::Execute(Volume, "Height", -0.5f, Surface);
+        ASSERT(std::fabs(SumArea(Surface, FVector(0.0f, 0.0f, -1.0f), bOriented) - Case.ExpectedArea) < 1e-5f);
+        ASSERT(bOriented);
+    }
+}
+
+// ============================================================================
+// 分块范围复用与错误处理
+// ============================================================================
+
+TEST(Contour_ChunkRanges)
+{
+    constexpr int32 N = 8;
+    IMesh Volume("Volume");
+    BuildHexGridMesh(Volume, N);
+    const FField* XField = Volume.GetVertexField("X");
+
+    // 每块一行单元（同一行的 x 范围为 [0, N]），每 N 行的 y 范围相同
+    FScalarChunkRanges Ranges;
+    Ranges.Build(Volume, *Volume.GetVertexField("Y"), N);
+    ASSERT(Ranges.IsBuiltFor(Volume, *Volume.GetVertexField("Y")));
+    ASSERT(!Ranges.IsBuiltFor(Volume, *XField));
+    ASSERT_EQ(Ranges.GetChunkCount(), static_cast<uint32>(N * N));
+    ASSERT_EQ(Ranges.GetChunkMin(3), 3.0f);
+    ASSERT_EQ(Ranges.GetChunkMax(3), 4.0f);
+    ASSERT(Ranges.MayIntersect(3, 3.5f));
+    ASSERT(Ranges.MayIntersect(3, 4.0f));
+    ASSERT(!Ranges.MayIntersect(3, 3.0f));
+    ASSERT(!Ranges.MayIntersect(3, 4.5f));
+
+    // 使用预先计算的范围与临时计算的结果一致，并行与串行的结果一致
+    FContourOptions Options;
+    Options.ChunkRanges = &Ranges;
+    IMesh WithRanges;
+    IMesh Reference;
+    TArray<int32> ParentsWithRanges;
+    TArray<int32> ReferenceParents;
+    FContourFilter::Execute(Volume, "Y", 3.5f, WithRanges, Options, &ParentsWithRanges);
+    FContourOptions Serial;
+    Serial.bParallel = false;
+    FContourFilter::Execute(Volume, "Y", 3.5f, Reference, Serial, &ReferenceParents);
+    ASSERT(WithRanges.GetCellCount() > 0);
+    ASSERT_EQ(WithRanges.GetCellCount(), Reference.GetCellCount());
+    ASSERT(ParentsWithRanges == ReferenceParents);
+    ASSERT(WithRanges.GetVerticesPositions() == Reference.GetVerticesPositions());
+    const TArrayView<const int32> Indices = WithRanges.GetCells().GetVertexIndicesView();
+    const TArrayView<const int32> ReferenceIndices = Reference.GetCells().GetVertexIndicesView();
+    ASSERT(std::equal(Indices.begin(), Indices.end(), ReferenceIndices.begin(), ReferenceIndices.end()));
+
+    // 单元数组修改后范围失效
+    Volume.GetCells().RemoveCell(0);
+    ASSERT(!Ranges.IsBuiltFor(Volume, *Volume.GetVertexField("Y")));
+
+    bool bThrown = false;
+    try
+    {
+        FContourFilter::Execute(Volume, "CellId", 1.0f, WithRanges);
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+}
+
+// ============================================================================
+// 闭合等值面
+// ============================================================================
+
+TEST(Contour_ClosedSphere)
+{
+    constexpr int32 N = 40;
+    IMesh Volume("Volume");
+    BuildHexGridMesh(Volume, N);
+    TUniquePtr<FField> Distance = MakeUnique<FField>("Distance", EFieldType::Scalar, EFieldAttachment::Vertex);
+    const FVector Center(N * 0.5f, N * 0.5f, N * 0.5f);
+    for (uint32 i = 0; i < Volume.GetVertexCount(); ++i)
+    {
+        Distance->AddScalar((Volume.GetVertexPosition(i) - Center).Size());
+    }
+    Volume.AddField(std::move(Distance));
+
+    IMesh Surface;
+    FContourFilter::Execute(Volume, "Distance", 15.0f, Surface);
+    ASSERT(Surface.GetCellCount() > 20000u);
+
+    // 每条边恰好被两个三角形共享（相邻单元、相邻块之间的点都已合并）
+    TArray<uint64> Edges;
+    for (const FCellView Cell : Surface.GetCells())
+    {
+        for (uint32 k = 0; k < 3; ++k)
+        {
+            const uint64 A = static_cast<uint64>(Cell[k]);
+            const uint64 B = static_cast<uint64>(Cell[(k + 1) % 3]);
+            Edges.Add(A < B ? (A << 32) | B : (B << 32) | A);
+        }
+    }
+    std::sort(Edges.begin(), Edges.end());
+    bool bClosed = true;
+    for (uint32 i = 0; i < Edges.Num(); i += 2)
+    {
+        if (i + 1 >= Edges.Num() || Edges[i] != Edges[i + 1] || (i + 2 < Edges.Num() && Edges[i + 2] == Edges[i]))
+        {
+            bClosed = false;
+            break;
+        }
+    }
+    ASSERT(bClosed);
+
+    // 法线朝外（标量增大的方向）
+    bool bOutward = true;
+    for (const FCellView Cell : Surface.GetCells())
+    {
+        const FVector V0 = Surface.GetVertexPosition(Cell[0]);
+        const FVector Normal = (Surface.GetVertexPosition(Cell[1]) - V0).Cross(Surface.GetVertexPosition(Cell[2]) - V0);
+        if (Normal.Dot(V0 - Center) < 0.0f)
+        {
+            bOutward = false;
+        }
+    }
+    ASSERT(bOutward);
+
+    // 并行结果与串行一致
+    FContourOptions Serial;
+    Serial.bParallel = false;
+    IMesh Reference;
+    FContourFilter::Execute(Volume, "Distance", 15.0f, Reference, Serial);
+    ASSERT(Surface.GetVerticesPositions() == Reference.GetVerticesPositions());
+}
@@ -0,0 +1,207 @@
+#include "TestFramework.h"
+#include "TestMeshUtil.h"
+#include "Filters/CutFilter.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include "Math/Math.h"
+#include <cmath>
+#include <limits>
+
+TEST_GROUP(TestCutFilter)
+
+namespace
+{
+    /** 三角形 [Begin, End) 的面积之和，同时检查法线与 Direction 同向（平面经过顶点时产生的退化三角形除外） */
+    float SumArea(const IMesh& Surface, uint32 Begin, uint32 End, const FVector& Direction, bool& bOriented)
+    {
+        float Area = 0.0f;
+        bOriented = true;
+        for (uint32 i = Begin; i < End; ++i)
+        {
+            const FCellView Cell = Surface.GetCells().GetCellView(i);
+            const FVector V0 = Surface.GetVertexPosition(Cell[0]);
+            const FVector Normal = (Surface.GetVertexPosition(Cell[1]) - V0).Cross(Surface.GetVertexPosition(Cell[2]) - V0);
+            Area += 0.5f * Normal.Size();
+            if (Normal.Dot(Direction.GetSafeNormal()) < -1e-4f)
+            {
+                bOriented = false;
+            }
+        }
+        return Area;
+    }
+}
+
+// ============================================================================
+// 单个平面
+// ============================================================================
+
+TEST(Cut_HexGridPlane)
+{
+    constexpr int32 N = 4;
+    IMesh Volume("Volume");
+    BuildHexGridMesh(Volume, N);
+
+    // 法线不需要单位长度
+    IMesh Section;
+    TArray<int32> ParentCells;
+    FCutFilter::Execute(Volume, FVector(0.0f, 0.0f, 1.5f), FVector(0.0f, 0.0f, 2.0f), Section, FCutOptions(), &ParentCells);
+
+    ASSERT(Section.GetCellCount() > 0);
+    ASSERT(Section.GetCells().GetUniformCellType() == ECellType::Triangle);
+    ASSERT(Section.Validate());
+    ASSERT_EQ(ParentCells.Num(), Section.GetCellCount());
+    ASSERT_EQ(Section.GetMeshName(), std::string("Volume"));
+
+    // 截面为 z = 1.5 的正方形，法线与平面法线同向
+    bool bOriented = false;
+    const float Area = SumArea(Section, 0, Section.GetCellCount(), FVector(0.0f, 0.0f, 1.0f), bOriented);
+    ASSERT(std::fabs(Area - static_cast<float>(N * N)) < 1e-3f);
+    ASSERT(bOriented);
+
+    // 顶点场插值、单元场取父单元的值
+    const FField* XField = Section.GetVertexField("X");
+    const FField* CellId = Section.GetCellField("CellId");
+    ASSERT(XField && CellId);
+    for (uint32 i = 0; i < Section.GetVertexCount(); ++i)
+    {
+        const FVector Position = Section.GetVertexPosition(i);
+        ASSERT(std::fabs(Position.Z - 1.5f) < 1e-5f);
+        ASSERT(std::fabs(XField->GetScalar(i) - Position.X) < 1e-5f);
+    }
+    for (uint32 i = 0; i < Section.GetCellCount(); ++i)
+    {
+        ASSERT_EQ(CellId->GetScalar(i), static_cast<float>(ParentCells[i]));
+        ASSERT_EQ(ParentCells[i] / (N * N), 1);
+    }
+
+    // 过中心的斜截面为正六边形，面积 3√3/4 * N²；截面点都在平面上
+    const FVector Center(N * 0.5f, N * 0.5f, N * 0.5f);
+    const FVector Normal(1.0f, 1.0f, 1.0f);
+    FCutOptions Options;
+    Options.bPassVertexFields = false;
+    Options.bPassCellFields = false;
+    FCutFilter::Execute(Volume, Center, Normal, Section, Options);
+    ASSERT(Section.GetVertexField("X") == nullptr);
+    ASSERT(Section.GetCellField("CellId") == nullptr);
+    const float HexagonArea = SumArea(Section, 0, Section.GetCellCount(), Normal, bOriented);
+    ASSERT(std::fabs(HexagonArea - 3.0f * std::sqrt(3.0f) / 4.0f * N * N) < 1e-3f);
+    ASSERT(bOriented);
+    for (uint32 i = 0; i < Section.GetVertexCount(); ++i)
+    {
+        ASSERT(std::fabs(Normal.GetSafeNormal().Dot(Section.GetVertexPosition(i) - Center)) < 1e-4f);
+    }
+
+    // 平面不与网格相交时输出为空
+    FCutFilter::Execute(Volume, FVector(0.0f, 0.0f, 10.0f), FVector(0.0f, 0.0f, 1.0f), Section);
+    ASSERT_EQ(Section.GetCellCount(), 0u);
+    ASSERT_EQ(Section.GetVertexCount(), 0u);
+}
+
+// ============================================================================
+// 多个平行平面
+// ============================================================================
+
+TEST(Cut_MultiplePlanes)
+{
+    constexpr int32 N = 40;
+    IMesh Volume("Volume");
+    BuildHexGridMesh(Volume, N);
+
+    // 偏移不必有序，可以重复，可以在网格外
+    const TArray<float> Offsets = { 20.5f, 0.25f, 37.75f, 100.0f, 0.25f, 12.0f };
+    const FVector Origin(0.0f, 0.0f, 0.0f);
+    const FVector Normal(0.0f, 0.0f, 1.0f);
+    IMesh Stack;
+    TArray<int32> ParentCells;
+    TArray<uint32> PlaneStarts;
+    FCutFilter::Execute(Volume, Origin, Normal, Offsets, Stack, FCutOptions(), &ParentCells, &PlaneStarts);
+
+    ASSERT_EQ(PlaneStarts.Num(), Offsets.Num() + 1);
+    ASSERT_EQ(PlaneStarts[0], 0u);
+    ASSERT_EQ(PlaneStarts.Last(), Stack.GetCellCount());
+    ASSERT(Stack.Validate());
+
+    IMesh Single;
+    TArray<int32> SingleParents;
+    FCutOptions Serial;
+    Serial.bParallel = false;
+    for (uint32 Plane = 0; Plane < Offsets.Num(); ++Plane)
+    {
+        // 每个平面的截面与单独切片的结果一致
+        FCutFilter::Execute(Volume, Origin + Normal * Offsets[Plane], Normal, Single, Serial, &SingleParents);
+        ASSERT_EQ(PlaneStarts[Plane + 1] - PlaneStarts[Plane], Single.GetCellCount());
+
+        bool bOriented = false;
+        const float Area = SumArea(Stack, PlaneStarts[Plane], PlaneStarts[Plane + 1], Normal, bOriented);
+        const float ExpectedArea = Offsets[Plane] <= static_cast<float>(N) ? static_cast<float>(N * N) : 0.0f;
+        ASSERT(std::fabs(Area - ExpectedArea) < 1e-1f);
+        ASSERT(bOriented);
+
+        for (uint32 i = 0; i < Single.GetCellCount(); ++i)
+        {
+            const uint32 StackTriangle = PlaneStarts[Plane] + i;
+            ASSERT_EQ(ParentCells[StackTriangle], SingleParents[i]);
+            const FCellView StackCell = Stack.GetCells().GetCellView(StackTriangle);
+            const FCellView SingleCell = Single.GetCells().GetCellView(i);
+            for (uint32 Corner = 0; Corner < 3; ++Corner)
+            {
+                ASSERT(Stack.GetVertexPosition(StackCell[Corner]).IsNearlyEqual(Single.GetVertexPosition(SingleCell[Corner]), 1e-4f));
+            }
+        }
+    }
+
+    // 并行与串行结果一致
+    IMesh SerialStack;
+    TArray<int32> SerialParents;
+    FCutFilter::Execute(Volume, Origin, Normal, Offsets, SerialStack, Serial, &SerialParents);
+    ASSERT(SerialParents == ParentCells);
+    ASSERT(SerialStack.GetVerticesPositions() == Stack.GetVerticesPositions());
+
+    // 没有平面时输出为空
+    FCutFilter::Execute(Volume, Origin, Normal, TArray<float>(), Stack, FCutOptions(), nullptr, &PlaneStarts);
+    ASSERT_EQ(Stack.GetCellCount(), 0u);
+    ASSERT_EQ(PlaneStarts.Num(), 1u);
+}
+
+TEST(Cut_InvalidArguments)
+{
+    IMesh Volume("Volume");
+    BuildHexGridMesh(Volume, 2);
+    IMesh Section;
+
+    bool bThrown = false;
+    try
+    {
+        FCutFilter::Execute(Volume, FVector(1.0f, 1.0f, 1.0f), FVector(0.0f, 0.0f, 0.0f), Section);
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+
+    bThrown = false;
+    try
+    {
+        FCutFilter::Execute(Volume, FVector(1.0f, 1.0f, 1.0f), FVector(0.0f, 0.0f, 1.0f),
+            TArray<float>{ 0.0f, std::numeric_limits<float>::quiet_NaN() }, Section);
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+
+    bThrown = false;
+    try
+    {
+        FCutFilter::Execute(Volume, FVector(1.0f, 1.0f, 1.0f), FVector(0.0f, 0.0f, 1.0f), Volume);
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+}
@@ -0,0 +1,120 @@
+#include "TestFramework.h"
+#include "TestMeshUtil.h"
+#include "Filters/ExtractSurfaceFilter.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "Math/Math.h"
+
+TEST_GROUP(TestExtractSurfaceFilter)
+
+// ============================================================================
+// 六面体网格表面提取
+// ============================================================================
+
+TEST(ExtractSurface_HexGrid)
+{
+    constexpr int32 N = 3;
+    IMesh Volume("Volume");
+    BuildHexGridMesh(Volume, N);
+
+    IMesh Surface;
+    TArray<int32> ParentCells;
+    FExtractSurfaceFilter::Execute(Volume, Surface, FExtractSurfaceOptions(), &ParentCells);
+
+    // 6 个面，每个面 N x N 个四边形；内部顶点被删除
+    ASSERT(Surface.GetCellCount() == 6 * N * N);
+    ASSERT(Surface.GetVertexCount() == (N + 1) * (N + 1) * (N + 1) - (N - 1) * (N - 1) * (N - 1));
+    ASSERT(Surface.GetCells().IsUniform());
+    ASSERT(Surface.GetCells().GetUniformCellType() == ECellType::Quad);
+    ASSERT(Surface.Validate());
+    ASSERT(ParentCells.Num() == 6 * N * N);
+
+    // 单元场取父单元的值
+    const FField* CellId = Surface.GetCellField("CellId");
+    ASSERT(CellId != nullptr);
+    for (uint32 i = 0; i < Surface.GetCellCount(); ++i)
+    {
+        ASSERT_EQ(CellId->GetScalar(i), static_cast<float>(ParentCells[i]));
+    }
+
+    // 顶点场随顶点压缩，坐标与原顶点一致
+    const FField* VertexIndexField = Surface.GetVertexField("Index");
+    ASSERT(VertexIndexField != nullptr && VertexIndexField->GetDataCount() == Surface.GetVertexCount());
+    for (uint32 i = 0; i < Surface.GetVertexCount(); ++i)
+    {
+        const uint32 Original = static_cast<uint32>(VertexIndexField->GetScalar(i));
+        ASSERT(Surface.GetVertexPosition(i) == Volume.GetVertexPosition(Original));
+    }
+
+    // 表面四边形的法线朝外
+    const FVector Center(N * 0.5f, N * 0.5f, N * 0.5f);
+    for (const FCellView Cell : Surface.GetCells())
+    {
+        const FVector V0 = Surface.GetVertexPosition(Cell[0]);
+        const FVector Normal = (Surface.GetVertexPosition(Cell[1]) - V0).Cross(Surface.GetVertexPosition(Cell[2]) - V0);
+        ASSERT(Normal.Dot(V0 - Center) > 0.0f);
+    }
+}
+
+TEST(ExtractSurface_KeepVertices)
+{
+    IMesh Volume("Volume");
+    BuildHexGridMesh(Volume, 2);
+
+    FExtractSurfaceOptions Options;
+    Options.bCompactVertices = false;
+    Options.bPassCellFields = false;
+    Options.bParallel = false;
+
+    IMesh Surface;
+    FExtractSurfaceFilter::Execute(Volume, Surface, Options);
+
+    ASSERT(Surface.GetCellCount() == 24);
+    ASSERT(Surface.GetVertexCount() == Volume.GetVertexCount());
+    ASSERT(Surface.GetVertexField("Index")->GetDataCount() == Volume.GetVertexCount());
+    ASSERT(!Surface.HasCellField("CellId"));
+
+    // 中心顶点 (1,1,1) 不被任何表面单元使用
+    ASSERT(Surface.GetCellsUsingVertex(13).IsEmpty());
+    ASSERT(Surface.Validate());
+}
+
+// ============================================================================
+// 混合单元
+// ============================================================================
+
+TEST(ExtractSurface_MixedCells)
+{
+    IMesh Volume("Mixed");
+    Volume.AddVertexPosition(0.0f, 0.0f, 0.0f);
+    Volume.AddVertexPosition(1.0f, 0.0f, 0.0f);
+    Volume.AddVertexPosition(0.0f, 1.0f, 0.0f);
+    Volume.AddVertexPosition(0.0f, 0.0f, 1.0f);
+    Volume.AddVertexPosition(1.0f, 1.0f, 1.0f);
+    Volume.AddVertexPosition(5.0f, 5.0f, 5.0f);
+    Volume.AddVertexPosition(6.0f, 5.0f, 5.0f);
+
+    FCellArray& Cells = Volume.GetCells();
+    // 两个共享面 (1,2,3) 的四面体
+    Cells.AddCell(ECellType::Tetra, TArray<int32>{0, 1, 2, 3});
+    Cells.AddCell(ECellType::Tetra, TArray<int32>{1, 2, 3, 4});
+    // 独立的线单元原样输出
+    Cells.AddCell(ECellType::Line, TArray<int32>{5, 6});
+
+    IMesh Surface;
+    TArray<int32> ParentCells;
+    FExtractSurfaceFilter::Execute(Volume, Surface, FExtractSurfaceOptions(), &ParentCells);
+
+    ASSERT(Surface.GetCellCount() == 7);
+    ASSERT(Surface.GetCells().GetCellCountByType(ECellType::Triangle) == 6);
+    ASSERT(Surface.GetCells().GetCellCountByType(ECellType::Line) == 1);
+    ASSERT(Surface.GetVertexCount() == 7);
+    ASSERT(ParentCells[6] == 2);
+
+    FExtractSurfaceOptions Options;
+    Options.bPassLowerDimensionCells = false;
+    FExtractSurfaceFilter::Execute(Volume, Surface, Options);
+    ASSERT(Surface.GetCellCount() == 6);
+    ASSERT(Surface.GetVertexCount() == 5);
+}
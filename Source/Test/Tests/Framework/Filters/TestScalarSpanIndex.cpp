@@ -0,0 +1,167 @@
+#include "TestFramework.h"
+#include "Filters/ScalarSpanIndex.h"
+#include "Filters/ContourFilter.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include <algorithm>
+
+TEST_GROUP(TestScalarSpanIndex)
+
+namespace
+{
+    /** 生成 N x N x N 的规则六面体网格，顶点场 "Noise" 为伪随机值 */
+    void BuildNoiseGridMesh(IMesh& Mesh, int32 N)
+    {
+        auto Index = [N](int32 x, int32 y, int32 z) { return (z * (N + 1) + y) * (N + 1) + x; };
+
+        TUniquePtr<FField> Noise = MakeUnique<FField>("Noise", EFieldType::Scalar, EFieldAttachment::Vertex);
+        uint32 Seed = 12345;
+        for (int32 z = 0; z <= N; ++z)
+        {
+            for (int32 y = 0; y <= N; ++y)
+            {
+                for (int32 x = 0; x <= N; ++x)
+                {
+                    Mesh.AddVertexPosition(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+                    Seed = Seed * 1664525u + 1013904223u;
+                    // 平滑的趋势加上噪声，单元区间宽度不一
+                    Noise->AddScalar(static_cast<float>(x + y) + static_cast<float>(Seed >> 24) / 64.0f);
+                }
+            }
+        }
+
+        FCellArray& Cells = Mesh.GetCells();
+        for (int32 z = 0; z < N; ++z)
+        {
+            for (int32 y = 0; y < N; ++y)
+            {
+                for (int32 x = 0; x < N; ++x)
+                {
+                    Cells.AddCell(ECellType::Hex, TArray<int32>{
+                        Index(x, y, z), Index(x + 1, y, z), Index(x + 1, y + 1, z), Index(x, y + 1, z),
+                        Index(x, y, z + 1), Index(x + 1, y, z + 1), Index(x + 1, y + 1, z + 1), Index(x, y + 1, z + 1) });
+                }
+            }
+        }
+        Mesh.AddField(std::move(Noise));
+    }
+
+    /** 暴力扫描所有单元 */
+    void BruteForceQuery(const IMesh& Mesh, const FField& Field, float IsoValue, TArray<uint32>& OutCells)
+    {
+        OutCells.Reset();
+        for (uint32 CellIndex = 0; CellIndex < Mesh.GetCellCount(); ++CellIndex)
+        {
+            const FCellView Cell = Mesh.GetCells().GetCellView(CellIndex);
+            float Min = Field.GetScalar(Cell[0]);
+            float Max = Min;
+            for (uint32 k = 1; k < Cell.Num(); ++k)
+            {
+                Min = std::min(Min, Field.GetScalar(Cell[k]));
+                Max = std::max(Max, Field.GetScalar(Cell[k]));
+            }
+            if (Min < IsoValue && IsoValue <= Max)
+            {
+                OutCells.Add(CellIndex);
+            }
+        }
+    }
+}
+
+// 查询结果与暴力扫描一致
+TEST(SpanIndex_QueryMatchesBruteForce)
+{
+    IMesh Mesh("Noise");
+    BuildNoiseGridMesh(Mesh, 30);
+    const FField& Noise = *Mesh.GetVertexField("Noise");
+
+    FScalarSpanIndex Index;
+    Index.Build(Mesh, Noise);
+    ASSERT(Index.IsBuiltFor(Mesh, Noise));
+    ASSERT_EQ(Index.GetIndexedCellCount(), 27000u);
+    ASSERT(Index.GetBucketCount() > 1);
+    ASSERT(Index.GetMemorySize() >= 27000u * 12u);
+
+    // 包括恰好等于顶点值的等值、范围外的等值
+    const TArray<float> IsoValues = { -1.0f, 0.5f, 10.0f, 29.75f, Noise.GetScalar(500), 45.2f, 61.0f, 100.0f };
+    TArray<uint32> Expected;
+    TArray<uint32> Actual;
+    TArray<uint32> Serial;
+    for (const float IsoValue : IsoValues)
+    {
+        BruteForceQuery(Mesh, Noise, IsoValue, Expected);
+        Index.Query(IsoValue, Actual);
+        Index.Query(IsoValue, Serial, false);
+        ASSERT(Actual == Expected);
+        ASSERT(Serial == Expected);
+    }
+    Index.Query(-1.0f, Actual);
+    ASSERT(Actual.IsEmpty());
+
+    Index.Clear();
+    ASSERT(!Index.IsBuiltFor(Mesh, Noise));
+    ASSERT_EQ(Index.GetIndexedCellCount(), 0u);
+}
+
+// 场或拓扑修改后自动重建；等值面过滤器使用索引的结果与不使用时一致
+TEST(SpanIndex_UpdateAndContour)
+{
+    IMesh Mesh("Noise");
+    BuildNoiseGridMesh(Mesh, 20);
+    FField& Noise = *Mesh.GetVertexField("Noise");
+
+    FScalarSpanIndex Index;
+    ASSERT(Index.Update(Mesh, Noise));
+    ASSERT(!Index.Update(Mesh, Noise));
+
+    FContourOptions Options;
+    Options.SpanIndex = &Index;
+    IMesh Indexed;
+    IMesh Reference;
+    TArray<int32> IndexedParents;
+    TArray<int32> ReferenceParents;
+    for (const float IsoValue : { 8.3f, 20.0f, 33.1f })
+    {
+        FContourFilter::Execute(Mesh, "Noise", IsoValue, Indexed, Options, &IndexedParents);
+        FContourFilter::Execute(Mesh, "Noise", IsoValue, Reference, FContourOptions(), &ReferenceParents);
+        ASSERT(Indexed.GetCellCount() > 0);
+        ASSERT(IndexedParents == ReferenceParents);
+        ASSERT(Indexed.GetVerticesPositions() == Reference.GetVerticesPositions());
+    }
+    ASSERT(!Index.Update(Mesh, Noise));
+
+    // 修改场数据：索引和分块范围都失效
+    FScalarChunkRanges Ranges;
+    Ranges.Build(Mesh, Noise);
+    Noise.SetScalar(0, 1000.0f);
+    ASSERT(!Index.IsBuiltFor(Mesh, Noise));
+    ASSERT(!Ranges.IsBuiltFor(Mesh, Noise));
+    FContourFilter::Execute(Mesh, "Noise", 500.0f, Indexed, Options, &IndexedParents);
+    ASSERT(Index.IsBuiltFor(Mesh, Noise));
+    ASSERT_EQ(IndexedParents.Num(), Indexed.GetCellCount());
+    ASSERT(!IndexedParents.IsEmpty());
+    ASSERT(std::all_of(IndexedParents.begin(), IndexedParents.end(), [](int32 Cell) { return Cell == 0; }));
+
+    // 修改拓扑
+    Mesh.GetCells().RemoveCell(0);
+    ASSERT(Index.Update(Mesh, Noise));
+    TArray<uint32> Cells;
+    Index.Query(500.0f, Cells);
+    ASSERT(Cells.IsEmpty());
+
+    // 非标量场
+    TUniquePtr<FField> Velocity = MakeUnique<FField>("Velocity", EFieldType::Vector, EFieldAttachment::Vertex);
+    Velocity->Resize(Mesh.GetVertexCount());
+    bool bThrown = false;
+    try
+    {
+        Index.Build(Mesh, *Velocity);
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+}
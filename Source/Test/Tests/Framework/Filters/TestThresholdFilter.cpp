@@ -0,0 +1,160 @@
+#include "TestFramework.h"
+#include "Filters/ThresholdFilter.h"
+#include "Mesh/Mesh.h"
+#include "Mesh/SubsetMesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include <cmath>
+#include <limits>
+
+TEST_GROUP(TestThresholdFilter)
+
+namespace
+{
+    /** 生成 N x N x N 的规则六面体网格，单元场 "Value" 为 (单元编号 * 37) % 101，每 13 个单元有一个 NaN */
+    void BuildThresholdMesh(IMesh& Mesh, int32 N)
+    {
+        auto Index = [N](int32 x, int32 y, int32 z) { return (z * (N + 1) + y) * (N + 1) + x; };
+        for (int32 z = 0; z <= N; ++z)
+        {
+            for (int32 y = 0; y <= N; ++y)
+            {
+                for (int32 x = 0; x <= N; ++x)
+                {
+                    Mesh.AddVertexPosition(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+                }
+            }
+        }
+
+        TUniquePtr<FField> ValueField = MakeUnique<FField>("Value", EFieldType::Scalar, EFieldAttachment::Cell);
+        TArray<int32> Indices;
+        for (int32 z = 0; z < N; ++z)
+        {
+            for (int32 y = 0; y < N; ++y)
+            {
+                for (int32 x = 0; x < N; ++x)
+                {
+                    const uint32 CellIndex = ValueField->GetDataCount();
+                    ValueField->AddScalar(CellIndex % 13 == 5 ? std::numeric_limits<float>::quiet_NaN() : static_cast<float>((CellIndex * 37) % 101));
+                    Indices.Append(TArray<int32>{
+                        Index(x, y, z), Index(x + 1, y, z), Index(x + 1, y + 1, z), Index(x, y + 1, z),
+                        Index(x, y, z + 1), Index(x + 1, y, z + 1), Index(x + 1, y + 1, z + 1), Index(x, y + 1, z + 1) });
+                }
+            }
+        }
+        Mesh.GetCells().AppendCells(ECellType::Hex, 8, std::move(Indices));
+        Mesh.AddField(std::move(ValueField));
+    }
+
+    /** 逐个单元比较得到的选择 */
+    TArray<uint32> BruteForceSelect(const FField& Field, float Lower, float Upper, bool bInvert)
+    {
+        TArray<uint32> Result;
+        for (uint32 i = 0; i < Field.GetDataCount(); ++i)
+        {
+            const float Value = Field.GetScalar(i);
+            if ((Value >= Lower && Value <= Upper) != bInvert)
+            {
+                Result.Add(i);
+            }
+        }
+        return Result;
+    }
+}
+
+TEST(Threshold_SelectionMatchesBruteForce)
+{
+    // 74088 个单元，位图跨越多个并行块
+    IMesh Volume("Volume");
+    BuildThresholdMesh(Volume, 42);
+    const FField& Field = *Volume.GetCellField("Value");
+
+    const float Ranges[][2] = { { 0.0f, 100.0f }, { 20.0f, 20.0f }, { 30.5f, 70.25f }, { 200.0f, 300.0f }, { 50.0f, 10.0f } };
+    for (const auto& Range : Ranges)
+    {
+        for (const bool bInvert : { false, true })
+        {
+            const TArray<uint32> Expected = BruteForceSelect(Field, Range[0], Range[1], bInvert);
+
+            FThresholdOptions Options;
+            Options.bInvert = bInvert;
+            TArray<uint64> Mask;
+            ASSERT_EQ(FThresholdFilter::ComputeMask(Field, Range[0], Range[1], Mask, Options), Expected.Num());
+            ASSERT_EQ(Mask.Num(), (Field.GetDataCount() + 63) / 64);
+
+            const FSubsetMesh Parallel = FThresholdFilter::Execute(Volume, "Value", Range[0], Range[1], Options);
+            Options.bParallel = false;
+            const FSubsetMesh Serial = FThresholdFilter::Execute(Volume, "Value", Range[0], Range[1], Options);
+            ASSERT(Parallel.GetSelectedCells() == Expected);
+            ASSERT(Serial.GetSelectedCells() == Expected);
+            ASSERT_EQ(Parallel.GetCellCount(), Expected.Num());
+        }
+    }
+}
+
+TEST(Threshold_ZeroCopySubset)
+{
+    IMesh Volume("Volume");
+    BuildThresholdMesh(Volume, 6);
+    const FSubsetMesh Subset = FThresholdFilter::Execute(Volume, "Value", 10.0f, 40.0f);
+
+    ASSERT(Subset.GetParent() == &Volume);
+    ASSERT(Subset.GetVerticesPositionsPtr() == Volume.GetVerticesPositionsPtr());
+    ASSERT_EQ(Subset.GetVertexCount(), Volume.GetVertexCount());
+    ASSERT_EQ(Subset.GetMeshName(), std::string("Volume"));
+    ASSERT(!Subset.IsCellsMaterialized());
+
+    // 单元视图直接指向父网格的单元数组
+    for (uint32 i = 0; i < Subset.GetCellCount(); ++i)
+    {
+        const FCellView View = Subset.GetCellView(i);
+        ASSERT(View.VertexIndices == Volume.GetCells().GetCellView(Subset.GetParentCellIndex(i)).VertexIndices);
+        const float Value = Volume.GetCellField("Value")->GetScalar(Subset.GetParentCellIndex(i));
+        ASSERT(Value >= 10.0f && Value <= 40.0f);
+    }
+    ASSERT(!Subset.IsCellsMaterialized());
+    ASSERT(Subset.Validate());
+}
+
+TEST(Threshold_InvalidArguments)
+{
+    IMesh Volume("Volume");
+    BuildThresholdMesh(Volume, 2);
+    TUniquePtr<FField> VectorField = MakeUnique<FField>("Velocity", EFieldType::Vector, EFieldAttachment::Cell, 3);
+    VectorField->Resize(Volume.GetCellCount());
+    Volume.AddField(std::move(VectorField));
+    TUniquePtr<FField> ShortField = MakeUnique<FField>("Short", EFieldType::Scalar, EFieldAttachment::Cell);
+    ShortField->AddScalar(1.0f);
+    Volume.AddField(std::move(ShortField));
+    // 单分量但不是标量类型的场同样被拒绝
+    TUniquePtr<FField> LabelField = MakeUnique<FField>("Label", EFieldType::Custom, EFieldAttachment::Cell);
+    LabelField->Resize(Volume.GetCellCount());
+    Volume.AddField(std::move(LabelField));
+
+    const char* FieldNames[] = { "Missing", "Velocity", "Short", "Label" };
+    for (const char* FieldName : FieldNames)
+    {
+        bool bThrown = false;
+        try
+        {
+            (void)FThresholdFilter::Execute(Volume, FieldName, 0.0f, 1.0f);
+        }
+        catch (const FInvalidArgumentException&)
+        {
+            bThrown = true;
+        }
+        ASSERT(bThrown);
+    }
+
+    bool bThrown = false;
+    try
+    {
+        (void)FThresholdFilter::Execute(Volume, "Value", std::numeric_limits<float>::quiet_NaN(), 1.0f);
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+}
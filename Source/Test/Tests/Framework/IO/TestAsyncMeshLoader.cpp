@@ -0,0 +1,172 @@
+#include "TestFramework.h"
+#include "TestMeshUtil.h"
+#include "IO/AsyncMeshLoader.h"
+#include "IO/NativeMeshFile.h"
+#include "Threading/FrameworkTaskQueue.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+TEST_GROUP(TestAsyncMeshLoader)
+
+namespace
+{
+    /** 写出传统 VTK ASCII 文件：NumPoints 个点、NumPoints - 2 个三角形条带式的三角形和一个顶点标量场 */
+    void WriteLegacyFile(const std::string& Path, uint32 NumPoints)
+    {
+        std::ofstream File(Path, std::ios::trunc);
+        File << "# vtk DataFile Version 3.0\nAsync\nASCII\nDATASET UNSTRUCTURED_GRID\n";
+        File << "POINTS " << NumPoints << " float\n";
+        for (uint32 i = 0; i < NumPoints; ++i)
+        {
+            File << i << " " << (i % 2) << " 0\n";
+        }
+        const uint32 NumCells = NumPoints - 2;
+        File << "CELLS " << NumCells << " " << NumCells * 4 << "\n";
+        for (uint32 i = 0; i < NumCells; ++i)
+        {
+            File << "3 " << i << " " << i + 1 << " " << i + 2 << "\n";
+        }
+        File << "CELL_TYPES " << NumCells << "\n";
+        for (uint32 i = 0; i < NumCells; ++i)
+        {
+            File << "5\n";
+        }
+        File << "POINT_DATA " << NumPoints << "\nSCALARS Temperature float\nLOOKUP_TABLE default\n";
+        for (uint32 i = 0; i < NumPoints; ++i)
+        {
+            File << 0.5f * static_cast<float>(i) << "\n";
+        }
+    }
+
+    /** 处理 Framework 任务队列直到加载的事件全部广播 */
+    void PumpFrameworkTasks(const FAsyncMeshLoad& Load)
+    {
+        Load.Wait();
+        while (FFrameworkTaskQueue::Get().GetPendingTaskCount() > 0)
+        {
+            FFrameworkTaskQueue::Get().ProcessTasks();
+        }
+    }
+}
+
+// Framework 任务队列：按提交顺序执行，超出时间预算的任务留到下一次
+TEST(AsyncMeshLoader_FrameworkTaskQueue)
+{
+    FFrameworkTaskQueue& Queue = FFrameworkTaskQueue::Get();
+    Queue.Flush();
+
+    TArray<int32> Order;
+    for (int32 i = 0; i < 3; ++i)
+    {
+        Queue.EnqueueTask([&Order, i]()
+        {
+            Order.Add(i);
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        });
+    }
+    ASSERT_EQ(Queue.GetPendingTaskCount(), 3u);
+    ASSERT_EQ(Queue.ProcessTasks(0.001), 1u);
+    ASSERT_EQ(Queue.GetPendingTaskCount(), 2u);
+    ASSERT_EQ(Queue.ProcessTasks(), 2u);
+    ASSERT_EQ(Order.Num(), 3u);
+    ASSERT(Order[0] == 0 && Order[1] == 1 && Order[2] == 2);
+}
+
+// 后台加载 VTK 与原生格式，事件在处理任务队列的线程上广播
+TEST(AsyncMeshLoader_Completed)
+{
+    FFrameworkTaskQueue::Get().Flush();
+    const std::string VtkPath = GetTempFilePath("IVisTest_AsyncLoad.vtk");
+    WriteLegacyFile(VtkPath, 200000);
+
+    TSharedPtr<FAsyncMeshLoad> Load = FAsyncMeshLoader::Load(VtkPath);
+    TArray<float> ProgressValues;
+    TSharedPtr<IMesh> Completed;
+    std::thread::id EventThread;
+    Load->OnProgress.AddLambda([&](float Progress) { ProgressValues.Add(Progress); });
+    Load->OnCompleted.AddLambda([&](const TSharedPtr<IMesh>& Mesh)
+    {
+        Completed = Mesh;
+        EventThread = std::this_thread::get_id();
+    });
+    PumpFrameworkTasks(*Load);
+
+    ASSERT(Load->GetState() == EAsyncMeshLoadState::Completed);
+    ASSERT(Completed.Get() != nullptr);
+    ASSERT(Completed.Get() == Load->GetMesh().Get());
+    ASSERT(EventThread == std::this_thread::get_id());
+    ASSERT_EQ(Completed->GetVertexCount(), 200000u);
+    ASSERT_EQ(Completed->GetCellCount(), 199998u);
+    ASSERT(Completed->GetVertexField("Temperature")->GetScalar(100) == 50.0f);
+    ASSERT(!ProgressValues.IsEmpty());
+    ASSERT(ProgressValues.Last() == 1.0f);
+    for (uint32 i = 1; i < ProgressValues.Num(); ++i)
+    {
+        ASSERT(ProgressValues[i] > ProgressValues[i - 1]);
+    }
+
+    // 原生格式按魔数识别
+    const std::string NativePath = GetTempFilePath("IVisTest_AsyncLoad.ivm");
+    FNativeMeshFile::Write(*Completed, NativePath);
+    FAsyncMeshLoadOptions Options;
+    Options.bPrefetch = false;
+    TSharedPtr<FAsyncMeshLoad> NativeLoad = FAsyncMeshLoader::Load(NativePath, Options);
+    PumpFrameworkTasks(*NativeLoad);
+    ASSERT(NativeLoad->GetState() == EAsyncMeshLoadState::Completed);
+    ASSERT_EQ(NativeLoad->GetMesh()->GetCellCount(), 199998u);
+    ASSERT(NativeLoad->GetProgress() == 1.0f);
+
+    std::remove(VtkPath.c_str());
+    std::remove(NativePath.c_str());
+}
+
+// 取消与失败
+TEST(AsyncMeshLoader_CanceledAndFailed)
+{
+    FFrameworkTaskQueue::Get().Flush();
+    const std::string Path = GetTempFilePath("IVisTest_AsyncCancel.vtk");
+    WriteLegacyFile(Path, 1000);
+
+    // 读取器第一次报告进度时请求取消，下一次报告时响应
+    std::atomic<FAsyncMeshLoad*> Handle{ nullptr };
+    FAsyncMeshLoadOptions Options;
+    Options.VtkOptions.Progress = [&Handle](uint64, uint64)
+    {
+        FAsyncMeshLoad* Load = nullptr;
+        while (!(Load = Handle.load()))
+        {
+            std::this_thread::yield();
+        }
+        Load->Cancel();
+        return true;
+    };
+    TSharedPtr<FAsyncMeshLoad> Load = FAsyncMeshLoader::Load(Path, Options);
+    Handle.store(Load.Get());
+    bool bCanceledEvent = false;
+    bool bCompletedEvent = false;
+    Load->OnCanceled.AddLambda([&]() { bCanceledEvent = true; });
+    Load->OnCompleted.AddLambda([&](const TSharedPtr<IMesh>&) { bCompletedEvent = true; });
+    PumpFrameworkTasks(*Load);
+    ASSERT(Load->GetState() == EAsyncMeshLoadState::Canceled);
+    ASSERT(Load->IsCancelRequested());
+    ASSERT(bCanceledEvent);
+    ASSERT(!bCompletedEvent);
+    ASSERT(Load->GetMesh().Get() == nullptr);
+
+    // 文件不存在
+    TSharedPtr<FAsyncMeshLoad> Missing = FAsyncMeshLoader::Load(GetTempFilePath("IVisTest_AsyncMissing.vtk"));
+    std::string FailedMessage;
+    Missing->OnFailed.AddLambda([&](const std::string& Message) { FailedMessage = Message; });
+    ASSERT(Missing->Wait(10000));
+    PumpFrameworkTasks(*Missing);
+    ASSERT(Missing->GetState() == EAsyncMeshLoadState::Failed);
+    ASSERT(!FailedMessage.empty());
+    ASSERT(FailedMessage == Missing->GetError());
+
+    std::remove(Path.c_str());
+}
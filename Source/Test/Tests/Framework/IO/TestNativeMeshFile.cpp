@@ -0,0 +1,295 @@
+#include "TestFramework.h"
+#include "TestMeshUtil.h"
+#include "IO/NativeMeshFile.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Field/FieldCompression.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include "HAL/MappedFile.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+TEST_GROUP(TestNativeMeshFile)
+
+namespace
+{
+    /** 读取整个文件 */
+    std::string ReadFileBytes(const std::string& Path)
+    {
+        std::ifstream File(Path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+    }
+
+    /** 写入整个文件 */
+    void WriteFileBytes(const std::string& Path, const std::string& Bytes)
+    {
+        std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+        File.write(Bytes.data(), static_cast<std::streamsize>(Bytes.size()));
+    }
+
+    /**
+     * 查找段表项在文件中的位置（文件头 64 字节：SectionCount 在 12，SectionTableOffset 在 16；
+     * 段表项 64 字节：Kind 在 0，CellType 在 3，Dimension 在 4，Offset 在 16，Size 在 24）
+     */
+    size_t FindSectionEntry(const std::string& Bytes, uint8 Kind)
+    {
+        uint32 SectionCount = 0;
+        uint64 TableOffset = 0;
+        std::memcpy(&SectionCount, Bytes.data() + 12, sizeof(SectionCount));
+        std::memcpy(&TableOffset, Bytes.data() + 16, sizeof(TableOffset));
+        for (uint32 i = 0; i < SectionCount; ++i)
+        {
+            const size_t Entry = static_cast<size_t>(TableOffset) + i * 64;
+            if (static_cast<uint8>(Bytes[Entry]) == Kind)
+            {
+                return Entry;
+            }
+        }
+        return std::string::npos;
+    }
+
+    /** 段数据在文件中的位置 */
+    size_t GetSectionData(const std::string& Bytes, size_t Entry)
+    {
+        uint64 Offset = 0;
+        std::memcpy(&Offset, Bytes.data() + Entry + 16, sizeof(Offset));
+        return static_cast<size_t>(Offset);
+    }
+
+    template<typename T>
+    void Patch(std::string& Bytes, size_t Position, T Value)
+    {
+        std::memcpy(Bytes.data() + Position, &Value, sizeof(T));
+    }
+
+    /** 读取损坏的文件是否抛出 FFileIOException */
+    bool IsRejected(const std::string& Path, const std::string& Bytes)
+    {
+        WriteFileBytes(Path, Bytes);
+        IMesh Loaded;
+        try
+        {
+            FNativeMeshFile::Read(Path, Loaded);
+        }
+        catch (const FFileIOException&)
+        {
+            return true;
+        }
+        return false;
+    }
+}
+
+// 均质单元与多种存储类型的场往返，场数据直接引用映射内存
+TEST(NativeMeshFile_RoundTripUniform)
+{
+    IMesh Mesh("Grid");
+    MakeQuadGrid(Mesh, 40);
+
+    TUniquePtr<FField> Material = MakeUnique<FField>("Material", EFieldType::Scalar, EFieldAttachment::Cell);
+    Material->SetStorage(EFieldStorage::UInt8);
+    TUniquePtr<FField> Pressure = MakeUnique<FField>("Pressure", EFieldType::Scalar, EFieldAttachment::Cell);
+    Pressure->SetStorage(EFieldStorage::Float16);
+    for (uint32 i = 0; i < Mesh.GetCellCount(); ++i)
+    {
+        Material->AddScalar(static_cast<float>(i % 7));
+        Pressure->AddScalar(0.25f * static_cast<float>(i % 100));
+    }
+    Mesh.AddField(std::move(Material));
+    Mesh.AddField(std::move(Pressure));
+
+    const std::string Path = GetTempFilePath("IVisTest_NativeMeshUniform.ivm");
+    FNativeMeshFile::Write(Mesh, Path);
+
+    IMesh Loaded;
+    FNativeMeshFile::Read(Path, Loaded);
+    ASSERT(Loaded.GetMeshName() == "Grid");
+    ASSERT(Loaded.GetVertexCount() == Mesh.GetVertexCount());
+    ASSERT(Loaded.GetCellCount() == Mesh.GetCellCount());
+    ASSERT(Loaded.GetCells().IsUniform());
+    ASSERT(Loaded.GetCells().GetUniformCellType() == ECellType::Quad);
+    ASSERT(Loaded.GetVertexPosition(1234) == Mesh.GetVertexPosition(1234));
+    ASSERT(Loaded.GetCells().GetCellView(777)[2] == Mesh.GetCells().GetCellView(777)[2]);
+    ASSERT(Loaded.Validate());
+
+    const FField* LoadedVelocity = Loaded.GetVertexField("Velocity");
+    ASSERT(LoadedVelocity != nullptr);
+    ASSERT(LoadedVelocity->IsExternal());
+    ASSERT(LoadedVelocity->GetMemorySize() == 0);
+    ASSERT(LoadedVelocity->GetVector(100) == FVector(100.0f, 1.0f, -100.0f));
+    ASSERT(LoadedVelocity->GetRawDataPtr()[3 * 1680 + 2] == -1680.0f);
+
+    const FField* LoadedMaterial = Loaded.GetCellField("Material");
+    ASSERT(LoadedMaterial->GetStorage() == EFieldStorage::UInt8);
+    ASSERT_EQ(LoadedMaterial->GetScalar(1599), 3.0f);
+    ASSERT(Loaded.GetCellField("Pressure")->GetStorage() == EFieldStorage::Float16);
+    ASSERT_EQ(Loaded.GetCellField("Pressure")->GetScalar(99), 24.75f);
+
+    // 映射的场在修改时复制，不影响其他引用同一映射的场
+    FField Copy = *LoadedVelocity;
+    Copy.SetVector(100, FVector(0.0f, 0.0f, 0.0f));
+    ASSERT(!Copy.IsExternal());
+    ASSERT(Copy.GetVector(100) == FVector(0.0f, 0.0f, 0.0f));
+    ASSERT(Copy.GetVector(101) == FVector(101.0f, 1.0f, -101.0f));
+    ASSERT(LoadedVelocity->GetVector(100) == FVector(100.0f, 1.0f, -100.0f));
+
+    // 外部存储不能以 TArray 的形式访问
+    bool bThrown = false;
+    try
+    {
+        LoadedVelocity->GetFieldData();
+    }
+    catch (const FInvalidOperationException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+
+    // 拷贝模式
+    FNativeMeshReadOptions Options;
+    Options.bMapFields = false;
+    IMesh Copied;
+    FNativeMeshFile::Read(Path, Copied, Options);
+    ASSERT(!Copied.GetVertexField("Velocity")->IsExternal());
+    ASSERT(Copied.GetVertexField("Velocity")->GetFieldData()[300] == 100.0f);
+
+    std::remove(Path.c_str());
+}
+
+// 混合单元与压缩场的往返；损坏的文件抛出异常
+TEST(NativeMeshFile_RoundTripMixed)
+{
+    IMesh Mesh("Mixed");
+    MakeQuadGrid(Mesh, 8);
+    Mesh.GetCells().AddCell(ECellType::Triangle, TArray<int32>{ 0, 1, 9 });
+    ASSERT(!Mesh.GetCells().IsUniform());
+
+    TUniquePtr<FField> Ids = MakeUnique<FField>("Ids", EFieldType::Scalar, EFieldAttachment::Cell);
+    Ids->SetStorage(EFieldStorage::Int32);
+    for (uint32 i = 0; i < Mesh.GetCellCount(); ++i)
+    {
+        Ids->AddScalar(static_cast<float>(i) - 10.0f);
+    }
+    Mesh.AddField(std::move(Ids));
+    FFieldCompressionOptions Compression;
+    Compression.BlockElementCount = 16;
+    Mesh.GetVertexField("Velocity")->Compress(Compression);
+
+    const std::string Path = GetTempFilePath("IVisTest_NativeMeshMixed.ivm");
+    FNativeMeshFile::Write(Mesh, Path);
+
+    IMesh Loaded;
+    FNativeMeshFile::Read(Path, Loaded);
+    ASSERT(Loaded.GetCellCount() == 65);
+    ASSERT(!Loaded.GetCells().IsUniform());
+    ASSERT(Loaded.GetCells().GetCellType(64) == ECellType::Triangle);
+    ASSERT(Loaded.GetCells().GetCellView(64)[2] == 9);
+    ASSERT(Loaded.GetCells().GetCellType(63) == ECellType::Quad);
+    ASSERT_EQ(Loaded.GetCellField("Ids")->GetScalar(64), 54.0f);
+    ASSERT(Loaded.GetVertexField("Velocity")->GetVector(80) == FVector(80.0f, 1.0f, -80.0f));
+
+    // 截断文件
+    const uint64 Size = FMappedFile::Open(Path)->GetSize();
+    std::filesystem::resize_file(Path, Size / 2);
+    bool bThrown = false;
+    try
+    {
+        FNativeMeshFile::Read(Path, Loaded);
+    }
+    catch (const FFileIOException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+
+    // 错误的魔数
+    {
+        std::ofstream Corrupt(Path, std::ios::binary | std::ios::trunc);
+        Corrupt << std::string(128, 'x');
+    }
+    bThrown = false;
+    try
+    {
+        FNativeMeshFile::Read(Path, Loaded);
+    }
+    catch (const FFileIOException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+
+    std::remove(Path.c_str());
+}
+
+// 单元内容损坏的文件：顶点索引越界、单元类型无效、顶点数与单元类型不符、偏移不递增
+TEST(NativeMeshFile_CorruptCells)
+{
+    constexpr uint8 UniformCellsKind = 2;
+    constexpr uint8 CellTypesKind = 3;
+    constexpr uint8 CellOffsetsKind = 4;
+    constexpr uint8 CellIndicesKind = 5;
+    const std::string Path = GetTempFilePath("IVisTest_NativeMeshCorrupt.ivm");
+
+    // 均质单元：2 x 2 的四边形网格，9 个顶点
+    IMesh Uniform("Uniform");
+    MakeQuadGrid(Uniform, 2);
+    FNativeMeshFile::Write(Uniform, Path);
+    const std::string UniformBytes = ReadFileBytes(Path);
+    const size_t UniformEntry = FindSectionEntry(UniformBytes, UniformCellsKind);
+    ASSERT(UniformEntry != std::string::npos);
+    const size_t UniformData = GetSectionData(UniformBytes, UniformEntry);
+    ASSERT(!IsRejected(Path, UniformBytes));
+
+    std::string Bytes = UniformBytes;
+    Patch<int32>(Bytes, UniformData + 5 * sizeof(int32), 9);
+    ASSERT(IsRejected(Path, Bytes));
+
+    Bytes = UniformBytes;
+    Patch<int32>(Bytes, UniformData, -1);
+    ASSERT(IsRejected(Path, Bytes));
+
+    Bytes = UniformBytes;
+    Patch<uint8>(Bytes, UniformEntry + 3, static_cast<uint8>(ECellType::None));
+    ASSERT(IsRejected(Path, Bytes));
+
+    Bytes = UniformBytes;
+    Patch<uint8>(Bytes, UniformEntry + 3, static_cast<uint8>(ECellType::Triangle));
+    ASSERT(IsRejected(Path, Bytes));
+
+    Bytes = UniformBytes;
+    Patch<uint32>(Bytes, UniformEntry + 4, 0u);
+    Patch<uint64>(Bytes, UniformEntry + 24, 0ull);
+    ASSERT(IsRejected(Path, Bytes));
+
+    // 混合单元：四个四边形加一个三角形
+    IMesh Mixed("Mixed");
+    MakeQuadGrid(Mixed, 2);
+    Mixed.GetCells().AddCell(ECellType::Triangle, TArray<int32>{ 0, 1, 3 });
+    FNativeMeshFile::Write(Mixed, Path);
+    const std::string MixedBytes = ReadFileBytes(Path);
+    const size_t TypesData = GetSectionData(MixedBytes, FindSectionEntry(MixedBytes, CellTypesKind));
+    const size_t OffsetsData = GetSectionData(MixedBytes, FindSectionEntry(MixedBytes, CellOffsetsKind));
+    const size_t IndicesData = GetSectionData(MixedBytes, FindSectionEntry(MixedBytes, CellIndicesKind));
+    ASSERT(!IsRejected(Path, MixedBytes));
+
+    Bytes = MixedBytes;
+    Patch<int32>(Bytes, IndicesData + 17 * sizeof(int32), 100);
+    ASSERT(IsRejected(Path, Bytes));
+
+    Bytes = MixedBytes;
+    Patch<uint8>(Bytes, TypesData + 1, static_cast<uint8>(ECellType::None));
+    ASSERT(IsRejected(Path, Bytes));
+
+    Bytes = MixedBytes;
+    Patch<uint8>(Bytes, TypesData + 4, static_cast<uint8>(ECellType::Quad));
+    ASSERT(IsRejected(Path, Bytes));
+
+    Bytes = MixedBytes;
+    Patch<uint32>(Bytes, OffsetsData + 2 * sizeof(uint32), 4u);
+    ASSERT(IsRejected(Path, Bytes));
+
+    std::remove(Path.c_str());
+}
@@ -0,0 +1,389 @@
+#include "TestFramework.h"
+#include "IO/VtkMeshReader.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+TEST_GROUP(TestVtkMeshReader)
+
+namespace
+{
+    std::string WriteTempFile(const std::string& Name, const std::string& Content)
+    {
+        const std::string Path = (std::filesystem::temp_directory_path() / Name).string();
+        std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+        File << Content;
+        return Path;
+    }
+
+    /** 按指定字节序追加数值 */
+    template<typename T>
+    void AppendValue(std::string& Out, T Value, bool bBigEndian)
+    {
+        char Bytes[sizeof(T)];
+        std::memcpy(Bytes, &Value, sizeof(T));
+        if (bBigEndian)
+        {
+            std::reverse(Bytes, Bytes + sizeof(T));
+        }
+        Out.append(Bytes, sizeof(T));
+    }
+
+    bool ThrowsFileIO(const std::string& Path, const FVtkReadOptions& Options = FVtkReadOptions())
+    {
+        IMesh Mesh;
+        try
+        {
+            FVtkMeshReader::Read(Path, Mesh, Options);
+        }
+        catch (const FFileIOException&)
+        {
+            return true;
+        }
+        return false;
+    }
+
+    /** 两个立方体单元（一个 Hex、一个 Voxel）、一个 Pixel、一个跳过的 Vertex 单元 */
+    const char* const LegacyAscii =
+        "# vtk DataFile Version 3.0\n"
+        "test mesh\n"
+        "ASCII\n"
+        "DATASET UNSTRUCTURED_GRID\n"
+        "POINTS 12 double\n"
+        "0 0 0  1 0 0  1 1 0  0 1 0\n"
+        "0 0 1  1 0 1  1 1 1  0 1 1\n"
+        "0 0 2  1 0 2  0 1 2  1 1 2\n"
+        "\n"
+        "CELLS 4 25\n"
+        "8 0 1 2 3 4 5 6 7\n"
+        "8 4 5 7 6 8 9 10 11\n"
+        "1 3\n"
+        "4 8 9 10 11\n"
+        "CELL_TYPES 4\n"
+        "12\n11\n1\n8\n"
+        "CELL_DATA 4\n"
+        "SCALARS Material int 1\n"
+        "LOOKUP_TABLE default\n"
+        "1 2 3 4\n"
+        "FIELD FieldData 1\n"
+        "Flux 3 4 float\n"
+        "1 0 0 2 0 0 3 0 0 4 0 0\n"
+        "POINT_DATA 12\n"
+        "SCALARS Temperature float\n"
+        "LOOKUP_TABLE default\n"
+        "0 1 2 3 4 5 6 7 8 9 10 1.5e+2\n"
+        "VECTORS Velocity float\n"
+        "0 0 0 1 0 0 2 0 0 3 0 0 4 0 0 5 0 0 6 0 0 7 0 0 8 0 0 9 0 0 10 0 0 11 0 0\n";
+}
+
+TEST(VtkMeshReader_CellTypes)
+{
+    ASSERT(FVtkMeshReader::ConvertCellType(5) == ECellType::Triangle);
+    ASSERT(FVtkMeshReader::ConvertCellType(12) == ECellType::Hex);
+    ASSERT(FVtkMeshReader::ConvertCellType(13) == ECellType::Prism);
+    ASSERT(FVtkMeshReader::ConvertCellType(14) == ECellType::Pyramid);
+    ASSERT(FVtkMeshReader::ConvertCellType(1) == ECellType::None);
+    ASSERT(FVtkMeshReader::ConvertCellType(24) == ECellType::None);
+}
+
+// 传统 ASCII 格式：混合单元、Pixel / Voxel 重排、跳过不支持的单元
+TEST(VtkMeshReader_LegacyAscii)
+{
+    const std::string Path = WriteTempFile("IVisTest_Legacy.vtk", LegacyAscii);
+    IMesh Mesh;
+    FVtkMeshReader::Read(Path, Mesh);
+
+    ASSERT(Mesh.GetMeshName() == "IVisTest_Legacy");
+    ASSERT(Mesh.GetVertexCount() == 12);
+    ASSERT(Mesh.GetVertexPosition(10) == FVector(0.0f, 1.0f, 2.0f));
+    ASSERT(Mesh.GetCellCount() == 3);
+    ASSERT(Mesh.GetCells().GetCellType(0) == ECellType::Hex);
+    ASSERT(Mesh.GetCells().GetCellType(1) == ECellType::Hex);
+    ASSERT(Mesh.GetCells().GetCellType(2) == ECellType::Quad);
+    const FCellView Voxel = Mesh.GetCells().GetCellView(1);
+    ASSERT(Voxel[2] == 6 && Voxel[3] == 7 && Voxel[6] == 11 && Voxel[7] == 10);
+    const FCellView Pixel = Mesh.GetCells().GetCellView(2);
+    ASSERT(Pixel[0] == 8 && Pixel[1] == 9 && Pixel[2] == 11 && Pixel[3] == 10);
+    ASSERT(Mesh.Validate());
+
+    // 单元场同步删除被跳过的 Vertex 单元
+    const FField* Material = Mesh.GetCellField("Material");
+    ASSERT(Material->GetDataCount() == 3);
+    ASSERT_EQ(Material->GetScalar(2), 4.0f);
+    ASSERT(Material->GetStorage() == EFieldStorage::Float32);
+    ASSERT(Mesh.GetCellField("Flux")->GetVector(2) == FVector(4.0f, 0.0f, 0.0f));
+    ASSERT_EQ(Mesh.GetVertexField("Temperature")->GetScalar(11), 150.0f);
+    ASSERT(Mesh.GetVertexField("Velocity")->GetFieldType() == EFieldType::Vector);
+    ASSERT(Mesh.GetVertexField("Velocity")->GetVector(7) == FVector(7.0f, 0.0f, 0.0f));
+
+    // 保留数值类型，只读取单元场
+    FVtkReadOptions Options;
+    Options.bPreserveFieldStorage = true;
+    Options.bReadVertexFields = false;
+    IMesh Typed;
+    FVtkMeshReader::ReadLegacy(Path, Typed, Options);
+    ASSERT(Typed.GetCellField("Material")->GetStorage() == EFieldStorage::Int32);
+    ASSERT(Typed.GetCellField("Material")->GetTypedData<int32>()[1] == 2);
+    ASSERT(!Typed.HasVertexField("Temperature"));
+
+    // 不跳过不支持的单元
+    Options.bSkipUnsupportedCells = false;
+    ASSERT(ThrowsFileIO(Path, Options));
+    std::remove(Path.c_str());
+}
+
+// 传统二进制格式（大端序，5.1 版 OFFSETS / CONNECTIVITY）
+TEST(VtkMeshReader_LegacyBinary)
+{
+    std::string Content =
+        "# vtk DataFile Version 5.1\n"
+        "binary\n"
+        "BINARY\n"
+        "DATASET UNSTRUCTURED_GRID\n"
+        "POINTS 5 float\n";
+    const float Points[15] = { 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1 };
+    for (float Value : Points)
+    {
+        AppendValue(Content, Value, true);
+    }
+    Content += "\nMETADATA\nINFORMATION 0\n\nCELLS 3 7\nOFFSETS vtktypeint64\n";
+    for (int64 Offset : { 0, 4, 7 })
+    {
+        AppendValue(Content, Offset, true);
+    }
+    Content += "\nCONNECTIVITY vtktypeint64\n";
+    for (int64 Index : { 0, 1, 2, 3, 1, 2, 4 })
+    {
+        AppendValue(Content, Index, true);
+    }
+    Content += "\nCELL_TYPES 2\n";
+    AppendValue(Content, int32(10), true);
+    AppendValue(Content, int32(5), true);
+    Content += "\nCELL_DATA 2\nSCALARS Id unsigned_char\nLOOKUP_TABLE default\n";
+    AppendValue(Content, uint8(7), true);
+    AppendValue(Content, uint8(9), true);
+    Content += "\nPOINT_DATA 5\nSCALARS Pressure double 1\nLOOKUP_TABLE default\n";
+    for (int32 i = 0; i < 5; ++i)
+    {
+        AppendValue(Content, 0.5 * i, true);
+    }
+    Content += "\n";
+
+    const std::string Path = WriteTempFile("IVisTest_LegacyBinary.vtk", Content);
+    FVtkReadOptions Options;
+    Options.bPreserveFieldStorage = true;
+    IMesh Mesh;
+    FVtkMeshReader::Read(Path, Mesh, Options);
+    ASSERT(Mesh.GetVertexCount() == 5);
+    ASSERT(Mesh.GetVertexPosition(4) == FVector(1.0f, 1.0f, 1.0f));
+    ASSERT(Mesh.GetCellCount() == 2);
+    ASSERT(Mesh.GetCells().GetCellType(0) == ECellType::Tetra);
+    ASSERT(Mesh.GetCells().GetCellType(1) == ECellType::Triangle);
+    ASSERT(Mesh.GetCells().GetCellView(1)[2] == 4);
+    ASSERT(Mesh.GetCellField("Id")->GetStorage() == EFieldStorage::UInt8);
+    ASSERT_EQ(Mesh.GetCellField("Id")->GetScalar(1), 9.0f);
+    ASSERT(Mesh.GetVertexField("Pressure")->GetStorage() == EFieldStorage::Float64);
+    ASSERT_EQ(Mesh.GetVertexField("Pressure")->GetScalar(3), 1.5f);
+
+    // 截断的二进制数据
+    const std::string Truncated = WriteTempFile("IVisTest_LegacyTruncated.vtk", Content.substr(0, 150));
+    ASSERT(ThrowsFileIO(Truncated));
+    std::remove(Truncated.c_str());
+    std::remove(Path.c_str());
+}
+
+// XML 格式：appended raw 数据与 ascii 数据混合
+TEST(VtkMeshReader_Vtu)
+{
+    std::string Appended;
+    const uint64 PointsOffset = Appended.size();
+    AppendValue(Appended, uint64(4 * 3 * sizeof(double)), false);
+    const double Points[12] = { 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0 };
+    for (double Value : Points)
+    {
+        AppendValue(Appended, Value, false);
+    }
+    const uint64 ConnectivityOffset = Appended.size();
+    AppendValue(Appended, uint64(6 * sizeof(int64)), false);
+    for (int64 Index : { 0, 1, 2, 0, 2, 3 })
+    {
+        AppendValue(Appended, Index, false);
+    }
+    const uint64 OffsetsOffset = Appended.size();
+    AppendValue(Appended, uint64(2 * sizeof(int64)), false);
+    AppendValue(Appended, int64(3), false);
+    AppendValue(Appended, int64(6), false);
+    const uint64 VelocityOffset = Appended.size();
+    AppendValue(Appended, uint64(12 * sizeof(float)), false);
+    for (int32 i = 0; i < 12; ++i)
+    {
+        AppendValue(Appended, static_cast<float>(i), false);
+    }
+
+    const std::string Content =
+        "<?xml version=\"1.0\"?>\n"
+        "<!-- written by a solver -->\n"
+        "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n"
+        "  <UnstructuredGrid>\n"
+        "    <Piece NumberOfPoints=\"4\" NumberOfCells=\"2\">\n"
+        "      <PointData Vectors=\"Velocity\">\n"
+        "        <DataArray type=\"Float32\" Name=\"Velocity\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" + std::to_string(VelocityOffset) + "\"/>\n"
+        "      </PointData>\n"
+        "      <CellData>\n"
+        "        <DataArray type=\"Int32\" Name=\"Part\" format=\"ascii\">\n          5 6\n        </DataArray>\n"
+        "      </CellData>\n"
+        "      <Points>\n"
+        "        <DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" + std::to_string(PointsOffset) + "\"/>\n"
+        "      </Points>\n"
+        "      <Cells>\n"
+        "        <DataArray type=\"Int64\" Name=\"connectivity\" format=\"appended\" offset=\"" + std::to_string(ConnectivityOffset) + "\"/>\n"
+        "        <DataArray type=\"Int64\" Name=\"offsets\" format=\"appended\" offset=\"" + std::to_string(OffsetsOffset) + "\"/>\n"
+        "        <DataArray type=\"UInt8\" Name=\"types\" format=\"ascii\">5 5</DataArray>\n"
+        "      </Cells>\n"
+        "    </Piece>\n"
+        "  </UnstructuredGrid>\n"
+        "  <AppendedData encoding=\"raw\">\n   _" + Appended + "\n  </AppendedData>\n"
+        "</VTKFile>\n";
+
+    const std::string Path = WriteTempFile("IVisTest_Mesh.vtu", Content);
+    IMesh Mesh;
+    FVtkMeshReader::Read(Path, Mesh);
+    ASSERT(Mesh.GetVertexCount() == 4);
+    ASSERT(Mesh.GetVertexPosition(2) == FVector(1.0f, 1.0f, 0.0f));
+    ASSERT(Mesh.GetCellCount() == 2);
+    ASSERT(Mesh.GetCells().IsUniform());
+    ASSERT(Mesh.GetCells().GetUniformCellType() == ECellType::Triangle);
+    ASSERT(Mesh.GetCells().GetCellView(1)[2] == 3);
+    ASSERT(Mesh.GetVertexField("Velocity")->GetVector(3) == FVector(9.0f, 10.0f, 11.0f));
+    ASSERT_EQ(Mesh.GetCellField("Part")->GetScalar(1), 6.0f);
+
+    // 压缩数据不支持
+    std::string Compressed = Content;
+    Compressed.replace(Compressed.find("header_type"), 0, "compressor=\"vtkZLibDataCompressor\" ");
+    const std::string CompressedPath = WriteTempFile("IVisTest_Compressed.vtu", Compressed);
+    ASSERT(ThrowsFileIO(CompressedPath));
+    std::remove(CompressedPath.c_str());
+
+    // 越界的偏移
+    std::string OutOfRange = Content;
+    OutOfRange.replace(OutOfRange.find("offset=\"" + std::to_string(VelocityOffset)), 9 + std::to_string(VelocityOffset).size(), "offset=\"100000\"");
+    const std::string OutOfRangePath = WriteTempFile("IVisTest_OutOfRange.vtu", OutOfRange);
+    ASSERT(ThrowsFileIO(OutOfRangePath));
+    std::remove(OutOfRangePath.c_str());
+    std::remove(Path.c_str());
+}
+
+// XML 格式：偏移在分配连接关系之前检查（递减、超出连接关系长度、巨大的末偏移）
+TEST(VtkMeshReader_VtuCorruptOffsets)
+{
+    auto MakeVtu = [](const std::string& Offsets)
+    {
+        return std::string(
+            "<?xml version=\"1.0\"?>\n"
+            "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\">\n"
+            "  <UnstructuredGrid>\n"
+            "    <Piece NumberOfPoints=\"4\" NumberOfCells=\"2\">\n"
+            "      <Points>\n"
+            "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"ascii\">0 0 0 1 0 0 1 1 0 0 1 0</DataArray>\n"
+            "      </Points>\n"
+            "      <Cells>\n"
+            "        <DataArray type=\"Int32\" Name=\"connectivity\" format=\"ascii\">\n          0 1 2\n          0 2 3\n        </DataArray>\n"
+            "        <DataArray type=\"Int64\" Name=\"offsets\" format=\"ascii\">") + Offsets + "</DataArray>\n"
+            "        <DataArray type=\"UInt8\" Name=\"types\" format=\"ascii\">5 5</DataArray>\n"
+            "      </Cells>\n"
+            "    </Piece>\n"
+            "  </UnstructuredGrid>\n"
+            "</VTKFile>\n";
+    };
+
+    const std::string ValidPath = WriteTempFile("IVisTest_ValidOffsets.vtu", MakeVtu("3 6"));
+    IMesh Mesh;
+    FVtkMeshReader::Read(ValidPath, Mesh);
+    ASSERT(Mesh.GetCellCount() == 2);
+    std::remove(ValidPath.c_str());
+
+    for (const char* Offsets : { "4 3", "3 7", "3 5", "3 4000000000" })
+    {
+        const std::string Path = WriteTempFile("IVisTest_CorruptOffsets.vtu", MakeVtu(Offsets));
+        ASSERT(ThrowsFileIO(Path));
+        std::remove(Path.c_str());
+    }
+}
+
+// 大块 ASCII 数据并行解析与串行解析的结果一致（数据跨越多个块和关键字）
+TEST(VtkMeshReader_ParallelAscii)
+{
+    const uint32 N = 160;
+    const uint32 NumPoints = (N + 1) * (N + 1);
+    std::string Content = "# vtk DataFile Version 3.0\nlarge\nASCII\nDATASET UNSTRUCTURED_GRID\n";
+    Content += "POINTS " + std::to_string(NumPoints) + " float\n";
+    for (uint32 i = 0; i < NumPoints; ++i)
+    {
+        Content += std::to_string(static_cast<float>(i % (N + 1)) * 0.125f) + " " + std::to_string(static_cast<float>(i / (N + 1)) * 0.25f)
+            + (i % 7 == 0 ? " -1.5e-3\n" : " 0 ");
+    }
+    const uint32 NumCells = N * N;
+    Content += "\nCELLS " + std::to_string(NumCells) + " " + std::to_string(NumCells * 5) + "\n";
+    for (uint32 y = 0; y < N; ++y)
+    {
+        for (uint32 x = 0; x < N; ++x)
+        {
+            const uint32 V0 = y * (N + 1) + x;
+            Content += "4 " + std::to_string(V0) + " " + std::to_string(V0 + 1) + " " + std::to_string(V0 + N + 2) + " " + std::to_string(V0 + N + 1) + "\n";
+        }
+    }
+    Content += "CELL_TYPES " + std::to_string(NumCells) + "\n";
+    for (uint32 i = 0; i < NumCells; ++i)
+    {
+        Content += "9\n";
+    }
+    Content += "POINT_DATA " + std::to_string(NumPoints) + "\nSCALARS Temperature float 1\nLOOKUP_TABLE default\n";
+    for (uint32 i = 0; i < NumPoints; ++i)
+    {
+        Content += std::to_string(i) + ".5 ";
+    }
+    Content += "\nVECTORS Velocity float\n";
+    for (uint32 i = 0; i < NumPoints; ++i)
+    {
+        Content += "1 " + std::to_string(-static_cast<int32>(i)) + " 3e1\n";
+    }
+    // 保证超过并行解析的最小字节数
+    while (Content.size() < (size_t(5) << 20))
+    {
+        Content += "METADATA\nINFORMATION 0\n\n";
+    }
+
+    const std::string Path = WriteTempFile("IVisTest_LargeAscii.vtk", Content);
+    IMesh Parallel;
+    FVtkMeshReader::Read(Path, Parallel);
+    FVtkReadOptions Options;
+    Options.bParallel = false;
+    IMesh Serial;
+    FVtkMeshReader::Read(Path, Serial, Options);
+
+    ASSERT(Parallel.GetVertexCount() == NumPoints);
+    ASSERT(Parallel.GetCellCount() == NumCells);
+    ASSERT(std::memcmp(Parallel.GetVerticesPositionsPtr(), Serial.GetVerticesPositionsPtr(), NumPoints * sizeof(FVector)) == 0);
+    ASSERT(Parallel.GetCells().GetVertexIndicesView().Num() == Serial.GetCells().GetVertexIndicesView().Num());
+    ASSERT(std::memcmp(Parallel.GetCells().GetVertexIndicesView().GetData(), Serial.GetCells().GetVertexIndicesView().GetData(),
+        NumCells * 4 * sizeof(int32)) == 0);
+    ASSERT(Parallel.GetCells().GetCellView(NumCells - 1)[2] == static_cast<int32>(NumPoints - 1));
+    ASSERT(Parallel.GetVertexField("Temperature")->GetFieldData() == Serial.GetVertexField("Temperature")->GetFieldData());
+    ASSERT_EQ(Parallel.GetVertexField("Temperature")->GetScalar(NumPoints - 1), static_cast<float>(NumPoints - 1) + 0.5f);
+    ASSERT(Parallel.GetVertexField("Velocity")->GetVector(NumPoints - 1) == FVector(1.0f, -static_cast<float>(NumPoints - 1), 30.0f));
+    ASSERT(Parallel.GetVertexPosition(7) == FVector(0.875f, 0.0f, -1.5e-3f));
+
+    // 数据不足时报错
+    std::string Missing = Content;
+    Missing.replace(Missing.find("POINTS " + std::to_string(NumPoints)), 7 + std::to_string(NumPoints).size(), "POINTS " + std::to_string(NumPoints + 1));
+    const std::string MissingPath = WriteTempFile("IVisTest_LargeAsciiMissing.vtk", Missing);
+    ASSERT(ThrowsFileIO(MissingPath));
+    std::remove(MissingPath.c_str());
+    std::remove(Path.c_str());
+}
@@ -2,7 +2,12 @@
 #include "Mesh/Mesh.h"
 #include "Field/Field.h"
 #include "Container/CellArray.h"
+#include "Container/CellLinks.h"
+#include "Math/VectorArraySoA.h"
 #include "Math/Math.h"
+#include "Exception/Exception.h"
+#include "TestTaskUtil.h"
+#include <atomic>
 
 TEST_GROUP(TestMesh)
 
@@ -317,3 +322,271 @@ TEST(Mesh_CopyMoveAndValidation)
     ASSERT(MemoryMesh.GetVertexCount() == 10);
 }
 
+// ============================================================================
+// 测试用例5: 数据验证
+// ============================================================================
+
+TEST(Mesh_ValidateCellIndices)
+{
+    IMesh Mesh("ValidateMesh");
+    Mesh.AddVertexPosition(0.0f, 0.0f, 0.0f);
+    Mesh.AddVertexPosition(1.0f, 0.0f, 0.0f);
+    Mesh.AddVertexPosition(0.0f, 1.0f, 0.0f);
+    Mesh.AddVertexPosition(0.0f, 0.0f, 1.0f);
+
+    FCellArray& Cells = Mesh.GetCells();
+    Cells.AddCell(ECellType::Tetra, TArray<int32>{0, 1, 2, 3});
+    Cells.AddCell(ECellType::Triangle, TArray<int32>{0, 1, 2});
+    ASSERT(Mesh.Validate());
+
+    // 越界的顶点索引
+    Cells.AddCell(ECellType::Triangle, TArray<int32>{0, 1, 4});
+    ASSERT(!Mesh.Validate());
+    Cells.RemoveCell(2);
+    ASSERT(Mesh.Validate());
+
+    // 负的顶点索引
+    Cells.AddCell(ECellType::Line, TArray<int32>{-1, 0});
+    ASSERT(!Mesh.Validate());
+}
+
+// ============================================================================
+// 测试用例6: 删除单元并同步单元场
+// ============================================================================
+
+TEST(Mesh_RemapCellFields)
+{
+    IMesh Mesh("RemapMesh");
+    for (int i = 0; i < 6; ++i)
+    {
+        Mesh.AddVertexPosition(static_cast<float>(i), 0.0f, 0.0f);
+    }
+
+    FCellArray& Cells = Mesh.GetCells();
+    Cells.AddCell(ECellType::Line, TArray<int32>{0, 1});
+    Cells.AddCell(ECellType::Triangle, TArray<int32>{0, 1, 2});
+    Cells.AddCell(ECellType::Line, TArray<int32>{2, 3});
+    Cells.AddCell(ECellType::Triangle, TArray<int32>{3, 4, 5});
+
+    TUniquePtr<FField> Scalar = MakeUnique<FField>("CellId", EFieldType::Scalar, EFieldAttachment::Cell);
+    Scalar->SetScalarData(TArray<float>{10.0f, 11.0f, 12.0f, 13.0f});
+    Mesh.AddField(std::move(Scalar));
+
+    TUniquePtr<FField> Vector = MakeUnique<FField>("CellVector", EFieldType::Vector, EFieldAttachment::Cell);
+    for (int i = 0; i < 4; ++i)
+    {
+        Vector->AddVector(FVector(static_cast<float>(i), 0.0f, 0.0f));
+    }
+    Mesh.AddField(std::move(Vector));
+
+    TArray<int32> Remap;
+    Cells.RemoveCellsIf([](int32, const FCellView& Cell) { return Cell.CellType == ECellType::Line; }, &Remap);
+    Mesh.RemapCellFields(Remap);
+
+    ASSERT(Mesh.GetCellCount() == 2);
+    ASSERT(Mesh.Validate());
+
+    const FField* CellId = Mesh.GetCellField("CellId");
+    ASSERT(CellId->GetDataCount() == 2);
+    ASSERT_EQ(CellId->GetScalar(0), 11.0f);
+    ASSERT_EQ(CellId->GetScalar(1), 13.0f);
+
+    const FField* CellVector = Mesh.GetCellField("CellVector");
+    ASSERT(CellVector->GetDataCount() == 2);
+    ASSERT_EQ(CellVector->GetVector(1).X, 3.0f);
+}
+
+TEST(Mesh_RemapCellFieldsSizeMismatch)
+{
+    IMesh Mesh("RemapMesh");
+    for (int i = 0; i < 4; ++i)
+    {
+        Mesh.AddVertexPosition(static_cast<float>(i), 0.0f, 0.0f);
+    }
+
+    FCellArray& Cells = Mesh.GetCells();
+    Cells.AddCell(ECellType::Line, TArray<int32>{0, 1});
+    Cells.AddCell(ECellType::Line, TArray<int32>{1, 2});
+    Cells.AddCell(ECellType::Line, TArray<int32>{2, 3});
+
+    TUniquePtr<FField> CellId = MakeUnique<FField>("CellId", EFieldType::Scalar, EFieldAttachment::Cell);
+    CellId->SetScalarData(TArray<float>{10.0f, 11.0f, 12.0f});
+    Mesh.AddField(std::move(CellId));
+
+    // 数量与单元数不一致的场无法按映射表压缩
+    TUniquePtr<FField> Short = MakeUnique<FField>("Short", EFieldType::Scalar, EFieldAttachment::Cell);
+    Short->SetScalarData(TArray<float>{1.0f, 2.0f});
+    Mesh.AddField(std::move(Short));
+
+    TArray<int32> Remap;
+    Cells.RemoveCellsIf([](int32 CellIndex, const FCellView&) { return CellIndex == 1; }, &Remap);
+
+    bool bThrown = false;
+    try
+    {
+        Mesh.RemapCellFields(Remap);
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+
+    // 抛出异常时不修改任何场
+    ASSERT(Mesh.GetCellField("CellId")->GetDataCount() == 3);
+    ASSERT(Mesh.GetCellField("Short")->GetDataCount() == 2);
+
+    Mesh.RemoveCellField("Short");
+    Mesh.RemapCellFields(Remap);
+    ASSERT(Mesh.GetCellField("CellId")->GetDataCount() == 2);
+    ASSERT_EQ(Mesh.GetCellField("CellId")->GetScalar(1), 12.0f);
+}
+
+// ============================================================================
+// 测试用例7: 顶点到单元的邻接查询
+// ============================================================================
+
+TEST(Mesh_CellsUsingVertex)
+{
+    IMesh Mesh("LinksMesh");
+    for (int i = 0; i < 5; ++i)
+    {
+        Mesh.AddVertexPosition(static_cast<float>(i), 0.0f, 0.0f);
+    }
+
+    FCellArray& Cells = Mesh.GetCells();
+    Cells.AddCell(ECellType::Triangle, TArray<int32>{0, 1, 2});
+    Cells.AddCell(ECellType::Triangle, TArray<int32>{1, 2, 3});
+
+    TArrayView<const int32> Vertex1 = Mesh.GetCellsUsingVertex(1);
+    ASSERT(Vertex1.Num() == 2);
+    ASSERT(Vertex1[0] == 0);
+    ASSERT(Vertex1[1] == 1);
+    ASSERT(Mesh.GetCellsUsingVertex(4).IsEmpty());
+
+    // 缓存命中时返回同一份邻接表
+    const FCellLinks* Cached = &Mesh.GetCellLinks();
+    ASSERT(&Mesh.GetCellLinks() == Cached);
+    ASSERT(Mesh.GetCellLinks().GetLinkCount() == 6);
+
+    // 修改单元后自动重建
+    Cells.AddCell(ECellType::Line, TArray<int32>{3, 4});
+    ASSERT(Mesh.GetCellsUsingVertex(4).Num() == 1);
+    ASSERT(Mesh.GetCellsUsingVertex(3).Num() == 2);
+
+    Cells.RemoveCell(0);
+    ASSERT(Mesh.GetCellsUsingVertex(0).IsEmpty());
+    ASSERT(Mesh.GetCellsUsingVertex(1).Num() == 1);
+    ASSERT(Mesh.GetCellsUsingVertex(1)[0] == 0);
+
+    // 添加顶点后自动重建
+    Mesh.AddVertexPosition(5.0f, 0.0f, 0.0f);
+    ASSERT(Mesh.GetCellLinks().GetVertexCount() == 6);
+
+    // 拷贝的网格拥有独立的缓存
+    IMesh Copy(Mesh);
+    ASSERT(Copy.GetCellsUsingVertex(4).Num() == 1);
+    Copy.GetCells().Clear();
+    ASSERT(Copy.GetCellsUsingVertex(4).IsEmpty());
+    ASSERT(Mesh.GetCellsUsingVertex(4).Num() == 1);
+}
+
+TEST(Mesh_CellLinksFromTasks)
+{
+    // 多个任务同时触发邻接表的并行构建：构建期间等待的线程可能执行其他查询任务，不能持锁构建
+    IMesh Mesh("Strip");
+    constexpr uint32 CellCount = 200000;
+    TArray<int32> Indices;
+    for (uint32 i = 0; i <= CellCount; ++i)
+    {
+        Mesh.AddVertexPosition(static_cast<float>(i), 0.0f, 0.0f);
+        if (i < CellCount)
+        {
+            Indices.Add(static_cast<int32>(i));
+            Indices.Add(static_cast<int32>(i + 1));
+        }
+    }
+    Mesh.GetCells().AppendCells(ECellType::Line, 2, std::move(Indices));
+
+    const IMesh& ConstMesh = Mesh;
+    std::atomic<uint32> LinkCount{0};
+    RunQueriesWithBusyWorkers(64, [&](uint32 i)
+    {
+        LinkCount += ConstMesh.GetCellsUsingVertex(i * 1000 + 1).Num();
+    });
+    ASSERT_EQ(LinkCount.load(), 130u);
+}
+
+// ============================================================================
+// 测试用例8: 顶点坐标 SoA 存储
+// ============================================================================
+
+TEST(Mesh_VertexLayoutSoA)
+{
+    IMesh Mesh("SoAMesh");
+    for (int i = 0; i < 10; ++i)
+    {
+        Mesh.AddVertexPosition(static_cast<float>(i), 1.0f, 2.0f);
+    }
+    ASSERT(Mesh.GetVertexLayout() == EVertexLayout::AoS);
+
+    // AoS 布局下按需生成 SoA 镜像，顶点修改后镜像失效
+    ASSERT_EQ(Mesh.GetVerticesPositionsSoA().GetX()[3], 3.0f);
+    Mesh.SetVertexPosition(3, 30.0f, 1.0f, 2.0f);
+    ASSERT_EQ(Mesh.GetVerticesPositionsSoA().GetX()[3], 30.0f);
+
+    // 切换到 SoA 布局并批量修改
+    FVectorArraySoA& Positions = Mesh.EditVerticesPositionsSoA();
+    ASSERT(Mesh.GetVertexLayout() == EVertexLayout::SoA);
+    float* Y = Positions.GetY();
+    for (uint32 i = 0; i < Positions.Num(); ++i)
+    {
+        Y[i] += 10.0f;
+    }
+
+    // AoS 接口继续可用
+    ASSERT(Mesh.GetVertexCount() == 10);
+    ASSERT(Mesh.GetVertexPosition(3) == FVector(30.0f, 11.0f, 2.0f));
+    ASSERT(Mesh.GetVerticesPositionsPtr()[5] == FVector(5.0f, 11.0f, 2.0f));
+
+    Mesh.AddVertexPosition(100.0f, 0.0f, 0.0f);
+    ASSERT(Mesh.GetVerticesPositions().Num() == 11);
+    ASSERT(Mesh.GetVerticesPositionsPtr()[10] == FVector(100.0f, 0.0f, 0.0f));
+
+    // 拷贝保持存储布局
+    IMesh Copy(Mesh);
+    ASSERT(Copy.GetVertexLayout() == EVertexLayout::SoA);
+    ASSERT(Copy.GetVertexPosition(10) == FVector(100.0f, 0.0f, 0.0f));
+
+    // 切换回 AoS 布局
+    Mesh.SetVertexLayout(EVertexLayout::AoS);
+    ASSERT(Mesh.GetVertexLayout() == EVertexLayout::AoS);
+    ASSERT(Mesh.GetVertexCount() == 11);
+    ASSERT(Mesh.GetVertexPosition(0) == FVector(0.0f, 11.0f, 2.0f));
+}
+
+TEST(Mesh_PositionsMirrorFromTasks)
+{
+    // 多个任务同时触发坐标镜像的并行转换：转换期间等待的线程可能执行其他查询任务，不能持锁转换
+    constexpr uint32 VertexCount = 1 << 18;
+    IMesh SoAMesh("SoA");
+    IMesh AoSMesh("AoS");
+    SoAMesh.SetVertexLayout(EVertexLayout::SoA);
+    for (uint32 i = 0; i < VertexCount; ++i)
+    {
+        SoAMesh.AddVertexPosition(static_cast<float>(i), 1.0f, 2.0f);
+        AoSMesh.AddVertexPosition(static_cast<float>(i), 1.0f, 2.0f);
+    }
+
+    std::atomic<uint32> MatchCount{0};
+    RunQueriesWithBusyWorkers(64, [&](uint32 i)
+    {
+        const uint32 Index = i * 4000;
+        if (SoAMesh.GetVerticesPositions()[Index] == FVector(static_cast<float>(Index), 1.0f, 2.0f)
+            && AoSMesh.GetVerticesPositionsSoA().Get(Index) == FVector(static_cast<float>(Index), 1.0f, 2.0f))
+        {
+            ++MatchCount;
+        }
+    });
+    ASSERT_EQ(MatchCount.load(), 65u);
+}
@@ -0,0 +1,214 @@
+#include "TestFramework.h"
+#include "TestMeshUtil.h"
+#include "Mesh/OutOfCoreMesh.h"
+#include "IO/ChunkedMeshFile.h"
+#include "Filters/CellGeometryFilter.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+
+TEST_GROUP(TestOutOfCoreMesh)
+
+// 按单元划分写入后逐块读取：块内拓扑、坐标和场通过全局编号与原网格一致
+TEST(OutOfCoreMesh_PartitionRoundTrip)
+{
+    IMesh Mesh("Grid");
+    MakeQuadGrid(Mesh, 40, true);
+    const std::string Path = GetTempFilePath("IVisTest_OutOfCorePartition.ivc");
+    FChunkedMeshFile::Write(Mesh, Path, 100);
+
+    FOutOfCoreMesh OutOfCore;
+    OutOfCore.Open(Path);
+    ASSERT(OutOfCore.GetMeshName() == "Grid");
+    ASSERT_EQ(OutOfCore.GetChunkCount(), 16u);
+    ASSERT_EQ(OutOfCore.GetCellCount(), uint64(1600));
+    ASSERT_EQ(OutOfCore.GetVertexCount(), uint64(41 * 41));
+    ASSERT_EQ(OutOfCore.FindChunkByCell(0), 0u);
+    ASSERT_EQ(OutOfCore.FindChunkByCell(1599), 15u);
+    ASSERT_EQ(OutOfCore.FindChunkByCell(250), 2u);
+
+    FVector Min, Max;
+    ASSERT(OutOfCore.GetBounds(Min, Max));
+    ASSERT(Min == FVector(0.0f, 0.0f, 0.0f));
+    ASSERT(Max == FVector(40.0f, 40.0f, 0.0f));
+
+    std::atomic<uint32> Mismatches{ 0 };
+    std::atomic<uint64> CellTotal{ 0 };
+    OutOfCore.ForEachChunk([&](const FMeshChunk& Chunk)
+    {
+        const IMesh& Local = Chunk.Mesh;
+        CellTotal += Local.GetCellCount();
+        const FField* Velocity = Local.GetVertexField("Velocity");
+        const FField* CellId = Local.GetCellField("CellId");
+        if (!Velocity || !CellId || CellId->GetStorage() != EFieldStorage::Int32 || !Local.GetCells().IsUniform())
+        {
+            ++Mismatches;
+            return;
+        }
+        for (uint32 i = 0; i < Local.GetCellCount(); ++i)
+        {
+            const uint32 GlobalCell = static_cast<uint32>(Chunk.FirstCell + i);
+            const FCellView Original = Mesh.GetCells().GetCellView(GlobalCell);
+            const FCellView Cell = Local.GetCells().GetCellView(i);
+            for (uint32 k = 0; k < Cell.Num(); ++k)
+            {
+                const uint64 GlobalVertex = Chunk.GlobalVertexIds[Cell[k]];
+                if (GlobalVertex != static_cast<uint64>(Original[k]) ||
+                    Local.GetVertexPosition(Cell[k]) != Mesh.GetVertexPosition(Original[k]) ||
+                    Velocity->GetVector(Cell[k]) != Mesh.GetVertexField("Velocity")->GetVector(Original[k]))
+                {
+                    ++Mismatches;
+                }
+            }
+            if (CellId->GetTypedData<int32>()[i] != static_cast<int32>(GlobalCell * 3))
+            {
+                ++Mismatches;
+            }
+        }
+    });
+    ASSERT_EQ(Mismatches.load(), 0u);
+    ASSERT_EQ(CellTotal.load(), uint64(1600));
+
+    // 现有过滤器直接作用于块
+    float TotalArea = 0.0f;
+    OutOfCore.ForEachChunk([&](const FMeshChunk& Chunk)
+    {
+        FField Areas;
+        FCellGeometryFilter::Execute(Chunk.Mesh, ECellGeometryQuantity::Area, Areas, false);
+        for (uint32 i = 0; i < Areas.GetDataCount(); ++i)
+        {
+            TotalArea += Areas.GetScalar(i);
+        }
+    }, false);
+    ASSERT(std::fabs(TotalArea - 1600.0f) < 1e-3f);
+
+    OutOfCore.Close();
+    std::remove(Path.c_str());
+}
+
+// LRU 淘汰、钉住的块不被淘汰、缓存统计
+TEST(OutOfCoreMesh_LruCache)
+{
+    IMesh Mesh("Grid");
+    MakeQuadGrid(Mesh, 40, true);
+    const std::string Path = GetTempFilePath("IVisTest_OutOfCoreLru.ivc");
+    FChunkedMeshFile::Write(Mesh, Path, 40);   // 每块一行，大小相同
+
+    FOutOfCoreMesh OutOfCore;
+    OutOfCore.Open(Path);
+    ASSERT_EQ(OutOfCore.GetChunkCount(), 40u);
+    const size_t ChunkSize = OutOfCore.LoadChunk(0)->MemorySize;
+    ASSERT(ChunkSize > 0);
+
+    // 预算只够两个块
+    OutOfCore.SetMemoryBudget(ChunkSize * 2 + ChunkSize / 2);
+    OutOfCore.LoadChunk(1);
+    OutOfCore.LoadChunk(0);
+    OutOfCore.LoadChunk(2);
+    ASSERT(OutOfCore.IsChunkResident(0));
+    ASSERT(!OutOfCore.IsChunkResident(1));
+    ASSERT(OutOfCore.IsChunkResident(2));
+    FOutOfCoreCacheStats Stats = OutOfCore.GetCacheStats();
+    ASSERT_EQ(Stats.Misses, uint64(3));
+    ASSERT_EQ(Stats.Hits, uint64(1));
+    ASSERT_EQ(Stats.Evictions, uint64(1));
+    ASSERT_EQ(Stats.ResidentChunks, 2u);
+    ASSERT_EQ(Stats.ResidentBytes, uint64(ChunkSize * 2));
+
+    // 外部持有的块不被淘汰
+    {
+        const TSharedPtr<const FMeshChunk> Pinned = OutOfCore.LoadChunk(3);
+        OutOfCore.SetMemoryBudget(0);
+        ASSERT(OutOfCore.IsChunkResident(3));
+        ASSERT_EQ(OutOfCore.GetCacheStats().ResidentChunks, 1u);
+        ASSERT_EQ(Pinned->FirstCell, uint64(120));
+    }
+    OutOfCore.Trim();
+    ASSERT_EQ(OutOfCore.GetCacheStats().ResidentChunks, 0u);
+    ASSERT_EQ(OutOfCore.GetCacheStats().ResidentBytes, uint64(0));
+
+    // 并行遍历时常驻内存受预算约束
+    OutOfCore.SetMemoryBudget(ChunkSize * 4);
+    std::atomic<uint64> CellTotal{ 0 };
+    OutOfCore.ForEachChunk([&](const FMeshChunk& Chunk) { CellTotal += Chunk.Mesh.GetCellCount(); });
+    ASSERT_EQ(CellTotal.load(), uint64(1600));
+    ASSERT(OutOfCore.GetCacheStats().ResidentBytes <= ChunkSize * 4);
+
+    bool bThrown = false;
+    try
+    {
+        OutOfCore.LoadChunk(40);
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+
+    OutOfCore.Close();
+    std::remove(Path.c_str());
+}
+
+// 生成器逐块写出混合单元，以及无效文件
+TEST(OutOfCoreMesh_StreamingWriter)
+{
+    const std::string Path = GetTempFilePath("IVisTest_OutOfCoreWriter.ivc");
+    {
+        FChunkedMeshWriter Writer;
+        Writer.Open(Path, "Streamed");
+        for (uint32 c = 0; c < 3; ++c)
+        {
+            // 每块：一个三角形和一个四边形，共享顶点 1、2，块之间共享一条边
+            IMesh Chunk;
+            const float X = static_cast<float>(c);
+            Chunk.AddVertexPosition(X, 0.0f, 0.0f);
+            Chunk.AddVertexPosition(X + 1.0f, 0.0f, 0.0f);
+            Chunk.AddVertexPosition(X + 1.0f, 1.0f, 0.0f);
+            Chunk.AddVertexPosition(X, 1.0f, 0.0f);
+            Chunk.GetCells().AppendCells(TArray<ECellType>{ ECellType::Triangle, ECellType::Quad },
+                TArray<uint32>{ 0, 3, 7 }, TArray<int32>{ 0, 1, 2, 0, 1, 2, 3 });
+            const TArray<uint64> GlobalIds = { c * 2, c * 2 + 2, c * 2 + 3, c * 2 + 1 };
+            Writer.AddChunk(Chunk, TArrayView<const uint64>(GlobalIds.GetData(), GlobalIds.Num()));
+        }
+        ASSERT_EQ(Writer.GetChunkCount(), 3u);
+        Writer.Finish();
+        ASSERT(!Writer.IsOpen());
+    }
+
+    FOutOfCoreMesh OutOfCore;
+    OutOfCore.Open(Path);
+    ASSERT(OutOfCore.GetMeshName() == "Streamed");
+    ASSERT_EQ(OutOfCore.GetCellCount(), uint64(6));
+    ASSERT_EQ(OutOfCore.GetVertexCount(), uint64(8));
+    ASSERT_EQ(OutOfCore.GetChunkInfo(2).FirstCell, uint64(4));
+    ASSERT(OutOfCore.GetChunkInfo(2).BoundsMax == FVector(3.0f, 1.0f, 0.0f));
+
+    const TSharedPtr<const FMeshChunk> Chunk = OutOfCore.LoadChunk(1);
+    ASSERT(!Chunk->Mesh.GetCells().IsUniform());
+    ASSERT(Chunk->Mesh.GetCells().GetCellType(1) == ECellType::Quad);
+    ASSERT_EQ(Chunk->GlobalVertexIds[2], uint64(5));
+    ASSERT(Chunk->Mesh.GetVertexPosition(2) == FVector(2.0f, 1.0f, 0.0f));
+    OutOfCore.Close();
+
+    // 截断块表后文件无效
+    std::filesystem::resize_file(Path, std::filesystem::file_size(Path) - 32);
+    bool bThrown = false;
+    try
+    {
+        OutOfCore.Open(Path);
+    }
+    catch (const FFileIOException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+    ASSERT(!OutOfCore.IsOpen());
+    std::remove(Path.c_str());
+}
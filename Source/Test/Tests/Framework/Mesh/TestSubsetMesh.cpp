@@ -0,0 +1,224 @@
+#include "TestFramework.h"
+#include "TestTaskUtil.h"
+#include "Mesh/SubsetMesh.h"
+#include "Mesh/Mesh.h"
+#include "Field/Field.h"
+#include "Container/CellArray.h"
+#include "Exception/Exception.h"
+#include <atomic>
+
+TEST_GROUP(TestSubsetMesh)
+
+namespace
+{
+    /**
+     * 构造混合单元网格：一排 N 个四边形后接 N 个三角形（共用 2 x (N + 1) 个顶点），
+     * 顶点场 "Height"，Int32 单元场 "Id" 为单元编号
+     */
+    void MakeMixedStrip(IMesh& Mesh, uint32 N)
+    {
+        TUniquePtr<FField> HeightField = MakeUnique<FField>("Height", EFieldType::Scalar, EFieldAttachment::Vertex);
+        for (uint32 Row = 0; Row < 2; ++Row)
+        {
+            for (uint32 x = 0; x <= N; ++x)
+            {
+                Mesh.AddVertexPosition(static_cast<float>(x), static_cast<float>(Row), 0.0f);
+                HeightField->AddScalar(static_cast<float>(Row * 100 + x));
+            }
+        }
+
+        FCellArray& Cells = Mesh.GetCells();
+        for (uint32 x = 0; x < N; ++x)
+        {
+            const int32 V0 = static_cast<int32>(x);
+            Cells.AddCell(ECellType::Quad, TArray<int32>{ V0, V0 + 1, V0 + static_cast<int32>(N) + 2, V0 + static_cast<int32>(N) + 1 });
+        }
+        for (uint32 x = 0; x < N; ++x)
+        {
+            const int32 V0 = static_cast<int32>(x);
+            Cells.AddCell(ECellType::Triangle, TArray<int32>{ V0, V0 + 1, V0 + static_cast<int32>(N) + 1 });
+        }
+
+        TUniquePtr<FField> IdField = MakeUnique<FField>("Id", EFieldType::Scalar, EFieldAttachment::Cell);
+        IdField->SetStorage(EFieldStorage::Int32);
+        for (uint32 i = 0; i < Cells.GetCellCount(); ++i)
+        {
+            IdField->AddScalar(static_cast<float>(i));
+        }
+        Mesh.AddField(std::move(HeightField));
+        Mesh.AddField(std::move(IdField));
+    }
+
+    /** 两个单元视图是否相同（类型和顶点索引） */
+    bool IsSameCell(const FCellView& A, const FCellView& B)
+    {
+        if (A.CellType != B.CellType || A.Num() != B.Num())
+        {
+            return false;
+        }
+        for (uint32 k = 0; k < A.Num(); ++k)
+        {
+            if (A[k] != B[k])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST(SubsetMesh_LazyCellsAndFields)
+{
+    IMesh Strip("Strip");
+    MakeMixedStrip(Strip, 4);
+    const FSubsetMesh Subset(Strip, TArray<uint32>{ 1, 5, 6 }, "Part");
+
+    ASSERT_EQ(Subset.GetMeshName(), std::string("Part"));
+    ASSERT_EQ(Subset.GetCellCount(), 3u);
+    ASSERT(Subset.IsValidCellIndex(2));
+    ASSERT(!Subset.IsValidCellIndex(3));
+    ASSERT(!Subset.IsCellsMaterialized());
+
+    // 首次访问单元数组时物化（混合布局），顶点索引仍指向父网格顶点
+    const FCellArray& Cells = Subset.GetCells();
+    ASSERT(Subset.IsCellsMaterialized());
+    ASSERT(&Cells == &Subset.GetCells());
+    ASSERT_EQ(Cells.GetCellCount(), 3u);
+    for (uint32 i = 0; i < Subset.GetCellCount(); ++i)
+    {
+        ASSERT(IsSameCell(Cells.GetCellView(i), Strip.GetCells().GetCellView(Subset.GetParentCellIndex(i))));
+        ASSERT(IsSameCell(Subset.GetCellView(i), Strip.GetCells().GetCellView(Subset.GetParentCellIndex(i))));
+    }
+
+    // 单元场按选中单元收集，保留存储类型；顶点场直接使用父网格的场
+    const FField* Id = Subset.GetCellField("Id");
+    ASSERT(Id != nullptr);
+    ASSERT(Id->GetStorage() == EFieldStorage::Int32);
+    ASSERT_EQ(Id->GetDataCount(), 3u);
+    ASSERT_EQ(Id->GetScalar(0), 1.0f);
+    ASSERT_EQ(Id->GetScalar(1), 5.0f);
+    ASSERT_EQ(Id->GetScalar(2), 6.0f);
+    ASSERT(Subset.GetCellField("Id") == Id);
+    ASSERT(Subset.GetField("Id") == Id);
+    ASSERT(Subset.GetVertexField("Height") == Strip.GetVertexField("Height"));
+    ASSERT(Subset.GetField("Height") == Strip.GetVertexField("Height"));
+    ASSERT(Subset.HasCellField("Id") && Subset.HasVertexField("Height") && !Subset.HasField("Missing"));
+
+    // 数量与父网格单元数不一致的单元场无法收集
+    TUniquePtr<FField> ShortField = MakeUnique<FField>("Short", EFieldType::Scalar, EFieldAttachment::Cell);
+    ShortField->AddScalar(1.0f);
+    Strip.AddField(std::move(ShortField));
+    ASSERT(Strip.HasCellField("Short"));
+    ASSERT(!Subset.HasCellField("Short"));
+    ASSERT(Subset.GetCellField("Short") == nullptr);
+}
+
+TEST(SubsetMesh_CopyOnWriteVertexField)
+{
+    IMesh Strip("Strip");
+    MakeMixedStrip(Strip, 3);
+    FSubsetMesh Subset(Strip, TArray<uint32>{ 0, 2 });
+
+    // 非常量访问得到子集自己的副本，父网格不受影响
+    FField* Height = Subset.GetVertexField("Height");
+    ASSERT(Height != nullptr);
+    ASSERT(Height != Strip.GetVertexField("Height"));
+    Height->SetScalar(0, -1.0f);
+    ASSERT_EQ(Strip.GetVertexField("Height")->GetScalar(0), 0.0f);
+    ASSERT(static_cast<const FSubsetMesh&>(Subset).GetVertexField("Height") == Height);
+
+    // 释放后重新引用父网格
+    Subset.ReleaseMaterialized();
+    ASSERT(static_cast<const FSubsetMesh&>(Subset).GetVertexField("Height") == Strip.GetVertexField("Height"));
+
+    // 移动后缓存和父网格随之转移
+    FSubsetMesh Moved(std::move(Subset));
+    ASSERT(Moved.GetParent() == &Strip);
+    ASSERT_EQ(Moved.GetCellCount(), 2u);
+    ASSERT(Subset.GetParent() == nullptr);
+
+    Moved.Clear();
+    ASSERT_EQ(Moved.GetCellCount(), 0u);
+    ASSERT_EQ(Moved.GetCells().GetCellCount(), 0u);
+    ASSERT(Moved.IsValid());
+    Moved.Reset();
+    ASSERT(!Moved.IsValid());
+    ASSERT(!Moved.Validate());
+    ASSERT_EQ(Moved.GetVertexCount(), 0u);
+}
+
+TEST(SubsetMesh_Materialize)
+{
+    IMesh Strip("Strip");
+    MakeMixedStrip(Strip, 4);
+    FSubsetMesh Subset(Strip, TArray<uint32>{ 3, 4 });
+    Subset.GetVertexField("Height")->SetScalar(3, 42.0f);
+
+    // 压缩：只保留两个单元用到的顶点（按原顺序为 0, 1, 3, 4, 5, 8, 9）
+    IMesh Compact;
+    Subset.Materialize(Compact);
+    ASSERT(Compact.Validate());
+    ASSERT_EQ(Compact.GetVertexCount(), 7u);
+    ASSERT_EQ(Compact.GetCellCount(), 2u);
+    for (uint32 i = 0; i < Compact.GetCellCount(); ++i)
+    {
+        const FCellView OutCell = Compact.GetCells().GetCellView(i);
+        const FCellView InCell = Strip.GetCells().GetCellView(Subset.GetParentCellIndex(i));
+        ASSERT(OutCell.CellType == InCell.CellType);
+        for (uint32 k = 0; k < OutCell.Num(); ++k)
+        {
+            ASSERT(Compact.GetVertexPosition(OutCell[k]).IsNearlyEqual(Strip.GetVertexPosition(InCell[k]), 1e-6f));
+        }
+    }
+    ASSERT_EQ(Compact.GetVertexField("Height")->GetDataCount(), 7u);
+    ASSERT_EQ(Compact.GetVertexField("Height")->GetScalar(2), 42.0f);
+    ASSERT_EQ(Compact.GetCellField("Id")->GetScalar(1), 4.0f);
+
+    // 不压缩：保留父网格全部顶点，单元顶点索引不变；串行与并行结果一致
+    IMesh Full;
+    Subset.Materialize(Full, false, false);
+    ASSERT(Full.Validate());
+    ASSERT_EQ(Full.GetVertexCount(), Strip.GetVertexCount());
+    ASSERT(IsSameCell(Full.GetCells().GetCellView(0), Strip.GetCells().GetCellView(3)));
+    ASSERT(IsSameCell(Full.GetCells().GetCellView(1), Strip.GetCells().GetCellView(4)));
+    ASSERT_EQ(Full.GetCellField("Id")->GetScalar(0), 3.0f);
+
+    IMesh Serial;
+    Subset.Materialize(Serial, true, false);
+    ASSERT(Serial.GetVerticesPositions() == Compact.GetVerticesPositions());
+
+    bool bThrown = false;
+    try
+    {
+        FSubsetMesh(Strip, TArray<uint32>{ 0, 8 });
+    }
+    catch (const FInvalidArgumentException&)
+    {
+        bThrown = true;
+    }
+    ASSERT(bThrown);
+}
+
+TEST(SubsetMesh_LazyCacheFromTasks)
+{
+    // 多个任务同时首次访问子集：并行收集期间不持有缓存锁，不会自我死锁
+    IMesh Strip;
+    MakeMixedStrip(Strip, 100000);
+    TArray<uint32> Selected;
+    for (uint32 i = 0; i < Strip.GetCellCount(); i += 2)
+    {
+        Selected.Add(i);
+    }
+    FSubsetMesh Subset(Strip, std::move(Selected));
+
+    std::atomic<uint32> MatchCount{0};
+    RunQueriesWithBusyWorkers(64, [&](uint32 i)
+    {
+        const FField* IdField = Subset.GetCellField("Id");
+        if (Subset.GetCells().GetCellCount() == 100000u && IdField && IdField->GetScalar(i) == static_cast<float>(i * 2))
+        {
+            ++MatchCount;
+        }
+    });
+    ASSERT_EQ(MatchCount.load(), 65u);
+}